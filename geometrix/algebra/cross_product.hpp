@@ -13,6 +13,7 @@
 #include <geometrix/arithmetic/arithmetic.hpp>
 #include <geometrix/arithmetic/scalar_arithmetic.hpp>
 #include <geometrix/arithmetic/vector.hpp>
+#include <geometrix/tensor/contiguous_sequence.hpp>
 
 #include <boost/mpl/transform_view.hpp>
 #include <boost/mpl/iter_fold.hpp>
@@ -86,6 +87,36 @@ namespace geometrix {
         };
     }//namespace result_of;
 
+    namespace detail
+    {
+        template <typename Vector1, typename Vector2>
+        inline typename result_of::cross_product<Vector1, Vector2>::type cross_product( const Vector1& A, const Vector2& B, std::false_type )
+        {
+            return typename result_of::cross_product<Vector1, Vector2>::type
+                (
+                    get<1>(A) * get<2>(B) - get<2>(A) * get<1>(B)
+                  , get<2>(A) * get<0>(B) - get<0>(A) * get<2>(B)
+                  , get<0>(A) * get<1>(B) - get<1>(A) * get<0>(B)
+                );
+        }
+
+        template <typename Vector1, typename Vector2>
+        inline typename result_of::cross_product<Vector1, Vector2>::type cross_product( const Vector1& A, const Vector2& B, std::true_type )
+        {
+            typename result_of::cross_product<Vector1, Vector2>::type result;
+            contiguous_sequence_kernels::cross_product( contiguous_sequence_kernels::data( A ), contiguous_sequence_kernels::data( B ), contiguous_sequence_kernels::data( result ) );
+            return result;
+        }
+    }//namespace detail;
+
+    //! Evaluate the cross product of two 3D vectors into a vector. Unlike A ^ B this is not a lazy expression.
+    template <typename Vector1, typename Vector2>
+    inline typename result_of::cross_product<Vector1, Vector2>::type cross_product( const Vector1& A, const Vector2& B )
+    {
+        using result_type = typename result_of::cross_product<Vector1, Vector2>::type;
+        return detail::cross_product( A, B, typename are_contiguous_sequences<Vector1, Vector2, result_type>::type() );
+    }
+
 }//namespace geometrix;
 
 #endif //GEOMETRIX_CROSS_PRODUCT_HPP
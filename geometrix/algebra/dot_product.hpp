@@ -15,6 +15,7 @@
 #include <geometrix/arithmetic/arithmetic.hpp>
 #include <geometrix/arithmetic/scalar_arithmetic.hpp>
 #include <geometrix/algebra/detail/dot_product.hpp>
+#include <geometrix/tensor/contiguous_sequence.hpp>
 
 #include <boost/fusion/include/transform_view.hpp>
 #include <boost/fusion/include/zip_view.hpp>
@@ -24,6 +25,22 @@
 
 namespace geometrix {
 
+    namespace detail
+    {
+        template <typename NumericSequence1, typename NumericSequence2>
+        inline typename result_of::dot_product<NumericSequence1, NumericSequence2>::type dot_product_dispatch( const NumericSequence1& v1, const NumericSequence2& v2, std::false_type )
+        {
+            return detail::dot_product<NumericSequence1, NumericSequence2>()( v1, v2 );
+        }
+
+        template <typename NumericSequence1, typename NumericSequence2>
+        inline typename result_of::dot_product<NumericSequence1, NumericSequence2>::type dot_product_dispatch( const NumericSequence1& v1, const NumericSequence2& v2, std::true_type )
+        {
+            using value_t = contiguous_sequence_value<NumericSequence1>;
+            return contiguous_sequence_kernels::dot<typename value_t::type, value_t::dimension>( contiguous_sequence_kernels::data( v1 ), contiguous_sequence_kernels::data( v2 ) );
+        }
+    }//namespace detail;
+
     //! Calculate the dot product between two NumericSequences.
     template <typename NumericSequence1, typename NumericSequence2>
     inline typename result_of::dot_product
@@ -35,7 +52,7 @@ namespace geometrix {
         BOOST_CONCEPT_ASSERT(( TensorConcept< NumericSequence1 > ));
         BOOST_CONCEPT_ASSERT(( TensorConcept< NumericSequence2 > ));
         GEOMETRIX_STATIC_ASSERT( dimension_of<NumericSequence1>::value == dimension_of<NumericSequence2>::value );
-        return detail::dot_product<NumericSequence1, NumericSequence2>()( v1, v2 );
+        return detail::dot_product_dispatch( v1, v2, typename are_contiguous_sequences<NumericSequence1, NumericSequence2>::type() );
     }
 
     //! Calculate the scalar_projection between two NumericSequences.
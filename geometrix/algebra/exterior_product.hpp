@@ -89,13 +89,27 @@ namespace geometrix {
         //! Function to find the exterior product between two vectors
         template <typename Vector1, typename Vector2>
         inline typename result_of::exterior_product_area<Vector1, Vector2>::type
-            exterior_product_area( const Vector1& A, const Vector2& B, dimension<2> )
+            exterior_product_area( const Vector1& A, const Vector2& B, dimension<2>, std::false_type )
         {  
             BOOST_CONCEPT_ASSERT(( Vector2DConcept<Vector1> ));
             BOOST_CONCEPT_ASSERT(( Vector2DConcept<Vector2> ));    
             return ( get<0>(A) * get<1>(B) - get<1>(A) * get<0>(B) );
         }
 
+        template <typename Vector1, typename Vector2>
+        inline typename result_of::exterior_product_area<Vector1, Vector2>::type
+            exterior_product_area( const Vector1& A, const Vector2& B, dimension<2>, std::true_type )
+        {
+            return contiguous_sequence_kernels::exterior_product_area( contiguous_sequence_kernels::data( A ), contiguous_sequence_kernels::data( B ) );
+        }
+
+        template <typename Vector1, typename Vector2, typename IsContiguous>
+        inline typename result_of::exterior_product_area<Vector1, Vector2>::type
+            exterior_product_area( const Vector1& A, const Vector2& B, dimension<3>, IsContiguous )
+        {
+            return exterior_product_area( A, B, dimension<3>() );
+        }
+
         //! Function to find the exterior product between three vectors
         template <typename Vector1, typename Vector2, typename Vector3>
         inline typename result_of::exterior_product_volume<Vector1, Vector2, Vector3>::type
@@ -113,7 +127,7 @@ namespace geometrix {
     template <typename Vector1, typename Vector2>
     inline typename result_of::exterior_product_area<Vector1, Vector2>::type exterior_product_area( const Vector1& v1, const Vector2& v2 )
     {
-        return detail::exterior_product_area( v1, v2, typename dimension_of< Vector1 >::type() );
+        return detail::exterior_product_area( v1, v2, typename dimension_of< Vector1 >::type(), typename are_contiguous_sequences<Vector1, Vector2>::type() );
     }
 
     //! Function to find the cross product between two vectors
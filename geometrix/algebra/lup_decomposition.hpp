@@ -9,38 +9,37 @@
 #ifndef GEOMETRIX_LINEAR_ALGEBRA_LUP_DECOMPOSITION_HPP
 #define GEOMETRIX_LINEAR_ALGEBRA_LUP_DECOMPOSITION_HPP
 
-#include <geometrix/utility/preprocessor.hpp>
+#include <geometrix/tensor/matrix.hpp>
 #include <geometrix/arithmetic/arithmetic.hpp>
-#include <exception>
 
-#if !defined( GEOMETRIX_USE_RUN_TIME_LUP_DECOMPOSITION )
+#include <boost/array.hpp>
 
-    #if !defined( GEOMETRIX_MAX_LUP_DECOMPOSITION_MATRIX_SIZE )
-        #define GEOMETRIX_MAX_LUP_DECOMPOSITION_MATRIX_SIZE 6
-    #endif
+#include <cmath>
+#include <stdexcept>
+#include <utility>
 
-    #include <geometrix/algebra/detail/lup_decomposition.hpp>
-
-#else
 namespace geometrix {
 
+    //! \brief Decompose m in place into L and U (with unit diagonal L) such that P*m = L*U. pi holds the row permutation.
+
+    //! The loops are over the compile time dimension N so the compiler unrolls them for the small matrices used in geometry.
+    //! Throws std::logic_error if m is singular.
     template <typename T, std::size_t N>
-    void lup_decomposition( matrix<T, N, N>& m, boost::array<std::size_t, N>& pi )
+    inline void lup_decomposition( matrix<T, N, N>& lu, boost::array<std::size_t, N>& pi )
     {
-		using std::abs;
+        using std::abs;
 
-        //! Initialize PI as zeros.
         for( std::size_t i = 0; i < N; ++i )
             pi[i] = i;
-        for( std::size_t k = 0; k < N - 1; ++k )
+        for( std::size_t k = 0; k < N; ++k )
         {
             T p = 0;
             std::size_t k_ = 0;
             for( std::size_t i = k; i < N; ++i )
             {
-                if( abs(m[i][k]) > p )
+                if( abs( lu[i][k] ) > p )
                 {
-                    p = abs(m[i][k]);
+                    p = abs( lu[i][k] );
                     k_ = i;
                 }
             }
@@ -48,19 +47,20 @@ namespace geometrix {
             if( p == 0 )
                 throw std::logic_error( "cannot lup decompose a singular matrix." );
             std::swap( pi[k], pi[k_] );
-            for( std::size_t i = 0; i < N; ++i )
-                std::swap( m[k][i], m[k_][i] );
+            for( std::size_t j = 0; j < N; ++j )
+                std::swap( lu[k][j], lu[k_][j] );
             for( std::size_t i = k + 1; i < N; ++i )
             {
-                m[i][k] /= m[k][k];
+                lu[i][k] = lu[i][k] / lu[k][k];
                 for( std::size_t j = k + 1; j < N; ++j )
-                    m[i][j] -= m[i][k]*m[k][j];
+                    lu[i][j] -= lu[i][k] * lu[k][j];
             }
         }
     }
 
-    template <typename T>
-    boost::array<T, N> lup_solve( matrix<T, N, N>& lu, const boost::array<std::size_t,N>& pi, const boost::array<T,N>& b )
+    //! \brief Solve m*x = b given the decomposition of m from lup_decomposition.
+    template <typename T, std::size_t N>
+    inline boost::array<T, N> lup_solve( const matrix<T, N, N>& lu, const boost::array<std::size_t, N>& pi, const boost::array<T, N>& b )
     {
         boost::array<T, N> x, y;
         for( std::size_t i = 0; i < N; ++i )
@@ -70,20 +70,17 @@ namespace geometrix {
                 sum += lu[i][j] * y[j];
             y[i] = b[pi[i]] - sum;
         }
-        for( std::size_t i = N-1; i >= 0; --i )
+        for( std::size_t i = N; i-- > 0; )
         {
             T sum = 0;
-            for( std::size_t j = i+1; j < N; ++j )
+            for( std::size_t j = i + 1; j < N; ++j )
                 sum += lu[i][j] * x[j];
             x[i] = ( y[i] - sum ) / lu[i][i];
-
-            if( i == 0 )
-                break;
         }
 
         return x;
     }
+
 }//namespace geometrix
 
-#endif//GEOMETRIX_USE_RUN_TIME_DECOMPOSITION
 #endif //GEOMETRIX_LINEAR_ALGEBRA_LUP_DECOMPOSITION_HPP
@@ -0,0 +1,487 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_AFFINE_TRANSFORM_HPP
+#define GEOMETRIX_AFFINE_TRANSFORM_HPP
+#pragma once
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/tensor/matrix.hpp>
+#include <geometrix/numeric/constants.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+#include <geometrix/utility/utilities.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GEOMETRIX_AFFINE_TRANSFORM_ISA avx
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GEOMETRIX_AFFINE_TRANSFORM_SSE2
+#define GEOMETRIX_AFFINE_TRANSFORM_ISA sse2
+#else
+#define GEOMETRIX_AFFINE_TRANSFORM_ISA generic
+#endif
+
+namespace geometrix {
+
+    //! \brief A transform of D dimensional points stored as a (D+1)x(D+1) homogeneous matrix acting on column vectors.
+
+    //! Transforms compose with operator* so that (a * b)(p) == a(b(p)). A chain of transforms should be composed once into a single
+    //! transform before it is applied to a batch of points. When the last row of the matrix is [0 ... 0 1] the transform is affine
+    //! and points are mapped without the perspective divide.
+    template <typename T, std::size_t D>
+    class affine_transform
+    {
+        static_assert(D == 2 || D == 3, "affine_transform supports 2D and 3D points.");
+
+    public:
+
+        using value_type = T;
+        using matrix_type = matrix<T, D + 1, D + 1>;
+        static const std::size_t dimension = D;
+
+        //! The identity transform.
+        affine_transform()
+        {
+            for (std::size_t i = 0; i <= D; ++i)
+                for (std::size_t j = 0; j <= D; ++j)
+                    m_m[i][j] = i == j ? constants::one<T>() : constants::zero<T>();
+        }
+
+        //! A transform from a homogeneous matrix which may be projective.
+        explicit affine_transform(const matrix_type& m)
+            : m_m(m)
+        {}
+
+        static affine_transform identity() { return affine_transform(); }
+
+        template <typename Vector>
+        static affine_transform translation(const Vector& v)
+        {
+            affine_transform result;
+            T x[D];
+            load(v, x, std::integral_constant<std::size_t, D>());
+            for (std::size_t i = 0; i < D; ++i)
+                result.m_m[i][D] = x[i];
+            return result;
+        }
+
+        static affine_transform scaling(const T& s)
+        {
+            affine_transform result;
+            for (std::size_t i = 0; i < D; ++i)
+                result.m_m[i][i] = s;
+            return result;
+        }
+
+        //! A transform with the linear part m followed by the translation t. E.g. the rotation matrices from make_rotation_matrix.
+        template <typename ArithmeticType, typename Vector>
+        static affine_transform linear(const matrix<ArithmeticType, D, D>& m, const Vector& t)
+        {
+            affine_transform result = translation(t);
+            result.set_linear(m);
+            return result;
+        }
+
+        template <typename ArithmeticType>
+        static affine_transform linear(const matrix<ArithmeticType, D, D>& m)
+        {
+            affine_transform result;
+            result.set_linear(m);
+            return result;
+        }
+
+        //! A counter-clockwise rotation in radians about the origin of the xy-plane (the z axis in 3D).
+        static affine_transform rotation(const T& angle)
+        {
+            using std::cos;
+            using std::sin;
+            affine_transform result;
+            auto c = cos(angle);
+            auto s = sin(angle);
+            result.m_m[0][0] = c; result.m_m[0][1] = -s;
+            result.m_m[1][0] = s; result.m_m[1][1] = c;
+            return result;
+        }
+
+        //! A counter-clockwise rotation in radians about the given point of the xy-plane.
+        template <typename Point>
+        static affine_transform rotation(const T& angle, const Point& origin)
+        {
+            auto toOrigin = translation(origin);
+            auto fromOrigin = toOrigin;
+            for (std::size_t i = 0; i < D; ++i)
+                fromOrigin.m_m[i][D] = -toOrigin.m_m[i][D];
+            return toOrigin * rotation(angle) * fromOrigin;
+        }
+
+        const matrix_type& get_matrix() const { return m_m; }
+
+        const T& operator()(std::size_t i, std::size_t j) const
+        {
+            GEOMETRIX_ASSERT(i <= D && j <= D);
+            return m_m[i][j];
+        }
+
+        bool is_affine() const
+        {
+            for (std::size_t j = 0; j < D; ++j)
+                if (m_m[D][j] != constants::zero<T>())
+                    return false;
+            return m_m[D][D] == constants::one<T>();
+        }
+
+        //! The composed transform which applies b and then a.
+        friend affine_transform operator*(const affine_transform& a, const affine_transform& b)
+        {
+            matrix_type m;
+            for (std::size_t i = 0; i <= D; ++i)
+            {
+                for (std::size_t j = 0; j <= D; ++j)
+                {
+                    auto sum = constants::zero<T>();
+                    for (std::size_t k = 0; k <= D; ++k)
+                        sum += a.m_m[i][k] * b.m_m[k][j];
+                    m[i][j] = sum;
+                }
+            }
+            return affine_transform(m);
+        }
+
+        //! The composed transform which applies this and then next.
+        affine_transform then(const affine_transform& next) const
+        {
+            return next * *this;
+        }
+
+        //! The inverse transform computed by Gauss-Jordan elimination with partial pivoting. The matrix must not be singular.
+        affine_transform inverse() const
+        {
+            using std::abs;
+            matrix_type a = m_m;
+            matrix_type inv = affine_transform().m_m;
+            for (std::size_t c = 0; c <= D; ++c)
+            {
+                auto pivot = c;
+                for (auto r = c + 1; r <= D; ++r)
+                    if (abs(a[r][c]) > abs(a[pivot][c]))
+                        pivot = r;
+                GEOMETRIX_ASSERT(a[pivot][c] != constants::zero<T>());
+                if (pivot != c)
+                {
+                    for (std::size_t j = 0; j <= D; ++j)
+                    {
+                        std::swap(a[c][j], a[pivot][j]);
+                        std::swap(inv[c][j], inv[pivot][j]);
+                    }
+                }
+
+                auto s = constants::one<T>() / a[c][c];
+                for (std::size_t j = 0; j <= D; ++j)
+                {
+                    a[c][j] *= s;
+                    inv[c][j] *= s;
+                }
+
+                for (std::size_t r = 0; r <= D; ++r)
+                {
+                    if (r == c || a[r][c] == constants::zero<T>())
+                        continue;
+                    auto f = a[r][c];
+                    for (std::size_t j = 0; j <= D; ++j)
+                    {
+                        a[r][j] -= f * a[c][j];
+                        inv[r][j] -= f * inv[c][j];
+                    }
+                }
+            }
+
+            //! Keep the last row of an affine inverse exact so that it is still detected as affine.
+            if (is_affine())
+            {
+                for (std::size_t j = 0; j < D; ++j)
+                    inv[D][j] = constants::zero<T>();
+                inv[D][D] = constants::one<T>();
+            }
+            return affine_transform(inv);
+        }
+
+        //! Transform the coordinates in x[0..D) into y[0..D). x and y may be the same array.
+        void apply(const T* x, T* y) const
+        {
+            T r[D];
+            for (std::size_t i = 0; i < D; ++i)
+            {
+                auto sum = m_m[i][D];
+                for (std::size_t j = 0; j < D; ++j)
+                    sum += m_m[i][j] * x[j];
+                r[i] = sum;
+            }
+
+            if (!is_affine())
+            {
+                auto w = m_m[D][D];
+                for (std::size_t j = 0; j < D; ++j)
+                    w += m_m[D][j] * x[j];
+                for (std::size_t i = 0; i < D; ++i)
+                    r[i] /= w;
+            }
+
+            for (std::size_t i = 0; i < D; ++i)
+                y[i] = r[i];
+        }
+
+        template <typename Point>
+        Point operator()(const Point& p) const
+        {
+            Point result(p);
+            T x[D];
+            load(p, x, std::integral_constant<std::size_t, D>());
+            apply(x, x);
+            assign(result, x, std::integral_constant<std::size_t, D>());
+            return result;
+        }
+
+    private:
+
+        template <typename ArithmeticType>
+        void set_linear(const matrix<ArithmeticType, D, D>& m)
+        {
+            for (std::size_t i = 0; i < D; ++i)
+                for (std::size_t j = 0; j < D; ++j)
+                    m_m[i][j] = static_cast<T>(m[i][j]);
+        }
+
+        template <typename Tensor>
+        static void load(const Tensor& p, T* x, std::integral_constant<std::size_t, 2>)
+        {
+            x[0] = static_cast<T>(geometrix::get<0>(p));
+            x[1] = static_cast<T>(geometrix::get<1>(p));
+        }
+
+        template <typename Tensor>
+        static void load(const Tensor& p, T* x, std::integral_constant<std::size_t, 3>)
+        {
+            x[0] = static_cast<T>(geometrix::get<0>(p));
+            x[1] = static_cast<T>(geometrix::get<1>(p));
+            x[2] = static_cast<T>(geometrix::get<2>(p));
+        }
+
+        template <typename Point>
+        static void assign(Point& p, const T* x, std::integral_constant<std::size_t, 2>)
+        {
+            geometrix::set<0>(p, x[0]);
+            geometrix::set<1>(p, x[1]);
+        }
+
+        template <typename Point>
+        static void assign(Point& p, const T* x, std::integral_constant<std::size_t, 3>)
+        {
+            geometrix::set<0>(p, x[0]);
+            geometrix::set<1>(p, x[1]);
+            geometrix::set<2>(p, x[2]);
+        }
+
+        matrix_type m_m;
+
+    };
+
+    template <typename T, std::size_t D>
+    const std::size_t affine_transform<T, D>::dimension;
+
+    using affine_transform_2d = affine_transform<double, 2>;
+    using affine_transform_3d = affine_transform<double, 3>;
+
+    //! The kernels and the functions which dispatch to them depend on the instruction set the translation unit is compiled for.
+    //! They are declared in an inline namespace named for it so that translation units built with different flags do not share
+    //! (and at link time exchange) different definitions of the same functions.
+    inline namespace GEOMETRIX_AFFINE_TRANSFORM_ISA {
+
+    namespace affine_transform_detail {
+
+        //! Spans with more points than this are transformed in parallel batches of this size.
+        static const std::size_t batch_size = 32768;
+
+        //! y = A x + t for n interleaved 2D points. The loops are written so that the compiler can vectorize them where the explicit
+        //! kernels below are not available.
+        template <typename T>
+        inline void affine_kernel(const affine_transform<T, 2>& xf, const T* x, T* y, std::size_t n)
+        {
+            auto const& m = xf.get_matrix();
+            const T a00 = m[0][0], a01 = m[0][1], a02 = m[0][2];
+            const T a10 = m[1][0], a11 = m[1][1], a12 = m[1][2];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto px = x[2 * i];
+                auto py = x[2 * i + 1];
+                y[2 * i] = a00 * px + a01 * py + a02;
+                y[2 * i + 1] = a10 * px + a11 * py + a12;
+            }
+        }
+
+        template <typename T>
+        inline void affine_kernel(const affine_transform<T, 3>& xf, const T* x, T* y, std::size_t n)
+        {
+            auto const& m = xf.get_matrix();
+            const T a00 = m[0][0], a01 = m[0][1], a02 = m[0][2], a03 = m[0][3];
+            const T a10 = m[1][0], a11 = m[1][1], a12 = m[1][2], a13 = m[1][3];
+            const T a20 = m[2][0], a21 = m[2][1], a22 = m[2][2], a23 = m[2][3];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto px = x[3 * i];
+                auto py = x[3 * i + 1];
+                auto pz = x[3 * i + 2];
+                y[3 * i] = a00 * px + a01 * py + a02 * pz + a03;
+                y[3 * i + 1] = a10 * px + a11 * py + a12 * pz + a13;
+                y[3 * i + 2] = a20 * px + a21 * py + a22 * pz + a23;
+            }
+        }
+
+#if defined(__AVX__)
+        //! Two interleaved 2D points per register: [x0 y0 x1 y1] -> [x0 x0 x1 x1] * [a00 a10 a00 a10] + [y0 y0 y1 y1] * [a01 a11 a01 a11] + t.
+        inline void affine_kernel(const affine_transform<double, 2>& xf, const double* x, double* y, std::size_t n)
+        {
+            auto const& m = xf.get_matrix();
+            auto c0 = _mm256_setr_pd(m[0][0], m[1][0], m[0][0], m[1][0]);
+            auto c1 = _mm256_setr_pd(m[0][1], m[1][1], m[0][1], m[1][1]);
+            auto t = _mm256_setr_pd(m[0][2], m[1][2], m[0][2], m[1][2]);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+            {
+                auto p = _mm256_loadu_pd(x + 2 * i);
+                auto r = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_unpacklo_pd(p, p), c0), _mm256_mul_pd(_mm256_unpackhi_pd(p, p), c1)), t);
+                _mm256_storeu_pd(y + 2 * i, r);
+            }
+            if (i < n)
+                affine_kernel<double>(xf, x + 2 * i, y + 2 * i, n - i);
+        }
+#elif defined(GEOMETRIX_AFFINE_TRANSFORM_SSE2)
+        //! One interleaved 2D point per register: [x y] -> [x x] * [a00 a10] + [y y] * [a01 a11] + t.
+        inline void affine_kernel(const affine_transform<double, 2>& xf, const double* x, double* y, std::size_t n)
+        {
+            auto const& m = xf.get_matrix();
+            auto c0 = _mm_setr_pd(m[0][0], m[1][0]);
+            auto c1 = _mm_setr_pd(m[0][1], m[1][1]);
+            auto t = _mm_setr_pd(m[0][2], m[1][2]);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto p = _mm_loadu_pd(x + 2 * i);
+                auto r = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(p, p), c0), _mm_mul_pd(_mm_unpackhi_pd(p, p), c1)), t);
+                _mm_storeu_pd(y + 2 * i, r);
+            }
+        }
+#endif
+
+        template <typename T, std::size_t D>
+        inline void projective_kernel(const affine_transform<T, D>& xf, const T* x, T* y, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                xf.apply(x + D * i, y + D * i);
+        }
+
+        //! Points whose coordinates are laid out as D contiguous values of type T (e.g. point<T, D>) can be transformed as a raw array.
+        template <typename Point, typename T, std::size_t D>
+        struct is_packed_point : std::integral_constant<bool,
+               std::is_standard_layout<Point>::value
+            && std::is_trivially_copyable<Point>::value
+            && sizeof(Point) == D * sizeof(T)
+            && std::is_same<typename geometric_traits<Point>::arithmetic_type, T>::value
+            && dimension_of<Point>::value == D>
+        {};
+
+        template <typename Range, typename = void>
+        struct has_data : std::false_type {};
+
+        template <typename Range>
+        struct has_data<Range, decltype((void)std::declval<Range&>().data())> : std::true_type {};
+
+    }//! namespace affine_transform_detail;
+
+    //! Transform n points with interleaved coordinates [x0 y0 (z0) x1 y1 (z1) ...] from x into y. The output may be the input for an
+    //! in place transform; otherwise the arrays must not overlap. Large spans are split into batches over nThreads threads.
+    template <typename T, std::size_t D>
+    inline void transform_coordinates(const affine_transform<T, D>& xf, const T* x, T* y, std::size_t n, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace affine_transform_detail;
+        auto isAffine = xf.is_affine();
+        parallel_for_batches(n, batch_size, [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+            if (isAffine)
+                affine_kernel(xf, x + D * begin, y + D * begin, end - begin);
+            else
+                projective_kernel(xf, x + D * begin, y + D * begin, end - begin);
+        }, nThreads);
+    }
+
+    namespace affine_transform_detail {
+
+        template <typename T, std::size_t D, typename InputRange, typename OutputRange>
+        inline void transform_points(const affine_transform<T, D>& xf, const InputRange& in, OutputRange& out, std::size_t nThreads, std::true_type)
+        {
+            transform_coordinates(xf, reinterpret_cast<const T*>(in.data()), reinterpret_cast<T*>(out.data()), in.size(), nThreads);
+        }
+
+        template <typename T, std::size_t D, typename InputRange, typename OutputRange>
+        inline void transform_points(const affine_transform<T, D>& xf, const InputRange& in, OutputRange& out, std::size_t nThreads, std::false_type)
+        {
+            using std::begin;
+            auto first = begin(in);
+            auto result = begin(out);
+            parallel_for_batches(in.size(), batch_size, [&](std::size_t, std::size_t b, std::size_t e)
+            {
+                auto it = std::next(first, b);
+                auto oit = std::next(result, b);
+                for (auto i = b; i < e; ++i, ++it, ++oit)
+                    *oit = xf(*it);
+            }, nThreads);
+        }
+
+    }//! namespace affine_transform_detail;
+
+    //! Transform the points of in into the caller's buffer out which must hold at least as many points. Ranges of packed points
+    //! (see affine_transform_detail::is_packed_point) with contiguous storage use the batch kernels directly. in and out may be
+    //! the same range.
+    template <typename T, std::size_t D, typename InputRange, typename OutputRange>
+    inline void transform_points(const affine_transform<T, D>& xf, const InputRange& in, OutputRange& out, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace affine_transform_detail;
+        using in_point = typename std::decay<decltype(*std::begin(in))>::type;
+        using out_point = typename std::decay<decltype(*std::begin(out))>::type;
+        using is_packed = std::integral_constant<bool,
+               is_packed_point<in_point, T, D>::value
+            && is_packed_point<out_point, T, D>::value
+            && has_data<const InputRange>::value
+            && has_data<OutputRange>::value>;
+        GEOMETRIX_ASSERT(out.size() >= in.size());
+        affine_transform_detail::transform_points(xf, in, out, nThreads, is_packed());
+    }
+
+    //! Transform the points of a range in place.
+    template <typename T, std::size_t D, typename Range>
+    inline void transform_points(const affine_transform<T, D>& xf, Range& points, std::size_t nThreads = get_default_concurrency())
+    {
+        transform_points(xf, static_cast<const Range&>(points), points, nThreads);
+    }
+
+    }//! inline namespace GEOMETRIX_AFFINE_TRANSFORM_ISA;
+
+}//! namespace geometrix;
+
+#undef GEOMETRIX_AFFINE_TRANSFORM_ISA
+#ifdef GEOMETRIX_AFFINE_TRANSFORM_SSE2
+#undef GEOMETRIX_AFFINE_TRANSFORM_SSE2
+#endif
+
+#endif//! GEOMETRIX_AFFINE_TRANSFORM_HPP
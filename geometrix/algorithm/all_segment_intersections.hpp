@@ -0,0 +1,244 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALL_SEGMENT_INTERSECTIONS_HPP
+#define GEOMETRIX_ALL_SEGMENT_INTERSECTIONS_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/fast_voxel_grid_traversal.hpp>
+#include <geometrix/algorithm/intersection/segment_segment_intersection.hpp>
+#include <geometrix/algorithm/distance/point_point_distance.hpp>
+#include <geometrix/primitive/segment_traits.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief The result of a pairwise segment intersection test as reported by all_segment_intersections.
+    template <typename Point>
+    struct segment_intersection_record
+    {
+        std::size_t first;
+        std::size_t second;
+        intersection_type type;
+        Point xPoints[2];
+    };
+
+    namespace all_segment_intersections_detail {
+
+        //! Compressed rows: the items of row r are items[offsets[r], offsets[r + 1]).
+        struct compressed_rows
+        {
+            std::vector<std::size_t> offsets;
+            std::vector<std::uint32_t> items;
+        };
+
+        //! The canonical cell of a pair of segments is the lowest indexed cell visited by both. Cell lists are sorted.
+        inline bool is_canonical_cell(const compressed_rows& segmentCells, std::size_t a, std::size_t b, std::uint32_t cell)
+        {
+            auto i = segmentCells.offsets[a], iend = segmentCells.offsets[a + 1];
+            auto j = segmentCells.offsets[b], jend = segmentCells.offsets[b + 1];
+            while (i != iend && j != jend)
+            {
+                auto ci = segmentCells.items[i], cj = segmentCells.items[j];
+                if (ci == cj)
+                    return ci == cell;
+                if (ci < cj)
+                    ++i;
+                else
+                    ++j;
+            }
+
+            GEOMETRIX_ASSERT(false);
+            return false;
+        }
+
+    }//! namespace all_segment_intersections_detail;
+
+    //! Make a grid covering the segments. If the cell size is not positive one is chosen from the mean segment length and the density of the segments.
+    template <typename Segments>
+    inline grid_traits<typename geometric_traits<typename geometric_traits<typename Segments::value_type>::point_type>::arithmetic_type> make_segment_intersection_grid(const Segments& segments, typename geometric_traits<typename geometric_traits<typename Segments::value_type>::point_type>::arithmetic_type cellSize = {})
+    {
+        using length_t = typename geometric_traits<typename geometric_traits<typename Segments::value_type>::point_type>::arithmetic_type;
+        using std::sqrt;
+
+        auto zero = constants::zero<length_t>();
+        auto xmin = constants::infinity<length_t>(), ymin = constants::infinity<length_t>();
+        auto xmax = -constants::infinity<length_t>(), ymax = -constants::infinity<length_t>();
+        auto totalLength = zero;
+        for (auto const& s : segments)
+        {
+            for (auto const& p : { get_start(s), get_end(s) })
+            {
+                xmin = (std::min)(xmin, get<0>(p));
+                xmax = (std::max)(xmax, get<0>(p));
+                ymin = (std::min)(ymin, get<1>(p));
+                ymax = (std::max)(ymax, get<1>(p));
+            }
+            totalLength += point_point_distance(get_start(s), get_end(s));
+        }
+
+        if (segments.empty())
+        {
+            xmin = ymin = zero;
+            xmax = ymax = constants::one<length_t>();
+        }
+
+        if (!(cellSize > zero))
+        {
+            auto n = static_cast<double>((std::max)(segments.size(), std::size_t{ 1 }));
+            cellSize = (std::max)(totalLength / n, sqrt((xmax - xmin) * (ymax - ymin) / n));
+            if (!(cellSize > zero))
+                cellSize = (std::max)((std::max)(xmax - xmin, ymax - ymin), constants::one<length_t>());
+        }
+
+        //! The grid must have positive extent on both axes.
+        xmax = (std::max)(xmax, xmin + cellSize);
+        ymax = (std::max)(ymax, ymin + cellSize);
+        return grid_traits<length_t>(xmin, xmax, ymin, ymax, cellSize);
+    }
+
+    //! \brief Compute the intersections of all pairs of segments in a random access range in parallel.
+
+    //! The segments are bucketed into the cells of a uniform grid which they cross using fast_voxel_grid_traversal, and the pairs
+    //! of segments which share a cell are tested with segment_segment_intersection in parallel batches of cells. A pair which shares
+    //! several cells is only tested in the lowest indexed of them, so each intersecting pair is found once. The grid must cover
+    //! all of the segments (see make_segment_intersection_grid).
+    //!
+    //! Returns the intersections sorted by the indices of the segments (first < second). The result does not depend on the
+    //! number of threads.
+    template <typename Segments, typename Grid, typename NumberComparisonPolicy>
+    inline std::vector<segment_intersection_record<typename geometric_traits<typename Segments::value_type>::point_type>> find_segment_intersections(const Segments& segments, const Grid& grid, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace all_segment_intersections_detail;
+        using point_t = typename geometric_traits<typename Segments::value_type>::point_type;
+        using record_t = segment_intersection_record<point_t>;
+
+        const std::size_t segmentBatchSize = 256;
+        const std::size_t cellBatchSize = 64;
+        auto nSegments = segments.size();
+        auto width = grid.get_width();
+        GEOMETRIX_ASSERT(static_cast<std::uint64_t>(width) * grid.get_height() <= (std::numeric_limits<std::uint32_t>::max)());
+
+        //! Rasterize the segments into sorted per segment cell lists.
+        std::vector<compressed_rows> batches(get_number_batches(nSegments, segmentBatchSize));
+        parallel_for_batches(nSegments, segmentBatchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+        {
+            auto& rows = batches[b];
+            rows.offsets.reserve(end - begin + 1);
+            rows.offsets.push_back(0);
+            for (auto i = begin; i < end; ++i)
+            {
+                auto first = rows.items.size();
+                fast_voxel_grid_traversal(grid, segments[i], [&](std::uint32_t x, std::uint32_t y)
+                {
+                    rows.items.push_back(y * width + x);
+                }, cmp);
+                std::sort(rows.items.begin() + first, rows.items.end());
+                rows.items.erase(std::unique(rows.items.begin() + first, rows.items.end()), rows.items.end());
+                rows.offsets.push_back(rows.items.size());
+            }
+        }, nThreads);
+
+        compressed_rows segmentCells;
+        segmentCells.offsets.reserve(nSegments + 1);
+        segmentCells.offsets.push_back(0);
+        for (auto const& rows : batches)
+        {
+            auto base = segmentCells.items.size();
+            for (std::size_t r = 1; r < rows.offsets.size(); ++r)
+                segmentCells.offsets.push_back(base + rows.offsets[r]);
+            segmentCells.items.insert(segmentCells.items.end(), rows.items.begin(), rows.items.end());
+        }
+        batches.clear();
+
+        //! Transpose into per cell segment lists. Filling in segment order leaves each list sorted.
+        std::size_t nCells = static_cast<std::size_t>(width) * grid.get_height();
+        compressed_rows cellSegments;
+        cellSegments.offsets.assign(nCells + 1, 0);
+        for (auto c : segmentCells.items)
+            ++cellSegments.offsets[c + 1];
+        for (std::size_t c = 0; c < nCells; ++c)
+            cellSegments.offsets[c + 1] += cellSegments.offsets[c];
+        cellSegments.items.resize(segmentCells.items.size());
+        {
+            std::vector<std::size_t> cursor(cellSegments.offsets.begin(), cellSegments.offsets.end() - 1);
+            for (std::size_t s = 0; s < nSegments; ++s)
+                for (auto k = segmentCells.offsets[s]; k < segmentCells.offsets[s + 1]; ++k)
+                    cellSegments.items[cursor[segmentCells.items[k]]++] = static_cast<std::uint32_t>(s);
+        }
+
+        std::vector<std::uint32_t> occupied;
+        for (std::size_t c = 0; c < nCells; ++c)
+            if (cellSegments.offsets[c + 1] - cellSegments.offsets[c] > 1)
+                occupied.push_back(static_cast<std::uint32_t>(c));
+
+        //! Test the pairs in each occupied cell.
+        std::vector<std::vector<record_t>> results(get_number_batches(occupied.size(), cellBatchSize));
+        parallel_for_batches(occupied.size(), cellBatchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+        {
+            auto& out = results[b];
+            for (auto k = begin; k < end; ++k)
+            {
+                auto cell = occupied[k];
+                auto first = cellSegments.offsets[cell], last = cellSegments.offsets[cell + 1];
+                for (auto i = first; i < last; ++i)
+                {
+                    auto a = cellSegments.items[i];
+                    for (auto j = i + 1; j < last; ++j)
+                    {
+                        auto b2 = cellSegments.items[j];
+                        if (!is_canonical_cell(segmentCells, a, b2, cell))
+                            continue;
+
+                        record_t r;
+                        r.type = segment_segment_intersection(segments[a], segments[b2], r.xPoints, cmp);
+                        if (r.type != e_non_crossing)
+                        {
+                            r.first = a;
+                            r.second = b2;
+                            out.push_back(r);
+                        }
+                    }
+                }
+            }
+        }, nThreads);
+
+        std::vector<record_t> records;
+        for (auto& out : results)
+            records.insert(records.end(), out.begin(), out.end());
+        std::sort(records.begin(), records.end(), [](const record_t& lhs, const record_t& rhs)
+        {
+            return std::tie(lhs.first, lhs.second) < std::tie(rhs.first, rhs.second);
+        });
+
+        return records;
+    }
+
+    //! Compute the intersections of all pairs of segments on a grid chosen by make_segment_intersection_grid and visit them in
+    //! order of the segment indices as visitor(i, j, iType, xPoint0, xPoint1) on the calling thread (as polyline_self_intersection).
+    //! Returns the number of intersecting pairs.
+    template <typename Segments, typename Visitor, typename NumberComparisonPolicy>
+    inline std::size_t all_segment_intersections(const Segments& segments, Visitor&& visitor, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        auto records = find_segment_intersections(segments, make_segment_intersection_grid(segments), cmp, nThreads);
+        for (auto const& r : records)
+            visitor(r.first, r.second, r.type, r.xPoints[0], r.xPoints[1]);
+        return records.size();
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALL_SEGMENT_INTERSECTIONS_HPP
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <geometrix/algorithm/bentley_ottmann_sweep.hpp>
+#include <geometrix/algorithm/intersection/segment_segment_intersection.hpp>
 #include <geometrix/utility/utilities.hpp>
 #include <geometrix/numeric/rational_utilities.hpp>
 #include <geometrix/primitive/point_traits.hpp>
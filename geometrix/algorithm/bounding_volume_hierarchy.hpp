@@ -0,0 +1,775 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_HPP
+#define GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_HPP
+#pragma once
+
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/algorithm/broad_phase/sweep_and_prune.hpp>
+#include <geometrix/numeric/constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief A dynamic bounding volume hierarchy of axis aligned bounding boxes.
+
+    //! Each leaf holds the box of a single primitive along with a user supplied 32 bit data value (typically the index of
+    //! the primitive in the caller's container). The tree may be built in bulk from a range of boxes using a binned surface
+    //! area heuristic, and subsequently updated incrementally:
+    //! - insert/erase add and remove leaves, choosing the insertion sibling by the surface area heuristic and restoring balance with tree rotations.
+    //! - move reinserts a leaf when it leaves its fattened box, so that small motions cost nothing.
+    //! - refit updates a leaf box in place and propagates it to the root, keeping the topology (useful for small deformations).
+    //! Queries visit the data of leaves whose boxes overlap a box, are hit by a ray or segment, or are nearest to a point;
+    //! the primitive tests themselves are delegated to the visitor (see bounding_volume_hierarchy_queries.hpp).
+    template <typename Point>
+    class bounding_volume_hierarchy
+    {
+    public:
+
+        using point_type = Point;
+        using length_type = typename arithmetic_type_of<Point>::type;
+        using area_type = decltype(std::declval<length_type>() * std::declval<length_type>());
+        using aabb_type = axis_aligned_bounding_box<Point>;
+        using proxy_type = std::uint32_t;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static const proxy_type null_proxy = static_cast<proxy_type>(-1);
+
+        //! margin is the amount by which leaf boxes are fattened on insert/move so that subsequent small motions do not restructure the tree.
+        bounding_volume_hierarchy(const length_type& margin = constants::zero<length_type>())
+            : m_margin(margin)
+        {}
+
+        //! Build the tree from a range of boxes using a binned SAH. Box i is assigned the data value i and the returned proxies are in the same order.
+        template <typename Boxes>
+        std::vector<proxy_type> build(const Boxes& boxes, std::size_t nBins = 16)
+        {
+            clear();
+            std::vector<proxy_type> leaves;
+            leaves.reserve(boxes.size());
+            for (std::size_t i = 0; i < boxes.size(); ++i)
+            {
+                auto n = allocate_node();
+                set_bounds(m_nodes[n], boxes[i], m_margin);
+                m_nodes[n].data = static_cast<std::uint32_t>(i);
+                m_nodes[n].height = 0;
+                leaves.push_back(n);
+            }
+
+            auto order = leaves;
+            m_size = leaves.size();
+            m_root = build_sah(order.begin(), order.end(), (std::max<std::size_t>)(nBins, 2));
+            if (m_root != null_proxy)
+                m_nodes[m_root].parent = null_proxy;
+            return leaves;
+        }
+
+        //! Rebuild the tree over the current leaves using the binned SAH. Proxies remain valid.
+        void rebuild(std::size_t nBins = 16)
+        {
+            std::vector<proxy_type> leaves;
+            for (proxy_type i = 0; i < m_nodes.size(); ++i)
+            {
+                if (m_nodes[i].height == 0)
+                    leaves.push_back(i);
+                else if (m_nodes[i].height > 0)
+                    free_node(i);
+            }
+
+            m_root = build_sah(leaves.begin(), leaves.end(), (std::max<std::size_t>)(nBins, 2));
+            if (m_root != null_proxy)
+                m_nodes[m_root].parent = null_proxy;
+        }
+
+        void clear()
+        {
+            m_nodes.clear();
+            m_free = null_proxy;
+            m_root = null_proxy;
+            m_size = 0;
+        }
+
+        //! Insert a box with associated data and return its proxy.
+        proxy_type insert(const aabb_type& box, std::uint32_t data)
+        {
+            auto leaf = allocate_node();
+            set_bounds(m_nodes[leaf], box, m_margin);
+            m_nodes[leaf].data = data;
+            m_nodes[leaf].height = 0;
+            insert_leaf(leaf);
+            return leaf;
+        }
+
+        void erase(proxy_type leaf)
+        {
+            GEOMETRIX_ASSERT(is_leaf(leaf));
+            remove_leaf(leaf);
+            free_node(leaf);
+        }
+
+        //! Update the box of a leaf. The leaf is reinserted only if the new box escapes the fattened box. Returns true if the tree was restructured.
+        bool move(proxy_type leaf, const aabb_type& box)
+        {
+            GEOMETRIX_ASSERT(is_leaf(leaf));
+            node tmp;
+            set_bounds(tmp, box, constants::zero<length_type>());
+            if (contains(m_nodes[leaf], tmp))
+                return false;
+
+            remove_leaf(leaf);
+            set_bounds(m_nodes[leaf], box, m_margin);
+            insert_leaf(leaf);
+            return true;
+        }
+
+        //! Set the box of a leaf and refit its ancestors without changing the topology of the tree.
+        void refit(proxy_type leaf, const aabb_type& box)
+        {
+            GEOMETRIX_ASSERT(is_leaf(leaf));
+            set_bounds(m_nodes[leaf], box, m_margin);
+            for (auto i = m_nodes[leaf].parent; i != null_proxy; i = m_nodes[i].parent)
+                combine(m_nodes[i], m_nodes[m_nodes[i].child1], m_nodes[m_nodes[i].child2]);
+        }
+
+        std::uint32_t get_data(proxy_type leaf) const
+        {
+            GEOMETRIX_ASSERT(is_leaf(leaf));
+            return m_nodes[leaf].data;
+        }
+
+        //! Access the (fattened) box of a node.
+        aabb_type get_bounds(proxy_type n) const
+        {
+            using indices = std::make_index_sequence<dimension>;
+            return aabb_type(broad_phase_detail::from_array<Point>(m_nodes[n].lo, indices{}), broad_phase_detail::from_array<Point>(m_nodes[n].hi, indices{}));
+        }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        proxy_type get_root() const { return m_root; }
+
+        //! Height of the tree. A tree with a single leaf has height 0.
+        std::int32_t get_height() const { return m_root == null_proxy ? 0 : m_nodes[m_root].height; }
+
+        //! Visit the data of each leaf whose box overlaps the query box. The visitor returns false to terminate the query.
+        template <typename Visitor>
+        void query(const aabb_type& box, Visitor&& visitor) const
+        {
+            node q;
+            set_bounds(q, box, constants::zero<length_type>());
+            traverse([&](const node& n) { return overlaps(n, q); }, [&](const node& n) { return visitor(n.data); });
+        }
+
+        //! Visit the data of each leaf whose box contains the point. The visitor returns false to terminate the query.
+        template <typename Visitor>
+        void query(const point_type& p, Visitor&& visitor) const
+        {
+            query(aabb_type(p, p), std::forward<Visitor>(visitor));
+        }
+
+        //! Cast the ray o + t * d, t in [0, tmax], against the leaf boxes.
+
+        //! The visitor is called as visitor(data, tmax) for leaves whose box is hit in front of the current tmax and
+        //! returns the new tmax: the parameter of the primitive hit if it is closer, the current tmax to continue unchanged
+        //! or zero to terminate. Segments are cast by passing d = b - a and tmax = 1.
+        template <typename Vector, typename T, typename Visitor>
+        void ray_cast(const point_type& o, const Vector& d, T tmax, Visitor&& visitor) const
+        {
+            using indices = std::make_index_sequence<dimension>;
+            auto origin = broad_phase_detail::to_array(o, indices{});
+            auto dir = to_direction(d, indices{});
+            traverse([&](const node& n) { return ray_overlaps(n, origin, dir, tmax); }, [&](const node& n)
+            {
+                tmax = visitor(n.data, tmax);
+                return tmax > T{};
+            });
+        }
+
+        //! Find the nearest primitive to the point with a best first search.
+
+        //! The visitor is called as visitor(data) and returns the squared distance from the point to the primitive. The subtrees
+        //! whose boxes are further than the best distance found are pruned. Returns the data of the nearest primitive and its squared distance,
+        //! or null_proxy if the tree is empty.
+        template <typename Visitor>
+        std::pair<std::uint32_t, area_type> nearest(const point_type& p, Visitor&& visitor, area_type maxDistanceSqrd = constants::infinity<area_type>()) const
+        {
+            using indices = std::make_index_sequence<dimension>;
+            auto result = std::make_pair(static_cast<std::uint32_t>(null_proxy), maxDistanceSqrd);
+            if (m_root == null_proxy)
+                return result;
+
+            auto pa = broad_phase_detail::to_array(p, indices{});
+            using item = std::pair<area_type, proxy_type>;
+            std::priority_queue<item, std::vector<item>, std::greater<item>> Q;
+            Q.emplace(distance_sqrd(m_nodes[m_root], pa), m_root);
+            while (!Q.empty())
+            {
+                auto top = Q.top();
+                Q.pop();
+                if (!(top.first < result.second))
+                    break;
+
+                auto const& n = m_nodes[top.second];
+                if (n.is_leaf())
+                {
+                    auto d2 = visitor(n.data);
+                    if (d2 < result.second)
+                        result = std::make_pair(n.data, d2);
+                    continue;
+                }
+
+                auto d1 = distance_sqrd(m_nodes[n.child1], pa);
+                if (d1 < result.second)
+                    Q.emplace(d1, n.child1);
+                auto d2 = distance_sqrd(m_nodes[n.child2], pa);
+                if (d2 < result.second)
+                    Q.emplace(d2, n.child2);
+            }
+
+            return result;
+        }
+
+        //! Visit each pair of leaves from this tree and other whose boxes overlap as visitor(dataA, dataB).
+        template <typename Visitor>
+        void query_overlapping_pairs(const bounding_volume_hierarchy& other, Visitor&& visitor) const
+        {
+            if (m_root == null_proxy || other.m_root == null_proxy)
+                return;
+
+            std::vector<std::pair<proxy_type, proxy_type>> stack;
+            stack.emplace_back(m_root, other.m_root);
+            while (!stack.empty())
+            {
+                auto top = stack.back();
+                stack.pop_back();
+                auto const& a = m_nodes[top.first];
+                auto const& b = other.m_nodes[top.second];
+                if (!overlaps(a, b))
+                    continue;
+
+                if (a.is_leaf() && b.is_leaf())
+                    visitor(a.data, b.data);
+                else if (b.is_leaf() || (!a.is_leaf() && a.height >= b.height))
+                {
+                    stack.emplace_back(a.child1, top.second);
+                    stack.emplace_back(a.child2, top.second);
+                }
+                else
+                {
+                    stack.emplace_back(top.first, b.child1);
+                    stack.emplace_back(top.first, b.child2);
+                }
+            }
+        }
+
+    private:
+
+        using bounds_t = std::array<length_type, dimension_of<Point>::value>;
+
+        struct node
+        {
+            bounds_t lo;
+            bounds_t hi;
+            proxy_type parent{ null_proxy };//! Next free node when the node is on the free list.
+            proxy_type child1{ null_proxy };
+            proxy_type child2{ null_proxy };
+            std::uint32_t data{ 0 };
+            std::int32_t height{ -1 };//! -1 for free nodes, 0 for leaves.
+
+            bool is_leaf() const { return child1 == null_proxy; }
+        };
+
+        bool is_leaf(proxy_type i) const { return i < m_nodes.size() && m_nodes[i].height == 0; }
+
+        template <typename Vector, std::size_t... I>
+        static std::array<typename std::decay<decltype(get<0>(std::declval<Vector>()))>::type, sizeof...(I)> to_direction(const Vector& v, std::index_sequence<I...>)
+        {
+            return {{ get<I>(v)... }};
+        }
+
+        static void set_bounds(node& n, const aabb_type& box, const length_type& margin)
+        {
+            using indices = std::make_index_sequence<dimension>;
+            n.lo = broad_phase_detail::to_array(box.get_lower_bound(), indices{});
+            n.hi = broad_phase_detail::to_array(box.get_upper_bound(), indices{});
+            for (std::size_t d = 0; d < dimension; ++d)
+            {
+                n.lo[d] -= margin;
+                n.hi[d] += margin;
+            }
+        }
+
+        static void combine(node& n, const node& a, const node& b)
+        {
+            for (std::size_t d = 0; d < dimension; ++d)
+            {
+                n.lo[d] = (std::min)(a.lo[d], b.lo[d]);
+                n.hi[d] = (std::max)(a.hi[d], b.hi[d]);
+            }
+        }
+
+        static bool contains(const node& a, const node& b)
+        {
+            for (std::size_t d = 0; d < dimension; ++d)
+                if (b.lo[d] < a.lo[d] || a.hi[d] < b.hi[d])
+                    return false;
+            return true;
+        }
+
+        static bool overlaps(const node& a, const node& b)
+        {
+            for (std::size_t d = 0; d < dimension; ++d)
+                if (a.hi[d] < b.lo[d] || b.hi[d] < a.lo[d])
+                    return false;
+            return true;
+        }
+
+        //! The surface area heuristic cost of a box (half perimeter in 2D, half surface area in 3D).
+        static double cost(const bounds_t& lo, const bounds_t& hi)
+        {
+            std::array<double, dimension> e;
+            for (std::size_t d = 0; d < dimension; ++d)
+                e[d] = construct<double>(hi[d] - lo[d]);
+            if (dimension == 2)
+                return e[0] + e[1];
+            double r = 0;
+            for (std::size_t i = 0; i < dimension; ++i)
+                for (std::size_t j = i + 1; j < dimension; ++j)
+                    r += e[i] * e[j];
+            return r;
+        }
+
+        static double cost(const node& n) { return cost(n.lo, n.hi); }
+
+        static double combined_cost(const node& a, const node& b)
+        {
+            node c;
+            combine(c, a, b);
+            return cost(c);
+        }
+
+        template <typename Direction, typename T>
+        static bool ray_overlaps(const node& n, const bounds_t& o, const Direction& dir, const T& tmax)
+        {
+            //! Slab test over each dimension.
+            auto tmin = T{};
+            auto tlim = tmax;
+            for (std::size_t d = 0; d < dimension; ++d)
+            {
+                if (dir[d] == decltype(dir[d]){})
+                {
+                    if (o[d] < n.lo[d] || n.hi[d] < o[d])
+                        return false;
+                    continue;
+                }
+
+                T t1 = (n.lo[d] - o[d]) / dir[d];
+                T t2 = (n.hi[d] - o[d]) / dir[d];
+                if (t2 < t1)
+                    std::swap(t1, t2);
+                if (tmin < t1)
+                    tmin = t1;
+                if (t2 < tlim)
+                    tlim = t2;
+                if (tlim < tmin)
+                    return false;
+            }
+
+            return true;
+        }
+
+        static area_type distance_sqrd(const node& n, const bounds_t& p)
+        {
+            auto r = constants::zero<area_type>();
+            for (std::size_t d = 0; d < dimension; ++d)
+            {
+                if (p[d] < n.lo[d])
+                    r += (n.lo[d] - p[d]) * (n.lo[d] - p[d]);
+                else if (n.hi[d] < p[d])
+                    r += (p[d] - n.hi[d]) * (p[d] - n.hi[d]);
+            }
+            return r;
+        }
+
+        //! Depth first traversal visiting leaves for which enter(node) holds. The leaf visitor returns false to terminate.
+        template <typename Enter, typename Visit>
+        void traverse(Enter&& enter, Visit&& visit) const
+        {
+            if (m_root == null_proxy)
+                return;
+
+            proxy_type fixed[64];
+            std::vector<proxy_type> overflow;
+            std::size_t top = 0;
+            auto push = [&](proxy_type i)
+            {
+                if (top < 64)
+                    fixed[top] = i;
+                else
+                    overflow.push_back(i);
+                ++top;
+            };
+            auto pop = [&]()
+            {
+                --top;
+                if (top < 64)
+                    return fixed[top];
+                auto i = overflow.back();
+                overflow.pop_back();
+                return i;
+            };
+
+            push(m_root);
+            while (top)
+            {
+                auto const& n = m_nodes[pop()];
+                if (!enter(n))
+                    continue;
+
+                if (n.is_leaf())
+                {
+                    if (!visit(n))
+                        return;
+                }
+                else
+                {
+                    push(n.child2);
+                    push(n.child1);
+                }
+            }
+        }
+
+        proxy_type allocate_node()
+        {
+            proxy_type i;
+            if (m_free != null_proxy)
+            {
+                i = m_free;
+                m_free = m_nodes[i].parent;
+                m_nodes[i] = node{};
+            }
+            else
+            {
+                i = static_cast<proxy_type>(m_nodes.size());
+                m_nodes.emplace_back();
+            }
+
+            m_nodes[i].height = 0;
+            return i;
+        }
+
+        void free_node(proxy_type i)
+        {
+            m_nodes[i].parent = m_free;
+            m_nodes[i].child1 = m_nodes[i].child2 = null_proxy;
+            m_nodes[i].height = -1;
+            m_free = i;
+        }
+
+        template <typename Iterator>
+        proxy_type build_sah(Iterator first, Iterator last, std::size_t nBins)
+        {
+            auto n = static_cast<std::size_t>(std::distance(first, last));
+            if (n == 0)
+                return null_proxy;
+
+            if (n == 1)
+                return *first;
+
+            //! Bound the centroids and choose the axis of greatest extent.
+            bounds_t clo = centroid(m_nodes[*first]), chi = clo;
+            for (auto it = first; it != last; ++it)
+            {
+                auto c = centroid(m_nodes[*it]);
+                for (std::size_t d = 0; d < dimension; ++d)
+                {
+                    clo[d] = (std::min)(clo[d], c[d]);
+                    chi[d] = (std::max)(chi[d], c[d]);
+                }
+            }
+
+            std::size_t axis = 0;
+            for (std::size_t d = 1; d < dimension; ++d)
+                if (chi[axis] - clo[axis] < chi[d] - clo[d])
+                    axis = d;
+
+            Iterator mid;
+            auto extent = construct<double>(chi[axis] - clo[axis]);
+            if (!(extent > 0.0))
+                mid = first + n / 2;
+            else
+            {
+                //! Bin the centroids and evaluate the SAH at each bin boundary.
+                struct bin { node box; std::size_t count{ 0 }; };
+                std::vector<bin> bins(nBins);
+                auto binOf = [&](proxy_type i)
+                {
+                    auto c = construct<double>(centroid(m_nodes[i])[axis] - clo[axis]);
+                    return (std::min)(nBins - 1, static_cast<std::size_t>(nBins * c / extent));
+                };
+
+                for (auto it = first; it != last; ++it)
+                {
+                    auto& b = bins[binOf(*it)];
+                    if (b.count++ == 0)
+                        b.box = m_nodes[*it];
+                    else
+                        combine(b.box, b.box, m_nodes[*it]);
+                }
+
+                std::vector<double> leftCost(nBins), rightCost(nBins);
+                node acc;
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < nBins - 1; ++i)
+                {
+                    if (bins[i].count)
+                    {
+                        if (count == 0)
+                            acc = bins[i].box;
+                        else
+                            combine(acc, acc, bins[i].box);
+                        count += bins[i].count;
+                    }
+                    leftCost[i] = count ? cost(acc) * count : 0.0;
+                }
+
+                count = 0;
+                for (std::size_t i = nBins - 1; i > 0; --i)
+                {
+                    if (bins[i].count)
+                    {
+                        if (count == 0)
+                            acc = bins[i].box;
+                        else
+                            combine(acc, acc, bins[i].box);
+                        count += bins[i].count;
+                    }
+                    rightCost[i - 1] = count ? cost(acc) * count : 0.0;
+                }
+
+                std::size_t best = 0;
+                for (std::size_t i = 1; i < nBins - 1; ++i)
+                    if (leftCost[i] + rightCost[i] < leftCost[best] + rightCost[best])
+                        best = i;
+
+                mid = std::partition(first, last, [&](proxy_type i) { return binOf(i) <= best; });
+                if (mid == first || mid == last)
+                    mid = first + n / 2;
+            }
+
+            auto left = build_sah(first, mid, nBins);
+            auto right = build_sah(mid, last, nBins);
+            auto parent = allocate_node();
+            auto& p = m_nodes[parent];
+            p.child1 = left;
+            p.child2 = right;
+            p.height = 1 + (std::max)(m_nodes[left].height, m_nodes[right].height);
+            combine(p, m_nodes[left], m_nodes[right]);
+            m_nodes[left].parent = parent;
+            m_nodes[right].parent = parent;
+            return parent;
+        }
+
+        static bounds_t centroid(const node& n)
+        {
+            bounds_t c;
+            for (std::size_t d = 0; d < dimension; ++d)
+                c[d] = n.lo[d] + 0.5 * (n.hi[d] - n.lo[d]);
+            return c;
+        }
+
+        void insert_leaf(proxy_type leaf)
+        {
+            ++m_size;
+            if (m_root == null_proxy)
+            {
+                m_root = leaf;
+                m_nodes[leaf].parent = null_proxy;
+                return;
+            }
+
+            //! Find the best sibling using the surface area heuristic.
+            auto const& leafNode = m_nodes[leaf];
+            auto index = m_root;
+            while (!m_nodes[index].is_leaf())
+            {
+                auto const& n = m_nodes[index];
+                auto area = cost(n);
+                auto combinedArea = combined_cost(n, leafNode);
+
+                //! Cost of creating a new parent for this node and the new leaf.
+                auto c = 2.0 * combinedArea;
+
+                //! Minimum cost of pushing the leaf further down the tree.
+                auto inheritance = 2.0 * (combinedArea - area);
+                auto childCost = [&](proxy_type child)
+                {
+                    auto const& cn = m_nodes[child];
+                    if (cn.is_leaf())
+                        return combined_cost(leafNode, cn) + inheritance;
+                    return combined_cost(leafNode, cn) - cost(cn) + inheritance;
+                };
+
+                auto cost1 = childCost(n.child1);
+                auto cost2 = childCost(n.child2);
+                if (c < cost1 && c < cost2)
+                    break;
+
+                index = cost1 < cost2 ? n.child1 : n.child2;
+            }
+
+            auto sibling = index;
+            auto oldParent = m_nodes[sibling].parent;
+            auto newParent = allocate_node();
+            m_nodes[newParent].parent = oldParent;
+            combine(m_nodes[newParent], m_nodes[leaf], m_nodes[sibling]);
+            m_nodes[newParent].height = m_nodes[sibling].height + 1;
+            m_nodes[newParent].child1 = sibling;
+            m_nodes[newParent].child2 = leaf;
+            m_nodes[sibling].parent = newParent;
+            m_nodes[leaf].parent = newParent;
+
+            if (oldParent != null_proxy)
+            {
+                if (m_nodes[oldParent].child1 == sibling)
+                    m_nodes[oldParent].child1 = newParent;
+                else
+                    m_nodes[oldParent].child2 = newParent;
+            }
+            else
+                m_root = newParent;
+
+            fix_upwards(m_nodes[leaf].parent);
+        }
+
+        void remove_leaf(proxy_type leaf)
+        {
+            --m_size;
+            if (leaf == m_root)
+            {
+                m_root = null_proxy;
+                return;
+            }
+
+            auto parent = m_nodes[leaf].parent;
+            auto grandParent = m_nodes[parent].parent;
+            auto sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+            if (grandParent != null_proxy)
+            {
+                if (m_nodes[grandParent].child1 == parent)
+                    m_nodes[grandParent].child1 = sibling;
+                else
+                    m_nodes[grandParent].child2 = sibling;
+                m_nodes[sibling].parent = grandParent;
+                free_node(parent);
+                fix_upwards(grandParent);
+            }
+            else
+            {
+                m_root = sibling;
+                m_nodes[sibling].parent = null_proxy;
+                free_node(parent);
+            }
+        }
+
+        //! Walk back up the tree restoring balance, heights and boxes.
+        void fix_upwards(proxy_type index)
+        {
+            while (index != null_proxy)
+            {
+                index = balance(index);
+                auto& n = m_nodes[index];
+                n.height = 1 + (std::max)(m_nodes[n.child1].height, m_nodes[n.child2].height);
+                combine(n, m_nodes[n.child1], m_nodes[n.child2]);
+                index = n.parent;
+            }
+        }
+
+        //! Perform a left or right rotation if node A is imbalanced. Returns the new root of the subtree.
+        proxy_type balance(proxy_type iA)
+        {
+            auto& A = m_nodes[iA];
+            if (A.is_leaf() || A.height < 2)
+                return iA;
+
+            auto iB = A.child1;
+            auto iC = A.child2;
+            auto heightBalance = m_nodes[iC].height - m_nodes[iB].height;
+            if (heightBalance > 1)
+                return rotate(iA, iC, iB);
+            if (heightBalance < -1)
+                return rotate(iA, iB, iC);
+            return iA;
+        }
+
+        //! Rotate the taller child iUp of iA above it. iOther is the other child of iA.
+        proxy_type rotate(proxy_type iA, proxy_type iUp, proxy_type iOther)
+        {
+            auto& A = m_nodes[iA];
+            auto& U = m_nodes[iUp];
+            auto iF = U.child1;
+            auto iG = U.child2;
+
+            //! Swap A and U.
+            U.child1 = iA;
+            U.parent = A.parent;
+            A.parent = iUp;
+
+            if (U.parent != null_proxy)
+            {
+                if (m_nodes[U.parent].child1 == iA)
+                    m_nodes[U.parent].child1 = iUp;
+                else
+                    m_nodes[U.parent].child2 = iUp;
+            }
+            else
+                m_root = iUp;
+
+            //! Keep the taller grandchild under U and move the other beneath A.
+            auto iKeep = iF, iMove = iG;
+            if (m_nodes[iF].height < m_nodes[iG].height)
+                std::swap(iKeep, iMove);
+
+            U.child2 = iKeep;
+            if (A.child1 == iUp)
+                A.child1 = iMove;
+            else
+                A.child2 = iMove;
+            m_nodes[iMove].parent = iA;
+
+            combine(A, m_nodes[iOther], m_nodes[iMove]);
+            A.height = 1 + (std::max)(m_nodes[iOther].height, m_nodes[iMove].height);
+            combine(U, A, m_nodes[iKeep]);
+            U.height = 1 + (std::max)(A.height, m_nodes[iKeep].height);
+            return iUp;
+        }
+
+        std::vector<node> m_nodes;
+        proxy_type m_root{ null_proxy };
+        proxy_type m_free{ null_proxy };
+        std::size_t m_size{ 0 };
+        length_type m_margin;
+    };
+
+    template <typename Point>
+    const std::size_t bounding_volume_hierarchy<Point>::dimension;
+
+    template <typename Point>
+    const typename bounding_volume_hierarchy<Point>::proxy_type bounding_volume_hierarchy<Point>::null_proxy;
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_HPP
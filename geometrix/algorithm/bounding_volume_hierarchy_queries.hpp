@@ -0,0 +1,187 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_QUERIES_HPP
+#define GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_QUERIES_HPP
+#pragma once
+
+#include <geometrix/algorithm/bounding_volume_hierarchy.hpp>
+#include <geometrix/algorithm/intersection/ray_segment_intersection.hpp>
+#include <geometrix/algorithm/intersection/segment_segment_intersection.hpp>
+#include <geometrix/algorithm/intersection/segment_triangle_intersection.hpp>
+#include <geometrix/algorithm/distance/point_segment_distance.hpp>
+#include <geometrix/algorithm/distance/point_polygon_distance.hpp>
+#include <geometrix/algorithm/point_in_polygon.hpp>
+#include <geometrix/primitive/triangle.hpp>
+
+#include <vector>
+
+//! Queries of a bounding_volume_hierarchy over a random access range of 2D segments, triangles or polygons (whose data
+//! values are the indices of the primitives). The tree prunes the candidates and the primitive tests are delegated
+//! to the narrow phase functions of the library. Triangles and polygons are treated as solids.
+namespace geometrix {
+
+    //! Build a bounding volume hierarchy over the boxes of the primitives in which leaf i holds primitive i.
+    template <typename Point, typename Primitives>
+    inline bounding_volume_hierarchy<Point> make_bounding_volume_hierarchy(const Primitives& primitives, const typename arithmetic_type_of<Point>::type& margin = constants::zero<typename arithmetic_type_of<Point>::type>(), std::size_t nBins = 16)
+    {
+        std::vector<axis_aligned_bounding_box<Point>> boxes;
+        boxes.reserve(primitives.size());
+        for (auto const& p : primitives)
+            boxes.push_back(make_aabb<Point>(p));
+
+        bounding_volume_hierarchy<Point> bvh(margin);
+        bvh.build(boxes, nBins);
+        return bvh;
+    }
+
+    namespace bvh_detail {
+
+        //! Ray casts: compute the distance t along the unit vector v to the first point of the primitive.
+        template <typename Point, typename UnitVector, typename Segment, typename Length, typename NumberComparisonPolicy>
+        inline bool ray_primitive_intersection(const Point& o, const UnitVector& v, const Segment& seg, Length& t, const NumberComparisonPolicy& cmp, typename std::enable_if<is_segment<Segment>::value>::type* = nullptr)
+        {
+            Point xPoints[2];
+            return ray_segment_intersection(o, v, get_start(seg), get_end(seg), t, xPoints, cmp) != e_non_crossing;
+        }
+
+        template <typename Point, typename UnitVector, typename Polygon, typename Length, typename NumberComparisonPolicy>
+        inline bool ray_primitive_intersection(const Point& o, const UnitVector& v, const Polygon& poly, Length& t, const NumberComparisonPolicy& cmp, typename std::enable_if<is_point_sequence<Polygon>::value>::type* = nullptr)
+        {
+            if (point_in_polygon(o, poly))
+            {
+                t = constants::zero<Length>();
+                return true;
+            }
+
+            using access = point_sequence_traits<Polygon>;
+            bool hit = false;
+            auto size = access::size(poly);
+            for (std::size_t i = size - 1, j = 0; j < size; i = j++)
+            {
+                Length l;
+                Point xPoints[2];
+                if (ray_segment_intersection(o, v, access::get_point(poly, i), access::get_point(poly, j), l, xPoints, cmp) != e_non_crossing && (!hit || l < t))
+                {
+                    t = l;
+                    hit = true;
+                }
+            }
+
+            return hit;
+        }
+
+        //! Segment tests.
+        template <typename PointA, typename PointB, typename Segment, typename NumberComparisonPolicy>
+        inline bool segment_primitive_intersect(const PointA& a, const PointB& b, const Segment& seg, const NumberComparisonPolicy& cmp, typename std::enable_if<is_segment<Segment>::value>::type* = nullptr)
+        {
+            PointA xPoints[2];
+            return segment_segment_intersection(a, b, get_start(seg), get_end(seg), xPoints, cmp) != e_non_crossing;
+        }
+
+        template <typename PointA, typename PointB, typename Point, typename NumberComparisonPolicy>
+        inline bool segment_primitive_intersect(const PointA& a, const PointB& b, const triangle<Point>& tri, const NumberComparisonPolicy&)
+        {
+            return segment_triangle_intersect(a, b, tri[0], tri[1], tri[2]);
+        }
+
+        template <typename PointA, typename PointB, typename Polygon, typename NumberComparisonPolicy>
+        inline bool segment_primitive_intersect(const PointA& a, const PointB& b, const Polygon& poly, const NumberComparisonPolicy& cmp, typename std::enable_if<is_point_sequence<Polygon>::value>::type* = nullptr)
+        {
+            if (point_in_polygon(a, poly))
+                return true;
+
+            using access = point_sequence_traits<Polygon>;
+            auto size = access::size(poly);
+            for (std::size_t i = size - 1, j = 0; j < size; i = j++)
+            {
+                PointA xPoints[2];
+                if (segment_segment_intersection(a, b, access::get_point(poly, i), access::get_point(poly, j), xPoints, cmp) != e_non_crossing)
+                    return true;
+            }
+
+            return false;
+        }
+
+        //! Squared distances.
+        template <typename Point, typename Segment, typename NumberComparisonPolicy>
+        inline typename result_of::point_segment_distance_sqrd<Point, Segment>::type primitive_distance_sqrd(const Point& p, const Segment& seg, const NumberComparisonPolicy&, typename std::enable_if<is_segment<Segment>::value>::type* = nullptr)
+        {
+            return point_segment_distance_sqrd(p, seg);
+        }
+
+        template <typename Point, typename T, typename NumberComparisonPolicy>
+        inline typename result_of::point_polygon_distance_sqrd<Point, triangle<T>>::type primitive_distance_sqrd(const Point& p, const triangle<T>& tri, const NumberComparisonPolicy& cmp)
+        {
+            using area_t = typename result_of::point_polygon_distance_sqrd<Point, triangle<T>>::type;
+            return point_in_triangle(p, tri[0], tri[1], tri[2], cmp) ? constants::zero<area_t>() : point_polygon_distance_sqrd(p, tri);
+        }
+
+        template <typename Point, typename Polygon, typename NumberComparisonPolicy>
+        inline typename result_of::point_polygon_distance_sqrd<Point, Polygon>::type primitive_distance_sqrd(const Point& p, const Polygon& poly, const NumberComparisonPolicy&, typename std::enable_if<is_point_sequence<Polygon>::value>::type* = nullptr)
+        {
+            using area_t = typename result_of::point_polygon_distance_sqrd<Point, Polygon>::type;
+            return point_in_polygon(p, poly) ? constants::zero<area_t>() : point_polygon_distance_sqrd(p, poly);
+        }
+
+    }//! namespace bvh_detail;
+
+    //! Find the first primitive hit by the ray o + t * v with t in [0, tmax] where v is a unit vector.
+    //! Returns the index of the primitive and sets t to the distance of the hit, or returns null_proxy if nothing is hit.
+    template <typename Point, typename Primitives, typename UnitVector, typename Length, typename NumberComparisonPolicy>
+    inline std::uint32_t bvh_ray_cast(const bounding_volume_hierarchy<Point>& bvh, const Primitives& primitives, const Point& o, const UnitVector& v, const Length& tmax, Length& t, const NumberComparisonPolicy& cmp)
+    {
+        auto result = bounding_volume_hierarchy<Point>::null_proxy;
+        bvh.ray_cast(o, v, tmax, [&](std::uint32_t i, const Length& tcurrent)
+        {
+            Length l;
+            if (bvh_detail::ray_primitive_intersection(o, v, primitives[i], l, cmp) && l < tcurrent)
+            {
+                result = i;
+                t = l;
+                //! Terminate on contact at the origin.
+                return cmp.greater_than(l, constants::zero<Length>()) ? l : constants::zero<Length>();
+            }
+            return tcurrent;
+        });
+
+        return result;
+    }
+
+    //! Visit the index of each primitive intersected by the segment (a, b). The visitor returns false to terminate the query.
+    template <typename Point, typename Primitives, typename Visitor, typename NumberComparisonPolicy>
+    inline void bvh_segment_query(const bounding_volume_hierarchy<Point>& bvh, const Primitives& primitives, const Point& a, const Point& b, Visitor&& visitor, const NumberComparisonPolicy& cmp)
+    {
+        using length_t = typename arithmetic_type_of<Point>::type;
+        using dimensionless_t = decltype(std::declval<length_t>() / std::declval<length_t>());
+        vector<length_t, 2> d = b - a;
+        bvh.ray_cast(a, d, constants::one<dimensionless_t>(), [&](std::uint32_t i, const dimensionless_t& tcurrent)
+        {
+            if (bvh_detail::segment_primitive_intersect(a, b, primitives[i], cmp) && !visitor(i))
+                return constants::zero<dimensionless_t>();
+            return tcurrent;
+        });
+    }
+
+    //! Visit the index of each primitive whose box overlaps the query box. The visitor returns false to terminate the query.
+    template <typename Point, typename Visitor>
+    inline void bvh_aabb_query(const bounding_volume_hierarchy<Point>& bvh, const axis_aligned_bounding_box<Point>& box, Visitor&& visitor)
+    {
+        bvh.query(box, std::forward<Visitor>(visitor));
+    }
+
+    //! Find the primitive nearest to p. Returns the index of the primitive and its squared distance (zero inside solids), or null_proxy if the tree is empty.
+    template <typename Point, typename Primitives, typename NumberComparisonPolicy>
+    inline std::pair<std::uint32_t, typename bounding_volume_hierarchy<Point>::area_type> bvh_nearest_primitive(const bounding_volume_hierarchy<Point>& bvh, const Primitives& primitives, const Point& p, const NumberComparisonPolicy& cmp)
+    {
+        return bvh.nearest(p, [&](std::uint32_t i) { return bvh_detail::primitive_distance_sqrd(p, primitives[i], cmp); });
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_BOUNDING_VOLUME_HIERARCHY_QUERIES_HPP
@@ -0,0 +1,146 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_BROAD_PHASE_MOVING_COLLISION_DETECTION_HPP
+#define GEOMETRIX_ALGORITHM_BROAD_PHASE_MOVING_COLLISION_DETECTION_HPP
+#pragma once
+
+#include <geometrix/algorithm/broad_phase/sweep_and_prune.hpp>
+#include <geometrix/algorithm/intersection/moving_obb_obb_intersection.hpp>
+#include <geometrix/algorithm/intersection/moving_sphere_sphere_intersection.hpp>
+#include <geometrix/algorithm/intersection/moving_separating_axis_convex_polygons.hpp>
+#include <geometrix/primitive/polygon.hpp>
+#include <geometrix/primitive/sphere.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+#include <geometrix/utility/ignore_unused_warnings.hpp>
+
+#include <vector>
+
+namespace geometrix {
+
+    //! The first time of contact between the shapes referenced by a broad phase pair.
+    template <typename Time>
+    struct time_of_impact
+    {
+        broad_phase_proxy first;
+        broad_phase_proxy second;
+        Time              time;
+    };
+
+    //! Uniform narrow-phase adaptors over the moving intersection tests. Each computes the time of first contact in [0, tmax]
+    //! of two shapes moving with constant velocity and returns false if they do not touch in that interval.
+
+    template <typename Point1, typename Vector1, typename Velocity1, typename Point2, typename Vector2, typename Velocity2, typename Time, typename NumberComparisonPolicy>
+    inline bool moving_intersection_time(const oriented_bounding_box<Point1, Vector1>& o1, const Velocity1& v1, const oriented_bounding_box<Point2, Vector2>& o2, const Velocity2& v2, const Time& tmax, Time& t, const NumberComparisonPolicy&)
+    {
+        auto tlast = Time{};
+        return moving_obb_obb_intersection(o1, v1, o2, v2, tmax, t, tlast);
+    }
+
+    template <std::size_t N, typename Point, typename Velocity, typename Time, typename NumberComparisonPolicy>
+    inline bool moving_intersection_time(const sphere<N, Point>& s1, const Velocity& v1, const sphere<N, Point>& s2, const Velocity& v2, const Time& tmax, Time& t, const NumberComparisonPolicy& cmp)
+    {
+        Point q;
+        return moving_sphere_sphere_intersection(s1, s2, v1, v2, t, q, cmp) && cmp.less_than_or_equal(t, tmax);
+    }
+
+    template <typename Point, typename Velocity, typename Time, typename NumberComparisonPolicy>
+    inline bool moving_intersection_time(const polygon<Point>& p1, const Velocity& v1, const polygon<Point>& p2, const Velocity& v2, const Time& tmax, Time& t, const NumberComparisonPolicy& cmp)
+    {
+        auto tlast = Time{};
+        return moving_convex_polygons_intersection(p1, v1, p2, v2, tmax, t, tlast, cmp);
+    }
+
+    //! Run a narrow phase over the candidate pairs in parallel batches.
+
+    //! The narrow phase is invoked as narrowPhase(first, second, t) and returns true when the pair collides, setting t to the time of impact.
+    //! Results are returned in the order of the input pairs regardless of the number of threads.
+    template <typename Time, typename NarrowPhase>
+    inline std::vector<time_of_impact<Time>> find_times_of_impact(const std::vector<broad_phase_pair>& pairs, NarrowPhase&& narrowPhase, std::size_t batchSize = 256, std::size_t nThreads = get_default_concurrency())
+    {
+        std::vector<std::vector<time_of_impact<Time>>> batches(get_number_batches(pairs.size(), batchSize));
+        parallel_for_batches(pairs.size(), batchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+        {
+            auto& out = batches[b];
+            for (auto i = begin; i < end; ++i)
+            {
+                auto t = Time{};
+                if (narrowPhase(pairs[i].first, pairs[i].second, t))
+                    out.push_back(time_of_impact<Time>{ pairs[i].first, pairs[i].second, t });
+            }
+        }, nThreads);
+
+        std::vector<time_of_impact<Time>> results;
+        for (auto const& out : batches)
+            results.insert(results.end(), out.begin(), out.end());
+        return results;
+    }
+
+    //! Dispatch the candidate pairs to moving_intersection_time using shapes and velocities indexed by proxy.
+    template <typename Shapes, typename Velocities, typename Time, typename NumberComparisonPolicy>
+    inline std::vector<time_of_impact<Time>> find_times_of_impact(const std::vector<broad_phase_pair>& pairs, const Shapes& shapes, const Velocities& velocities, const Time& tmax, const NumberComparisonPolicy& cmp, std::size_t batchSize = 256, std::size_t nThreads = get_default_concurrency())
+    {
+        return find_times_of_impact<Time>(pairs, [&](broad_phase_proxy i, broad_phase_proxy j, Time& t)
+        {
+            return moving_intersection_time(shapes[i], velocities[i], shapes[j], velocities[j], tmax, t, cmp);
+        }, batchSize, nThreads);
+    }
+
+    //! \brief Broad and narrow phase collision detection for a set of shapes moving with constant velocity over a time step.
+
+    //! Shapes are registered in a sweep_and_prune using their swept bounds over the time step. Each call to detect refits the
+    //! bounds of all shapes incrementally and reports the time of impact of each colliding pair. Shape i in the ranges passed
+    //! to detect corresponds to proxy i.
+    template <typename Point>
+    class moving_collision_detector
+    {
+    public:
+
+        using broad_phase_type = sweep_and_prune<Point>;
+
+        moving_collision_detector(std::size_t batchSize = 1024, std::size_t nThreads = get_default_concurrency())
+            : m_broadPhase(batchSize, nThreads)
+            , m_nThreads(nThreads)
+        {}
+
+        template <typename Shapes, typename Velocities, typename Time, typename NumberComparisonPolicy>
+        std::vector<time_of_impact<Time>> detect(const Shapes& shapes, const Velocities& velocities, const Time& dt, const NumberComparisonPolicy& cmp)
+        {
+            GEOMETRIX_ASSERT(shapes.size() == velocities.size());
+            auto n = shapes.size();
+            while (m_broadPhase.size() > n)
+                m_broadPhase.erase(static_cast<broad_phase_proxy>(m_broadPhase.size() - 1));
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto box = make_swept_aabb(shapes[i], velocities[i], dt);
+                if (i < m_broadPhase.size())
+                    m_broadPhase.update(static_cast<broad_phase_proxy>(i), box);
+                else
+                {
+                    auto id = m_broadPhase.insert(box);
+                    ignore_unused_warning_of(id);
+                    GEOMETRIX_ASSERT(id == i);
+                }
+            }
+
+            auto const& pairs = m_broadPhase.update_pairs();
+            return find_times_of_impact(pairs, shapes, velocities, dt, cmp, 256, m_nThreads);
+        }
+
+        const broad_phase_type& get_broad_phase() const { return m_broadPhase; }
+
+    private:
+
+        broad_phase_type m_broadPhase;
+        std::size_t m_nThreads;
+    };
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_BROAD_PHASE_MOVING_COLLISION_DETECTION_HPP
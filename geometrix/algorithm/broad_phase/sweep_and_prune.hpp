@@ -0,0 +1,366 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_BROAD_PHASE_SWEEP_AND_PRUNE_HPP
+#define GEOMETRIX_ALGORITHM_BROAD_PHASE_SWEEP_AND_PRUNE_HPP
+#pragma once
+
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/primitive/oriented_bounding_box.hpp>
+#include <geometrix/primitive/sphere_traits.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace geometrix {
+
+    //! Handle to an object registered with a broad phase.
+    using broad_phase_proxy = std::uint32_t;
+
+    //! An unordered pair of proxies whose bounds overlap. By convention first < second.
+    struct broad_phase_pair
+    {
+        broad_phase_proxy first;
+        broad_phase_proxy second;
+
+        bool operator ==(const broad_phase_pair& rhs) const { return first == rhs.first && second == rhs.second; }
+        bool operator !=(const broad_phase_pair& rhs) const { return !(*this == rhs); }
+        bool operator <(const broad_phase_pair& rhs) const { return first < rhs.first || (first == rhs.first && second < rhs.second); }
+    };
+
+    namespace broad_phase_detail {
+
+        template <typename Point, std::size_t... I>
+        inline std::array<typename arithmetic_type_of<Point>::type, sizeof...(I)> to_array(const Point& p, std::index_sequence<I...>)
+        {
+            return {{ get<I>(p)... }};
+        }
+
+        template <typename Point, typename T, std::size_t D, std::size_t... I>
+        inline Point from_array(const std::array<T, D>& a, std::index_sequence<I...>)
+        {
+            return construct<Point>(a[I]...);
+        }
+
+        template <typename Point, typename Vector, typename Time, std::size_t... I>
+        inline void sweep(std::array<typename arithmetic_type_of<Point>::type, sizeof...(I)>& lo, std::array<typename arithmetic_type_of<Point>::type, sizeof...(I)>& hi, const Vector& v, const Time& t, std::index_sequence<I...>)
+        {
+            using length_t = typename arithmetic_type_of<Point>::type;
+            std::array<length_t, sizeof...(I)> d = {{ length_t(get<I>(v) * t)... }};
+            for (std::size_t i = 0; i < sizeof...(I); ++i)
+            {
+                if (d[i] < constants::zero<length_t>())
+                    lo[i] += d[i];
+                else
+                    hi[i] += d[i];
+            }
+        }
+
+    }//! namespace broad_phase_detail;
+
+    //! Expand an aabb so that it bounds the region swept by the box when translated by velocity over the interval [0, t].
+    template <typename Point, typename Velocity, typename Time>
+    inline axis_aligned_bounding_box<Point> make_swept_aabb(const axis_aligned_bounding_box<Point>& box, const Velocity& velocity, const Time& t)
+    {
+        using indices = std::make_index_sequence<dimension_of<Point>::value>;
+        auto lo = broad_phase_detail::to_array(box.get_lower_bound(), indices{});
+        auto hi = broad_phase_detail::to_array(box.get_upper_bound(), indices{});
+        broad_phase_detail::sweep<Point>(lo, hi, velocity, t, indices{});
+        return axis_aligned_bounding_box<Point>(broad_phase_detail::from_array<Point>(lo, indices{}), broad_phase_detail::from_array<Point>(hi, indices{}));
+    }
+
+    //! Swept bounds of a sphere.
+    template <typename Sphere, typename Velocity, typename Time, typename std::enable_if<is_sphere<Sphere>::value, int>::type = 0>
+    inline axis_aligned_bounding_box<typename geometric_traits<Sphere>::point_type> make_swept_aabb(const Sphere& s, const Velocity& velocity, const Time& t)
+    {
+        using point_t = typename geometric_traits<Sphere>::point_type;
+        using indices = std::make_index_sequence<dimension_of<point_t>::value>;
+        auto lo = broad_phase_detail::to_array(get_center(s), indices{});
+        auto hi = lo;
+        auto r = get_radius(s);
+        for (std::size_t i = 0; i < lo.size(); ++i)
+        {
+            lo[i] -= r;
+            hi[i] += r;
+        }
+        return make_swept_aabb(axis_aligned_bounding_box<point_t>(broad_phase_detail::from_array<point_t>(lo, indices{}), broad_phase_detail::from_array<point_t>(hi, indices{})), velocity, t);
+    }
+
+    //! Swept bounds of an oriented bounding box.
+    template <typename Point, typename Vector, typename Velocity, typename Time>
+    inline axis_aligned_bounding_box<Point> make_swept_aabb(const oriented_bounding_box<Point, Vector>& o, const Velocity& velocity, const Time& t)
+    {
+        using std::abs;
+        using length_t = typename arithmetic_type_of<Point>::type;
+        auto const& c = o.get_center();
+        length_t ex = o.get_halfwidth(0) * abs(get<0>(o.get_axis(0))) + o.get_halfwidth(1) * abs(get<0>(o.get_axis(1)));
+        length_t ey = o.get_halfwidth(0) * abs(get<1>(o.get_axis(0))) + o.get_halfwidth(1) * abs(get<1>(o.get_axis(1)));
+        auto lo = construct<Point>(get<0>(c) - ex, get<1>(c) - ey);
+        auto hi = construct<Point>(get<0>(c) + ex, get<1>(c) + ey);
+        return make_swept_aabb(axis_aligned_bounding_box<Point>(lo, hi), velocity, t);
+    }
+
+    //! Swept bounds of a point sequence (e.g. a convex polygon).
+    template <typename PointSequence, typename Velocity, typename Time, typename std::enable_if<is_point_sequence<PointSequence>::value, int>::type = 0>
+    inline axis_aligned_bounding_box<typename point_sequence_traits<PointSequence>::point_type> make_swept_aabb(const PointSequence& poly, const Velocity& velocity, const Time& t)
+    {
+        using point_t = typename point_sequence_traits<PointSequence>::point_type;
+        return make_swept_aabb(make_aabb<point_t>(poly), velocity, t);
+    }
+
+    //! \brief An incremental sweep-and-prune broad phase over axis aligned bounding boxes.
+
+    //! Proxies are kept sorted by their lower bound along a sweep axis. Each call to update_pairs re-sorts the proxies
+    //! using an insertion sort, which is close to linear when motion is coherent from frame to frame, and then sweeps
+    //! the sorted list emitting each pair whose boxes overlap on every axis. The sweep is partitioned into batches
+    //! which run in parallel; the resulting pair list is sorted so that the output is deterministic.
+    //! The sweep axis is re-selected on each update as the axis of greatest variance in the box centers.
+    //! Example usage:
+    //! \code
+    //! sweep_and_prune<point2> sap;
+    //! for (auto const& s : spheres)
+    //!     sap.insert(make_swept_aabb(s, velocity, dt));
+    //! sap.update_pairs();
+    //! for (auto const& p : sap.get_pairs())
+    //!     ...
+    //! \endcode
+    template <typename Point>
+    class sweep_and_prune
+    {
+    public:
+
+        using point_type = Point;
+        using length_type = typename arithmetic_type_of<Point>::type;
+        using aabb_type = axis_aligned_bounding_box<Point>;
+        using pair_container = std::vector<broad_phase_pair>;
+        static const std::size_t dimension = dimension_of<Point>::value;
+
+        sweep_and_prune(std::size_t batchSize = 1024, std::size_t nThreads = get_default_concurrency())
+            : m_batchSize(batchSize)
+            , m_nThreads(nThreads)
+        {
+            GEOMETRIX_ASSERT(batchSize > 0);
+        }
+
+        //! Register a new box and return its proxy. Proxies of erased boxes are recycled.
+        broad_phase_proxy insert(const aabb_type& box)
+        {
+            broad_phase_proxy id;
+            if (!m_free.empty())
+            {
+                id = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                id = static_cast<broad_phase_proxy>(m_proxies.size());
+                m_proxies.emplace_back();
+            }
+
+            auto& p = m_proxies[id];
+            set_bounds(p, box);
+            p.active = true;
+            m_inserted.push_back(id);
+            return id;
+        }
+
+        //! Remove a box. Its proxy may be reused by insertions after the next call to update_pairs.
+        void erase(broad_phase_proxy id)
+        {
+            GEOMETRIX_ASSERT(is_active(id));
+            m_proxies[id].active = false;
+            m_erased.push_back(id);
+        }
+
+        //! Update the bounds of an existing box.
+        void update(broad_phase_proxy id, const aabb_type& box)
+        {
+            GEOMETRIX_ASSERT(is_active(id));
+            set_bounds(m_proxies[id], box);
+        }
+
+        bool is_active(broad_phase_proxy id) const { return id < m_proxies.size() && m_proxies[id].active; }
+
+        std::size_t size() const { return m_proxies.size() - m_free.size() - m_erased.size(); }
+
+        aabb_type get_bounds(broad_phase_proxy id) const
+        {
+            GEOMETRIX_ASSERT(is_active(id));
+            using indices = std::make_index_sequence<dimension>;
+            auto const& p = m_proxies[id];
+            return aabb_type(broad_phase_detail::from_array<Point>(p.lo, indices{}), broad_phase_detail::from_array<Point>(p.hi, indices{}));
+        }
+
+        std::size_t get_sweep_axis() const { return m_axis; }
+
+        //! Bring the sorted order up to date with the current bounds and recompute the overlapping pairs.
+        const pair_container& update_pairs()
+        {
+            sort_proxies();
+            sweep();
+            return m_pairs;
+        }
+
+        //! The pairs found by the last call to update_pairs sorted lexicographically.
+        const pair_container& get_pairs() const { return m_pairs; }
+
+    private:
+
+        using bounds_t = std::array<length_type, dimension_of<Point>::value>;
+
+        struct proxy
+        {
+            bounds_t lo;
+            bounds_t hi;
+            bool active{ false };
+        };
+
+        void set_bounds(proxy& p, const aabb_type& box)
+        {
+            using indices = std::make_index_sequence<dimension>;
+            p.lo = broad_phase_detail::to_array(box.get_lower_bound(), indices{});
+            p.hi = broad_phase_detail::to_array(box.get_upper_bound(), indices{});
+        }
+
+        static bool overlaps(const bounds_t& alo, const bounds_t& ahi, const bounds_t& blo, const bounds_t& bhi)
+        {
+            for (std::size_t d = 0; d < dimension; ++d)
+                if (ahi[d] < blo[d] || bhi[d] < alo[d])
+                    return false;
+            return true;
+        }
+
+        std::size_t select_axis() const
+        {
+            //! Pick the axis along which the box centers are most spread out, as this minimizes the overlap on the sweep axis.
+            if (m_order.size() < 2)
+                return m_axis;
+
+            std::array<double, dimension> sum = {}, sum2 = {};
+            for (auto id : m_order)
+            {
+                auto const& p = m_proxies[id];
+                for (std::size_t d = 0; d < dimension; ++d)
+                {
+                    auto c = 0.5 * construct<double>(p.lo[d] + p.hi[d]);
+                    sum[d] += c;
+                    sum2[d] += c * c;
+                }
+            }
+
+            auto n = static_cast<double>(m_order.size());
+            std::array<double, dimension> variance;
+            for (std::size_t d = 0; d < dimension; ++d)
+                variance[d] = sum2[d] - sum[d] * sum[d] / n;
+            auto best = static_cast<std::size_t>(std::max_element(variance.begin(), variance.end()) - variance.begin());
+
+            //! Only switch when the improvement is substantial since switching costs a full sort.
+            return variance[best] > 2.0 * variance[m_axis] ? best : m_axis;
+        }
+
+        void sort_proxies()
+        {
+            if (!m_erased.empty())
+            {
+                m_order.erase(std::remove_if(m_order.begin(), m_order.end(), [this](broad_phase_proxy id) { return !m_proxies[id].active; }), m_order.end());
+                m_inserted.erase(std::remove_if(m_inserted.begin(), m_inserted.end(), [this](broad_phase_proxy id) { return !m_proxies[id].active; }), m_inserted.end());
+                m_free.insert(m_free.end(), m_erased.begin(), m_erased.end());
+                m_erased.clear();
+            }
+
+            auto less = [this](broad_phase_proxy a, broad_phase_proxy b)
+            {
+                return m_proxies[a].lo[m_axis] < m_proxies[b].lo[m_axis];
+            };
+
+            auto axis = select_axis();
+            if (axis != m_axis)
+            {
+                m_axis = axis;
+                std::sort(m_order.begin(), m_order.end(), less);
+            }
+            else
+            {
+                //! Insertion sort exploits the temporal coherence of the ordering. Fall back to a full sort if the order has been scrambled.
+                std::size_t swaps = 0;
+                auto const maxSwaps = 4 * m_order.size() + 64;
+                for (std::size_t i = 1; i < m_order.size() && swaps <= maxSwaps; ++i)
+                {
+                    auto id = m_order[i];
+                    auto j = i;
+                    for (; j > 0 && less(id, m_order[j - 1]); --j, ++swaps)
+                        m_order[j] = m_order[j - 1];
+                    m_order[j] = id;
+                }
+
+                if (swaps > maxSwaps)
+                    std::sort(m_order.begin(), m_order.end(), less);
+            }
+
+            if (!m_inserted.empty())
+            {
+                std::sort(m_inserted.begin(), m_inserted.end(), less);
+                auto mid = m_order.size();
+                m_order.insert(m_order.end(), m_inserted.begin(), m_inserted.end());
+                std::inplace_merge(m_order.begin(), m_order.begin() + mid, m_order.end(), less);
+                m_inserted.clear();
+            }
+        }
+
+        void sweep()
+        {
+            auto nBatches = get_number_batches(m_order.size(), m_batchSize);
+            std::vector<pair_container> batches(nBatches);
+            auto const axis = m_axis;
+            parallel_for_batches(m_order.size(), m_batchSize, [&, this](std::size_t b, std::size_t begin, std::size_t end)
+            {
+                auto& out = batches[b];
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto const& a = m_proxies[m_order[i]];
+                    for (auto j = i + 1; j < m_order.size(); ++j)
+                    {
+                        auto const& c = m_proxies[m_order[j]];
+                        if (a.hi[axis] < c.lo[axis])
+                            break;
+                        if (overlaps(a.lo, a.hi, c.lo, c.hi))
+                            out.push_back(make_pair(m_order[i], m_order[j]));
+                    }
+                }
+            }, m_nThreads);
+
+            m_pairs.clear();
+            for (auto const& out : batches)
+                m_pairs.insert(m_pairs.end(), out.begin(), out.end());
+            std::sort(m_pairs.begin(), m_pairs.end());
+        }
+
+        static broad_phase_pair make_pair(broad_phase_proxy a, broad_phase_proxy b)
+        {
+            return a < b ? broad_phase_pair{ a, b } : broad_phase_pair{ b, a };
+        }
+
+        std::vector<proxy> m_proxies;
+        std::vector<broad_phase_proxy> m_order;
+        std::vector<broad_phase_proxy> m_inserted;
+        std::vector<broad_phase_proxy> m_free;
+        std::vector<broad_phase_proxy> m_erased;
+        pair_container m_pairs;
+        std::size_t m_axis{ 0 };
+        std::size_t m_batchSize;
+        std::size_t m_nThreads;
+    };
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_BROAD_PHASE_SWEEP_AND_PRUNE_HPP
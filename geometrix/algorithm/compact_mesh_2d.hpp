@@ -0,0 +1,306 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_COMPACT_MESH_2D_HPP
+#define GEOMETRIX_ALGORITHM_COMPACT_MESH_2D_HPP
+#pragma once
+
+#include <geometrix/algorithm/mesh_2d.hpp>
+#include <geometrix/algorithm/space_filling_curve.hpp>
+
+#include <boost/optional.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//! A read-only copy of a mesh_2d in about a third of the memory. Triangles and adjacency are stored as 32 bit indices, the
+//! triangle coordinates are fetched from the vertices instead of being duplicated per triangle and the triangle cache is a
+//! flat array of cell offsets into one array of 32 bit triangle indices. The vertices may also be quantized relative to
+//! the mesh bounds. The mesh has the query interface of mesh_2d so find_triangle and mesh_search visitors such as
+//! visible_vertices_mesh_search run on it unchanged.
+namespace geometrix {
+
+    //! \brief Vertex storage for compact_mesh_2d which keeps the coordinates as they are.
+    template <typename CoordinateType>
+    class full_vertex_storage
+    {
+    public:
+
+        using coordinate_t = CoordinateType;
+        using point_t = point<coordinate_t, 2>;
+
+        template <typename Points>
+        explicit full_vertex_storage(const Points& points)
+        {
+            m_points.reserve(points.size());
+            for (auto const& p : points)
+                m_points.push_back(construct<point_t>(p));
+        }
+
+        std::size_t size() const { return m_points.size(); }
+        const point_t& get_point(std::size_t i) const { return m_points[i]; }
+        std::size_t get_memory_usage() const { return m_points.capacity() * sizeof(point_t); }
+
+    private:
+
+        std::vector<point_t> m_points;
+
+    };
+
+    //! \brief Vertex storage for compact_mesh_2d which rounds the coordinates to a grid over the bounds of the vertices.
+
+    //! The grid has 2^bits - 1 steps of get_resolution() along the longer side of the bounds, where bits is the width of
+    //! Integer, so each coordinate moves by at most half a step. The resolution should be well below the smallest feature
+    //! of the mesh; vertices which round to the same grid point make their triangles degenerate.
+    template <typename CoordinateType, typename Integer = std::uint32_t>
+    class quantized_vertex_storage
+    {
+    public:
+
+        using coordinate_t = CoordinateType;
+        using point_t = point<coordinate_t, 2>;
+
+        template <typename Points>
+        explicit quantized_vertex_storage(const Points& points)
+        {
+            using std::round;
+
+            double xmin = (std::numeric_limits<double>::max)(), ymin = xmin, xmax = -xmin, ymax = -xmin;
+            for (auto const& p : points)
+            {
+                double x = get<0>(p), y = get<1>(p);
+                xmin = (std::min)(xmin, x), xmax = (std::max)(xmax, x);
+                ymin = (std::min)(ymin, y), ymax = (std::max)(ymax, y);
+            }
+
+            const double steps = static_cast<double>((std::numeric_limits<Integer>::max)());
+            auto extent = (std::max)(xmax - xmin, ymax - ymin);
+            m_xmin = xmin, m_ymin = ymin;
+            m_step = extent > 0 ? extent / steps : 1.0;
+
+            m_points.reserve(points.size());
+            for (auto const& p : points)
+            {
+                auto qx = (std::min)((std::max)(round((static_cast<double>(get<0>(p)) - xmin) / m_step), 0.0), steps);
+                auto qy = (std::min)((std::max)(round((static_cast<double>(get<1>(p)) - ymin) / m_step), 0.0), steps);
+                m_points.push_back({ { static_cast<Integer>(qx), static_cast<Integer>(qy) } });
+            }
+        }
+
+        std::size_t size() const { return m_points.size(); }
+        point_t get_point(std::size_t i) const { return construct<point_t>(m_xmin + m_points[i][0] * m_step, m_ymin + m_points[i][1] * m_step); }
+        std::size_t get_memory_usage() const { return m_points.capacity() * sizeof(std::array<Integer, 2>); }
+
+        //! The distance between neighbouring grid points.
+        double get_resolution() const { return m_step; }
+
+    private:
+
+        std::vector<std::array<Integer, 2>> m_points;
+        double m_xmin;
+        double m_ymin;
+        double m_step;
+
+    };
+
+    //! \brief A read-only mesh_2d with 32 bit indices and no duplicated triangle coordinates.
+
+    //! Built from a mesh_2d it keeps the triangle and vertex numbering, so indices from one are valid in the other. With
+    //! full_vertex_storage the triangle cache is built the same way as the default mesh_2d cache and the queries give the
+    //! same results as the mesh. Triangles and vertices are returned by value. Random sampling is left to mesh_2d.
+    template <typename CoordinateType, typename VertexStorage = full_vertex_storage<CoordinateType>>
+    class compact_mesh_2d
+    {
+    public:
+
+        using coordinate_t = CoordinateType;
+        using point_t = point<coordinate_t, 2>;
+        using vector_t = vector<coordinate_t, 2>;
+        using vertex_storage_t = VertexStorage;
+        using index_t = std::uint32_t;
+
+        static constexpr index_t no_index = 0xFFFFFFFFu;
+
+        template <typename Traits>
+        explicit compact_mesh_2d(const mesh_2d<coordinate_t, Traits>& mesh, coordinate_t cellSize = construct<coordinate_t>(1.0))
+            : m_vertices(mesh.get_vertices())
+        {
+            if (mesh.get_number_vertices() >= no_index || mesh.get_number_triangles() >= no_index)
+                throw std::length_error("mesh_2d is too large for 32 bit indices.");
+
+            const auto none = (std::numeric_limits<std::size_t>::max)();
+            auto const& adjMatrix = mesh.get_adjacency_matrix();
+            m_indices.resize(mesh.get_number_triangles());
+            m_adjacency.resize(mesh.get_number_triangles());
+            for (std::size_t i = 0; i < m_indices.size(); ++i)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    m_indices[i][k] = static_cast<index_t>(mesh.get_triangle_indices(i)[k]);
+                    m_adjacency[i][k] = adjMatrix[i][k] == none ? no_index : static_cast<index_t>(adjMatrix[i][k]);
+                }
+            }
+
+            if (!m_indices.empty())
+                build_cache(cellSize);
+        }
+
+        std::size_t get_number_triangles() const { return m_indices.size(); }
+        std::size_t get_number_vertices() const { return m_vertices.size(); }
+
+        point_t get_vertex(std::size_t i) const { return m_vertices.get_point(i); }
+
+        std::array<std::size_t, 3> get_triangle_indices(std::size_t i) const
+        {
+            auto const& t = m_indices[i];
+            return {{ t[0], t[1], t[2] }};
+        }
+
+        std::array<point_t, 3> get_triangle_vertices(std::size_t i) const
+        {
+            auto const& t = m_indices[i];
+            return {{ m_vertices.get_point(t[0]), m_vertices.get_point(t[1]), m_vertices.get_point(t[2]) }};
+        }
+
+        //! The triangles across sides 0, 1 and 2 of triangle i (as in mesh_2d::get_adjacency_matrix()[i]).
+        std::array<std::size_t, 3> get_adjacent_triangles(std::size_t i) const
+        {
+            std::array<std::size_t, 3> r;
+            for (std::size_t k = 0; k < 3; ++k)
+                r[k] = m_adjacency[i][k] == no_index ? (std::numeric_limits<std::size_t>::max)() : m_adjacency[i][k];
+            return r;
+        }
+
+        const vertex_storage_t& get_vertex_storage() const { return m_vertices; }
+
+        //! The bytes held by the vertices, triangles, adjacency and triangle cache.
+        std::size_t get_memory_usage() const
+        {
+            return m_vertices.get_memory_usage() + (m_indices.capacity() + m_adjacency.capacity()) * sizeof(std::array<index_t, 3>) + (m_cellOffsets.capacity() + m_cellTriangles.capacity()) * sizeof(index_t);
+        }
+
+        template <typename Point, typename NumberComparisonPolicy>
+        boost::optional<std::size_t> find_triangle(const Point& p, const NumberComparisonPolicy& cmp) const
+        {
+            if (!m_traits || !m_traits->is_contained(p))
+                return boost::none;
+
+            auto cell = static_cast<std::size_t>(m_traits->get_y_index(get<1>(p))) * m_traits->get_width() + m_traits->get_x_index(get<0>(p));
+            for (auto i = m_cellOffsets[cell]; i < m_cellOffsets[cell + 1]; ++i)
+            {
+                std::size_t ti = m_cellTriangles[i];
+                const auto points = get_triangle_vertices(ti);
+                if (point_in_triangle(p, points[0], points[1], points[2], cmp))
+                    return ti;
+            }
+
+            return boost::none;
+        }
+
+        //! search the mesh graph in a DFS fashion.
+        template <typename MeshSearch >
+        void search(MeshSearch&& visitor) const
+        {
+            typedef typename remove_const_ref<MeshSearch>::type::edge_item edge_item;
+            std::vector<edge_item> Q;
+            Q.reserve(100);
+            Q.push_back(visitor.get_start());
+
+            while (!Q.empty())
+            {
+                edge_item item = Q.back();
+                Q.pop_back();
+
+                //! return value indicates if the search should continue.
+                if (!visitor.visit(item))
+                    return;
+
+                for (auto adjTrig : m_adjacency[item.get_triangle_index()])
+                {
+                    if (adjTrig != no_index && adjTrig != item.from)
+                    {
+                        boost::optional<edge_item> newItem = visitor.prepare_adjacent_traversal(adjTrig, item);
+                        if (newItem)
+                            Q.push_back(*newItem);
+                    }
+                }
+            }
+        }
+
+    private:
+
+        //! Bin the triangles into the cells of a grid over the (stored) vertices padded as in triangle_grid_cache. The
+        //! (cell, triangle) pairs are radix sorted by cell which keeps the triangles of a cell in ascending order.
+        void build_cache(coordinate_t cellSize)
+        {
+            std::vector<point_t> points;
+            points.reserve(m_vertices.size());
+            for (std::size_t i = 0; i < m_vertices.size(); ++i)
+                points.push_back(m_vertices.get_point(i));
+
+            auto bounds = get_bounds(points, absolute_tolerance_comparison_policy<coordinate_t>(constants::zero<coordinate_t>()));
+            point_t lowerLeft(std::get<e_xmin>(bounds), std::get<e_ymin>(bounds));
+            point_t upperRight(std::get<e_xmax>(bounds), std::get<e_ymax>(bounds));
+            const auto offset = constants::sqrt_2<coordinate_t>();
+            lowerLeft = lowerLeft + offset * normalize(lowerLeft - upperRight);
+            upperRight = upperRight + offset * normalize(upperRight - lowerLeft);
+            std::get<e_xmin>(bounds) = lowerLeft[0], std::get<e_ymin>(bounds) = lowerLeft[1];
+            std::get<e_xmax>(bounds) = upperRight[0], std::get<e_ymax>(bounds) = upperRight[1];
+            m_traits.emplace(bounds, cellSize);
+            auto const& gTraits = *m_traits;
+
+            std::vector<std::pair<std::uint64_t, index_t>> entries;
+            coordinate_t xmin, xmax, ymin, ymax;
+            for (std::size_t i = 0; i < m_indices.size(); ++i)
+            {
+                auto trig = get_triangle_vertices(i);
+                std::tie(xmin, xmax, ymin, ymax) = get_bounds(trig, absolute_tolerance_comparison_policy<coordinate_t>(constants::zero<coordinate_t>()));
+                for (auto col = gTraits.get_x_index(xmin); col <= gTraits.get_x_index(xmax); ++col)
+                {
+                    for (auto row = gTraits.get_y_index(ymin); row <= gTraits.get_y_index(ymax); ++row)
+                    {
+                        axis_aligned_bounding_box<point_t> box(gTraits.get_cell_corner0(col, row), gTraits.get_cell_corner2(col, row));
+                        if (eberly_triangle_aabb_intersection_2d(trig[0], trig[1], trig[2], box, absolute_tolerance_comparison_policy<coordinate_t>(construct<coordinate_t>(1e-10))))
+                            entries.emplace_back(static_cast<std::uint64_t>(row) * gTraits.get_width() + col, static_cast<index_t>(i));
+                    }
+                }
+            }
+
+            if (entries.size() >= no_index)
+                throw std::length_error("mesh_2d triangle cache is too large for 32 bit indices.");
+            parallel_radix_sort(entries);
+
+            std::size_t nCells = static_cast<std::size_t>(gTraits.get_width()) * gTraits.get_height();
+            m_cellOffsets.assign(nCells + 1, 0);
+            m_cellTriangles.resize(entries.size());
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                ++m_cellOffsets[entries[i].first + 1];
+                m_cellTriangles[i] = entries[i].second;
+            }
+            for (std::size_t c = 0; c < nCells; ++c)
+                m_cellOffsets[c + 1] += m_cellOffsets[c];
+        }
+
+        vertex_storage_t                            m_vertices;
+        std::vector<std::array<index_t, 3>>         m_indices;
+        std::vector<std::array<index_t, 3>>         m_adjacency;
+        std::vector<index_t>                        m_cellOffsets;
+        std::vector<index_t>                        m_cellTriangles;
+        boost::optional<grid_traits<coordinate_t>>  m_traits;
+
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_COMPACT_MESH_2D_HPP
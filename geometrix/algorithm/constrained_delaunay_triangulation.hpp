@@ -0,0 +1,1099 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_CONSTRAINED_DELAUNAY_TRIANGULATION_HPP
+#define GEOMETRIX_CONSTRAINED_DELAUNAY_TRIANGULATION_HPP
+#pragma once
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/algorithm/mesh_2d.hpp>
+#include <geometrix/algorithm/space_filling_curve.hpp>
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/primitive/point_sequence_traits.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief The part of a constrained Delaunay triangulation which is kept by mark_domain.
+    enum class delaunay_domain
+    {
+        convex_hull //! All triangles inside the convex hull of the vertices.
+      , even_odd    //! Triangles separated from the exterior by an odd number of constraints (e.g. polygons with holes.)
+    };
+
+    namespace constrained_delaunay_triangulation_detail {
+
+        inline std::size_t ccw(std::size_t i) { return i == 2 ? 0 : i + 1; }
+        inline std::size_t cw(std::size_t i) { return i == 0 ? 2 : i - 1; }
+
+    }//! namespace constrained_delaunay_triangulation_detail;
+
+    //! \brief A constrained Delaunay triangulation of points and segments in the plane with Ruppert/Chew quality refinement.
+
+    //! Vertices are inserted incrementally with the Bowyer-Watson algorithm into a triangulation of a bounding triangle which
+    //! is far larger than the bounds given at construction. Batches of points are inserted in the order of a Hilbert curve so that
+    //! each point is located by a short walk from the previous one. Constraints are recovered by removing the triangles they cross
+    //! and retriangulating the two pseudo polygons on either side (Anglada). Constraints which cross each other are split at the
+    //! crossing. All decisions are made with the exact filtered_orientation and filtered_in_circle predicates so the
+    //! triangulation remains valid for degenerate input.
+    //!
+    //! Once constraints are in place, mark_domain selects the triangles which are kept and refine inserts Steiner points until no
+    //! triangle in the domain has an angle below the bound or an area above the bound.
+    template <typename CoordinateType>
+    class constrained_delaunay_triangulation
+    {
+    public:
+
+        using coordinate_type = CoordinateType;
+        using point_type = point<coordinate_type, 2>;
+        using vertex_handle = std::uint32_t;
+        using triangle_handle = std::uint32_t;
+        using mesh_type = mesh_2d<coordinate_type>;
+
+        static const std::uint32_t null_handle = static_cast<std::uint32_t>(-1);
+
+        //! Point sets with more points than this have their spatial sort keys computed in parallel batches of this size.
+        static const std::size_t batch_size = 16384;
+
+        //! Make the triangulation of the bounding triangle of a region. Vertices must lie well within a few times the size of the region.
+        constrained_delaunay_triangulation(const point_type& lowerBound, const point_type& upperBound)
+        {
+            using std::abs;
+
+            m_xmin = to_double(get<0>(lowerBound));
+            m_ymin = to_double(get<1>(lowerBound));
+            auto dx = to_double(get<0>(upperBound)) - m_xmin;
+            auto dy = to_double(get<1>(upperBound)) - m_ymin;
+            GEOMETRIX_ASSERT(!(dx < 0.0) && !(dy < 0.0));
+            m_extent = (std::max)((std::max)(dx, dy), std::numeric_limits<double>::min());
+
+            //! The bounding vertices are far enough away that they are outside the circumcircles of all but the most nearly
+            //! degenerate triangles of the region. This keeps the hull of the vertices convex in practice.
+            auto cx = m_xmin + 0.5 * dx;
+            auto cy = m_ymin + 0.5 * dy;
+            auto M = std::ldexp(m_extent, 20);
+            m_points.push_back(make_point(cx - 2.0 * M, cy - M));
+            m_points.push_back(make_point(cx + 2.0 * M, cy - M));
+            m_points.push_back(make_point(cx, cy + 2.0 * M));
+            m_vertexTriangles.assign(3, 0);
+            m_hint = create_triangle(0, 1, 2);
+        }
+
+        //! Insert a range of points in spatial order and return their handles in the order of the input. Coincident points share a handle.
+        template <typename Points>
+        std::vector<vertex_handle> insert_points(const Points& points, std::size_t nThreads = get_default_concurrency())
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            std::size_t n = points.size();
+            std::vector<std::pair<std::uint64_t, std::uint32_t>> order(n);
+            auto scale = 65535.0 / m_extent;
+            parallel_for_batches(n, batch_size, [&](std::size_t, std::size_t begin, std::size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto const& p = points[i];
+                    auto x = (std::min)((std::max)((to_double(get<0>(p)) - m_xmin) * scale, 0.0), 65535.0);
+                    auto y = (std::min)((std::max)((to_double(get<1>(p)) - m_ymin) * scale, 0.0), 65535.0);
+                    order[i] = std::make_pair(hilbert_encode_2d(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y), 16), static_cast<std::uint32_t>(i));
+                }
+            }, nThreads);
+            parallel_radix_sort(order, nThreads);
+
+            reserve(m_points.size() + n);
+            std::vector<vertex_handle> handles(n);
+            for (auto const& item : order)
+                handles[item.second] = insert_point(construct<point_type>(points[item.second]));
+            return handles;
+        }
+
+        //! Insert a point and return its handle. If the point coincides with a vertex the handle of the vertex is returned.
+        vertex_handle insert_point(const point_type& p)
+        {
+            triangle_handle t;
+            int edge, vertex;
+            std::tie(t, edge, vertex) = locate(p);
+            if (vertex >= 0)
+                return m_triangles[t][vertex];
+
+            auto v = add_vertex(p);
+            find_cavity(p, t, edge);
+            fill_cavity(v);
+            return v;
+        }
+
+        //! Insert the constrained edge between two vertices. Vertices which lie on the edge split it, as do other constraints which cross it.
+        void insert_constraint(vertex_handle a, vertex_handle b)
+        {
+            GEOMETRIX_ASSERT(a < m_points.size() && b < m_points.size());
+            while (a != b)
+                a = insert_constraint_part(a, b);
+        }
+
+        //! Insert the vertices and edges of a closed polygon as constraints.
+        template <typename Polygon>
+        void insert_polygon(const Polygon& poly, std::size_t nThreads = get_default_concurrency())
+        {
+            auto handles = insert_points(poly, nThreads);
+            for (std::size_t i = 0, j = handles.size() - 1; i < handles.size(); j = i++)
+                insert_constraint(handles[j], handles[i]);
+        }
+
+        //! Select the triangles of the domain. The edges on the boundary of the domain are constrained.
+        void mark_domain(delaunay_domain domain = delaunay_domain::even_odd)
+        {
+            std::vector<triangle_handle> current, next;
+            std::vector<std::uint8_t> visited(m_triangles.size(), 0);
+            for (triangle_handle t = 0; t < m_triangles.size(); ++t)
+            {
+                if (is_dead(t))
+                    continue;
+                m_flags[t] |= e_outside;
+                if (domain == delaunay_domain::convex_hull && !is_bounding_triangle(t))
+                    m_flags[t] &= ~e_outside;
+                if (domain == delaunay_domain::even_odd && is_bounding_triangle(t))
+                {
+                    visited[t] = 1;
+                    current.push_back(t);
+                }
+            }
+
+            //! Flood fill the regions between constraints from the outside in. Triangles at odd depths are inside.
+            for (std::size_t depth = 0; !current.empty(); ++depth)
+            {
+                while (!current.empty())
+                {
+                    auto t = current.back();
+                    current.pop_back();
+                    if (depth % 2 == 1)
+                        m_flags[t] &= ~e_outside;
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        auto n = m_adjacent[t][k];
+                        if (n == null_handle || visited[n])
+                            continue;
+                        visited[n] = 1;
+                        (is_constrained(t, k) ? next : current).push_back(n);
+                    }
+                }
+                std::swap(current, next);
+            }
+
+            //! Constrain the boundary of the domain so that refinement does not leave it.
+            for (triangle_handle t = 0; t < m_triangles.size(); ++t)
+            {
+                if (is_dead(t) || is_outside(t))
+                    continue;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto n = m_adjacent[t][k];
+                    if (n == null_handle || is_outside(n))
+                        set_constrained(t, k);
+                }
+            }
+        }
+
+        //! Insert Steiner points until no triangle in the domain has an angle less than minAngle (in radians, at most about 20 degrees
+        //! for guaranteed termination) or an area greater than maxArea. Subsegments of the constraints which are encroached are split
+        //! first. Triangles whose smallest angle is between two constraints are left as they are, but small input
+        //! angles can still make refinement run on, which maxSteinerPoints bounds. Call mark_domain first. Returns the number of
+        //! Steiner points inserted.
+        std::size_t refine(double minAngle, double maxArea = (std::numeric_limits<double>::max)(), std::size_t maxSteinerPoints = (std::numeric_limits<std::size_t>::max)())
+        {
+            using std::sin;
+
+            m_ratioBound = 1.0 / (2.0 * sin(minAngle));
+            m_maxArea = maxArea;
+            m_firstSteinerPoint = static_cast<vertex_handle>(m_points.size());
+            m_segmentQueue.clear();
+            m_triangleQueue.clear();
+            for (triangle_handle t = 0; t < m_triangles.size(); ++t)
+            {
+                if (is_dead(t) || is_outside(t))
+                    continue;
+                for (std::size_t k = 0; k < 3; ++k)
+                    if (is_constrained(t, k) && is_encroached(t, k))
+                        m_segmentQueue.push_back(get_edge(t, k));
+                if (is_bad(t))
+                    m_triangleQueue.push_back(triangle_key(t));
+            }
+
+            std::size_t nSteinerPoints = 0;
+            while (nSteinerPoints < maxSteinerPoints)
+            {
+                if (!m_segmentQueue.empty())
+                {
+                    auto e = m_segmentQueue.front();
+                    m_segmentQueue.pop_front();
+                    triangle_handle t;
+                    std::size_t k;
+                    if (!find_edge(e.first, e.second, t, k) || !is_constrained(t, k) || !is_encroached_from_either_side(t, k))
+                        continue;
+                    if (split_segment(t, k))
+                        ++nSteinerPoints;
+                }
+                else if (!m_triangleQueue.empty())
+                {
+                    auto key = m_triangleQueue.front();
+                    m_triangleQueue.pop_front();
+                    auto t = key.first;
+                    if (is_dead(t) || m_triangles[t] != key.second || is_outside(t) || !is_bad(t))
+                        continue;
+
+                    //! Try again after splitting the constraints which the circumcenter encroaches upon.
+                    auto n = split_triangle(t);
+                    nSteinerPoints += n;
+                    if (n > 0 && !is_dead(t) && m_triangles[t] == key.second)
+                        m_triangleQueue.push_back(key);
+                }
+                else
+                    break;
+            }
+
+            m_segmentQueue.clear();
+            m_triangleQueue.clear();
+            return nSteinerPoints;
+        }
+
+        //! The number of vertices excluding those of the bounding triangle.
+        std::size_t get_number_vertices() const { return m_points.size() - 3; }
+        const point_type& get_vertex(vertex_handle v) const { return m_points[v]; }
+
+        //! The number of triangles in the domain. Before mark_domain this is every triangle not incident to the bounding triangle.
+        std::size_t get_number_triangles() const
+        {
+            std::size_t n = 0;
+            for_each_triangle([&n](vertex_handle, vertex_handle, vertex_handle) { ++n; });
+            return n;
+        }
+
+        //! Visit the CCW triangles of the domain as visitor(a, b, c) with the vertex handles of the corners.
+        template <typename Visitor>
+        void for_each_triangle(Visitor&& visitor) const
+        {
+            for (triangle_handle t = 0; t < m_triangles.size(); ++t)
+                if (!is_dead(t) && !is_outside(t) && !is_bounding_triangle(t))
+                    visitor(m_triangles[t][0], m_triangles[t][1], m_triangles[t][2]);
+        }
+
+        //! Visit the constrained edges between triangles of the domain once each as visitor(a, b).
+        template <typename Visitor>
+        void for_each_constraint(Visitor&& visitor) const
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+            for (triangle_handle t = 0; t < m_triangles.size(); ++t)
+            {
+                if (is_dead(t) || is_outside(t) || is_bounding_triangle(t))
+                    continue;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto n = m_adjacent[t][k];
+                    bool owner = n == null_handle || is_outside(n) || is_bounding_triangle(n) || t < n;
+                    if (is_constrained(t, k) && owner)
+                        visitor(m_triangles[t][ccw(k)], m_triangles[t][cw(k)]);
+                }
+            }
+        }
+
+        //! Make a mesh of the triangles of the domain. The vertices of the mesh are those used by its triangles.
+        template <typename NumberComparisonPolicy>
+        mesh_type make_mesh(const NumberComparisonPolicy& cmp) const
+        {
+            std::vector<vertex_handle> remap(m_points.size(), null_handle);
+            typename mesh_type::point_container_t points;
+            std::vector<std::size_t> indices;
+            for_each_triangle([&](vertex_handle a, vertex_handle b, vertex_handle c)
+            {
+                for (auto v : { a, b, c })
+                {
+                    if (remap[v] == null_handle)
+                    {
+                        remap[v] = static_cast<vertex_handle>(points.size());
+                        points.push_back(m_points[v]);
+                    }
+                    indices.push_back(remap[v]);
+                }
+            });
+
+            return mesh_type(std::move(points), std::move(indices), cmp);
+        }
+
+    private:
+
+        enum flag : std::uint8_t
+        {
+            e_constrained = 7 //! Bit k is set when the edge opposite vertex k is constrained.
+          , e_outside = 8
+          , e_dead = 16
+        };
+
+        using edge_t = std::pair<vertex_handle, vertex_handle>;
+        using triangle_key_t = std::pair<triangle_handle, std::array<vertex_handle, 3>>;
+
+        struct cavity_edge
+        {
+            vertex_handle u, v;
+            triangle_handle outer;
+            std::uint8_t flags;
+        };
+
+        template <typename T>
+        static double to_double(const T& v) { return filtered_predicates_detail::to_double(v); }
+
+        static point_type make_point(double x, double y) { return point_type(construct<coordinate_type>(x), construct<coordinate_type>(y)); }
+
+        double x(vertex_handle v) const { return to_double(get<0>(m_points[v])); }
+        double y(vertex_handle v) const { return to_double(get<1>(m_points[v])); }
+
+        int orientation(vertex_handle a, vertex_handle b, vertex_handle c) const
+        {
+            return filtered_predicates_detail::orientation_sign(x(a), y(a), x(b), y(b), x(c), y(c));
+        }
+
+        int orientation(vertex_handle a, vertex_handle b, double px, double py) const
+        {
+            return filtered_predicates_detail::orientation_sign(x(a), y(a), x(b), y(b), px, py);
+        }
+
+        //! > 0 when p is strictly inside the circumcircle of triangle t.
+        int in_circle(triangle_handle t, double px, double py) const
+        {
+            auto const& v = m_triangles[t];
+            return filtered_predicates_detail::in_circle_sign(x(v[0]), y(v[0]), x(v[1]), y(v[1]), x(v[2]), y(v[2]), px, py);
+        }
+
+        bool is_dead(triangle_handle t) const { return (m_flags[t] & e_dead) != 0; }
+        bool is_outside(triangle_handle t) const { return (m_flags[t] & e_outside) != 0; }
+        bool is_constrained(triangle_handle t, std::size_t k) const { return (m_flags[t] & (1u << k)) != 0; }
+        bool is_bounding_triangle(triangle_handle t) const
+        {
+            auto const& v = m_triangles[t];
+            return v[0] < 3 || v[1] < 3 || v[2] < 3;
+        }
+
+        //! Constrain edge k of t on both sides.
+        void set_constrained(triangle_handle t, std::size_t k)
+        {
+            m_flags[t] |= static_cast<std::uint8_t>(1u << k);
+            auto n = m_adjacent[t][k];
+            if (n != null_handle)
+                m_flags[n] |= static_cast<std::uint8_t>(1u << neighbor_slot(n, t));
+        }
+
+        std::size_t neighbor_slot(triangle_handle t, triangle_handle n) const
+        {
+            auto const& a = m_adjacent[t];
+            std::size_t k = a[0] == n ? 0 : (a[1] == n ? 1 : 2);
+            GEOMETRIX_ASSERT(a[k] == n);
+            return k;
+        }
+
+        std::size_t vertex_slot(triangle_handle t, vertex_handle v) const
+        {
+            auto const& a = m_triangles[t];
+            std::size_t k = a[0] == v ? 0 : (a[1] == v ? 1 : 2);
+            GEOMETRIX_ASSERT(a[k] == v);
+            return k;
+        }
+
+        edge_t get_edge(triangle_handle t, std::size_t k) const
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+            return edge_t(m_triangles[t][ccw(k)], m_triangles[t][cw(k)]);
+        }
+
+        triangle_key_t triangle_key(triangle_handle t) const { return triangle_key_t(t, m_triangles[t]); }
+
+        void reserve(std::size_t nVertices)
+        {
+            m_points.reserve(nVertices);
+            m_vertexTriangles.reserve(nVertices);
+            m_triangles.reserve(2 * nVertices);
+            m_adjacent.reserve(2 * nVertices);
+            m_flags.reserve(2 * nVertices);
+            m_marks.reserve(2 * nVertices);
+        }
+
+        vertex_handle add_vertex(const point_type& p)
+        {
+            m_points.push_back(p);
+            m_vertexTriangles.push_back(null_handle);
+            return static_cast<vertex_handle>(m_points.size() - 1);
+        }
+
+        triangle_handle create_triangle(vertex_handle a, vertex_handle b, vertex_handle c, std::uint8_t flags = 0)
+        {
+            triangle_handle t;
+            if (!m_free.empty())
+            {
+                t = m_free.back();
+                m_free.pop_back();
+                m_triangles[t] = { a, b, c };
+                m_adjacent[t] = { null_handle, null_handle, null_handle };
+                m_flags[t] = flags;
+            }
+            else
+            {
+                t = static_cast<triangle_handle>(m_triangles.size());
+                m_triangles.push_back({ a, b, c });
+                m_adjacent.push_back({ null_handle, null_handle, null_handle });
+                m_flags.push_back(flags);
+                m_marks.push_back(0);
+            }
+
+            m_vertexTriangles[a] = m_vertexTriangles[b] = m_vertexTriangles[c] = t;
+            return t;
+        }
+
+        void destroy_triangle(triangle_handle t)
+        {
+            m_flags[t] = e_dead;
+            m_free.push_back(t);
+        }
+
+        //! Link the edge (u, v) of the new triangle t in slot k to the triangle n across it which has the edge (v, u).
+        void link_outer(triangle_handle t, std::size_t k, triangle_handle n)
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+            m_adjacent[t][k] = n;
+            if (n == null_handle)
+                return;
+            auto u = m_triangles[t][ccw(k)];
+            auto j = vertex_slot(n, u);
+            m_adjacent[n][ccw(j)] = t;
+        }
+
+        std::uint32_t random()
+        {
+            m_seed ^= m_seed << 13;
+            m_seed ^= m_seed >> 17;
+            m_seed ^= m_seed << 5;
+            return m_seed;
+        }
+
+        //! Walk from the last created triangle to the triangle containing p. Returns the triangle and the edge or vertex of it on which p lies (or -1.)
+        std::tuple<triangle_handle, int, int> locate(const point_type& p)
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            auto px = to_double(get<0>(p)), py = to_double(get<1>(p));
+            auto t = m_hint;
+            if (is_dead(t))
+                t = m_vertexTriangles[0];
+
+            //! A visibility walk starting from a random edge of each triangle which cannot cycle.
+            for (bool moved = true; moved;)
+            {
+                moved = false;
+                auto start = random() % 3;
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    auto k = (start + j) % 3;
+                    auto const& v = m_triangles[t];
+                    if (orientation(v[ccw(k)], v[cw(k)], px, py) < 0)
+                    {
+                        t = m_adjacent[t][k];
+                        GEOMETRIX_ASSERT(t != null_handle);
+                        moved = true;
+                        break;
+                    }
+                }
+            }
+
+            int edge = -1, vertex = -1, nZero = 0;
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                auto const& v = m_triangles[t];
+                if (orientation(v[ccw(k)], v[cw(k)], px, py) == 0)
+                {
+                    vertex = edge < 0 ? -1 : static_cast<int>(3 - k - edge);
+                    edge = static_cast<int>(k);
+                    ++nZero;
+                }
+            }
+
+            m_hint = t;
+            if (nZero > 1)
+                return std::make_tuple(t, -1, vertex);
+            return std::make_tuple(t, edge, -1);
+        }
+
+        //! Collect the triangles whose circumcircles contain p and which are connected to t without crossing a constraint.
+        //! If p lies on edge k of t the triangle across it is included and the edge is split. Returns false if p is not inside the cavity.
+        bool find_cavity(const point_type& p, triangle_handle t, int k)
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            auto px = to_double(get<0>(p)), py = to_double(get<1>(p));
+            ++m_epoch;
+            m_cavity.clear();
+            m_stack.clear();
+            m_splitEdge = edge_t(null_handle, null_handle);
+
+            m_marks[t] = m_epoch;
+            m_cavity.push_back(t);
+            m_stack.push_back(t);
+            if (k >= 0)
+            {
+                auto n = m_adjacent[t][k];
+                GEOMETRIX_ASSERT(n != null_handle);
+                if (is_constrained(t, k))
+                    m_splitEdge = get_edge(t, k);
+                m_marks[n] = m_epoch;
+                m_cavity.push_back(n);
+                m_stack.push_back(n);
+            }
+
+            while (!m_stack.empty())
+            {
+                auto c = m_stack.back();
+                m_stack.pop_back();
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    auto n = m_adjacent[c][j];
+                    if (n == null_handle || m_marks[n] == m_epoch || is_constrained(c, j))
+                        continue;
+                    if (in_circle(n, px, py) > 0)
+                    {
+                        m_marks[n] = m_epoch;
+                        m_cavity.push_back(n);
+                        m_stack.push_back(n);
+                    }
+                }
+            }
+
+            if (k >= 0)
+                return true;
+
+            for (auto c : m_cavity)
+            {
+                auto const& v = m_triangles[c];
+                if (orientation(v[1], v[2], px, py) >= 0 && orientation(v[2], v[0], px, py) >= 0 && orientation(v[0], v[1], px, py) >= 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        //! Replace the triangles of the cavity by a fan around the vertex v.
+        void fill_cavity(vertex_handle v)
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            m_boundary.clear();
+            for (auto c : m_cavity)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto n = m_adjacent[c][k];
+                    if (n != null_handle && m_marks[n] == m_epoch)
+                        continue;
+                    auto e = get_edge(c, k);
+                    auto flags = static_cast<std::uint8_t>((m_flags[c] & e_outside) | (is_constrained(c, k) ? 4 : 0));
+                    m_boundary.push_back(cavity_edge{ e.first, e.second, n, flags });
+                }
+            }
+
+            for (auto c : m_cavity)
+                destroy_triangle(c);
+
+            //! New triangles (u, w, v) with the boundary edge (u, w) opposite v in slot 2.
+            m_created.clear();
+            m_fan.clear();
+            for (auto const& b : m_boundary)
+            {
+                auto t = create_triangle(b.u, b.v, v, b.flags);
+                link_outer(t, 2, b.outer);
+                m_created.push_back(t);
+                m_fan.emplace_back(b.u, t);
+            }
+
+            std::sort(m_fan.begin(), m_fan.end());
+            for (auto t : m_created)
+            {
+                //! The edge (w, v) opposite u is shared with the triangle whose boundary edge starts at w.
+                auto w = m_triangles[t][1];
+                auto it = std::lower_bound(m_fan.begin(), m_fan.end(), std::make_pair(w, vertex_handle(0)));
+                GEOMETRIX_ASSERT(it != m_fan.end() && it->first == w);
+                auto n = it->second;
+                m_adjacent[t][0] = n;
+                m_adjacent[n][1] = t;
+                if (w == m_splitEdge.first || w == m_splitEdge.second)
+                {
+                    m_flags[t] |= 1;
+                    m_flags[n] |= 2;
+                }
+            }
+
+            m_hint = m_created.back();
+        }
+
+        //! Find the triangle t and slot k of the edge between u and v in either direction.
+        bool find_edge(vertex_handle u, vertex_handle v, triangle_handle& t, std::size_t& k) const
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            auto start = m_vertexTriangles[u];
+            t = start;
+            do
+            {
+                auto i = vertex_slot(t, u);
+                if (m_triangles[t][ccw(i)] == v)
+                {
+                    k = cw(i);
+                    return true;
+                }
+                if (m_triangles[t][cw(i)] == v)
+                {
+                    k = ccw(i);
+                    return true;
+                }
+                t = m_adjacent[t][ccw(i)];
+            } while (t != start && t != null_handle);
+
+            return false;
+        }
+
+        //! Insert the constraint from a towards b up to the first vertex on it and return that vertex.
+        vertex_handle insert_constraint_part(vertex_handle a, vertex_handle b)
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+
+            auto bx = x(b), by = y(b);
+            auto dot = [&](vertex_handle u) { return (x(u) - x(a)) * (bx - x(a)) + (y(u) - y(a)) * (by - y(a)); };
+
+            //! Rotate around a to find the edge ab or the triangle through which it leaves a.
+            triangle_handle t = m_vertexTriangles[a];
+            vertex_handle r = null_handle, l = null_handle;
+            for (;;)
+            {
+                auto i = vertex_slot(t, a);
+                auto u = m_triangles[t][ccw(i)], w = m_triangles[t][cw(i)];
+                if (u == b || w == b)
+                {
+                    set_constrained(t, u == b ? cw(i) : ccw(i));
+                    return b;
+                }
+
+                auto ou = orientation(a, b, u), ow = orientation(a, b, w);
+                if (ou == 0 && dot(u) > 0)
+                {
+                    set_constrained(t, cw(i));
+                    return u;
+                }
+                if (ow == 0 && dot(w) > 0)
+                {
+                    set_constrained(t, ccw(i));
+                    return w;
+                }
+                if (ou < 0 && ow > 0)
+                {
+                    r = u;
+                    l = w;
+                    break;
+                }
+
+                t = m_adjacent[t][ccw(i)];
+                GEOMETRIX_ASSERT(t != null_handle && t != m_vertexTriangles[a]);
+            }
+
+            //! Walk the triangles crossed by ab collecting the vertices on either side.
+            m_crossed.assign(1, t);
+            m_left.assign(1, l);
+            m_right.assign(1, r);
+            vertex_handle e;
+            for (;;)
+            {
+                auto k = 3 - vertex_slot(t, r) - vertex_slot(t, l);
+                if (is_constrained(t, k))
+                {
+                    //! Split the constraint which is crossed at the crossing.
+                    auto rx = x(r), ry = y(r), lx = x(l), ly = y(l);
+                    auto ax = x(a), ay = y(a);
+                    auto denom = (bx - ax) * (ly - ry) - (by - ay) * (lx - rx);
+                    auto s = ((rx - ax) * (ly - ry) - (ry - ay) * (lx - rx)) / denom;
+                    auto p = make_point(ax + s * (bx - ax), ay + s * (by - ay));
+                    auto q = add_vertex(p);
+                    find_cavity(p, t, static_cast<int>(k));
+                    fill_cavity(q);
+                    insert_constraint(a, q);
+                    return q;
+                }
+
+                auto n = m_adjacent[t][k];
+                GEOMETRIX_ASSERT(n != null_handle);
+                auto v = m_triangles[n][neighbor_slot(n, t)];
+                m_crossed.push_back(n);
+                t = n;
+                if (v == b)
+                {
+                    e = b;
+                    break;
+                }
+
+                auto o = orientation(a, b, v);
+                if (o == 0)
+                {
+                    e = v;
+                    break;
+                }
+                if (o < 0)
+                {
+                    m_right.push_back(v);
+                    r = v;
+                }
+                else
+                {
+                    m_left.push_back(v);
+                    l = v;
+                }
+            }
+
+            //! Record the edges around the crossed triangles with the triangles outside of them.
+            ++m_epoch;
+            for (auto c : m_crossed)
+                m_marks[c] = m_epoch;
+
+            std::unordered_map<std::uint64_t, triangle_handle> outer;
+            auto key = [](vertex_handle u, vertex_handle v) { return (static_cast<std::uint64_t>(u) << 32) | v; };
+            std::uint8_t flags = 0;
+            for (auto c : m_crossed)
+            {
+                flags = m_flags[c] & e_outside;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto n = m_adjacent[c][k];
+                    if (n != null_handle && m_marks[n] == m_epoch)
+                        continue;
+                    auto edge = get_edge(c, k);
+                    outer[key(edge.first, edge.second)] = n;
+                    if (is_constrained(c, k))
+                        m_constrainedOuter.push_back(edge);
+                }
+            }
+
+            for (auto c : m_crossed)
+                destroy_triangle(c);
+
+            //! Retriangulate the pseudo polygons on the left and right of ae.
+            m_created.clear();
+            std::reverse(m_left.begin(), m_left.end());
+            triangulate_pseudo_polygon(a, e, m_left, 0, m_left.size(), flags);
+            triangulate_pseudo_polygon(e, a, m_right, 0, m_right.size(), flags);
+
+            std::unordered_map<std::uint64_t, std::pair<triangle_handle, std::size_t>> inner;
+            for (auto c : m_created)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto edge = get_edge(c, k);
+                    auto it = outer.find(key(edge.first, edge.second));
+                    if (it != outer.end())
+                    {
+                        link_outer(c, k, it->second);
+                        continue;
+                    }
+
+                    auto twin = inner.find(key(edge.second, edge.first));
+                    if (twin != inner.end())
+                    {
+                        m_adjacent[c][k] = twin->second.first;
+                        m_adjacent[twin->second.first][twin->second.second] = c;
+                        inner.erase(twin);
+                    }
+                    else
+                        inner[key(edge.first, edge.second)] = std::make_pair(c, k);
+                }
+            }
+
+            //! Restore the constraints on the boundary and add the new one.
+            for (auto const& edge : m_constrainedOuter)
+            {
+                triangle_handle c;
+                std::size_t k;
+                if (find_edge(edge.first, edge.second, c, k))
+                    set_constrained(c, k);
+            }
+            m_constrainedOuter.clear();
+
+            triangle_handle c;
+            std::size_t k;
+            if (find_edge(a, e, c, k))
+                set_constrained(c, k);
+            else
+                GEOMETRIX_ASSERT(false);
+
+            m_hint = m_created.back();
+            return e;
+        }
+
+        //! Triangulate the pseudo polygon u, v, P[first], ..., P[last - 1] in CCW order with the edge uv.
+        void triangulate_pseudo_polygon(vertex_handle u, vertex_handle v, const std::vector<vertex_handle>& P, std::size_t first, std::size_t last, std::uint8_t flags)
+        {
+            if (first == last)
+                return;
+
+            auto ci = first;
+            for (auto i = first + 1; i < last; ++i)
+            {
+                auto c = P[ci], p = P[i];
+                if (filtered_predicates_detail::in_circle_sign(x(u), y(u), x(v), y(v), x(c), y(c), x(p), y(p)) > 0)
+                    ci = i;
+            }
+
+            auto c = P[ci];
+            m_created.push_back(create_triangle(u, v, c, flags));
+            triangulate_pseudo_polygon(c, v, P, first, ci, flags);
+            triangulate_pseudo_polygon(u, c, P, ci + 1, last, flags);
+        }
+
+        double area(triangle_handle t) const
+        {
+            auto const& v = m_triangles[t];
+            return 0.5 * ((x(v[1]) - x(v[0])) * (y(v[2]) - y(v[0])) - (y(v[1]) - y(v[0])) * (x(v[2]) - x(v[0])));
+        }
+
+        double length_sqrd(vertex_handle a, vertex_handle b) const
+        {
+            auto dx = x(b) - x(a), dy = y(b) - y(a);
+            return dx * dx + dy * dy;
+        }
+
+        //! A triangle is bad if its circumradius to shortest edge ratio exceeds the bound or it is too large. Triangles whose
+        //! smallest angle is between two constraints cannot be improved, nor can those with edges at the resolution of the coordinates.
+        bool is_bad(triangle_handle t) const
+        {
+            using namespace constrained_delaunay_triangulation_detail;
+            using std::sqrt;
+
+            if (is_bounding_triangle(t))
+                return false;
+
+            auto const& v = m_triangles[t];
+            double l[3] = { length_sqrd(v[1], v[2]), length_sqrd(v[2], v[0]), length_sqrd(v[0], v[1]) };
+            auto a = area(t);
+            if (a > m_maxArea)
+                return true;
+
+            std::size_t k = l[0] < l[1] ? (l[0] < l[2] ? 0 : 2) : (l[1] < l[2] ? 1 : 2);
+            if (l[k] < min_length_sqrd() || (is_constrained(t, ccw(k)) && is_constrained(t, cw(k))))
+                return false;
+
+            //! R / lmin = l0 l1 l2 / (4 A lmin).
+            auto ratio = sqrt(l[0] * l[1] * l[2] / l[k]) / (4.0 * a);
+            return ratio > m_ratioBound;
+        }
+
+        bool is_encroached(vertex_handle u, vertex_handle v, double px, double py) const
+        {
+            return (x(u) - px) * (x(v) - px) + (y(u) - py) * (y(v) - py) < 0.0;
+        }
+
+        //! True if the vertex opposite edge k of t is inside its diametral circle.
+        bool is_encroached(triangle_handle t, std::size_t k) const
+        {
+            auto e = get_edge(t, k);
+            auto p = m_triangles[t][k];
+            return is_encroached(e.first, e.second, x(p), y(p));
+        }
+
+        bool is_encroached_from_either_side(triangle_handle t, std::size_t k) const
+        {
+            if (!is_outside(t) && is_encroached(t, k))
+                return true;
+            auto n = m_adjacent[t][k];
+            return n != null_handle && !is_outside(n) && is_encroached(n, neighbor_slot(n, t));
+        }
+
+        //! Segments shorter than this are not split.
+        double min_length_sqrd() const
+        {
+            auto l = std::ldexp(m_extent, -40);
+            return l * l;
+        }
+
+        //! Split the constrained edge k of t. A subsegment with one input vertex is split on the circle about that vertex with the
+        //! power of two radius nearest to half its length (Ruppert's concentric shells) so that the subsegments of two constraints
+        //! meeting at a small angle are split at matching distances and do not encroach upon each other indefinitely.
+        bool split_segment(triangle_handle t, std::size_t k)
+        {
+            using std::sqrt;
+
+            auto e = get_edge(t, k);
+            auto l2 = length_sqrd(e.first, e.second);
+            if (l2 < 4.0 * min_length_sqrd())
+                return false;
+
+            auto s = 0.5;
+            bool firstIsInput = e.first < m_firstSteinerPoint, secondIsInput = e.second < m_firstSteinerPoint;
+            if (firstIsInput != secondIsInput)
+            {
+                auto l = sqrt(l2);
+                auto r = std::ldexp(1.0, static_cast<int>(std::floor(std::log2(0.5 * l) + 0.5)));
+                s = firstIsInput ? r / l : 1.0 - r / l;
+            }
+
+            auto p = make_point(x(e.first) + s * (x(e.second) - x(e.first)), y(e.first) + s * (y(e.second) - y(e.first)));
+            auto v = add_vertex(p);
+            find_cavity(p, t, static_cast<int>(k));
+            fill_cavity(v);
+            enqueue_created();
+            return true;
+        }
+
+        //! Insert the circumcenter of t unless it encroaches upon constraints in which case those are split instead. Returns the
+        //! number of vertices inserted which is zero if the circumcenter cannot be inserted.
+        std::size_t split_triangle(triangle_handle t)
+        {
+            auto const& v = m_triangles[t];
+            auto ax = x(v[0]), ay = y(v[0]);
+            auto bx = x(v[1]) - ax, by = y(v[1]) - ay;
+            auto cx = x(v[2]) - ax, cy = y(v[2]) - ay;
+            auto d = 2.0 * (bx * cy - by * cx);
+            auto b2 = bx * bx + by * by, c2 = cx * cx + cy * cy;
+            auto p = make_point(ax + (cy * b2 - by * c2) / d, ay + (bx * c2 - cx * b2) / d);
+            auto px = to_double(get<0>(p)), py = to_double(get<1>(p));
+
+            //! A circumcenter outside of the cavity is beyond a constraint of it.
+            bool inside = find_cavity(p, t, -1);
+            m_encroached.clear();
+            for (auto c : m_cavity)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    if (!is_constrained(c, k))
+                        continue;
+                    auto e = get_edge(c, k);
+                    if (is_encroached(e.first, e.second, px, py) || (!inside && orientation(e.first, e.second, px, py) < 0))
+                        m_encroached.push_back(e);
+                }
+            }
+
+            if (m_encroached.empty())
+            {
+                if (!inside)
+                    return 0;
+                fill_cavity(add_vertex(p));
+                enqueue_created();
+                return 1;
+            }
+
+            std::size_t n = 0;
+            for (auto const& e : m_encroached)
+            {
+                triangle_handle c;
+                std::size_t k;
+                if (find_edge(e.first, e.second, c, k) && is_constrained(c, k) && split_segment(c, k))
+                    ++n;
+            }
+            return n;
+        }
+
+        //! Queue the new triangles which are bad and the constraints around them which are encroached.
+        void enqueue_created()
+        {
+            for (auto t : m_created)
+            {
+                if (is_outside(t))
+                    continue;
+                for (std::size_t k = 0; k < 3; ++k)
+                    if (is_constrained(t, k) && is_encroached_from_either_side(t, k))
+                        m_segmentQueue.push_back(get_edge(t, k));
+                if (is_bad(t))
+                    m_triangleQueue.push_back(triangle_key(t));
+            }
+        }
+
+        double m_xmin{ 0 };
+        double m_ymin{ 0 };
+        double m_extent{ 1 };
+        std::vector<point_type> m_points;
+        std::vector<triangle_handle> m_vertexTriangles;
+        std::vector<std::array<vertex_handle, 3>> m_triangles;
+        std::vector<std::array<triangle_handle, 3>> m_adjacent;   //! The triangle across the edge opposite each vertex.
+        std::vector<std::uint8_t> m_flags;
+        std::vector<std::uint32_t> m_marks;
+        std::vector<triangle_handle> m_free;
+        std::uint32_t m_epoch{ 0 };
+        std::uint32_t m_seed{ 2463534242u };
+        triangle_handle m_hint{ 0 };
+
+        //! Scratch space for insertion.
+        std::vector<triangle_handle> m_cavity;
+        std::vector<triangle_handle> m_stack;
+        std::vector<cavity_edge> m_boundary;
+        std::vector<triangle_handle> m_created;
+        std::vector<std::pair<vertex_handle, triangle_handle>> m_fan;
+        edge_t m_splitEdge;
+        std::vector<triangle_handle> m_crossed;
+        std::vector<vertex_handle> m_left;
+        std::vector<vertex_handle> m_right;
+        std::vector<edge_t> m_constrainedOuter;
+        std::vector<edge_t> m_encroached;
+
+        //! Refinement state.
+        double m_ratioBound{ 0 };
+        double m_maxArea{ 0 };
+        vertex_handle m_firstSteinerPoint{ 0 };
+        std::deque<edge_t> m_segmentQueue;
+        std::deque<triangle_key_t> m_triangleQueue;
+
+    };
+
+    template <typename CoordinateType>
+    const std::uint32_t constrained_delaunay_triangulation<CoordinateType>::null_handle;
+
+    template <typename CoordinateType>
+    const std::size_t constrained_delaunay_triangulation<CoordinateType>::batch_size;
+
+    //! Make the constrained Delaunay triangulation of a polygon with holes as a mesh. If minAngle is positive the mesh is refined
+    //! until no triangle has a smaller angle (in radians) or an area greater than maxArea, inserting at most maxSteinerPoints.
+    template <typename Polygon, typename Holes, typename NumberComparisonPolicy>
+    inline mesh_2d<typename geometric_traits<typename point_sequence_traits<Polygon>::point_type>::arithmetic_type> make_delaunay_mesh(const Polygon& outer, const Holes& holes, const NumberComparisonPolicy& cmp, double minAngle = 0.0, double maxArea = (std::numeric_limits<double>::max)(), std::size_t maxSteinerPoints = (std::numeric_limits<std::size_t>::max)())
+    {
+        using access = point_sequence_traits<Polygon>;
+        using coordinate_t = typename geometric_traits<typename access::point_type>::arithmetic_type;
+        using cdt_t = constrained_delaunay_triangulation<coordinate_t>;
+        using point_t = typename cdt_t::point_type;
+
+        GEOMETRIX_ASSERT(!access::empty(outer));
+        auto const& p0 = access::get_point(outer, 0);
+        auto xmin = get<0>(p0), xmax = xmin, ymin = get<1>(p0), ymax = ymin;
+        for (std::size_t i = 1, size = access::size(outer); i < size; ++i)
+        {
+            auto const& p = access::get_point(outer, i);
+            xmin = (std::min)(xmin, get<0>(p));
+            xmax = (std::max)(xmax, get<0>(p));
+            ymin = (std::min)(ymin, get<1>(p));
+            ymax = (std::max)(ymax, get<1>(p));
+        }
+
+        cdt_t cdt(point_t(xmin, ymin), point_t(xmax, ymax));
+        cdt.insert_polygon(outer);
+        for (auto const& hole : holes)
+            cdt.insert_polygon(hole);
+        cdt.mark_domain(delaunay_domain::even_odd);
+        if (minAngle > 0.0 || maxArea < (std::numeric_limits<double>::max)())
+            cdt.refine(minAngle, maxArea, maxSteinerPoints);
+        return cdt.make_mesh(cmp);
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_CONSTRAINED_DELAUNAY_TRIANGULATION_HPP
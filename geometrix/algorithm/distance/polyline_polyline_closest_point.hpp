@@ -15,6 +15,8 @@
 #include <geometrix/algorithm/distance/aabb_aabb_distance.hpp>
 #include <geometrix/primitive/point_sequence_utilities.hpp>
 
+#include <queue>
+
 namespace geometrix {
     namespace result_of {
         template <typename Polyline1, typename Polyline2>
@@ -0,0 +1,463 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_POLYLINE_SIMILARITY_HPP
+#define GEOMETRIX_ALGORITHM_POLYLINE_SIMILARITY_HPP
+#pragma once
+
+#include <geometrix/algorithm/distance/aabb_aabb_distance.hpp>
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/primitive/point_sequence_traits.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//! Shape similarity of polylines (trajectories) in 2D and 3D: the discrete Fréchet distance (T. Eiter, H. Mannila, Computing
+//! discrete Fréchet distance, 1994), the continuous Fréchet distance (H. Alt, M. Godau, Computing the Fréchet distance between two
+//! polygonal curves, 1995) and the directed and undirected Hausdorff distances between the curves.
+//!
+//! Each query takes a threshold: once the distance is known to exceed it the query is abandoned and returns infinity, which is what
+//! makes dedup and matching over large candidate sets cheap. The distances are computed in double precision.
+namespace geometrix {
+
+    enum polyline_similarity_metric
+    {
+        e_discrete_frechet
+      , e_continuous_frechet
+      , e_directed_hausdorff
+      , e_hausdorff
+    };
+
+    namespace polyline_similarity_detail {
+
+        template <std::size_t D>
+        using sample = std::array<double, D>;
+
+        template <typename Point>
+        inline void to_sample(const Point& p, sample<2>& s, dimension<2>)
+        {
+            using filtered_predicates_detail::to_double;
+            s[0] = to_double(get<0>(p));
+            s[1] = to_double(get<1>(p));
+        }
+
+        template <typename Point>
+        inline void to_sample(const Point& p, sample<3>& s, dimension<3>)
+        {
+            using filtered_predicates_detail::to_double;
+            s[0] = to_double(get<0>(p));
+            s[1] = to_double(get<1>(p));
+            s[2] = to_double(get<2>(p));
+        }
+
+        template <typename Polyline>
+        struct polyline_dimension : dimension_of<typename point_sequence_traits<Polyline>::point_type> {};
+
+        template <typename Polyline>
+        inline std::vector<sample<polyline_dimension<Polyline>::value>> get_samples(const Polyline& poly)
+        {
+            using access = point_sequence_traits<Polyline>;
+            using dimension_t = typename dimension_of<typename access::point_type>::type;
+            std::vector<sample<dimension_t::value>> samples(access::size(poly));
+            for (std::size_t i = 0; i < samples.size(); ++i)
+                to_sample(access::get_point(poly, i), samples[i], dimension_t());
+            return samples;
+        }
+
+        template <std::size_t D>
+        inline double distance_sqrd(const sample<D>& a, const sample<D>& b)
+        {
+            double r = 0;
+            for (std::size_t k = 0; k < D; ++k)
+                r += (a[k] - b[k]) * (a[k] - b[k]);
+            return r;
+        }
+
+        template <std::size_t D>
+        inline sample<D> lerp(const sample<D>& a, const sample<D>& b, double t)
+        {
+            sample<D> r;
+            for (std::size_t k = 0; k < D; ++k)
+                r[k] = a[k] + t * (b[k] - a[k]);
+            return r;
+        }
+
+        template <std::size_t D>
+        inline double point_segment_distance_sqrd(const sample<D>& p, const sample<D>& a, const sample<D>& b)
+        {
+            double ll = 0, t = 0;
+            for (std::size_t k = 0; k < D; ++k)
+            {
+                ll += (b[k] - a[k]) * (b[k] - a[k]);
+                t += (p[k] - a[k]) * (b[k] - a[k]);
+            }
+            t = ll > 0 ? (std::min)((std::max)(t / ll, 0.0), 1.0) : 0.0;
+            return distance_sqrd(p, lerp(a, b, t));
+        }
+
+        //! The distance from p to the polyline, or any distance below bound found on the way (the scan stops there).
+        template <std::size_t D>
+        inline double get_distance_below(const sample<D>& p, const std::vector<sample<D>>& q, double bound)
+        {
+            auto bound2 = bound * bound;
+            auto best = distance_sqrd(p, q[0]);
+            for (std::size_t j = 1; j < q.size() && best >= bound2; ++j)
+                best = (std::min)(best, point_segment_distance_sqrd(p, q[j - 1], q[j]));
+            return std::sqrt(best);
+        }
+
+        //! The parameters [lo, hi] of the points of segment [a, b] within epsilon of p, or lo > hi if there are none.
+        template <std::size_t D>
+        inline std::array<double, 2> get_free_interval(const sample<D>& p, const sample<D>& a, const sample<D>& b, double epsilon)
+        {
+            double aa = 0, bb = 0, cc = -epsilon * epsilon;
+            for (std::size_t k = 0; k < D; ++k)
+            {
+                auto d = b[k] - a[k], f = a[k] - p[k];
+                aa += d * d;
+                bb += 2.0 * d * f;
+                cc += f * f;
+            }
+
+            if (!(aa > 0))
+                return cc <= 0 ? std::array<double, 2>{ { 0.0, 1.0 } } : std::array<double, 2>{ { 1.0, 0.0 } };
+
+            auto disc = bb * bb - 4.0 * aa * cc;
+            if (disc < 0)
+                return { { 1.0, 0.0 } };
+            auto root = std::sqrt(disc);
+            return { { (std::max)((-bb - root) / (2.0 * aa), 0.0), (std::min)((-bb + root) / (2.0 * aa), 1.0) } };
+        }
+
+        inline bool is_empty(const std::array<double, 2>& interval) { return interval[0] > interval[1]; }
+
+        template <std::size_t D>
+        inline double discrete_frechet(const std::vector<sample<D>>& p, const std::vector<sample<D>>& q, double threshold)
+        {
+            const double infinity = std::numeric_limits<double>::infinity();
+            auto threshold2 = threshold * threshold;
+            if ((std::max)(distance_sqrd(p.front(), q.front()), distance_sqrd(p.back(), q.back())) > threshold2)
+                return infinity;
+
+            //! Coupling costs by rows of p with the row minimum for early abandoning.
+            std::vector<double> previous(q.size()), current(q.size());
+            for (std::size_t i = 0; i < p.size(); ++i)
+            {
+                auto rowMin = infinity;
+                for (std::size_t j = 0; j < q.size(); ++j)
+                {
+                    auto d = distance_sqrd(p[i], q[j]);
+                    double reach;
+                    if (i == 0 && j == 0)
+                        reach = d;
+                    else if (i == 0)
+                        reach = current[j - 1];
+                    else if (j == 0)
+                        reach = previous[0];
+                    else
+                        reach = (std::min)({ previous[j], previous[j - 1], current[j - 1] });
+                    current[j] = (std::max)(reach, d);
+                    rowMin = (std::min)(rowMin, current[j]);
+                }
+
+                if (rowMin > threshold2)
+                    return infinity;
+                previous.swap(current);
+            }
+
+            auto distance = std::sqrt(previous.back());
+            return distance > threshold ? infinity : distance;
+        }
+
+        //! Decide whether the Fréchet distance is at most epsilon by propagating the reachable free space cell by cell.
+        template <std::size_t D>
+        inline bool is_frechet_within(const std::vector<sample<D>>& p, const std::vector<sample<D>>& q, double epsilon)
+        {
+            auto epsilon2 = epsilon * epsilon;
+            if (distance_sqrd(p.front(), q.front()) > epsilon2 || distance_sqrd(p.back(), q.back()) > epsilon2)
+                return false;
+
+            if (p.size() == 1 || q.size() == 1)
+            {
+                auto const& point = p.size() == 1 ? p[0] : q[0];
+                auto const& curve = p.size() == 1 ? q : p;
+                for (auto const& s : curve)
+                    if (distance_sqrd(point, s) > epsilon2)
+                        return false;
+                return true;
+            }
+
+            using interval = std::array<double, 2>;
+            const interval empty = { { 1.0, 0.0 } };
+            auto n = p.size() - 1, m = q.size() - 1;
+
+            //! left[j] is the reachable part of the boundary at vertex i of p over segment j of q.
+            std::vector<interval> left(m, empty), right(m);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                auto f = get_free_interval(p[0], q[j], q[j + 1], epsilon);
+                if (is_empty(f) || f[0] > 0 || (j > 0 && left[j - 1][1] < 1))
+                    break;
+                left[j] = f;
+            }
+
+            //! The bottom row is reachable only along the first vertex of q through fully reachable cells.
+            interval bottomRow = empty;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto f = get_free_interval(q[0], p[i], p[i + 1], epsilon);
+                bottomRow = ((i == 0 || (!is_empty(bottomRow) && bottomRow[1] >= 1)) && !is_empty(f) && f[0] <= 0) ? f : empty;
+
+                auto bottom = bottomRow;
+                bool any = false;
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    auto freeRight = get_free_interval(p[i + 1], q[j], q[j + 1], epsilon);
+                    auto freeTop = get_free_interval(q[j + 1], p[i], p[i + 1], epsilon);
+
+                    if (!is_empty(bottom))
+                        right[j] = freeRight;
+                    else if (!is_empty(left[j]))
+                        right[j] = interval{ { (std::max)(freeRight[0], left[j][0]), freeRight[1] } };
+                    else
+                        right[j] = empty;
+
+                    interval top;
+                    if (!is_empty(left[j]))
+                        top = freeTop;
+                    else if (!is_empty(bottom))
+                        top = interval{ { (std::max)(freeTop[0], bottom[0]), freeTop[1] } };
+                    else
+                        top = empty;
+
+                    any = any || !is_empty(right[j]);
+                    if (j + 1 == m && i + 1 == n)
+                        return (!is_empty(right[j]) && right[j][1] >= 1) || (!is_empty(top) && top[1] >= 1);
+                    bottom = top;
+                }
+
+                if (!any)
+                    return false;
+                left.swap(right);
+            }
+
+            return false;
+        }
+
+        template <std::size_t D>
+        inline double continuous_frechet(const std::vector<sample<D>>& p, const std::vector<sample<D>>& q, double threshold)
+        {
+            const double infinity = std::numeric_limits<double>::infinity();
+            auto lo = std::sqrt((std::max)(distance_sqrd(p.front(), q.front()), distance_sqrd(p.back(), q.back())));
+            if (lo > threshold)
+                return infinity;
+            if (is_frechet_within(p, q, lo))
+                return lo;
+
+            //! The discrete distance over the vertices bounds the continuous one from above.
+            auto hi = discrete_frechet(p, q, threshold);
+            if (hi == infinity)
+            {
+                if (!is_frechet_within(p, q, threshold))
+                    return infinity;
+                hi = threshold;
+            }
+
+            const double tolerance = 1e-12 * (std::max)(1.0, hi);
+            while (hi - lo > tolerance)
+            {
+                auto mid = 0.5 * (lo + hi);
+                if (is_frechet_within(p, q, mid))
+                    hi = mid;
+                else
+                    lo = mid;
+            }
+            return hi;
+        }
+
+        //! Whether the piece [a, b] lies within bound of a single segment of q. The distance to a segment is convex along the piece
+        //! so it is enough to check the ends.
+        template <std::size_t D>
+        inline bool is_piece_within(const sample<D>& a, const sample<D>& b, const std::vector<sample<D>>& q, double bound)
+        {
+            auto bound2 = bound * bound;
+            if (q.size() == 1)
+                return distance_sqrd(a, q[0]) <= bound2 && distance_sqrd(b, q[0]) <= bound2;
+            for (std::size_t j = 1; j < q.size(); ++j)
+                if (point_segment_distance_sqrd(a, q[j - 1], q[j]) <= bound2 && point_segment_distance_sqrd(b, q[j - 1], q[j]) <= bound2)
+                    return true;
+            return false;
+        }
+
+        //! The directed Hausdorff distance from the curve p to the curve q. The pieces of p are bisected until they cannot raise the
+        //! running maximum: either a single segment of q is within the maximum of both ends, or by the distance to q being 1-Lipschitz
+        //! along p a piece of length L whose ends are at distances fa and fb from q gets no farther than (fa + fb + L) / 2.
+        template <std::size_t D>
+        inline double directed_hausdorff(const std::vector<sample<D>>& p, const std::vector<sample<D>>& q, double threshold)
+        {
+            const double infinity = std::numeric_limits<double>::infinity();
+            std::vector<double> f(p.size());
+            double cmax = 0, scale = 0;
+            for (std::size_t i = 0; i < p.size(); ++i)
+            {
+                f[i] = get_distance_below(p[i], q, cmax);
+                cmax = (std::max)(cmax, f[i]);
+                if (cmax > threshold)
+                    return infinity;
+                scale = (std::max)(scale, distance_sqrd(p[i], p[0]));
+            }
+
+            const double tolerance = 1e-12 * (std::max)(1.0, std::sqrt(scale));
+            struct piece
+            {
+                sample<D> a, b;
+                double    fa, fb;
+            };
+            std::vector<piece> stack;
+            for (std::size_t i = 1; i < p.size(); ++i)
+            {
+                stack.push_back(piece{ p[i - 1], p[i], f[i - 1], f[i] });
+                while (!stack.empty())
+                {
+                    auto s = stack.back();
+                    stack.pop_back();
+                    auto length = std::sqrt(distance_sqrd(s.a, s.b));
+                    if (length <= tolerance || 0.5 * (s.fa + s.fb + length) <= cmax + tolerance || is_piece_within(s.a, s.b, q, cmax + tolerance))
+                        continue;
+
+                    auto m = lerp(s.a, s.b, 0.5);
+                    auto fm = get_distance_below(m, q, cmax);
+                    cmax = (std::max)(cmax, fm);
+                    if (cmax > threshold)
+                        return infinity;
+                    stack.push_back(piece{ s.a, m, s.fa, fm });
+                    stack.push_back(piece{ m, s.b, fm, s.fb });
+                }
+            }
+
+            return cmax;
+        }
+
+        template <std::size_t D>
+        inline double get_similarity(const std::vector<sample<D>>& p, const std::vector<sample<D>>& q, polyline_similarity_metric metric, double threshold)
+        {
+            switch (metric)
+            {
+            case e_discrete_frechet:
+                return discrete_frechet(p, q, threshold);
+            case e_continuous_frechet:
+                return continuous_frechet(p, q, threshold);
+            case e_directed_hausdorff:
+                return directed_hausdorff(p, q, threshold);
+            default:
+            {
+                auto h = directed_hausdorff(p, q, threshold);
+                if (h == std::numeric_limits<double>::infinity())
+                    return h;
+                return (std::max)(h, directed_hausdorff(q, p, threshold));
+            }
+            };
+        }
+
+        //! A lower bound of every metric: any point of either curve is at least as far from the other as their boxes are apart.
+        template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+        inline double get_aabb_lower_bound(const Polyline1& p1, const Polyline2& p2, const NumberComparisonPolicy& cmp)
+        {
+            using point_t = typename point_sequence_traits<Polyline1>::point_type;
+            return std::sqrt(filtered_predicates_detail::to_double(aabb_aabb_distance_sqrd(make_aabb<point_t>(p1, cmp), make_aabb<point_t>(p2, cmp))));
+        }
+
+    }//! namespace polyline_similarity_detail;
+
+    //! \brief The similarity of two polylines under the given metric.
+
+    //! Returns infinity if the distance exceeds threshold. With a finite threshold the distance of the bounding boxes is tried first
+    //! to reject distant pairs without touching the curves.
+    template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+    inline double polyline_similarity(const Polyline1& p1, const Polyline2& p2, polyline_similarity_metric metric, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity())
+    {
+        using namespace polyline_similarity_detail;
+        static_assert(polyline_dimension<Polyline1>::value == polyline_dimension<Polyline2>::value, "The polylines must have the same dimension.");
+        GEOMETRIX_ASSERT(point_sequence_traits<Polyline1>::size(p1) > 0 && point_sequence_traits<Polyline2>::size(p2) > 0);
+        if (threshold < std::numeric_limits<double>::infinity() && get_aabb_lower_bound(p1, p2, cmp) > threshold)
+            return std::numeric_limits<double>::infinity();
+        return get_similarity(get_samples(p1), get_samples(p2), metric, threshold);
+    }
+
+    //! The discrete Fréchet distance: the least over monotone couplings of the vertices of the polylines of the largest distance of a
+    //! coupled pair.
+    template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+    inline double discrete_frechet_distance(const Polyline1& p1, const Polyline2& p2, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity())
+    {
+        return polyline_similarity(p1, p2, e_discrete_frechet, cmp, threshold);
+    }
+
+    //! The Fréchet distance of the curves: the least over monotone reparameterizations of both curves of the largest distance
+    //! between simultaneous points. It is found by bisection on the free space decision between the endpoint distance and the
+    //! discrete distance.
+    template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+    inline double frechet_distance(const Polyline1& p1, const Polyline2& p2, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity())
+    {
+        return polyline_similarity(p1, p2, e_continuous_frechet, cmp, threshold);
+    }
+
+    //! The greatest distance of a point on the curve p1 from the curve p2.
+    template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+    inline double directed_hausdorff_distance(const Polyline1& p1, const Polyline2& p2, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity())
+    {
+        return polyline_similarity(p1, p2, e_directed_hausdorff, cmp, threshold);
+    }
+
+    template <typename Polyline1, typename Polyline2, typename NumberComparisonPolicy>
+    inline double hausdorff_distance(const Polyline1& p1, const Polyline2& p2, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity())
+    {
+        return polyline_similarity(p1, p2, e_hausdorff, cmp, threshold);
+    }
+
+    //! \brief Compare a query polyline against a sequence of candidates in parallel.
+
+    //! Returns the similarity of each candidate in order, with infinity for those beyond threshold. Candidates are rejected by the
+    //! distance of the bounding boxes (and of the endpoints for the Fréchet metrics) before any of their vertices are visited.
+    template <typename Polyline, typename Candidates, typename NumberComparisonPolicy>
+    inline std::vector<double> get_polyline_similarities(const Polyline& query, const Candidates& candidates, polyline_similarity_metric metric, const NumberComparisonPolicy& cmp, double threshold = std::numeric_limits<double>::infinity(), std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace polyline_similarity_detail;
+        using point_t = typename point_sequence_traits<Polyline>::point_type;
+        using filtered_predicates_detail::to_double;
+        const double infinity = std::numeric_limits<double>::infinity();
+
+        auto q = get_samples(query);
+        auto queryBox = make_aabb<point_t>(query, cmp);
+        std::vector<double> results(candidates.size(), infinity);
+        parallel_for(candidates.size(), [&](std::size_t i)
+        {
+            auto const& candidate = candidates[i];
+            if (threshold < infinity && std::sqrt(to_double(aabb_aabb_distance_sqrd(queryBox, make_aabb<point_t>(candidate, cmp)))) > threshold)
+                return;
+
+            auto c = get_samples(candidate);
+            if (metric == e_discrete_frechet || metric == e_continuous_frechet)
+            {
+                if ((std::max)(distance_sqrd(q.front(), c.front()), distance_sqrd(q.back(), c.back())) > threshold * threshold)
+                    return;
+            }
+
+            results[i] = get_similarity(q, c, metric, threshold);
+        }, 16, nThreads);
+
+        return results;
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_POLYLINE_SIMILARITY_HPP
@@ -0,0 +1,375 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_DISTANCE_FIELD_2D_HPP
+#define GEOMETRIX_ALGORITHM_DISTANCE_FIELD_2D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_2d.hpp>
+#include <geometrix/algorithm/fast_voxel_grid_traversal.hpp>
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/algorithm/point_in_solid_classification.hpp>
+#include <geometrix/primitive/polygon.hpp>
+#include <geometrix/primitive/polygon_with_holes.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/primitive/segment_range_view.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+//! Distance fields sampled at the cell centroids of a grid_2d. A field is built once from static geometry in linear time in
+//! the number of cells and then answers distance and gradient queries in constant time by bilinear interpolation, in place of
+//! a scan over all of the edges of the geometry per query.
+//!
+//! The boundary of the geometry is rasterized into the cells it crosses and the exact Euclidean distance transform of the
+//! raster gives the distance from each centroid to the nearest boundary cell, so the field is within half a cell diagonal of
+//! the true distance to the boundary.
+namespace geometrix {
+
+    namespace distance_field_detail {
+
+        //! The lower envelope of the parabolas rooted at the finite samples of f from P. Felzenszwalb, D. Huttenlocher,
+        //! Distance Transforms of Sampled Functions, Theory of Computing, 2012. On return d[q] = min_p((q - p)^2 + f[p]).
+        template <typename Data>
+        inline void squared_distance_transform_1d(const Data* f, Data* d, std::size_t n, std::vector<std::size_t>& v, std::vector<Data>& z)
+        {
+            const auto inf = std::numeric_limits<Data>::infinity();
+            v.resize(n);
+            z.resize(n + 1);
+
+            std::size_t q = 0;
+            while (q < n && f[q] == inf)
+                ++q;
+            if (q == n)
+            {
+                std::fill(d, d + n, inf);
+                return;
+            }
+
+            std::size_t k = 0;
+            v[0] = q;
+            z[0] = -inf;
+            z[1] = inf;
+            for (++q; q < n; ++q)
+            {
+                if (f[q] == inf)
+                    continue;
+
+                auto intersect = [&](std::size_t p) { return ((f[q] + Data(q * q)) - (f[p] + Data(p * p))) / (Data(2) * (Data(q) - Data(p))); };
+                auto s = intersect(v[k]);
+                while (s <= z[k])
+                    s = intersect(v[--k]);
+
+                ++k;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = inf;
+            }
+
+            k = 0;
+            for (q = 0; q < n; ++q)
+            {
+                while (z[k + 1] < Data(q))
+                    ++k;
+                auto delta = Data(q) - Data(v[k]);
+                d[q] = delta * delta + f[v[k]];
+            }
+        }
+
+        //! Call fn(segment) for each edge of the rings of a polygon, a polygon_with_holes or a std::vector of either.
+        template <typename Point, typename Alloc, typename Fn>
+        inline void for_each_ring_edge(const polygon<Point, Alloc>& pgon, Fn&& fn)
+        {
+            for (std::size_t i = 0, n = pgon.size(); i < n; ++i)
+                fn(segment<Point>(pgon[i], pgon[(i + 1) % n]));
+        }
+
+        template <typename Point, typename Alloc, typename Fn>
+        inline void for_each_ring_edge(const polygon_with_holes<Point, Alloc>& pgon, Fn&& fn)
+        {
+            for_each_ring_edge(pgon.get_outer(), fn);
+            for (auto const& hole : pgon.get_holes())
+                for_each_ring_edge(hole, fn);
+        }
+
+        template <typename T, typename Alloc, typename Fn>
+        inline void for_each_ring_edge(const std::vector<T, Alloc>& pgons, Fn&& fn)
+        {
+            for (auto const& pgon : pgons)
+                for_each_ring_edge(pgon, fn);
+        }
+
+    }//! namespace distance_field_detail;
+
+    //! \brief Compute the squared Euclidean distance transform of a grid in place.
+
+    //! On entry each cell holds a sample of f (0 for the feature cells and infinity elsewhere for a plain distance transform)
+    //! and on return each cell (i, j) holds min over the cells (k, l) of (i - k)^2 + (j - l)^2 + f(k, l) in squared cell units.
+    //! The transform is separable: the columns and then the rows are transformed in parallel with the linear time algorithm
+    //! of Felzenszwalb and Huttenlocher.
+    template <typename Data, typename GridTraits>
+    inline void squared_euclidean_distance_transform(grid_2d<Data, GridTraits>& grid, std::size_t nThreads = get_default_concurrency())
+    {
+        static_assert(std::numeric_limits<Data>::has_infinity, "The distance transform requires a floating point data type.");
+        using namespace distance_field_detail;
+        const std::size_t width = grid.get_traits().get_width();
+        const std::size_t height = grid.get_traits().get_height();
+        const std::size_t batchSize = 16;
+
+        auto transform_lines = [&](std::size_t nLines, std::size_t length, bool columns)
+        {
+            parallel_for_batches(nLines, batchSize, [&](std::size_t, std::size_t begin, std::size_t end)
+            {
+                std::vector<Data> f(length), d(length), z;
+                std::vector<std::size_t> v;
+                for (auto line = begin; line < end; ++line)
+                {
+                    auto cell = [&](std::size_t k) -> Data& { return columns ? grid.get_cell(static_cast<boost::uint32_t>(line), static_cast<boost::uint32_t>(k)) : grid.get_cell(static_cast<boost::uint32_t>(k), static_cast<boost::uint32_t>(line)); };
+                    for (std::size_t k = 0; k < length; ++k)
+                        f[k] = cell(k);
+                    squared_distance_transform_1d(f.data(), d.data(), length, v, z);
+                    for (std::size_t k = 0; k < length; ++k)
+                        cell(k) = d[k];
+                }
+            }, nThreads);
+        };
+
+        transform_lines(width, height, true);
+        transform_lines(height, width, false);
+    }
+
+    //! \brief A distance field sampled at the cell centroids of a grid.
+
+    //! Signed fields are negative inside the geometry. Queries interpolate bilinearly between the four nearest centroids and
+    //! are clamped to the outer centroids near the bounds of the grid.
+    template <typename GridTraits>
+    class distance_field_2d
+    {
+    public:
+
+        typedef GridTraits                                   traits_type;
+        typedef typename traits_type::coordinate_type        coordinate_type;
+        typedef typename traits_type::dimensionless_type     dimensionless_type;
+        typedef grid_2d<coordinate_type, traits_type>        grid_type;
+        typedef vector<dimensionless_type, 2>                gradient_type;
+
+        distance_field_2d(const traits_type& traits)
+            : m_grid(traits)
+        {}
+
+        const traits_type& get_traits() const { return m_grid.get_traits(); }
+        const grid_type& get_grid() const { return m_grid; }
+        grid_type& get_grid() { return m_grid; }
+
+        coordinate_type get_cell_distance(boost::uint32_t i, boost::uint32_t j) const { return m_grid.get_cell(i, j); }
+
+        template <typename Point>
+        coordinate_type get_distance(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            auto s = get_sample(p);
+            auto one = constants::one<dimensionless_type>();
+            auto f0 = (one - s.tx) * m_grid.get_cell(s.i0, s.j0) + s.tx * m_grid.get_cell(s.i1, s.j0);
+            auto f1 = (one - s.tx) * m_grid.get_cell(s.i0, s.j1) + s.tx * m_grid.get_cell(s.i1, s.j1);
+            return (one - s.ty) * f0 + s.ty * f1;
+        }
+
+        //! The gradient of the interpolated field. Away from the medial axis of the geometry it is close to the unit vector
+        //! pointing away from the nearest boundary.
+        template <typename Point>
+        gradient_type get_gradient(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            auto s = get_sample(p);
+            auto one = constants::one<dimensionless_type>();
+            auto zero = constants::zero<dimensionless_type>();
+            auto cell = get_traits().get_cell_size();
+            dimensionless_type gx = s.i0 == s.i1 ? zero : ((one - s.ty) * (m_grid.get_cell(s.i1, s.j0) - m_grid.get_cell(s.i0, s.j0)) + s.ty * (m_grid.get_cell(s.i1, s.j1) - m_grid.get_cell(s.i0, s.j1))) / cell;
+            dimensionless_type gy = s.j0 == s.j1 ? zero : ((one - s.tx) * (m_grid.get_cell(s.i0, s.j1) - m_grid.get_cell(s.i0, s.j0)) + s.tx * (m_grid.get_cell(s.i1, s.j1) - m_grid.get_cell(s.i1, s.j0))) / cell;
+            return gradient_type(gx, gy);
+        }
+
+    private:
+
+        struct sample
+        {
+            boost::uint32_t i0, i1, j0, j1;
+            dimensionless_type tx, ty;
+        };
+
+        static void get_axis_sample(dimensionless_type u, boost::uint32_t n, boost::uint32_t& k0, boost::uint32_t& k1, dimensionless_type& t)
+        {
+            auto zero = constants::zero<dimensionless_type>();
+            if (n == 1 || !(u > zero))
+            {
+                k0 = 0;
+                k1 = n > 1 ? 1 : 0;
+                t = zero;
+                return;
+            }
+
+            k0 = (std::min)(static_cast<boost::uint32_t>(u), n - 2);
+            k1 = k0 + 1;
+            t = (std::min)(u - construct<dimensionless_type>(k0), constants::one<dimensionless_type>());
+        }
+
+        template <typename Point>
+        sample get_sample(const Point& p) const
+        {
+            auto const& traits = get_traits();
+            auto half = construct<dimensionless_type>(0.5);
+            auto cell = traits.get_cell_size();
+            sample s;
+            get_axis_sample((get<0>(p) - traits.get_min_x()) / cell - half, traits.get_width(), s.i0, s.i1, s.tx);
+            get_axis_sample((get<1>(p) - traits.get_min_y()) / cell - half, traits.get_height(), s.j0, s.j1, s.ty);
+            return s;
+        }
+
+        grid_type m_grid;
+
+    };
+
+    namespace distance_field_detail {
+
+        //! Rasterize the boundary segments visited by forEachSegment(fn) and transform the raster into the field. The sign of a
+        //! cell is negative where isInside(i, j) is true.
+        template <typename GridTraits, typename ForEachSegment, typename IsInside, typename NumberComparisonPolicy>
+        inline void make_distance_field(distance_field_2d<GridTraits>& field, ForEachSegment&& forEachSegment, IsInside&& isInside, const NumberComparisonPolicy& cmp, std::size_t nThreads)
+        {
+            using dimensionless_t = typename GridTraits::dimensionless_type;
+            auto const& traits = field.get_traits();
+
+            grid_2d<double, GridTraits> sqrd(traits);
+            const auto width = traits.get_width(), height = traits.get_height();
+            parallel_for(width, [&](std::size_t i)
+            {
+                for (boost::uint32_t j = 0; j < height; ++j)
+                    sqrd.get_cell(static_cast<boost::uint32_t>(i), j) = std::numeric_limits<double>::infinity();
+            }, 16, nThreads);
+
+            forEachSegment([&](const auto& s)
+            {
+                fast_voxel_grid_traversal(traits, s, [&sqrd](boost::uint32_t i, boost::uint32_t j) { sqrd.get_cell(i, j) = 0.0; }, cmp);
+            });
+
+            squared_euclidean_distance_transform(sqrd, nThreads);
+
+            auto cell = traits.get_cell_size();
+            parallel_for(width, [&](std::size_t i)
+            {
+                using std::sqrt;
+                auto ii = static_cast<boost::uint32_t>(i);
+                for (boost::uint32_t j = 0; j < height; ++j)
+                {
+                    auto d = sqrt(sqrd.get_cell(ii, j));
+                    field.get_grid().get_cell(ii, j) = construct<dimensionless_t>(isInside(ii, j) ? -d : d) * cell;
+                }
+            }, 16, nThreads);
+        }
+
+        //! Mark the cells whose centroids are inside the rings by the even-odd rule, scanning the rows in parallel.
+        template <typename GridTraits, typename ForEachSegment>
+        inline grid_2d<std::uint8_t, GridTraits> get_inside_cells(const GridTraits& traits, ForEachSegment&& forEachSegment, std::size_t nThreads)
+        {
+            using namespace filtered_predicates_detail;
+            const auto width = traits.get_width(), height = traits.get_height();
+            const double xmin = to_double(traits.get_min_x()), ymin = to_double(traits.get_min_y()), cell = to_double(traits.get_cell_size());
+
+            std::vector<std::vector<double>> crossings(height);
+            forEachSegment([&](const auto& s)
+            {
+                double ax = to_double(get<0>(get_start(s))), ay = to_double(get<1>(get_start(s)));
+                double bx = to_double(get<0>(get_end(s))), by = to_double(get<1>(get_end(s)));
+                auto j0 = std::ceil(((std::min)(ay, by) - ymin) / cell - 0.5);
+                auto j1 = std::floor(((std::max)(ay, by) - ymin) / cell - 0.5);
+                j0 = (std::max)(j0, 0.0);
+                j1 = (std::min)(j1, static_cast<double>(height) - 1.0);
+                for (auto j = j0; j <= j1; ++j)
+                {
+                    double y = ymin + (j + 0.5) * cell;
+                    if ((ay <= y) != (by <= y))
+                        crossings[static_cast<std::size_t>(j)].push_back(ax + (y - ay) * (bx - ax) / (by - ay));
+                }
+            });
+
+            grid_2d<std::uint8_t, GridTraits> inside(traits);
+            parallel_for(height, [&](std::size_t j)
+            {
+                auto& xs = crossings[j];
+                std::sort(xs.begin(), xs.end());
+                auto jj = static_cast<boost::uint32_t>(j);
+                for (boost::uint32_t i = 0; i < width; ++i)
+                    inside.get_cell(i, jj) = 0;
+                for (std::size_t k = 0; k + 1 < xs.size(); k += 2)
+                {
+                    auto i0 = (std::max)(std::ceil((xs[k] - xmin) / cell - 0.5), 0.0);
+                    auto i1 = (std::min)(std::ceil((xs[k + 1] - xmin) / cell - 0.5), static_cast<double>(width));
+                    for (auto i = i0; i < i1; ++i)
+                        inside.get_cell(static_cast<boost::uint32_t>(i), jj) = 1;
+                }
+            }, 16, nThreads);
+
+            return inside;
+        }
+
+    }//! namespace distance_field_detail;
+
+    //! Make the signed distance field of a polygon, a polygon_with_holes or a std::vector of either (inside by the even-odd
+    //! rule). The grid should cover the polygons as boundaries outside of it are not rasterized.
+    template <typename GridTraits, typename Polygons, typename NumberComparisonPolicy>
+    inline distance_field_2d<GridTraits> make_polygon_distance_field(const GridTraits& traits, const Polygons& polygons, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace distance_field_detail;
+        auto forEachSegment = [&polygons](auto&& fn) { for_each_ring_edge(polygons, fn); };
+        auto inside = get_inside_cells(traits, forEachSegment, nThreads);
+
+        distance_field_2d<GridTraits> field(traits);
+        make_distance_field(field, forEachSegment, [&inside](boost::uint32_t i, boost::uint32_t j) { return inside.get_cell(i, j) != 0; }, cmp, nThreads);
+        return field;
+    }
+
+    //! Make the unsigned distance field of a range of point sequences (read through point_sequence_traits).
+    template <typename GridTraits, typename Polylines, typename NumberComparisonPolicy>
+    inline distance_field_2d<GridTraits> make_polyline_distance_field(const GridTraits& traits, const Polylines& polylines, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        auto forEachSegment = [&polylines](auto&& fn)
+        {
+            for (auto const& pline : polylines)
+                for (auto const& s : polyline_segment_view<typename std::decay<decltype(pline)>::type>(pline))
+                    fn(s);
+        };
+
+        distance_field_2d<GridTraits> field(traits);
+        distance_field_detail::make_distance_field(field, forEachSegment, [](boost::uint32_t, boost::uint32_t) { return false; }, cmp, nThreads);
+        return field;
+    }
+
+    //! Make the signed distance field of the boundary of a solid_leaf_bsp_tree (or solid_leaf_bsp_tree_view) of segments which
+    //! is negative in solid space.
+    template <typename GridTraits, typename SolidBSP, typename NumberComparisonPolicy>
+    inline distance_field_2d<GridTraits> make_solid_bsp_distance_field(const GridTraits& traits, const SolidBSP& bsp, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        auto forEachSegment = [&bsp](auto&& fn) { bsp.for_each_simplex(fn); };
+        auto isInside = [&](boost::uint32_t i, boost::uint32_t j) { return bsp.point_in_solid_space(traits.get_cell_centroid(i, j)) == point_in_solid_classification::in_solid; };
+
+        distance_field_2d<GridTraits> field(traits);
+        distance_field_detail::make_distance_field(field, forEachSegment, isInside, cmp, nThreads);
+        return field;
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_DISTANCE_FIELD_2D_HPP
@@ -0,0 +1,600 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_DYNAMIC_SPATIAL_INDEX_HPP
+#define GEOMETRIX_DYNAMIC_SPATIAL_INDEX_HPP
+#pragma once
+
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/algorithm/broad_phase/sweep_and_prune.hpp>
+#include <geometrix/numeric/constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief A dynamic index of points supporting insert, erase and move with range and k nearest neighbor queries.
+
+    //! The index is a bucketed region quadtree (octree in 3D, 2^D-tree in general). Leaves hold up to leafCapacity points and
+    //! split when they overflow. A subtree collapses back into a leaf when it holds at most half of that, so alternating inserts
+    //! and erases near the threshold do not thrash. The root cell is grown by doubling when a point falls outside of it, so the
+    //! index needs no bounds up front. Each point carries a user supplied 32 bit data value (typically the index of the object in
+    //! the caller's container) and is identified by the proxy returned from insert.
+    //! - insert and erase cost O(depth) and the depth is O(log n) for points which are not pathologically clustered.
+    //! - move updates a point in place when it stays within its leaf cell, which is the common case for objects tracked at a
+    //!   high rate, and otherwise reinserts it.
+    //! The range query mirrors kd_tree::search.
+    template <typename Point>
+    class dynamic_spatial_index
+    {
+    public:
+
+        using point_type = Point;
+        using length_type = typename arithmetic_type_of<Point>::type;
+        using area_type = decltype(std::declval<length_type>() * std::declval<length_type>());
+        using aabb_type = axis_aligned_bounding_box<Point>;
+        using proxy_type = std::uint32_t;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static const std::size_t number_children = std::size_t(1) << dimension;
+        static const proxy_type null_proxy = static_cast<proxy_type>(-1);
+
+        //! Leaves are not split beyond this depth so that coincident points cannot recurse indefinitely.
+        static const std::size_t max_depth = 40;
+
+        //! The root cell is created around the first point inserted with the given half extent.
+        explicit dynamic_spatial_index(std::size_t leafCapacity = 16, const length_type& initialHalfExtent = constants::one<length_type>())
+            : m_leafCapacity(leafCapacity)
+            , m_initialHalfExtent(initialHalfExtent)
+        {
+            GEOMETRIX_ASSERT(leafCapacity > 0);
+        }
+
+        //! Start with a root cell covering the given bounds.
+        explicit dynamic_spatial_index(const aabb_type& bounds, std::size_t leafCapacity = 16)
+            : m_leafCapacity(leafCapacity)
+            , m_initialHalfExtent(constants::one<length_type>())
+        {
+            GEOMETRIX_ASSERT(leafCapacity > 0);
+            using indices = std::make_index_sequence<dimension>;
+            m_nodes.emplace_back();
+            m_nodes[0].lo = broad_phase_detail::to_array(bounds.get_lower_bound(), indices{});
+            m_nodes[0].hi = broad_phase_detail::to_array(bounds.get_upper_bound(), indices{});
+        }
+
+        void clear()
+        {
+            m_items.clear();
+            m_nodes.clear();
+            m_freeBlocks.clear();
+            m_free = null_proxy;
+            m_size = 0;
+        }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        //! Insert a point with associated data and return its proxy.
+        proxy_type insert(const point_type& p, std::uint32_t data)
+        {
+            using indices = std::make_index_sequence<dimension>;
+            auto i = allocate_item();
+            m_items[i].p = broad_phase_detail::to_array(p, indices{});
+            m_items[i].data = data;
+            insert_item(i);
+            ++m_size;
+            return i;
+        }
+
+        void erase(proxy_type i)
+        {
+            GEOMETRIX_ASSERT(is_valid(i));
+            auto parent = m_nodes[m_items[i].node].parent;
+            remove_item(i);
+            free_item(i);
+            --m_size;
+            collapse_from(parent);
+        }
+
+        //! Update the position of a point. Returns true if the point changed leaves.
+        bool move(proxy_type i, const point_type& p)
+        {
+            GEOMETRIX_ASSERT(is_valid(i));
+            using indices = std::make_index_sequence<dimension>;
+            auto a = broad_phase_detail::to_array(p, indices{});
+            if (in_cell(m_nodes[m_items[i].node], a))
+            {
+                m_items[i].p = a;
+                return false;
+            }
+
+            //! Climb to the nearest ancestor containing the new position and descend from there, so only the counts on the
+            //! path between the two leaves change.
+            auto leaf = m_items[i].node;
+            auto parent = m_nodes[leaf].parent;
+            auto ancestor = parent;
+            while (ancestor != null_proxy && !in_cell(m_nodes[ancestor], a))
+                ancestor = m_nodes[ancestor].parent;
+            if (ancestor == null_proxy)
+            {
+                remove_item(i);
+                m_items[i].p = a;
+                insert_item(i);
+            }
+            else
+            {
+                remove_item(i, m_nodes[ancestor].parent);
+                m_items[i].p = a;
+                insert_item(i, ancestor);
+            }
+            collapse_from(parent);
+            return true;
+        }
+
+        point_type get_point(proxy_type i) const
+        {
+            GEOMETRIX_ASSERT(is_valid(i));
+            return broad_phase_detail::from_array<Point>(m_items[i].p, std::make_index_sequence<dimension>{});
+        }
+
+        std::uint32_t get_data(proxy_type i) const
+        {
+            GEOMETRIX_ASSERT(is_valid(i));
+            return m_items[i].data;
+        }
+
+        //! The bounds of the root cell. The index must not be empty.
+        aabb_type get_bounds() const
+        {
+            GEOMETRIX_ASSERT(!m_nodes.empty());
+            using indices = std::make_index_sequence<dimension>;
+            return aabb_type(broad_phase_detail::from_array<Point>(m_nodes[0].lo, indices{}), broad_phase_detail::from_array<Point>(m_nodes[0].hi, indices{}));
+        }
+
+        //! The depth of the deepest leaf. An index with a single leaf has depth 0.
+        std::size_t get_depth() const
+        {
+            if (m_nodes.empty())
+                return 0;
+            std::size_t result = 0;
+            std::vector<std::pair<proxy_type, std::size_t>> stack{ { 0, 0 } };
+            while (!stack.empty())
+            {
+                auto top = stack.back();
+                stack.pop_back();
+                result = (std::max)(result, top.second);
+                if (!m_nodes[top.first].is_leaf())
+                    for (std::size_t c = 0; c < number_children; ++c)
+                        stack.emplace_back(m_nodes[top.first].children + c, top.second + 1);
+            }
+            return result;
+        }
+
+        //! Visit the points inside the range. The visitor is called as visitor(point, data) if it accepts those arguments and
+        //! as visitor(point) otherwise.
+        template <typename T, typename Visitor, typename NumberComparisonPolicy>
+        void search(const axis_aligned_bounding_box<T>& range, Visitor&& visitor, const NumberComparisonPolicy& compare) const
+        {
+            if (m_size == 0)
+                return;
+
+            using indices = std::make_index_sequence<dimension>;
+            auto lo = broad_phase_detail::to_array(range.get_lower_bound(), indices{});
+            auto hi = broad_phase_detail::to_array(range.get_upper_bound(), indices{});
+            auto overlaps = [&](const bounds_t& cellLo, const bounds_t& cellHi)
+            {
+                for (std::size_t d = 0; d < dimension; ++d)
+                    if (compare.less_than(cellHi[d], lo[d]) || compare.greater_than(cellLo[d], hi[d]))
+                        return false;
+                return true;
+            };
+
+            std::vector<proxy_type> stack{ 0 };
+            while (!stack.empty())
+            {
+                auto const& n = m_nodes[stack.back()];
+                stack.pop_back();
+                if (n.count == 0 || !overlaps(n.lo, n.hi))
+                    continue;
+
+                if (!n.is_leaf())
+                {
+                    for (std::size_t c = 0; c < number_children; ++c)
+                        stack.push_back(n.children + c);
+                    continue;
+                }
+
+                for (auto i : n.items)
+                {
+                    auto const& item = m_items[i];
+                    if (overlaps(item.p, item.p))
+                        visit(visitor, item, decltype(is_data_visitor<Visitor>(0))());
+                }
+            }
+        }
+
+        //! Find the k points nearest to p in order of increasing distance as pairs of the squared distance and the data of the point.
+        //! Points further than maxDistanceSqrd are ignored.
+        std::vector<std::pair<area_type, std::uint32_t>> nearest_neighbors(const point_type& p, std::size_t k, area_type maxDistanceSqrd = constants::infinity<area_type>()) const
+        {
+            using item_t = std::pair<area_type, std::uint32_t>;
+            std::vector<item_t> result;
+            if (m_size == 0 || k == 0)
+                return result;
+
+            //! Best first search over the cells keeping the k best points in a max heap.
+            using indices = std::make_index_sequence<dimension>;
+            auto pa = broad_phase_detail::to_array(p, indices{});
+            auto pruned = [&](const area_type& d2) { return result.size() < k ? d2 > maxDistanceSqrd : !(d2 < result.front().first); };
+            using entry = std::pair<area_type, proxy_type>;
+            std::priority_queue<entry, std::vector<entry>, std::greater<entry>> Q;
+            Q.emplace(distance_sqrd(m_nodes[0].lo, m_nodes[0].hi, pa), 0);
+            while (!Q.empty())
+            {
+                auto top = Q.top();
+                Q.pop();
+                if (pruned(top.first))
+                    break;
+
+                auto const& n = m_nodes[top.second];
+                if (n.is_leaf())
+                {
+                    for (auto i : n.items)
+                    {
+                        auto const& item = m_items[i];
+                        auto d2 = distance_sqrd(item.p, item.p, pa);
+                        if (pruned(d2))
+                            continue;
+                        if (result.size() == k)
+                            std::pop_heap(result.begin(), result.end());
+                        else
+                            result.emplace_back();
+                        result.back() = item_t(d2, item.data);
+                        std::push_heap(result.begin(), result.end());
+                    }
+                    continue;
+                }
+
+                for (std::size_t c = 0; c < number_children; ++c)
+                {
+                    auto const& child = m_nodes[n.children + c];
+                    if (child.count == 0)
+                        continue;
+                    auto d2 = distance_sqrd(child.lo, child.hi, pa);
+                    if (!pruned(d2))
+                        Q.emplace(d2, n.children + c);
+                }
+            }
+
+            std::sort_heap(result.begin(), result.end());
+            return result;
+        }
+
+        //! The nearest point to p as the pair of its squared distance and data, or (infinity, null_proxy) if the index is empty.
+        std::pair<area_type, std::uint32_t> nearest_neighbor(const point_type& p) const
+        {
+            auto r = nearest_neighbors(p, 1);
+            return r.empty() ? std::make_pair(constants::infinity<area_type>(), static_cast<std::uint32_t>(null_proxy)) : r.front();
+        }
+
+    private:
+
+        using bounds_t = std::array<length_type, dimension_of<Point>::value>;
+
+        struct node
+        {
+            bounds_t lo;
+            bounds_t hi;
+            proxy_type parent{ null_proxy };
+            proxy_type children{ null_proxy };//! Index of the first of number_children consecutive nodes.
+            std::uint32_t count{ 0 };//! Number of points in the subtree.
+            std::vector<proxy_type> items;
+
+            bool is_leaf() const { return children == null_proxy; }
+        };
+
+        struct item
+        {
+            bounds_t p;
+            std::uint32_t data{ 0 };
+            proxy_type node{ null_proxy };//! null_proxy for free items.
+            std::uint32_t slot{ 0 };//! Position in the leaf's items, or the next free item.
+        };
+
+        template <typename Visitor>
+        static auto is_data_visitor(int) -> decltype(std::declval<Visitor&>()(std::declval<const point_type&>(), std::uint32_t()), std::true_type());
+
+        template <typename Visitor>
+        static std::false_type is_data_visitor(...);
+
+        template <typename Visitor>
+        void visit(Visitor& visitor, const item& i, std::true_type) const
+        {
+            visitor(broad_phase_detail::from_array<Point>(i.p, std::make_index_sequence<dimension>{}), i.data);
+        }
+
+        template <typename Visitor>
+        void visit(Visitor& visitor, const item& i, std::false_type) const
+        {
+            visitor(broad_phase_detail::from_array<Point>(i.p, std::make_index_sequence<dimension>{}));
+        }
+
+        bool is_valid(proxy_type i) const { return i < m_items.size() && m_items[i].node != null_proxy; }
+
+        static bool in_cell(const node& n, const bounds_t& p)
+        {
+            for (std::size_t d = 0; d < dimension; ++d)
+                if (p[d] < n.lo[d] || n.hi[d] < p[d])
+                    return false;
+            return true;
+        }
+
+        static area_type distance_sqrd(const bounds_t& lo, const bounds_t& hi, const bounds_t& p)
+        {
+            auto r = constants::zero<area_type>();
+            for (std::size_t d = 0; d < dimension; ++d)
+            {
+                if (p[d] < lo[d])
+                    r += (lo[d] - p[d]) * (lo[d] - p[d]);
+                else if (hi[d] < p[d])
+                    r += (p[d] - hi[d]) * (p[d] - hi[d]);
+            }
+            return r;
+        }
+
+        static length_type mid(const node& n, std::size_t d)
+        {
+            return n.lo[d] + (n.hi[d] - n.lo[d]) / 2;
+        }
+
+        static std::size_t child_index(const node& n, const bounds_t& p)
+        {
+            std::size_t c = 0;
+            for (std::size_t d = 0; d < dimension; ++d)
+                if (!(p[d] < mid(n, d)))
+                    c |= std::size_t(1) << d;
+            return c;
+        }
+
+        proxy_type allocate_item()
+        {
+            if (m_free != null_proxy)
+            {
+                auto i = m_free;
+                m_free = m_items[i].slot;
+                return i;
+            }
+            m_items.emplace_back();
+            return static_cast<proxy_type>(m_items.size() - 1);
+        }
+
+        void free_item(proxy_type i)
+        {
+            m_items[i].node = null_proxy;
+            m_items[i].slot = m_free;
+            m_free = i;
+        }
+
+        //! Allocate number_children consecutive nodes splitting the cell of node n.
+        proxy_type allocate_children(proxy_type n)
+        {
+            proxy_type first;
+            if (!m_freeBlocks.empty())
+            {
+                first = m_freeBlocks.back();
+                m_freeBlocks.pop_back();
+            }
+            else
+            {
+                first = static_cast<proxy_type>(m_nodes.size());
+                m_nodes.resize(m_nodes.size() + number_children);
+            }
+
+            for (std::size_t c = 0; c < number_children; ++c)
+            {
+                auto& child = m_nodes[first + c];
+                for (std::size_t d = 0; d < dimension; ++d)
+                {
+                    auto m = mid(m_nodes[n], d);
+                    child.lo[d] = (c & (std::size_t(1) << d)) ? m : m_nodes[n].lo[d];
+                    child.hi[d] = (c & (std::size_t(1) << d)) ? m_nodes[n].hi[d] : m;
+                }
+                child.parent = n;
+                child.children = null_proxy;
+                child.count = 0;
+                child.items.clear();
+            }
+            return first;
+        }
+
+        //! Grow the root by doubling until it contains p. The old root becomes one of the children of the new one.
+        void grow_to(const bounds_t& p)
+        {
+            if (m_nodes.empty())
+            {
+                m_nodes.emplace_back();
+                for (std::size_t d = 0; d < dimension; ++d)
+                {
+                    m_nodes[0].lo[d] = p[d] - m_initialHalfExtent;
+                    m_nodes[0].hi[d] = p[d] + m_initialHalfExtent;
+                }
+                return;
+            }
+
+            while (!in_cell(m_nodes[0], p))
+            {
+                //! Extend towards p in each dimension. The old root occupies the child on the side away from p.
+                node old = std::move(m_nodes[0]);
+                std::size_t k = 0;
+                auto& root = m_nodes[0];
+                root = node{};
+                for (std::size_t d = 0; d < dimension; ++d)
+                {
+                    auto size = old.hi[d] - old.lo[d];
+                    if (!(size > constants::zero<length_type>()))
+                        size = m_initialHalfExtent;
+                    if (p[d] < old.lo[d])
+                    {
+                        root.lo[d] = old.lo[d] - size;
+                        root.hi[d] = old.hi[d];
+                        k |= std::size_t(1) << d;
+                    }
+                    else
+                    {
+                        root.lo[d] = old.lo[d];
+                        root.hi[d] = old.hi[d] + size;
+                    }
+                }
+
+                root.count = old.count;
+                auto first = allocate_children(0);
+                auto moved = static_cast<proxy_type>(first + k);
+                auto& m = m_nodes[moved];
+                m.lo = old.lo;
+                m.hi = old.hi;
+                m.count = old.count;
+                m.children = old.children;
+                m.items = std::move(old.items);
+                m_nodes[0].children = first;
+                if (m.is_leaf())
+                {
+                    for (auto i : m.items)
+                        m_items[i].node = moved;
+                }
+                else
+                {
+                    for (std::size_t c = 0; c < number_children; ++c)
+                        m_nodes[m.children + c].parent = moved;
+                }
+            }
+        }
+
+        void insert_item(proxy_type i)
+        {
+            grow_to(m_items[i].p);
+            insert_item(i, 0);
+        }
+
+        //! Insert an item into the subtree of node n which must contain it. The counts of the ancestors of n are not updated.
+        void insert_item(proxy_type i, proxy_type n)
+        {
+            auto const& p = m_items[i].p;
+            std::size_t depth = 0;
+            for (auto a = m_nodes[n].parent; a != null_proxy; a = m_nodes[a].parent)
+                ++depth;
+            while (!m_nodes[n].is_leaf())
+            {
+                ++m_nodes[n].count;
+                n = static_cast<proxy_type>(m_nodes[n].children + child_index(m_nodes[n], p));
+                ++depth;
+            }
+
+            add_to_leaf(n, i);
+            if (m_nodes[n].count > m_leafCapacity && depth < max_depth)
+                split(n, depth);
+        }
+
+        void add_to_leaf(proxy_type n, proxy_type i)
+        {
+            auto& leaf = m_nodes[n];
+            m_items[i].node = n;
+            m_items[i].slot = static_cast<std::uint32_t>(leaf.items.size());
+            leaf.items.push_back(i);
+            ++leaf.count;
+        }
+
+        //! Split an overflowing leaf, recursing into children which still overflow.
+        void split(proxy_type n, std::size_t depth)
+        {
+            auto first = allocate_children(n);
+            m_nodes[n].children = first;
+            auto items = std::move(m_nodes[n].items);
+            m_nodes[n].items = std::vector<proxy_type>();
+            for (auto i : items)
+                add_to_leaf(static_cast<proxy_type>(first + child_index(m_nodes[n], m_items[i].p)), i);
+
+            if (depth + 1 < max_depth)
+                for (std::size_t c = 0; c < number_children; ++c)
+                    if (m_nodes[first + c].count > m_leafCapacity)
+                        split(static_cast<proxy_type>(first + c), depth + 1);
+        }
+
+        //! Remove an item from its leaf and decrement the counts on the path up to (not including) node last.
+        void remove_item(proxy_type i, proxy_type last = null_proxy)
+        {
+            auto n = m_items[i].node;
+            auto& leaf = m_nodes[n];
+            auto slot = m_items[i].slot;
+            leaf.items[slot] = leaf.items.back();
+            m_items[leaf.items[slot]].slot = slot;
+            leaf.items.pop_back();
+            for (auto a = n; a != last; a = m_nodes[a].parent)
+                --m_nodes[a].count;
+        }
+
+        //! Collapse the highest ancestor of n (inclusive) which holds at most half a leaf of points.
+        void collapse_from(proxy_type n)
+        {
+            proxy_type target = null_proxy;
+            for (auto a = n; a != null_proxy && 2 * m_nodes[a].count <= m_leafCapacity; a = m_nodes[a].parent)
+                target = a;
+            if (target == null_proxy)
+                return;
+
+            std::vector<proxy_type> items;
+            items.reserve(m_nodes[target].count);
+            gather_and_free(m_nodes[target].children, items);
+            auto& t = m_nodes[target];
+            t.children = null_proxy;
+            t.count = 0;
+            t.items.clear();
+            for (auto i : items)
+                add_to_leaf(target, i);
+        }
+
+        void gather_and_free(proxy_type first, std::vector<proxy_type>& items)
+        {
+            for (std::size_t c = 0; c < number_children; ++c)
+            {
+                auto& child = m_nodes[first + c];
+                if (child.is_leaf())
+                    items.insert(items.end(), child.items.begin(), child.items.end());
+                else
+                    gather_and_free(child.children, items);
+                child.items = std::vector<proxy_type>();
+            }
+            m_freeBlocks.push_back(first);
+        }
+
+        std::size_t m_leafCapacity;
+        length_type m_initialHalfExtent;
+        std::vector<node> m_nodes;//! The root is node 0.
+        std::vector<item> m_items;
+        std::vector<proxy_type> m_freeBlocks;
+        proxy_type m_free{ null_proxy };
+        std::size_t m_size{ 0 };
+
+    };
+
+    template <typename Point>
+    const std::size_t dynamic_spatial_index<Point>::dimension;
+    template <typename Point>
+    const std::size_t dynamic_spatial_index<Point>::number_children;
+    template <typename Point>
+    const typename dynamic_spatial_index<Point>::proxy_type dynamic_spatial_index<Point>::null_proxy;
+    template <typename Point>
+    const std::size_t dynamic_spatial_index<Point>::max_depth;
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_DYNAMIC_SPATIAL_INDEX_HPP
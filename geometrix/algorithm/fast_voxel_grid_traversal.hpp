@@ -14,6 +14,7 @@
 #include <geometrix/arithmetic/arithmetic.hpp>
 #include <geometrix/algorithm/cohen_sutherland_line_clipping.hpp>
 #include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
 #include <geometrix/primitive/point.hpp>
 #include <geometrix/algebra/algebra.hpp>
 #include <geometrix/numeric/constants.hpp>
@@ -22,9 +23,11 @@
 namespace geometrix
 {
     //! Traverse a grid using the algorithm presented in A fast voxel traversal algorithm for ray tracing J Amanatides, A Woo - Eurographics, 1987 - cse.yorku.ca
-    template <typename Grid, typename Segment, typename Visitor, typename NumberComparisonPolicy>
-    inline void fast_voxel_grid_traversal(const Grid& grid, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
+    //! The grid may be a grid_traits or any grid modeling Grid2DConcept.
+    template <typename GridOrTraits, typename Segment, typename Visitor, typename NumberComparisonPolicy>
+    inline void fast_voxel_grid_traversal(const GridOrTraits& gridOrTraits, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
     {
+        auto const& grid = get_grid_traits(gridOrTraits);
         BOOST_CONCEPT_ASSERT((Segment2DConcept<Segment>));
         using point_t = typename geometric_traits<Segment>::point_type;
         using length_t = typename geometric_traits<point_t>::arithmetic_type;
@@ -166,9 +169,10 @@ namespace geometrix
         }
     }
 
-    template <typename Grid, typename Segment, typename Visitor, typename NumberComparisonPolicy>
-    inline void stoppable_fast_voxel_grid_traversal(const Grid& grid, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
+    template <typename GridOrTraits, typename Segment, typename Visitor, typename NumberComparisonPolicy>
+    inline void stoppable_fast_voxel_grid_traversal(const GridOrTraits& gridOrTraits, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
     {
+        auto const& grid = get_grid_traits(gridOrTraits);
         BOOST_CONCEPT_ASSERT((Segment2DConcept<Segment>));
         using point_t = typename geometric_traits<Segment>::point_type;
         using length_t = typename geometric_traits<point_t>::arithmetic_type;
@@ -0,0 +1,194 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_FAST_VOXEL_GRID_TRAVERSAL_3D_HPP
+#define GEOMETRIX_ALGORITHM_FAST_VOXEL_GRID_TRAVERSAL_3D_HPP
+#pragma once
+
+#include <geometrix/primitive/segment_traits.hpp>
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+#include <geometrix/numeric/constants.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geometrix
+{
+    namespace detail
+    {
+        //! Traverse the cells of a 3D grid crossed by a segment in order from its start. The traversal runs in grid units
+        //! (see grid_traits_3d::get_scaled_grid_coordinate_x) with the segment parameterized over [0, 1] and clipped to the
+        //! bounds of the grid. Returns false if the visitor stopped the traversal.
+        template <typename GridTraits, typename Segment, typename Visitor, typename NumberComparisonPolicy>
+        inline bool fast_voxel_grid_traversal_3d(const GridTraits& grid, const Segment& segment, Visitor& visitor, const NumberComparisonPolicy& cmp)
+        {
+            BOOST_CONCEPT_ASSERT((Segment3DConcept<Segment>));
+            using dimensionless_t = typename GridTraits::dimensionless_type;
+
+            const auto zero = constants::zero<dimensionless_t>();
+            const auto one = constants::one<dimensionless_t>();
+
+            auto const& s = get_start(segment);
+            auto const& e = get_end(segment);
+            std::array<dimensionless_t, 3> p = { grid.get_scaled_grid_coordinate_x(get<0>(s)), grid.get_scaled_grid_coordinate_y(get<1>(s)), grid.get_scaled_grid_coordinate_z(get<2>(s)) };
+            std::array<dimensionless_t, 3> d = { grid.get_scaled_grid_coordinate_x(get<0>(e)) - p[0], grid.get_scaled_grid_coordinate_y(get<1>(e)) - p[1], grid.get_scaled_grid_coordinate_z(get<2>(e)) - p[2] };
+            std::array<dimensionless_t, 3> upper = { grid.get_scaled_grid_coordinate_x(grid.get_max_x()), grid.get_scaled_grid_coordinate_y(grid.get_max_y()), grid.get_scaled_grid_coordinate_z(grid.get_max_z()) };
+            std::array<boost::uint32_t, 3> n = { grid.get_width(), grid.get_height(), grid.get_depth() };
+
+            //! Clip the segment to the grid bounds one slab at a time.
+            dimensionless_t t0 = zero, t1 = one;
+            for (std::size_t a = 0; a < 3; ++a)
+            {
+                if (cmp.equals(d[a], zero))
+                {
+                    if (p[a] < zero || p[a] > upper[a])
+                        return true;
+                    d[a] = zero;
+                    continue;
+                }
+
+                auto ta = (zero - p[a]) / d[a];
+                auto tb = (upper[a] - p[a]) / d[a];
+                if (tb < ta)
+                    std::swap(ta, tb);
+                t0 = (std::max)(t0, ta);
+                t1 = (std::min)(t1, tb);
+            }
+
+            if (t1 < t0)
+                return true;
+
+            auto get_index = [&](std::size_t a, dimensionless_t t)
+            {
+                auto x = (std::max)(zero, p[a] + t * d[a]);
+                return (std::min)(static_cast<boost::uint32_t>(x), n[a] - 1);
+            };
+
+            std::array<boost::uint32_t, 3> cell = { get_index(0, t0), get_index(1, t0), get_index(2, t0) };
+            std::array<boost::uint32_t, 3> last = { get_index(0, t1), get_index(1, t1), get_index(2, t1) };
+            std::array<boost::int32_t, 3> step;
+            std::array<dimensionless_t, 3> tMax, tDelta;
+            for (std::size_t a = 0; a < 3; ++a)
+            {
+                if (d[a] > zero)
+                {
+                    step[a] = 1;
+                    tMax[a] = (construct<dimensionless_t>(cell[a] + 1) - p[a]) / d[a];
+                    tDelta[a] = one / d[a];
+                }
+                else if (d[a] < zero)
+                {
+                    step[a] = -1;
+                    tMax[a] = (construct<dimensionless_t>(cell[a]) - p[a]) / d[a];
+                    tDelta[a] = -one / d[a];
+                }
+                else
+                {
+                    step[a] = 0;
+                    tMax[a] = t1 + one;
+                    tDelta[a] = zero;
+                }
+            }
+
+            if (!visitor(cell[0], cell[1], cell[2]))
+                return false;
+
+            while (cell != last)
+            {
+                std::size_t a = tMax[0] < tMax[1] ? (tMax[0] < tMax[2] ? 0 : 2) : (tMax[1] < tMax[2] ? 1 : 2);
+                if (t1 < tMax[a])
+                    break;
+
+                cell[a] += step[a];
+                if (cell[a] >= n[a])
+                    break;
+                tMax[a] += tDelta[a];
+
+                if (!visitor(cell[0], cell[1], cell[2]))
+                    return false;
+            }
+
+            return true;
+        }
+    }//! namespace detail;
+
+    //! Traverse the voxels of a 3D grid crossed by a segment using the algorithm presented in A fast voxel traversal algorithm
+    //! for ray tracing J Amanatides, A Woo - Eurographics, 1987. The visitor is called as visitor(i, j, k) from the start of the
+    //! segment to its end for the cells inside the grid. The grid may be a grid_traits_3d or any grid modeling Grid3DConcept.
+    template <typename GridOrTraits, typename Segment, typename Visitor, typename NumberComparisonPolicy>
+    inline void fast_voxel_grid_traversal_3d(const GridOrTraits& gridOrTraits, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
+    {
+        auto v = [&visitor](boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) { visitor(i, j, k); return true; };
+        detail::fast_voxel_grid_traversal_3d(get_grid_traits(gridOrTraits), segment, v, cmp);
+    }
+
+    //! As fast_voxel_grid_traversal_3d but the traversal stops when the visitor returns false.
+    template <typename GridOrTraits, typename Segment, typename Visitor, typename NumberComparisonPolicy>
+    inline void stoppable_fast_voxel_grid_traversal_3d(const GridOrTraits& gridOrTraits, const Segment& segment, Visitor&& visitor, const NumberComparisonPolicy& cmp)
+    {
+        detail::fast_voxel_grid_traversal_3d(get_grid_traits(gridOrTraits), segment, visitor, cmp);
+    }
+
+    //! Traverse the voxels crossed by each segment of a random access range (e.g. the rays of a lidar scan from the sensor to
+    //! its returns). The traversals run concurrently in rounds of batchSize segments per thread, while the visitor is called
+    //! as visitor(segmentIndex, i, j, k) on the calling thread in the order of the segments, so it may write to a grid which
+    //! is not thread safe.
+    template <typename GridOrTraits, typename Segments, typename Visitor, typename NumberComparisonPolicy>
+    inline void fast_voxel_grid_traversal_3d_batch(const GridOrTraits& gridOrTraits, const Segments& segments, Visitor&& visitor, const NumberComparisonPolicy& cmp, std::size_t batchSize = 64, std::size_t nThreads = get_default_concurrency())
+    {
+        using cell_t = std::array<boost::uint32_t, 3>;
+        auto const& grid = get_grid_traits(gridOrTraits);
+        const std::size_t n = segments.size();
+        batchSize = (std::max)(std::size_t(1), batchSize);
+        nThreads = (std::max)(std::size_t(1), nThreads);
+        const std::size_t roundSize = batchSize * nThreads;
+
+        //! For each batch of the round the cells of its segments and the end of the cells of each segment.
+        std::vector<std::vector<cell_t>> cells(nThreads);
+        std::vector<std::vector<std::size_t>> ends(nThreads);
+        for (std::size_t first = 0; first < n; first += roundSize)
+        {
+            const std::size_t count = (std::min)(roundSize, n - first);
+            parallel_for_batches(count, batchSize, [&](std::size_t batch, std::size_t begin, std::size_t end)
+            {
+                auto& bCells = cells[batch];
+                auto& bEnds = ends[batch];
+                bCells.clear();
+                bEnds.clear();
+                auto collect = [&bCells](boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) { bCells.push_back(cell_t{ { i, j, k } }); return true; };
+                for (auto index = begin; index < end; ++index)
+                {
+                    detail::fast_voxel_grid_traversal_3d(grid, segments[first + index], collect, cmp);
+                    bEnds.push_back(bCells.size());
+                }
+            }, nThreads);
+
+            for (std::size_t batch = 0, index = first; batch < get_number_batches(count, batchSize); ++batch)
+            {
+                std::size_t c = 0;
+                for (auto end : ends[batch])
+                {
+                    for (; c < end; ++c)
+                        visitor(index, cells[batch][c][0], cells[batch][c][1], cells[batch][c][2]);
+                    ++index;
+                }
+            }
+        }
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_FAST_VOXEL_GRID_TRAVERSAL_3D_HPP
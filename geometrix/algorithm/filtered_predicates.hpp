@@ -0,0 +1,223 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_FILTERED_PREDICATES_HPP
+#define GEOMETRIX_FILTERED_PREDICATES_HPP
+#pragma once
+
+#include <geometrix/algorithm/orientation/orientation_enum.hpp>
+#include <geometrix/algorithm/linear_components_intersection.hpp>
+#include <geometrix/numeric/expansion_arithmetic.hpp>
+#include <geometrix/primitive/point_traits.hpp>
+#include <geometrix/primitive/segment_traits.hpp>
+#include <geometrix/tensor/vector_traits.hpp>
+#include <geometrix/utility/construction_policy.hpp>
+
+#include <cmath>
+#include <utility>
+
+//! Filtered geometric predicates for points with double coordinates.
+//!
+//! Each predicate first evaluates its determinant in ordinary floating point together with a forward error bound, i.e. as the
+//! midpoint-radius interval [det - err, det + err] which is guaranteed to contain the exact value. When the interval excludes
+//! zero the sign is certified at the cost of a few extra operations. Only when the sign is ambiguous is the determinant
+//! re-evaluated exactly with expansion arithmetic. The results are therefore exact and need no NumberComparisonPolicy.
+//! The error bounds are those of Shewchuk's predicates (see predicates.hpp) and assume IEEE round to nearest without underflow.
+namespace geometrix {
+
+    namespace filtered_predicates_detail {
+
+        //! 2^-53: the relative rounding error of IEEE double.
+        const double epsilon = 1.1102230246251565e-16;
+        const double orientation_bound = (3.0 + 16.0 * epsilon) * epsilon;
+        const double in_circle_bound = (10.0 + 96.0 * epsilon) * epsilon;
+        const double plane_side_bound = (4.0 + 32.0 * epsilon) * epsilon;
+
+        inline int sign_of(double v)
+        {
+            return v > 0.0 ? 1 : (v < 0.0 ? -1 : 0);
+        }
+
+        template <typename T>
+        inline double to_double(const T& v)
+        {
+            return construct<double>(v);
+        }
+
+        //! Sign of (ax - cx) * (by - cy) - (ay - cy) * (bx - cx).
+        inline int orientation_sign(double ax, double ay, double bx, double by, double cx, double cy)
+        {
+            double detleft = (ax - cx) * (by - cy);
+            double detright = (ay - cy) * (bx - cx);
+            double det = detleft - detright;
+
+            double detsum;
+            if (detleft > 0.0)
+            {
+                if (detright <= 0.0)
+                    return sign_of(det);
+                detsum = detleft + detright;
+            }
+            else if (detleft < 0.0)
+            {
+                if (detright >= 0.0)
+                    return sign_of(det);
+                detsum = -detleft - detright;
+            }
+            else
+                return sign_of(det);
+
+            double err = orientation_bound * detsum;
+            if (det >= err || -det >= err)
+                return sign_of(det);
+
+            auto exact = expansion::difference(ax, cx) * expansion::difference(by, cy) - expansion::difference(ay, cy) * expansion::difference(bx, cx);
+            return exact.sign();
+        }
+
+        inline int in_circle_sign(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+        {
+            double adx = ax - dx, bdx = bx - dx, cdx = cx - dx;
+            double ady = ay - dy, bdy = by - dy, cdy = cy - dy;
+
+            double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+            double alift = adx * adx + ady * ady;
+
+            double cdxady = cdx * ady, adxcdy = adx * cdy;
+            double blift = bdx * bdx + bdy * bdy;
+
+            double adxbdy = adx * bdy, bdxady = bdx * ady;
+            double clift = cdx * cdx + cdy * cdy;
+
+            double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+            double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift + (std::abs(cdxady) + std::abs(adxcdy)) * blift + (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+            double err = in_circle_bound * permanent;
+            if (det > err || -det > err)
+                return sign_of(det);
+
+            auto eadx = expansion::difference(ax, dx), ebdx = expansion::difference(bx, dx), ecdx = expansion::difference(cx, dx);
+            auto eady = expansion::difference(ay, dy), ebdy = expansion::difference(by, dy), ecdy = expansion::difference(cy, dy);
+            auto ealift = eadx * eadx + eady * eady;
+            auto eblift = ebdx * ebdx + ebdy * ebdy;
+            auto eclift = ecdx * ecdx + ecdy * ecdy;
+            auto exact = ealift * (ebdx * ecdy - ecdx * ebdy) + eblift * (ecdx * eady - eadx * ecdy) + eclift * (eadx * ebdy - ebdx * eady);
+            return exact.sign();
+        }
+
+        //! Sign of n . p - d.
+        template <std::size_t N>
+        inline int plane_side_sign(const double (&n)[N], const double (&p)[N], double d)
+        {
+            double s = -d;
+            double magnitude = std::abs(d);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                double t = n[i] * p[i];
+                s += t;
+                magnitude += std::abs(t);
+            }
+
+            double err = plane_side_bound * magnitude;
+            if (s > err || -s > err)
+                return sign_of(s);
+
+            auto exact = expansion(-d);
+            for (std::size_t i = 0; i < N; ++i)
+                exact = exact + expansion::product(n[i], p[i]);
+            return exact.sign();
+        }
+
+    }//! namespace filtered_predicates_detail;
+
+    //! Exact orientation of C relative to the line through A and B with the same convention as get_orientation.
+    template <typename Point1, typename Point2, typename Point3>
+    inline orientation_type filtered_orientation(const Point1& A, const Point2& B, const Point3& C)
+    {
+        using namespace filtered_predicates_detail;
+        return static_cast<orientation_type>(orientation_sign(to_double(get<0>(A)), to_double(get<1>(A)), to_double(get<0>(B)), to_double(get<1>(B)), to_double(get<0>(C)), to_double(get<1>(C))));
+    }
+
+    //! Exact in-circle test. Returns a positive value if D lies inside the circle through A, B and C, a negative value if it lies
+    //! outside and zero if the four points are cocircular. A, B and C must be in counterclockwise order (the sign is reversed otherwise).
+    template <typename Point1, typename Point2, typename Point3, typename Point4>
+    inline int filtered_in_circle(const Point1& A, const Point2& B, const Point3& C, const Point4& D)
+    {
+        using namespace filtered_predicates_detail;
+        return in_circle_sign(to_double(get<0>(A)), to_double(get<1>(A)), to_double(get<0>(B)), to_double(get<1>(B)), to_double(get<0>(C)), to_double(get<1>(C)), to_double(get<0>(D)), to_double(get<1>(D)));
+    }
+
+    //! Exact classification of the intersection of segments AB and CD without computing the intersection points.
+
+    //! Returns e_non_crossing if they are disjoint, e_crossing if they cross at a point interior to both, e_endpoint if they meet
+    //! at a single point which is an endpoint of one of them and e_overlapping if they are collinear and share more than one point.
+    template <typename PointA, typename PointB, typename PointC, typename PointD>
+    inline intersection_type filtered_segment_segment_classification(const PointA& A, const PointB& B, const PointC& C, const PointD& D)
+    {
+        using namespace filtered_predicates_detail;
+        auto o1 = filtered_orientation(A, B, C);
+        auto o2 = filtered_orientation(A, B, D);
+        auto o3 = filtered_orientation(C, D, A);
+        auto o4 = filtered_orientation(C, D, B);
+
+        if (o1 == oriented_collinear && o2 == oriented_collinear && o3 == oriented_collinear && o4 == oriented_collinear)
+        {
+            //! Collinear (or degenerate): compare the extents along the common line.
+            using point_t = std::pair<double, double>;
+            point_t a0(to_double(get<0>(A)), to_double(get<1>(A))), a1(to_double(get<0>(B)), to_double(get<1>(B)));
+            point_t c0(to_double(get<0>(C)), to_double(get<1>(C))), c1(to_double(get<0>(D)), to_double(get<1>(D)));
+            if (a1 < a0)
+                std::swap(a0, a1);
+            if (c1 < c0)
+                std::swap(c0, c1);
+
+            if (a1 < c0 || c1 < a0)
+                return e_non_crossing;
+            if (a1 == c0 || c1 == a0 || a0 == a1 || c0 == c1)
+                return e_endpoint;
+            return e_overlapping;
+        }
+
+        if (o1 * o2 > 0 || o3 * o4 > 0)
+            return e_non_crossing;
+
+        if (o1 == oriented_collinear || o2 == oriented_collinear || o3 == oriented_collinear || o4 == oriented_collinear)
+            return e_endpoint;
+
+        return e_crossing;
+    }
+
+    template <typename Segment1, typename Segment2>
+    inline intersection_type filtered_segment_segment_classification(const Segment1& s1, const Segment2& s2, typename std::enable_if<is_segment<Segment1>::value && is_segment<Segment2>::value>::type* = nullptr)
+    {
+        return filtered_segment_segment_classification(get_start(s1), get_end(s1), get_start(s2), get_end(s2));
+    }
+
+    namespace filtered_predicates_detail {
+
+        template <typename Point, typename Vector, std::size_t... I>
+        inline int plane_side(const Point& p, const Vector& n, double d, std::index_sequence<I...>)
+        {
+            const double na[] = { to_double(get<I>(n))... };
+            const double pa[] = { to_double(get<I>(p))... };
+            return plane_side_sign(na, pa, d);
+        }
+
+    }//! namespace filtered_predicates_detail;
+
+    //! Exact sign of the signed distance n . p - d of the point p from the hyperplane with normal n at distance d from the origin.
+    //! Positive values are in front of the plane.
+    template <typename Point, typename Vector, typename Length>
+    inline int filtered_plane_side(const Point& p, const Vector& n, const Length& d)
+    {
+        using namespace filtered_predicates_detail;
+        return plane_side(p, n, to_double(d), std::make_index_sequence<dimension_of<Point>::value>());
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_FILTERED_PREDICATES_HPP
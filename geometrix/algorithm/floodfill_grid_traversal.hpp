@@ -9,7 +9,9 @@
 #pragma once
 
 #include <geometrix/algorithm/fast_voxel_grid_traversal.hpp>
+#include <geometrix/algorithm/hash_grid_2d.hpp>
 #include <geometrix/primitive/segment.hpp>
+#include <geometrix/primitive/segment_range_view.hpp>
 #include <geometrix/primitive/polygon.hpp>
 #include <geometrix/primitive/polygon_with_holes.hpp>
 #include <geometrix/primitive/polyline.hpp>
@@ -25,11 +27,13 @@ namespace geometrix
     //! \class floodfill_grid_traversal
     //! This class encapsulates a color grid which can be used to perform
     //! flood-fill traversals on convex polygons. 
-    template <typename GridTraits>
+    //! The color grid is generated by ColorGridGenerator (see grid_2d, hash_grid_2d and tiled_grid_2d) and must model Grid2DConcept.
+    template <typename GridTraits, typename ColorGridGenerator = sparse_grid_type_generator>
     class floodfill_grid_traversal_helper
     {
         using grid_traits = GridTraits;
-        using grid = hash_grid_2d<std::uint32_t, grid_traits>;
+        using grid = typename ColorGridGenerator::template type<std::uint32_t, grid_traits>;
+        BOOST_CONCEPT_ASSERT((Grid2DConcept<grid>));
 		using cell_key = std::pair<std::uint32_t, std::uint32_t>;
 		using bound_map = std::unordered_map<std::uint32_t, cell_key>;
 		using cell_key_set = boost::container::flat_set<cell_key>;
@@ -129,12 +133,8 @@ namespace geometrix
                 update_bound(i,j);
                 visit_cell(i, j, v);
 			};
-            auto size = point_sequence_traits<Polygon>::size(pgon);
-            for(std::size_t i = 0, j = 1; i < size; ++i, ++j %= size)
-            {
-                segment_type segment(point_sequence_traits<Polygon>::get_point(pgon, i), point_sequence_traits<Polygon>::get_point(pgon, j));
+            for (const auto& segment : polygon_segment_view<Polygon, segment_type>(pgon))
 				fast_voxel_grid_traversal(m_gridTraits, segment, visitor, cmp);
-            }
         }
         
         template <typename Polygon, typename Visitor, typename NumberComparisonPolicy>
@@ -153,12 +153,8 @@ namespace geometrix
 					holeBoundMap.insert(it, std::make_pair(i, std::make_pair(j, j)));
                 visit_cell(i, j, v);
 			};
-            auto size = point_sequence_traits<Polygon>::size(pgon);
-            for(std::size_t i = 0, j = 1; i < size; ++i, ++j %= size)
-            {
-                segment_type segment(point_sequence_traits<Polygon>::get_point(pgon, i), point_sequence_traits<Polygon>::get_point(pgon, j));
+            for (const auto& segment : polygon_segment_view<Polygon, segment_type>(pgon))
 				fast_voxel_grid_traversal(m_gridTraits, segment, visitor, cmp);
-            }
 			for (auto item : holeBoundMap)
 				m_holeBoundMap[item.first].insert(item.second);
         }
@@ -288,10 +284,10 @@ namespace geometrix
     };
 
 	//! NOTE: Incomplete.. works only with convex polygons.
-    template <typename GridTraits, typename Polygon, typename Visitor, typename NumberComparisonPolicy, typename std::enable_if<is_polygon<Polygon>::value, int>::type = 0>
-    inline void floodfill_grid_traversal(const GridTraits& grid, const Polygon& pgon, Visitor&& v, const NumberComparisonPolicy& cmp)
+    template <typename GridTraits, typename Polygon, typename Visitor, typename NumberComparisonPolicy, typename ColorGridGenerator = sparse_grid_type_generator, typename std::enable_if<is_polygon<Polygon>::value, int>::type = 0>
+    inline void floodfill_grid_traversal(const GridTraits& grid, const Polygon& pgon, Visitor&& v, const NumberComparisonPolicy& cmp, ColorGridGenerator = ColorGridGenerator())
     {
-       auto ff = floodfill_grid_traversal_helper<GridTraits>(grid);
+       auto ff = floodfill_grid_traversal_helper<GridTraits, ColorGridGenerator>(grid);
        ff.mark_boundary(pgon, std::forward<Visitor>(v), cmp);
 	   ff.scan(std::forward<Visitor>(v));
        //auto start = ff.get_empty_interior();
@@ -300,10 +296,10 @@ namespace geometrix
     }
 
 	//! NOTE: Incomplete.. works only with convex polygons with convex holes.
-    template <typename GridTraits, typename Point, typename Visitor, typename NumberComparisonPolicy>
-    inline void floodfill_grid_traversal(const GridTraits& grid, const polygon_with_holes<Point>& pgon, Visitor&& v, const NumberComparisonPolicy& cmp)
+    template <typename GridTraits, typename Point, typename Visitor, typename NumberComparisonPolicy, typename ColorGridGenerator = sparse_grid_type_generator>
+    inline void floodfill_grid_traversal(const GridTraits& grid, const polygon_with_holes<Point>& pgon, Visitor&& v, const NumberComparisonPolicy& cmp, ColorGridGenerator = ColorGridGenerator())
     {
-       auto ff = floodfill_grid_traversal_helper<GridTraits>(grid);
+       auto ff = floodfill_grid_traversal_helper<GridTraits, ColorGridGenerator>(grid);
        ff.mark_boundary(pgon.get_outer(), std::forward<Visitor>(v), cmp);
 	   for (const auto& h : pgon.get_holes())
 		   ff.mark_hole_boundary(h, std::forward<Visitor>(v), cmp);
@@ -0,0 +1,967 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_GJK_EPA_HPP
+#define GEOMETRIX_ALGORITHM_GJK_EPA_HPP
+#pragma once
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+//! capsule.hpp uses segment without including it.
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/primitive/capsule.hpp>
+#include <geometrix/primitive/oriented_bounding_box.hpp>
+#include <geometrix/primitive/polygon.hpp>
+#include <geometrix/primitive/sphere.hpp>
+#include <geometrix/primitive/triangle.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+//! Distance, intersection and penetration queries between pairs of convex shapes of any type described by a support mapping
+//! (see convex_support_traits): the distance by the GJK algorithm (E. Gilbert, D. Johnson, S. Keerthi, A fast procedure for
+//! computing the distance between complex objects in three-dimensional space, 1988, with the termination criteria of
+//! G. van den Bergen, A Fast and Robust GJK Implementation for Collision Detection of Convex Objects, 1999) and the penetration
+//! depth by the expanding polytope algorithm (G. van den Bergen, Proximity Queries and Penetration Depth Computation on 3D Game
+//! Objects, 2001). The queries work in double precision in 2D and 3D.
+//!
+//! Shapes with a round part (spheres and capsules) are handled as a core shape plus a margin so that their distance is found
+//! exactly in a few iterations. A gjk_cache keeps the support directions of the final simplex of a query and seeds the next
+//! query on the same pair with them, which for shapes which moved a little since the last query typically converges in one
+//! or two iterations.
+namespace geometrix {
+
+    template <std::size_t Dimension>
+    using gjk_vector = std::array<double, Dimension>;
+
+    namespace gjk_detail {
+
+        template <std::size_t D>
+        inline gjk_vector<D> add(const gjk_vector<D>& a, const gjk_vector<D>& b)
+        {
+            gjk_vector<D> r;
+            for (std::size_t k = 0; k < D; ++k)
+                r[k] = a[k] + b[k];
+            return r;
+        }
+
+        template <std::size_t D>
+        inline gjk_vector<D> sub(const gjk_vector<D>& a, const gjk_vector<D>& b)
+        {
+            gjk_vector<D> r;
+            for (std::size_t k = 0; k < D; ++k)
+                r[k] = a[k] - b[k];
+            return r;
+        }
+
+        template <std::size_t D>
+        inline gjk_vector<D> scale(const gjk_vector<D>& a, double s)
+        {
+            gjk_vector<D> r;
+            for (std::size_t k = 0; k < D; ++k)
+                r[k] = a[k] * s;
+            return r;
+        }
+
+        template <std::size_t D>
+        inline gjk_vector<D> negate(const gjk_vector<D>& a)
+        {
+            return scale(a, -1.0);
+        }
+
+        template <std::size_t D>
+        inline double dot(const gjk_vector<D>& a, const gjk_vector<D>& b)
+        {
+            double r = 0;
+            for (std::size_t k = 0; k < D; ++k)
+                r += a[k] * b[k];
+            return r;
+        }
+
+        inline gjk_vector<3> cross(const gjk_vector<3>& a, const gjk_vector<3>& b)
+        {
+            return gjk_vector<3>{ { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] } };
+        }
+
+        template <typename Point>
+        inline gjk_vector<2> to_gjk_vector(const Point& p, dimension<2>)
+        {
+            using filtered_predicates_detail::to_double;
+            return gjk_vector<2>{ { to_double(get<0>(p)), to_double(get<1>(p)) } };
+        }
+
+        template <typename Point>
+        inline gjk_vector<3> to_gjk_vector(const Point& p, dimension<3>)
+        {
+            using filtered_predicates_detail::to_double;
+            return gjk_vector<3>{ { to_double(get<0>(p)), to_double(get<1>(p)), to_double(get<2>(p)) } };
+        }
+
+        template <typename Point>
+        inline gjk_vector<dimension_of<Point>::value> to_gjk_vector(const Point& p)
+        {
+            return to_gjk_vector(p, typename dimension_of<Point>::type());
+        }
+
+        template <typename T>
+        inline T from_gjk_vector(const gjk_vector<2>& v)
+        {
+            return construct<T>(v[0], v[1]);
+        }
+
+        template <typename T>
+        inline T from_gjk_vector(const gjk_vector<3>& v)
+        {
+            return construct<T>(v[0], v[1], v[2]);
+        }
+
+        //! The point of a sequence of points farthest along d.
+        template <typename Points, std::size_t D>
+        inline gjk_vector<D> get_vertex_support(const Points& points, const gjk_vector<D>& d)
+        {
+            GEOMETRIX_ASSERT(!points.empty());
+            auto best = to_gjk_vector(points[0]);
+            auto bestDot = dot(best, d);
+            for (std::size_t i = 1; i < points.size(); ++i)
+            {
+                auto p = to_gjk_vector(points[i]);
+                auto pDot = dot(p, d);
+                if (pDot > bestDot)
+                {
+                    best = p;
+                    bestDot = pDot;
+                }
+            }
+            return best;
+        }
+
+        template <typename Points, std::size_t D>
+        inline gjk_vector<D> get_vertex_center(const Points& points)
+        {
+            gjk_vector<D> c{};
+            for (auto const& p : points)
+                c = add(c, to_gjk_vector(p));
+            return scale(c, 1.0 / static_cast<double>((std::max)(points.size(), std::size_t{ 1 })));
+        }
+
+    }//! namespace gjk_detail;
+
+    //! \brief The support mapping of a convex shape.
+
+    //! Specializations provide the dimension, the point_type, get_support(shape, d) giving a point of the core of the shape
+    //! farthest along direction d, get_center(shape) giving a point inside the core and get_margin(shape) giving the radius by
+    //! which the core is grown into the shape.
+    template <typename Shape, typename EnableIf = void>
+    struct convex_support_traits;
+
+    template <typename Point>
+    struct convex_support_traits<segment<Point>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static gjk_vector<dimension> get_support(const segment<Point>& s, const gjk_vector<dimension>& d)
+        {
+            auto a = gjk_detail::to_gjk_vector(get_start(s)), b = gjk_detail::to_gjk_vector(get_end(s));
+            return gjk_detail::dot(a, d) >= gjk_detail::dot(b, d) ? a : b;
+        }
+        static gjk_vector<dimension> get_center(const segment<Point>& s) { return gjk_detail::scale(gjk_detail::add(gjk_detail::to_gjk_vector(get_start(s)), gjk_detail::to_gjk_vector(get_end(s))), 0.5); }
+        static double get_margin(const segment<Point>&) { return 0.0; }
+    };
+
+    template <typename Point>
+    struct convex_support_traits<triangle<Point>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static gjk_vector<dimension> get_support(const triangle<Point>& t, const gjk_vector<dimension>& d) { return gjk_detail::get_vertex_support(t, d); }
+        static gjk_vector<dimension> get_center(const triangle<Point>& t) { return gjk_detail::get_vertex_center<triangle<Point>, dimension>(t); }
+        static double get_margin(const triangle<Point>&) { return 0.0; }
+    };
+
+    //! A convex polygon, or more generally the convex hull of a sequence of points (e.g. the vertices of a convex polyhedron).
+    template <typename Point, typename Alloc>
+    struct convex_support_traits<polygon<Point, Alloc>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static gjk_vector<dimension> get_support(const polygon<Point, Alloc>& p, const gjk_vector<dimension>& d) { return gjk_detail::get_vertex_support(p, d); }
+        static gjk_vector<dimension> get_center(const polygon<Point, Alloc>& p) { return gjk_detail::get_vertex_center<polygon<Point, Alloc>, dimension>(p); }
+        static double get_margin(const polygon<Point, Alloc>&) { return 0.0; }
+    };
+
+    template <std::size_t N, typename Point>
+    struct convex_support_traits<sphere<N, Point>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = N;
+        static gjk_vector<dimension> get_support(const sphere<N, Point>& s, const gjk_vector<dimension>&) { return gjk_detail::to_gjk_vector(s.get_center()); }
+        static gjk_vector<dimension> get_center(const sphere<N, Point>& s) { return gjk_detail::to_gjk_vector(s.get_center()); }
+        static double get_margin(const sphere<N, Point>& s) { return filtered_predicates_detail::to_double(s.get_radius()); }
+    };
+
+    template <typename Point>
+    struct convex_support_traits<capsule<Point>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static gjk_vector<dimension> get_support(const capsule<Point>& c, const gjk_vector<dimension>& d) { return convex_support_traits<segment<Point>>::get_support(c.get_segment(), d); }
+        static gjk_vector<dimension> get_center(const capsule<Point>& c) { return convex_support_traits<segment<Point>>::get_center(c.get_segment()); }
+        static double get_margin(const capsule<Point>& c) { return filtered_predicates_detail::to_double(c.get_radius()); }
+    };
+
+    template <typename Point, typename Vector>
+    struct convex_support_traits<oriented_bounding_box<Point, Vector>>
+    {
+        using point_type = Point;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static gjk_vector<dimension> get_support(const oriented_bounding_box<Point, Vector>& b, const gjk_vector<dimension>& d)
+        {
+            using filtered_predicates_detail::to_double;
+            auto p = gjk_detail::to_gjk_vector(b.get_center());
+            for (std::size_t i = 0; i < dimension; ++i)
+            {
+                auto axis = gjk_detail::to_gjk_vector(b.get_axis(i), typename dimension_of<Point>::type());
+                auto h = to_double(b.get_halfwidth(i));
+                p = gjk_detail::add(p, gjk_detail::scale(axis, gjk_detail::dot(axis, d) >= 0 ? h : -h));
+            }
+            return p;
+        }
+        static gjk_vector<dimension> get_center(const oriented_bounding_box<Point, Vector>& b) { return gjk_detail::to_gjk_vector(b.get_center()); }
+        static double get_margin(const oriented_bounding_box<Point, Vector>&) { return 0.0; }
+    };
+
+    //! The support directions of the final simplex of a query used to seed the next query on the same pair of shapes.
+    template <std::size_t Dimension>
+    struct gjk_cache
+    {
+        std::array<gjk_vector<Dimension>, Dimension + 1> directions;
+        std::size_t size = 0;
+
+        void clear() { size = 0; }
+    };
+
+    //! \brief The result of a query between two convex shapes.
+    template <typename Point>
+    struct convex_contact
+    {
+        using vector_type = vector<double, dimension_of<Point>::value>;
+
+        //! True if the shapes overlap or touch.
+        bool        intersecting = false;
+
+        //! The distance between the shapes if they are apart, and minus the penetration depth if they overlap (zero when the
+        //! penetration depth was not computed).
+        double      distance = 0;
+
+        //! The closest points of the shapes if they are apart or their deepest points into each other if they overlap.
+        Point       pointA;
+        Point       pointB;
+
+        //! The unit direction in which to move B to increase the distance from A (zero if undetermined).
+        vector_type normal;
+
+        std::size_t iterations = 0;
+    };
+
+    namespace gjk_detail {
+
+        template <std::size_t D>
+        struct simplex
+        {
+            //! The vertices of the Minkowski difference A - B, the support points on A and B and the directions of the supports.
+            std::array<gjk_vector<D>, D + 1> w, a, b, d;
+            std::array<double, D + 1>        lambda;
+            std::size_t                      size = 0;
+
+            void push_back(const gjk_vector<D>& wi, const gjk_vector<D>& ai, const gjk_vector<D>& bi, const gjk_vector<D>& di)
+            {
+                GEOMETRIX_ASSERT(size < D + 1);
+                w[size] = wi;
+                a[size] = ai;
+                b[size] = bi;
+                d[size] = di;
+                ++size;
+            }
+
+            //! Keep the vertices with positive weights.
+            void compact()
+            {
+                std::size_t n = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if (lambda[i] > 0)
+                    {
+                        w[n] = w[i];
+                        a[n] = a[i];
+                        b[n] = b[i];
+                        d[n] = d[i];
+                        lambda[n] = lambda[i];
+                        ++n;
+                    }
+                }
+                size = n;
+            }
+        };
+
+        template <typename ShapeA, typename ShapeB, std::size_t D>
+        inline void add_support(const ShapeA& A, const ShapeB& B, const gjk_vector<D>& d, simplex<D>& s)
+        {
+            auto a = convex_support_traits<ShapeA>::get_support(A, d);
+            auto b = convex_support_traits<ShapeB>::get_support(B, negate(d));
+            s.push_back(sub(a, b), a, b, d);
+        }
+
+        //! Weights of the point of segment [A, B] closest to the origin.
+        template <std::size_t D>
+        inline std::array<double, 2> get_closest_on_segment(const gjk_vector<D>& A, const gjk_vector<D>& B)
+        {
+            auto ab = sub(B, A);
+            auto ll = dot(ab, ab);
+            auto t = ll > 0 ? -dot(A, ab) / ll : 0.0;
+            if (!(t > 0))
+                return { { 1.0, 0.0 } };
+            if (t >= 1)
+                return { { 0.0, 1.0 } };
+            return { { 1.0 - t, t } };
+        }
+
+        //! Weights of the point of triangle ABC closest to the origin by the Voronoi regions of the triangle (C. Ericson,
+        //! Real-Time Collision Detection, 2005, 5.1.5). interior is set if the point is inside the triangle.
+        template <std::size_t D>
+        inline std::array<double, 3> get_closest_on_triangle(const gjk_vector<D>& A, const gjk_vector<D>& B, const gjk_vector<D>& C, bool& interior)
+        {
+            interior = false;
+            auto ab = sub(B, A), ac = sub(C, A);
+            auto d1 = -dot(ab, A), d2 = -dot(ac, A);
+            if (d1 <= 0 && d2 <= 0)
+                return { { 1.0, 0.0, 0.0 } };
+
+            auto d3 = -dot(ab, B), d4 = -dot(ac, B);
+            if (d3 >= 0 && d4 <= d3)
+                return { { 0.0, 1.0, 0.0 } };
+
+            auto vc = d1 * d4 - d3 * d2;
+            if (vc <= 0 && d1 >= 0 && d3 <= 0)
+            {
+                auto t = d1 / (d1 - d3);
+                return { { 1.0 - t, t, 0.0 } };
+            }
+
+            auto d5 = -dot(ab, C), d6 = -dot(ac, C);
+            if (d6 >= 0 && d5 <= d6)
+                return { { 0.0, 0.0, 1.0 } };
+
+            auto vb = d5 * d2 - d1 * d6;
+            if (vb <= 0 && d2 >= 0 && d6 <= 0)
+            {
+                auto t = d2 / (d2 - d6);
+                return { { 1.0 - t, 0.0, t } };
+            }
+
+            auto va = d3 * d6 - d5 * d4;
+            if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+            {
+                auto t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                return { { 0.0, 1.0 - t, t } };
+            }
+
+            auto total = va + vb + vc;
+            if (!(total > 0))
+            {
+                //! A degenerate triangle: take the closest of its edges.
+                std::array<double, 3> best = { { 1.0, 0.0, 0.0 } };
+                double bestDistance = dot(A, A);
+                const gjk_vector<D>* v[3] = { &A, &B, &C };
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    auto j = (i + 1) % 3;
+                    auto l = get_closest_on_segment(*v[i], *v[j]);
+                    auto p = add(scale(*v[i], l[0]), scale(*v[j], l[1]));
+                    auto distance = dot(p, p);
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        best = std::array<double, 3>{ { 0.0, 0.0, 0.0 } };
+                        best[i] = l[0];
+                        best[j] = l[1];
+                    }
+                }
+                return best;
+            }
+
+            interior = true;
+            auto v = vb / total, w = vc / total;
+            return { { 1.0 - v - w, v, w } };
+        }
+
+        //! Set the weights of the point of the simplex closest to the origin and return that point. Returns true in contains if
+        //! the simplex is full dimensional and contains the origin.
+        inline gjk_vector<2> reduce(simplex<2>& s, bool& contains)
+        {
+            contains = false;
+            switch (s.size)
+            {
+            case 1:
+                s.lambda[0] = 1;
+                break;
+            case 2:
+            {
+                auto l = get_closest_on_segment(s.w[0], s.w[1]);
+                s.lambda[0] = l[0];
+                s.lambda[1] = l[1];
+                break;
+            }
+            default:
+            {
+                auto l = get_closest_on_triangle(s.w[0], s.w[1], s.w[2], contains);
+                std::copy(l.begin(), l.end(), s.lambda.begin());
+                if (contains)
+                    return gjk_vector<2>{};
+            }
+            };
+
+            gjk_vector<2> v{};
+            for (std::size_t i = 0; i < s.size; ++i)
+                v = add(v, scale(s.w[i], s.lambda[i]));
+            s.compact();
+            return v;
+        }
+
+        inline gjk_vector<3> reduce(simplex<3>& s, bool& contains)
+        {
+            contains = false;
+            bool interior;
+            switch (s.size)
+            {
+            case 1:
+                s.lambda[0] = 1;
+                break;
+            case 2:
+            {
+                auto l = get_closest_on_segment(s.w[0], s.w[1]);
+                s.lambda[0] = l[0];
+                s.lambda[1] = l[1];
+                break;
+            }
+            case 3:
+            {
+                auto l = get_closest_on_triangle(s.w[0], s.w[1], s.w[2], interior);
+                std::copy(l.begin(), l.end(), s.lambda.begin());
+                break;
+            }
+            default:
+            {
+                //! The closest point is on one of the faces which separate the origin from the opposite vertex.
+                static const std::size_t faces[4][4] = { { 0, 1, 2, 3 }, { 0, 1, 3, 2 }, { 0, 2, 3, 1 }, { 1, 2, 3, 0 } };
+                double bestDistance = (std::numeric_limits<double>::max)();
+                bool outside = false;
+                for (auto const& f : faces)
+                {
+                    auto n = cross(sub(s.w[f[1]], s.w[f[0]]), sub(s.w[f[2]], s.w[f[0]]));
+                    auto so = -dot(n, s.w[f[0]]);
+                    auto sl = dot(n, sub(s.w[f[3]], s.w[f[0]]));
+                    if (so * sl < 0 || sl == 0)
+                    {
+                        outside = true;
+                        auto l = get_closest_on_triangle(s.w[f[0]], s.w[f[1]], s.w[f[2]], interior);
+                        auto p = add(add(scale(s.w[f[0]], l[0]), scale(s.w[f[1]], l[1])), scale(s.w[f[2]], l[2]));
+                        auto distance = dot(p, p);
+                        if (distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            s.lambda[f[0]] = l[0];
+                            s.lambda[f[1]] = l[1];
+                            s.lambda[f[2]] = l[2];
+                            s.lambda[f[3]] = 0;
+                        }
+                    }
+                }
+
+                if (!outside)
+                {
+                    contains = true;
+                    return gjk_vector<3>{};
+                }
+            }
+            };
+
+            gjk_vector<3> v{};
+            for (std::size_t i = 0; i < s.size; ++i)
+                v = add(v, scale(s.w[i], s.lambda[i]));
+            s.compact();
+            return v;
+        }
+
+        template <std::size_t D>
+        struct gjk_state
+        {
+            simplex<D>    s;
+            gjk_vector<D> v;            //! The point of A - B closest to the origin if the cores are apart.
+            bool          intersecting;
+            bool          separated;    //! The query stopped early as the distance exceeds the separation threshold.
+            std::size_t   iterations;
+        };
+
+        //! Run GJK on the cores of the shapes seeded from the cache. If the lower bound on the distance of the cores rises above
+        //! separation the query stops early with separated set.
+        template <typename ShapeA, typename ShapeB, std::size_t D>
+        inline gjk_state<D> run_gjk(const ShapeA& A, const ShapeB& B, gjk_cache<D>& cache, double separation, std::size_t maxIterations)
+        {
+            const double relativeTolerance = 1e-10;
+            const double absoluteTolerance = 1e-20;
+
+            gjk_state<D> state;
+            state.intersecting = false;
+            state.separated = false;
+            state.iterations = 0;
+            auto& s = state.s;
+
+            for (std::size_t i = 0; i < cache.size; ++i)
+            {
+                add_support(A, B, cache.directions[i], s);
+                for (std::size_t j = 0; j + 1 < s.size; ++j)
+                {
+                    auto delta = sub(s.w[j], s.w[s.size - 1]);
+                    if (dot(delta, delta) == 0)
+                    {
+                        --s.size;
+                        break;
+                    }
+                }
+            }
+
+            if (s.size == 0)
+            {
+                auto d = sub(convex_support_traits<ShapeB>::get_center(B), convex_support_traits<ShapeA>::get_center(A));
+                if (dot(d, d) == 0)
+                    d[0] = 1;
+                add_support(A, B, d, s);
+            }
+
+            double scale2 = 0;
+            while (true)
+            {
+                for (std::size_t i = 0; i < s.size; ++i)
+                    scale2 = (std::max)(scale2, dot(s.w[i], s.w[i]));
+
+                bool contains;
+                state.v = reduce(s, contains);
+                auto vv = dot(state.v, state.v);
+                if (contains || vv <= absoluteTolerance * scale2)
+                {
+                    state.intersecting = true;
+                    break;
+                }
+
+                if (state.iterations == maxIterations)
+                    break;
+                ++state.iterations;
+
+                auto d = negate(state.v);
+                add_support(A, B, d, s);
+                auto const& w = s.w[s.size - 1];
+                auto vw = dot(state.v, w);
+                if (vw > 0 && vw * vw > separation * separation * vv)
+                {
+                    state.separated = true;
+                    --s.size;
+                    break;
+                }
+
+                bool duplicate = false;
+                for (std::size_t i = 0; i + 1 < s.size; ++i)
+                {
+                    auto delta = sub(s.w[i], w);
+                    duplicate = duplicate || dot(delta, delta) <= absoluteTolerance * scale2;
+                }
+
+                if (duplicate || vv - vw <= relativeTolerance * vv)
+                {
+                    --s.size;
+                    break;
+                }
+            }
+
+            cache.size = s.size;
+            std::copy(s.d.begin(), s.d.begin() + s.size, cache.directions.begin());
+            return state;
+        }
+
+        template <std::size_t D>
+        inline void get_closest_points(const simplex<D>& s, gjk_vector<D>& pa, gjk_vector<D>& pb)
+        {
+            pa = gjk_vector<D>{};
+            pb = gjk_vector<D>{};
+            for (std::size_t i = 0; i < s.size; ++i)
+            {
+                pa = add(pa, scale(s.a[i], s.lambda[i]));
+                pb = add(pb, scale(s.b[i], s.lambda[i]));
+            }
+        }
+
+        //! Grow a simplex which contains the origin (possibly on its boundary) to full dimension.
+        template <typename ShapeA, typename ShapeB, std::size_t D>
+        inline bool complete_simplex(const ShapeA& A, const ShapeB& B, simplex<D>& s)
+        {
+            double scale2 = 0;
+            for (std::size_t i = 0; i < s.size; ++i)
+                scale2 = (std::max)(scale2, dot(s.w[i], s.w[i]));
+            const double tolerance = 1e-20 * (std::max)(scale2, 1e-300);
+
+            std::vector<gjk_vector<D>> candidates;
+            for (std::size_t k = 0; k < D; ++k)
+            {
+                gjk_vector<D> e{};
+                e[k] = 1;
+                candidates.push_back(e);
+                candidates.push_back(negate(e));
+            }
+
+            //! The squared distance of w from the affine hull of the simplex (as the residual of the projection).
+            auto get_offset = [&](const gjk_vector<D>& w)
+            {
+                auto r = sub(w, s.w[0]);
+                std::array<gjk_vector<D>, D> basis;
+                std::size_t nBasis = 0;
+                for (std::size_t i = 1; i < s.size; ++i)
+                {
+                    auto e = sub(s.w[i], s.w[0]);
+                    for (std::size_t j = 0; j < nBasis; ++j)
+                        e = sub(e, scale(basis[j], dot(e, basis[j])));
+                    auto ee = dot(e, e);
+                    if (ee > tolerance)
+                        basis[nBasis++] = scale(e, 1.0 / std::sqrt(ee));
+                }
+                for (std::size_t j = 0; j < nBasis; ++j)
+                    r = sub(r, scale(basis[j], dot(r, basis[j])));
+                return dot(r, r);
+            };
+
+            for (std::size_t c = 0; c < candidates.size() && s.size < D + 1; ++c)
+            {
+                add_support(A, B, candidates[c], s);
+                auto w = s.w[s.size - 1];
+                --s.size;
+                if (get_offset(w) > tolerance)
+                    add_support(A, B, candidates[c], s);
+            }
+
+            return s.size == D + 1;
+        }
+
+        template <std::size_t D>
+        struct polytope_vertex
+        {
+            gjk_vector<D> w, a, b;
+        };
+
+        //! Expand the simplex containing the origin into the polygon A - B until the edge closest to the origin is on its boundary.
+        template <typename ShapeA, typename ShapeB>
+        inline bool run_epa(const ShapeA& A, const ShapeB& B, const simplex<2>& s, double& depth, gjk_vector<2>& normal, gjk_vector<2>& pa, gjk_vector<2>& pb, std::size_t& iterations, std::size_t maxIterations)
+        {
+            const double tolerance = 1e-10;
+            using vertex_t = polytope_vertex<2>;
+            std::vector<vertex_t> poly;
+            for (std::size_t i = 0; i < 3; ++i)
+                poly.push_back(vertex_t{ s.w[i], s.a[i], s.b[i] });
+            auto e1 = sub(poly[1].w, poly[0].w), e2 = sub(poly[2].w, poly[0].w);
+            if (e1[0] * e2[1] - e1[1] * e2[0] < 0)
+                std::swap(poly[1], poly[2]);
+
+            while (true)
+            {
+                std::size_t best = poly.size();
+                double bestDistance = (std::numeric_limits<double>::max)();
+                gjk_vector<2> bestNormal{};
+                for (std::size_t i = 0; i < poly.size(); ++i)
+                {
+                    auto e = sub(poly[(i + 1) % poly.size()].w, poly[i].w);
+                    auto l = std::sqrt(dot(e, e));
+                    if (!(l > 0))
+                        continue;
+                    gjk_vector<2> n = { { e[1] / l, -e[0] / l } };
+                    auto distance = dot(n, poly[i].w);
+                    if (distance < bestDistance)
+                    {
+                        best = i;
+                        bestDistance = distance;
+                        bestNormal = n;
+                    }
+                }
+
+                if (best == poly.size())
+                    return false;
+
+                vertex_t v;
+                v.a = convex_support_traits<ShapeA>::get_support(A, bestNormal);
+                v.b = convex_support_traits<ShapeB>::get_support(B, negate(bestNormal));
+                v.w = sub(v.a, v.b);
+                if (iterations == maxIterations || dot(v.w, bestNormal) - bestDistance <= tolerance * (std::max)(1.0, std::abs(bestDistance)))
+                {
+                    auto const& p = poly[best];
+                    auto const& q = poly[(best + 1) % poly.size()];
+                    auto l = get_closest_on_segment(p.w, q.w);
+                    depth = bestDistance;
+                    normal = bestNormal;
+                    pa = add(scale(p.a, l[0]), scale(q.a, l[1]));
+                    pb = add(scale(p.b, l[0]), scale(q.b, l[1]));
+                    return true;
+                }
+
+                ++iterations;
+                poly.insert(poly.begin() + best + 1, v);
+            }
+        }
+
+        //! Expand the tetrahedron containing the origin into the polytope A - B until the face closest to the origin is on its boundary.
+        template <typename ShapeA, typename ShapeB>
+        inline bool run_epa(const ShapeA& A, const ShapeB& B, const simplex<3>& s, double& depth, gjk_vector<3>& normal, gjk_vector<3>& pa, gjk_vector<3>& pb, std::size_t& iterations, std::size_t maxIterations)
+        {
+            const double tolerance = 1e-10;
+            using vertex_t = polytope_vertex<3>;
+            struct face
+            {
+                std::array<std::size_t, 3> v;
+                gjk_vector<3>              n;
+                double                     distance;
+            };
+
+            std::vector<vertex_t> vertices;
+            gjk_vector<3> center{};
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                vertices.push_back(vertex_t{ s.w[i], s.a[i], s.b[i] });
+                center = add(center, scale(s.w[i], 0.25));
+            }
+
+            std::vector<face> faces;
+            auto add_face = [&](std::size_t i, std::size_t j, std::size_t k, bool orient)
+            {
+                auto n = cross(sub(vertices[j].w, vertices[i].w), sub(vertices[k].w, vertices[i].w));
+                if (orient && dot(n, sub(vertices[i].w, center)) < 0)
+                {
+                    std::swap(j, k);
+                    n = negate(n);
+                }
+                auto l = std::sqrt(dot(n, n));
+                if (!(l > 0))
+                    return;
+                n = scale(n, 1.0 / l);
+                faces.push_back(face{ { { i, j, k } }, n, dot(n, vertices[i].w) });
+            };
+
+            add_face(0, 1, 2, true);
+            add_face(0, 1, 3, true);
+            add_face(0, 2, 3, true);
+            add_face(1, 2, 3, true);
+
+            std::vector<std::pair<std::size_t, std::size_t>> horizon;
+            while (!faces.empty())
+            {
+                std::size_t best = 0;
+                for (std::size_t i = 1; i < faces.size(); ++i)
+                    if (faces[i].distance < faces[best].distance)
+                        best = i;
+
+                auto const& f = faces[best];
+                vertex_t v;
+                v.a = convex_support_traits<ShapeA>::get_support(A, f.n);
+                v.b = convex_support_traits<ShapeB>::get_support(B, negate(f.n));
+                v.w = sub(v.a, v.b);
+                if (iterations == maxIterations || dot(v.w, f.n) - f.distance <= tolerance * (std::max)(1.0, std::abs(f.distance)))
+                {
+                    auto p = scale(f.n, f.distance);
+                    bool interior;
+                    auto l = get_closest_on_triangle(sub(vertices[f.v[0]].w, p), sub(vertices[f.v[1]].w, p), sub(vertices[f.v[2]].w, p), interior);
+                    depth = f.distance;
+                    normal = f.n;
+                    pa = pb = gjk_vector<3>{};
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        pa = add(pa, scale(vertices[f.v[k]].a, l[k]));
+                        pb = add(pb, scale(vertices[f.v[k]].b, l[k]));
+                    }
+                    return true;
+                }
+
+                ++iterations;
+                auto index = vertices.size();
+                vertices.push_back(v);
+
+                //! Remove the faces seen from the new vertex and close the hole with faces on its horizon.
+                horizon.clear();
+                std::vector<face> kept;
+                for (auto const& g : faces)
+                {
+                    if (dot(g.n, sub(v.w, vertices[g.v[0]].w)) > 0)
+                    {
+                        for (std::size_t k = 0; k < 3; ++k)
+                        {
+                            auto edge = std::make_pair(g.v[k], g.v[(k + 1) % 3]);
+                            auto reverse = std::find(horizon.begin(), horizon.end(), std::make_pair(edge.second, edge.first));
+                            if (reverse != horizon.end())
+                                horizon.erase(reverse);
+                            else
+                                horizon.push_back(edge);
+                        }
+                    }
+                    else
+                        kept.push_back(g);
+                }
+
+                faces.swap(kept);
+                for (auto const& edge : horizon)
+                    add_face(edge.first, edge.second, index, false);
+            }
+
+            return false;
+        }
+
+        template <typename ShapeA, typename ShapeB>
+        using contact_t = convex_contact<typename convex_support_traits<ShapeA>::point_type>;
+
+        //! Fill the contact of shapes whose cores are apart from the closest points of the cores.
+        template <typename Contact, std::size_t D>
+        inline void set_margin_contact(Contact& result, const gjk_vector<D>& pa, const gjk_vector<D>& pb, double ra, double rb)
+        {
+            using point_t = decltype(result.pointA);
+            using vector_t = typename Contact::vector_type;
+            auto n = sub(pb, pa);
+            auto l = std::sqrt(dot(n, n));
+            n = l > 0 ? scale(n, 1.0 / l) : gjk_vector<D>{};
+            result.distance = l - ra - rb;
+            result.intersecting = result.distance <= 0;
+            result.pointA = from_gjk_vector<point_t>(add(pa, scale(n, ra)));
+            result.pointB = from_gjk_vector<point_t>(sub(pb, scale(n, rb)));
+            result.normal = from_gjk_vector<vector_t>(n);
+        }
+
+    }//! namespace gjk_detail;
+
+    //! Compute the distance and closest points of two convex shapes. If they intersect only the intersecting flag is meaningful.
+    template <typename ShapeA, typename ShapeB>
+    inline gjk_detail::contact_t<ShapeA, ShapeB> gjk_distance(const ShapeA& a, const ShapeB& b, gjk_cache<convex_support_traits<ShapeA>::dimension>& cache, std::size_t maxIterations = 64)
+    {
+        using namespace gjk_detail;
+        static_assert(convex_support_traits<ShapeA>::dimension == convex_support_traits<ShapeB>::dimension, "The shapes must have the same dimension.");
+        const std::size_t D = convex_support_traits<ShapeA>::dimension;
+
+        gjk_detail::contact_t<ShapeA, ShapeB> result;
+        auto state = run_gjk(a, b, cache, (std::numeric_limits<double>::max)(), maxIterations);
+        result.iterations = state.iterations;
+        if (state.intersecting)
+        {
+            result.intersecting = true;
+            return result;
+        }
+
+        gjk_vector<D> pa, pb;
+        get_closest_points(state.s, pa, pb);
+        set_margin_contact(result, pa, pb, convex_support_traits<ShapeA>::get_margin(a), convex_support_traits<ShapeB>::get_margin(b));
+        if (result.intersecting)
+            result.distance = 0;
+        return result;
+    }
+
+    template <typename ShapeA, typename ShapeB>
+    inline gjk_detail::contact_t<ShapeA, ShapeB> gjk_distance(const ShapeA& a, const ShapeB& b)
+    {
+        gjk_cache<convex_support_traits<ShapeA>::dimension> cache;
+        return gjk_distance(a, b, cache);
+    }
+
+    //! Test whether two convex shapes intersect. The query stops as soon as a separating direction is found.
+    template <typename ShapeA, typename ShapeB>
+    inline bool gjk_intersection(const ShapeA& a, const ShapeB& b, gjk_cache<convex_support_traits<ShapeA>::dimension>& cache, std::size_t maxIterations = 64)
+    {
+        using namespace gjk_detail;
+        static_assert(convex_support_traits<ShapeA>::dimension == convex_support_traits<ShapeB>::dimension, "The shapes must have the same dimension.");
+        const std::size_t D = convex_support_traits<ShapeA>::dimension;
+
+        auto margin = convex_support_traits<ShapeA>::get_margin(a) + convex_support_traits<ShapeB>::get_margin(b);
+        auto state = run_gjk(a, b, cache, margin, maxIterations);
+        if (state.intersecting)
+            return true;
+        if (state.separated)
+            return false;
+
+        gjk_vector<D> pa, pb;
+        get_closest_points(state.s, pa, pb);
+        auto delta = sub(pb, pa);
+        return dot(delta, delta) <= margin * margin;
+    }
+
+    template <typename ShapeA, typename ShapeB>
+    inline bool gjk_intersection(const ShapeA& a, const ShapeB& b)
+    {
+        gjk_cache<convex_support_traits<ShapeA>::dimension> cache;
+        return gjk_intersection(a, b, cache);
+    }
+
+    //! Compute the distance of two convex shapes if they are apart, or minus their penetration depth with the deepest points
+    //! and the direction in which to move B to separate them with the least translation if they overlap.
+    template <typename ShapeA, typename ShapeB>
+    inline gjk_detail::contact_t<ShapeA, ShapeB> gjk_epa_contact(const ShapeA& a, const ShapeB& b, gjk_cache<convex_support_traits<ShapeA>::dimension>& cache, std::size_t maxIterations = 64)
+    {
+        using namespace gjk_detail;
+        static_assert(convex_support_traits<ShapeA>::dimension == convex_support_traits<ShapeB>::dimension, "The shapes must have the same dimension.");
+        const std::size_t D = convex_support_traits<ShapeA>::dimension;
+        using point_t = typename convex_support_traits<ShapeA>::point_type;
+        using vector_t = typename gjk_detail::contact_t<ShapeA, ShapeB>::vector_type;
+
+        auto ra = convex_support_traits<ShapeA>::get_margin(a);
+        auto rb = convex_support_traits<ShapeB>::get_margin(b);
+
+        gjk_detail::contact_t<ShapeA, ShapeB> result;
+        auto state = run_gjk(a, b, cache, (std::numeric_limits<double>::max)(), maxIterations);
+        result.iterations = state.iterations;
+
+        gjk_vector<D> pa, pb;
+        if (!state.intersecting)
+        {
+            get_closest_points(state.s, pa, pb);
+            set_margin_contact(result, pa, pb, ra, rb);
+            return result;
+        }
+
+        result.intersecting = true;
+        double depth;
+        gjk_vector<D> n;
+        if (!complete_simplex(a, b, state.s) || !run_epa(a, b, state.s, depth, n, pa, pb, result.iterations, result.iterations + maxIterations))
+        {
+            //! The cores are flat and touching: there is no depth beyond the margins.
+            get_closest_points(state.s, pa, pb);
+            result.distance = -(ra + rb);
+            result.pointA = from_gjk_vector<point_t>(pa);
+            result.pointB = from_gjk_vector<point_t>(pb);
+            result.normal = from_gjk_vector<vector_t>(gjk_vector<D>{});
+            return result;
+        }
+
+        result.distance = -(depth + ra + rb);
+        result.pointA = from_gjk_vector<point_t>(add(pa, scale(n, ra)));
+        result.pointB = from_gjk_vector<point_t>(sub(pb, scale(n, rb)));
+        result.normal = from_gjk_vector<vector_t>(n);
+        return result;
+    }
+
+    template <typename ShapeA, typename ShapeB>
+    inline gjk_detail::contact_t<ShapeA, ShapeB> gjk_epa_contact(const ShapeA& a, const ShapeB& b)
+    {
+        gjk_cache<convex_support_traits<ShapeA>::dimension> cache;
+        return gjk_epa_contact(a, b, cache);
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_GJK_EPA_HPP
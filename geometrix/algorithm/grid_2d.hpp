@@ -12,6 +12,7 @@
 #pragma once
 
 #include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
 
 #include <boost/multi_array.hpp>
 #include <boost/functional/hash.hpp>
@@ -63,6 +64,29 @@ namespace geometrix
         {            
             return m_grid[i][j];
         }
+
+        //! Every cell of a dense grid exists.
+        template <typename Point>
+        data_type const* find_cell(const Point& point) const
+        {
+            return &get_cell(point);
+        }
+
+        template <typename Point>
+        data_type* find_cell(const Point& point)
+        {
+            return &get_cell(point);
+        }
+
+        data_type const* find_cell(boost::uint32_t i, boost::uint32_t j) const
+        {
+            return &m_grid[i][j];
+        }
+
+        data_type* find_cell(boost::uint32_t i, boost::uint32_t j)
+        {
+            return &m_grid[i][j];
+        }
         
         const traits_type& get_traits() const { return m_gridTraits; }
 
@@ -73,6 +97,15 @@ namespace geometrix
 			return m_gridTraits.is_contained( p );
 		}
 
+        //! Call visitor(i, j, data) for every cell.
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (boost::uint32_t i = 0; i < m_gridTraits.get_width(); ++i)
+                for (boost::uint32_t j = 0; j < m_gridTraits.get_height(); ++j)
+                    visitor(i, j, m_grid[i][j]);
+        }
+
     private:
 
 		traits_type m_gridTraits;
@@ -80,6 +113,12 @@ namespace geometrix
 
     };
 
+    struct dense_grid_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = grid_2d<Data, Traits>;
+    };
+
 }//! namespace geometrix
 
 #endif // GEOMETRIX_GRID_2D_HPP
@@ -0,0 +1,119 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_GRID_3D_HPP
+#define GEOMETRIX_ALGORITHM_GRID_3D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+
+#include <boost/multi_array.hpp>
+#include <boost/cstdint.hpp>
+
+namespace geometrix
+{
+    //! \brief A dense 3D grid holding a value for every cell of its grid_traits_3d.
+    template <typename Data, typename GridTraits>
+    class grid_3d
+    {
+    public:
+
+        typedef Data data_type;
+        typedef GridTraits traits_type;
+        typedef boost::multi_array<data_type, 3> grid_type;
+
+        grid_3d(const GridTraits& traits)
+            : m_gridTraits(traits)
+            , m_grid(boost::extents[traits.get_width()][traits.get_height()][traits.get_depth()])
+        {}
+
+        template <typename Point>
+        data_type const& get_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type const& get_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            return m_grid[i][j][k];
+        }
+
+        template <typename Point>
+        data_type& get_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type& get_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            return m_grid[i][j][k];
+        }
+
+        //! Every cell of a dense grid exists.
+        template <typename Point>
+        data_type const* find_cell(const Point& point) const
+        {
+            return &get_cell(point);
+        }
+
+        template <typename Point>
+        data_type* find_cell(const Point& point)
+        {
+            return &get_cell(point);
+        }
+
+        data_type const* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            return &m_grid[i][j][k];
+        }
+
+        data_type* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            return &m_grid[i][j][k];
+        }
+
+        const traits_type& get_traits() const { return m_gridTraits; }
+
+        template <typename Point>
+        bool is_contained(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            return m_gridTraits.is_contained(p);
+        }
+
+        //! Call visitor(i, j, k, data) for every cell.
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (boost::uint32_t i = 0; i < m_gridTraits.get_width(); ++i)
+                for (boost::uint32_t j = 0; j < m_gridTraits.get_height(); ++j)
+                    for (boost::uint32_t k = 0; k < m_gridTraits.get_depth(); ++k)
+                        visitor(i, j, k, m_grid[i][j][k]);
+        }
+
+    private:
+
+        traits_type m_gridTraits;
+        grid_type m_grid;
+
+    };
+
+    struct dense_grid_3d_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = grid_3d<Data, Traits>;
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_GRID_3D_HPP
@@ -0,0 +1,92 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_GRID_CONCEPT_HPP
+#define GEOMETRIX_ALGORITHM_GRID_CONCEPT_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/utility/ignore_unused_warnings.hpp>
+
+#include <boost/concept_check.hpp>
+#include <boost/cstdint.hpp>
+
+namespace geometrix
+{
+    //! \brief Concept of a 2D grid of cells laid out by a grid_traits.
+
+    //! A grid exposes its traits, tests containment of points and gives access to the data of the cell (i, j):
+    //! - find_cell(i, j) returns a pointer to the data of the cell or nullptr if the grid holds no data for it. It never allocates.
+    //! - get_cell(i, j) returns a reference to the data of the cell, creating it if the grid is sparse.
+    //! - for_each_cell(visitor) calls visitor(i, j, data) for every cell the grid holds data for.
+    //! grid_2d, hash_grid_2d and tiled_grid_2d model the concept.
+    template <typename Grid>
+    struct Grid2DConcept
+    {
+        using data_type = typename Grid::data_type;
+        using traits_type = typename Grid::traits_type;
+
+        BOOST_CONCEPT_USAGE(Grid2DConcept)
+        {
+            Grid* grid = 0;
+            const Grid* cgrid = 0;
+            const traits_type& traits = cgrid->get_traits();
+            data_type const* pcData = cgrid->find_cell(boost::uint32_t(), boost::uint32_t());
+            data_type& data = grid->get_cell(boost::uint32_t(), boost::uint32_t());
+            ignore_unused_warning_of(traits);
+            ignore_unused_warning_of(pcData);
+            ignore_unused_warning_of(data);
+        }
+    };
+
+    //! \brief Concept of a 3D grid of cells (voxels) laid out by a grid_traits_3d.
+
+    //! The 3D counterpart of Grid2DConcept with cells addressed by (i, j, k) and visited as visitor(i, j, k, data).
+    //! grid_3d, hash_grid_3d and tiled_grid_3d model the concept.
+    template <typename Grid>
+    struct Grid3DConcept
+    {
+        using data_type = typename Grid::data_type;
+        using traits_type = typename Grid::traits_type;
+
+        BOOST_CONCEPT_USAGE(Grid3DConcept)
+        {
+            Grid* grid = 0;
+            const Grid* cgrid = 0;
+            const traits_type& traits = cgrid->get_traits();
+            data_type const* pcData = cgrid->find_cell(boost::uint32_t(), boost::uint32_t(), boost::uint32_t());
+            data_type& data = grid->get_cell(boost::uint32_t(), boost::uint32_t(), boost::uint32_t());
+            ignore_unused_warning_of(traits);
+            ignore_unused_warning_of(pcData);
+            ignore_unused_warning_of(data);
+        }
+    };
+
+    //! Access the grid traits of a grid or of the traits themselves, so algorithms which only need the cell layout accept either.
+    template <typename Coordinate>
+    inline const grid_traits<Coordinate>& get_grid_traits(const grid_traits<Coordinate>& traits)
+    {
+        return traits;
+    }
+
+    template <typename Coordinate>
+    inline const grid_traits_3d<Coordinate>& get_grid_traits(const grid_traits_3d<Coordinate>& traits)
+    {
+        return traits;
+    }
+
+    template <typename Grid>
+    inline auto get_grid_traits(const Grid& grid) -> decltype(grid.get_traits())
+    {
+        return grid.get_traits();
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_GRID_CONCEPT_HPP
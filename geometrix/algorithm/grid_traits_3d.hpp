@@ -0,0 +1,156 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_GRID_TRAITS_3D_HPP
+#define GEOMETRIX_ALGORITHM_GRID_TRAITS_3D_HPP
+#pragma once
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/numeric/constants.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/cstdint.hpp>
+#include <tuple>
+
+namespace geometrix
+{
+    //! \brief The layout of a 3D grid of cubic cells (voxels) over the box [xmin, xmax] x [ymin, ymax] x [zmin, zmax].
+
+    //! The 3D counterpart of grid_traits. Cell (i, j, k) covers [xmin + i * cellWidth, xmin + (i + 1) * cellWidth) along x
+    //! and likewise along y (j) and z (k).
+    template <typename Coordinate>
+    class grid_traits_3d
+    {
+    public:
+
+        using coordinate_type = Coordinate;
+        using dimensionless_type = decltype(std::declval<coordinate_type>() / std::declval<coordinate_type>());
+        using inverse_coordinate_type = decltype(std::declval<dimensionless_type>() / std::declval<coordinate_type>());
+
+        grid_traits_3d(const coordinate_type& xmin, const coordinate_type& xmax, const coordinate_type& ymin, const coordinate_type& ymax, const coordinate_type& zmin, const coordinate_type& zmax, const coordinate_type& cellWidth)
+            : m_xmin(xmin)
+            , m_xmax(xmax)
+            , m_ymin(ymin)
+            , m_ymax(ymax)
+            , m_zmin(zmin)
+            , m_zmax(zmax)
+            , m_cellWidth(cellWidth)
+            , m_cellWidthDivisor(constants::one<dimensionless_type>() / cellWidth)
+        {
+            init();
+        }
+
+        grid_traits_3d(const std::tuple<coordinate_type, coordinate_type, coordinate_type, coordinate_type, coordinate_type, coordinate_type>& bounds, const coordinate_type& cellWidth)
+            : m_xmin(std::get<e_xmin>(bounds))
+            , m_xmax(std::get<e_xmax>(bounds))
+            , m_ymin(std::get<e_ymin>(bounds))
+            , m_ymax(std::get<e_ymax>(bounds))
+            , m_zmin(std::get<e_zmin>(bounds))
+            , m_zmax(std::get<e_zmax>(bounds))
+            , m_cellWidth(cellWidth)
+            , m_cellWidthDivisor(constants::one<dimensionless_type>() / cellWidth)
+        {
+            init();
+        }
+
+        coordinate_type get_min_x() const { return m_xmin; }
+        coordinate_type get_min_y() const { return m_ymin; }
+        coordinate_type get_min_z() const { return m_zmin; }
+        coordinate_type get_max_x() const { return m_xmax; }
+        coordinate_type get_max_y() const { return m_ymax; }
+        coordinate_type get_max_z() const { return m_zmax; }
+        coordinate_type get_cell_size() const { return m_cellWidth; }
+
+        boost::uint32_t get_x_index(coordinate_type x) const
+        {
+            GEOMETRIX_ASSERT(x >= m_xmin && x <= m_xmax);
+            return static_cast<boost::uint32_t>((x - m_xmin) * m_cellWidthDivisor);
+        }
+
+        boost::uint32_t get_y_index(coordinate_type y) const
+        {
+            GEOMETRIX_ASSERT(y >= m_ymin && y <= m_ymax);
+            return static_cast<boost::uint32_t>((y - m_ymin) * m_cellWidthDivisor);
+        }
+
+        boost::uint32_t get_z_index(coordinate_type z) const
+        {
+            GEOMETRIX_ASSERT(z >= m_zmin && z <= m_zmax);
+            return static_cast<boost::uint32_t>((z - m_zmin) * m_cellWidthDivisor);
+        }
+
+        boost::uint32_t get_width() const { return m_numberXCells; }
+        boost::uint32_t get_height() const { return m_numberYCells; }
+        boost::uint32_t get_depth() const { return m_numberZCells; }
+
+        template <typename Point>
+        bool is_contained(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            return get<0>(p) >= m_xmin && get<0>(p) <= m_xmax && get<1>(p) >= m_ymin && get<1>(p) <= m_ymax && get<2>(p) >= m_zmin && get<2>(p) <= m_zmax;
+        }
+
+        point<coordinate_type, 3> get_cell_centroid(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            return point<coordinate_type, 3>(m_xmin + construct<dimensionless_type>(i + 0.5) * m_cellWidth, m_ymin + construct<dimensionless_type>(j + 0.5) * m_cellWidth, m_zmin + construct<dimensionless_type>(k + 0.5) * m_cellWidth);
+        }
+
+        //! Access the corner of the cell with the lowest coordinates.
+        point<coordinate_type, 3> get_cell_corner0(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            return point<coordinate_type, 3>(m_xmin + construct<dimensionless_type>(i) * m_cellWidth, m_ymin + construct<dimensionless_type>(j) * m_cellWidth, m_zmin + construct<dimensionless_type>(k) * m_cellWidth);
+        }
+
+        axis_aligned_bounding_box<point<coordinate_type, 3>> get_cell_aabb(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            return axis_aligned_bounding_box<point<coordinate_type, 3>>{ get_cell_corner0(i, j, k), get_cell_corner0(i + 1, j + 1, k + 1) };
+        }
+
+        //! Access the x coordinate translated to the grid origin and scaled to grid units where a unit is the cell width.
+        dimensionless_type get_scaled_grid_coordinate_x(coordinate_type x) const { return (x - m_xmin) * m_cellWidthDivisor; }
+
+        //! Access the y coordinate translated to the grid origin and scaled to grid units where a unit is the cell width.
+        dimensionless_type get_scaled_grid_coordinate_y(coordinate_type y) const { return (y - m_ymin) * m_cellWidthDivisor; }
+
+        //! Access the z coordinate translated to the grid origin and scaled to grid units where a unit is the cell width.
+        dimensionless_type get_scaled_grid_coordinate_z(coordinate_type z) const { return (z - m_zmin) * m_cellWidthDivisor; }
+
+        point<coordinate_type, 3> get_origin() const { return point<coordinate_type, 3>(m_xmin, m_ymin, m_zmin); }
+
+    private:
+
+        void init()
+        {
+            GEOMETRIX_ASSERT(m_cellWidth > constants::zero<coordinate_type>());
+            GEOMETRIX_ASSERT(m_xmin < m_xmax && m_ymin < m_ymax && m_zmin < m_zmax);
+
+            m_numberXCells = boost::numeric_cast<boost::uint32_t>((m_xmax - m_xmin) * m_cellWidthDivisor) + 1;
+            m_numberYCells = boost::numeric_cast<boost::uint32_t>((m_ymax - m_ymin) * m_cellWidthDivisor) + 1;
+            m_numberZCells = boost::numeric_cast<boost::uint32_t>((m_zmax - m_zmin) * m_cellWidthDivisor) + 1;
+        }
+
+        coordinate_type m_xmin;
+        coordinate_type m_xmax;
+        coordinate_type m_ymin;
+        coordinate_type m_ymax;
+        coordinate_type m_zmin;
+        coordinate_type m_zmax;
+        coordinate_type m_cellWidth;
+        inverse_coordinate_type m_cellWidthDivisor;
+        boost::uint32_t m_numberXCells;
+        boost::uint32_t m_numberYCells;
+        boost::uint32_t m_numberZCells;
+
+    };
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_GRID_TRAITS_3D_HPP
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
 #include <boost/functional/hash.hpp>
 #include <boost/cstdint.hpp>
 #include <unordered_map>
@@ -127,6 +128,14 @@ namespace geometrix
 
 		void clear(){ m_grid.clear(); }
 
+        //! Call visitor(i, j, data) for every cell which has been created (in no particular order).
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (auto const& item : m_grid)
+                visitor(item.first.first, item.first.second, item.second);
+        }
+
     private:
 
 		traits_type m_gridTraits;
@@ -134,6 +143,12 @@ namespace geometrix
 
     };
 
+    struct sparse_grid_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = hash_grid_2d<Data, Traits>;
+    };
+
 }//! namespace geometrix
 
 #endif //! GEOMETRIX_HASH_GRID_2D_HPP
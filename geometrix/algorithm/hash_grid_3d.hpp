@@ -0,0 +1,125 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_HASH_GRID_3D_HPP
+#define GEOMETRIX_ALGORITHM_HASH_GRID_3D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+
+#include <boost/functional/hash.hpp>
+#include <boost/cstdint.hpp>
+#include <tuple>
+#include <unordered_map>
+
+namespace geometrix
+{
+    //! \brief A sparse 3D grid holding values only for the cells which have been accessed mutably.
+    template <typename Data, typename GridTraits>
+    class hash_grid_3d
+    {
+    public:
+
+        typedef Data data_type;
+        typedef GridTraits traits_type;
+        typedef std::tuple<boost::uint32_t, boost::uint32_t, boost::uint32_t> key_type;
+        typedef std::unordered_map<key_type, data_type, boost::hash<key_type>> grid_type;
+
+        hash_grid_3d(const GridTraits& traits)
+            : m_gridTraits(traits)
+        {}
+
+        hash_grid_3d(const hash_grid_3d&) = delete;
+        hash_grid_3d& operator=(const hash_grid_3d&) = delete;
+        hash_grid_3d(hash_grid_3d&&) = default;
+        hash_grid_3d& operator=(hash_grid_3d&&) = default;
+
+        template <typename Point>
+        data_type const* find_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        template <typename Point>
+        data_type* find_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type const* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            auto iter = m_grid.find(key_type(i, j, k));
+            return iter != m_grid.end() ? &iter->second : nullptr;
+        }
+
+        data_type* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            auto iter = m_grid.find(key_type(i, j, k));
+            return iter != m_grid.end() ? &iter->second : nullptr;
+        }
+
+        template <typename Point>
+        data_type& get_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type& get_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            return m_grid[key_type(i, j, k)];
+        }
+
+        const traits_type& get_traits() const { return m_gridTraits; }
+
+        template <typename Point>
+        bool is_contained(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            return m_gridTraits.is_contained(p);
+        }
+
+        void erase(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            m_grid.erase(key_type(i, j, k));
+        }
+
+        void clear() { m_grid.clear(); }
+
+        std::size_t size() const { return m_grid.size(); }
+
+        //! Call visitor(i, j, k, data) for every cell which has been created (in no particular order).
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (auto const& item : m_grid)
+                visitor(std::get<0>(item.first), std::get<1>(item.first), std::get<2>(item.first), item.second);
+        }
+
+    private:
+
+        traits_type m_gridTraits;
+        grid_type m_grid;
+
+    };
+
+    struct sparse_grid_3d_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = hash_grid_3d<Data, Traits>;
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_HASH_GRID_3D_HPP
@@ -12,6 +12,7 @@
 
 #include <geometrix/primitive/axis_aligned_bounding_box.hpp>
 #include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/utility/binary_image_fwd.hpp>
 #include <memory>
 
 namespace geometrix {
@@ -74,6 +75,9 @@ namespace geometrix {
 
     private:
 
+        template <typename Structure>
+        friend struct binary_image_access;
+
         kd_tree( const axis_aligned_bounding_box< sequence_type >& region )
             : m_region( region )
         {}
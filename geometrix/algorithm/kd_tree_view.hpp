@@ -0,0 +1,191 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_KD_TREE_VIEW_HPP
+#define GEOMETRIX_KD_TREE_VIEW_HPP
+#pragma once
+
+#include <geometrix/algorithm/kd_tree.hpp>
+#include <geometrix/utility/binary_image.hpp>
+
+#include <utility>
+
+namespace geometrix {
+
+    namespace kd_tree_image_detail
+    {
+        enum section_id : std::uint32_t
+        {
+            nodes_section = 1
+          , points_section = 2
+        };
+
+        const std::uint32_t no_index = static_cast<std::uint32_t>(-1);
+
+        //! Nodes are stored in pre-order so the left child of an interior node always directly follows it.
+        template <typename T, std::size_t D>
+        struct node
+        {
+            std::uint32_t left;
+            std::uint32_t right;
+            std::uint32_t leaf;//! index into the points section or no_index.
+            std::uint32_t reserved;
+            T             lower[D];
+            T             upper[D];
+        };
+    }//! namespace kd_tree_image_detail;
+
+    template <typename NumericSequence>
+    struct binary_image_access< kd_tree<NumericSequence> >
+    {
+        using tree_type = kd_tree<NumericSequence>;
+        using numeric_type = typename tree_type::numeric_type;
+        static const std::size_t dimension = tree_type::dimension_type::value;
+        using node_type = kd_tree_image_detail::node<numeric_type, dimension>;
+        using point_type = binary_image_detail::stored_point<numeric_type, dimension>;
+
+        static binary_image_writer make_image(const tree_type& tree)
+        {
+            using namespace kd_tree_image_detail;
+            std::vector<node_type> nodes;
+            std::vector<point_type> points;
+            add_node(tree, nodes, points);
+
+            binary_image_writer image(binary_image_kind::kd_tree, binary_image_scalar_code<numeric_type>(), dimension);
+            image.add_section(nodes_section, nodes);
+            image.add_section(points_section, points);
+            return image;
+        }
+
+    private:
+
+        static std::uint32_t add_node(const tree_type& tree, std::vector<node_type>& nodes, std::vector<point_type>& points)
+        {
+            using namespace kd_tree_image_detail;
+            using binary_image_detail::store_coordinates;
+            auto id = static_cast<std::uint32_t>(nodes.size());
+            node_type n = {};
+            store_coordinates<dimension>(tree.m_region.get_lower_bound(), n.lower);
+            store_coordinates<dimension>(tree.m_region.get_upper_bound(), n.upper);
+            n.leaf = no_index;
+            if (tree.m_pLeaf)
+            {
+                n.leaf = static_cast<std::uint32_t>(points.size());
+                points.emplace_back();
+                store_coordinates<dimension>(*tree.m_pLeaf, points.back().coordinates);
+            }
+            nodes.push_back(n);
+
+            auto left = tree.m_pLeftChild ? add_node(*tree.m_pLeftChild, nodes, points) : no_index;
+            auto right = tree.m_pRightChild ? add_node(*tree.m_pRightChild, nodes, points) : no_index;
+            nodes[id].left = left;
+            nodes[id].right = right;
+            return id;
+        }
+    };
+
+    //! \brief A read-only kd_tree queried in place from a binary image (see binary_image.hpp).
+
+    //! The image is written with make_binary_image(tree) and holds the nodes of the tree in pre-order with their regions.
+    //! search visits the same points in the same order as kd_tree::search. The view does not own the image memory.
+    template <typename NumericSequence>
+    class kd_tree_view
+    {
+        using access = binary_image_access< kd_tree<NumericSequence> >;
+        using node_type = typename access::node_type;
+        using stored_point_type = typename access::point_type;
+
+    public:
+
+        typedef NumericSequence                                             sequence_type;
+        typedef typename geometric_traits< sequence_type >::dimension_type  dimension_type;
+        typedef typename geometric_traits< sequence_type >::arithmetic_type numeric_type;
+
+        kd_tree_view( const void* data, std::size_t size )
+            : kd_tree_view( binary_image_view( data, size, binary_image_kind::kd_tree, binary_image_scalar_code<numeric_type>(), dimension_type::value ) )
+        {}
+
+        explicit kd_tree_view( const mapped_binary_image& image )
+            : kd_tree_view( image.data(), image.size() )
+        {}
+
+        //! Traverse the tree on a range and visit all leaves in the specified range.
+        template <typename T, typename Visitor, typename NumberComparisonPolicy>
+        void search( const axis_aligned_bounding_box<T>& range, Visitor&& visitor, const NumberComparisonPolicy& compare ) const
+        {
+            if( m_nodes.empty() )
+                return;
+
+            search_node( 0, range, visitor, compare );
+        }
+
+        std::size_t size() const { return m_points.size(); }
+
+    private:
+
+        explicit kd_tree_view( const binary_image_view& image )
+            : m_nodes( image.section<node_type>( kd_tree_image_detail::nodes_section ) )
+            , m_points( image.section<stored_point_type>( kd_tree_image_detail::points_section ) )
+        {}
+
+        sequence_type get_point( std::uint32_t i ) const
+        {
+            return binary_image_detail::load_coordinates<sequence_type, dimension_type::value>( m_points[i].coordinates );
+        }
+
+        axis_aligned_bounding_box< sequence_type > get_region( std::uint32_t n ) const
+        {
+            return axis_aligned_bounding_box< sequence_type >( binary_image_detail::load_coordinates<sequence_type, dimension_type::value>( m_nodes[n].lower ), binary_image_detail::load_coordinates<sequence_type, dimension_type::value>( m_nodes[n].upper ) );
+        }
+
+        template <typename T, typename Visitor, typename NumberComparisonPolicy>
+        void search_node( std::uint32_t n, const axis_aligned_bounding_box<T>& range, Visitor& visitor, const NumberComparisonPolicy& compare ) const
+        {
+            const node_type& node = m_nodes[n];
+            if( node.leaf != kd_tree_image_detail::no_index )
+            {
+                visitor( get_point( node.leaf ) );
+                return;
+            }
+
+            for( auto child : { node.left, node.right } )
+            {
+                if( child == kd_tree_image_detail::no_index )
+                    continue;
+
+                auto region = get_region( child );
+                if( range.contains( region, compare ) )
+                    traverse_subtrees( child, visitor );
+                else if( range.intersects( region, compare ) )
+                    search_node( child, range, visitor, compare );
+            }
+        }
+
+        template <typename Visitor>
+        void traverse_subtrees( std::uint32_t n, Visitor& visitor ) const
+        {
+            const node_type& node = m_nodes[n];
+            if( node.leaf != kd_tree_image_detail::no_index )
+            {
+                visitor( get_point( node.leaf ) );
+                return;
+            }
+
+            if( node.left != kd_tree_image_detail::no_index )
+                traverse_subtrees( node.left, visitor );
+            if( node.right != kd_tree_image_detail::no_index )
+                traverse_subtrees( node.right, visitor );
+        }
+
+        binary_image_array<node_type>         m_nodes;
+        binary_image_array<stored_point_type> m_points;
+    };
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_KD_TREE_VIEW_HPP
@@ -19,28 +19,24 @@
 #include <geometrix/algorithm/grid_2d.hpp>
 #include <geometrix/algorithm/hash_grid_2d.hpp>
 #include <geometrix/algorithm/eberly_triangle_aabb_intersection.hpp>
+#include <geometrix/algorithm/space_filling_curve.hpp>
+#include <geometrix/utility/alias_sampler.hpp>
+#include <geometrix/utility/binary_image_fwd.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+#include <geometrix/utility/random_generator.hpp>
 #include <geometrix/numeric/constants.hpp>
 
 #include <boost/optional.hpp>
 #include <boost/utility/typed_in_place_factory.hpp>
 #include <boost/container/flat_set.hpp>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 #include <boost/limits.hpp>
 
 namespace geometrix
 {
-    struct dense_grid_type_generator
-    {
-        template <typename Data, typename Traits>
-        using type = grid_2d<Data, Traits>;
-    };
-
-    struct sparse_grid_type_generator
-    {
-        template <typename Data, typename Traits>
-        using type = hash_grid_2d<Data, Traits>;
-    };
-
     template <typename CoordinateType, typename GridTypeGenerator>
     struct triangle_grid_cache
     {
@@ -95,15 +91,41 @@ namespace geometrix
         template <typename Point>
         data_t find_indices(const Point& p) const
         {
-            auto& grid = *m_grid;
+            auto const& grid = *m_grid;
             if (grid.is_contained(p))
-                return grid.get_cell(p);
+            {
+                if (auto pCell = grid.find_cell(p))
+                    return *pCell;
+            }
 
             return data_t();
         }
 
         grid_t const* get_grid() const { return m_grid ? &(*m_grid) : nullptr; }
 
+        //! Renumber the triangles in the cells after the mesh is reordered. Triangle i becomes newIndices[i].
+        void remap_indices(const std::vector<std::size_t>& newIndices)
+        {
+            auto& grid = *m_grid;
+            std::vector<std::pair<boost::uint32_t, boost::uint32_t>> cells;
+            grid.for_each_cell([&cells](boost::uint32_t i, boost::uint32_t j, const data_t& data)
+            {
+                if (!data.empty())
+                    cells.emplace_back(i, j);
+            });
+
+            std::vector<std::size_t> indices;
+            for (auto const& cell : cells)
+            {
+                auto& data = grid.get_cell(cell.first, cell.second);
+                indices.clear();
+                for (auto t : data)
+                    indices.push_back(newIndices[t]);
+                std::sort(indices.begin(), indices.end());
+                data = data_t(boost::container::ordered_unique_range, indices.begin(), indices.end());
+            }
+        }
+
         mutable boost::optional<grid_t> m_grid;
     };
 
@@ -158,10 +180,14 @@ namespace geometrix
 
         template <typename Points, typename Indices, typename NumberComparisonPolicy, typename WeightPolicy>
 		mesh_2d_base(const Points& points, Indices indices, const NumberComparisonPolicy& cmp, const WeightPolicy& weightPolicy)
-        {
-            for( auto const& p : points )
-                m_points.push_back( construct< point_t >( p ) );
+            : mesh_2d_base(copy_points(points), std::move(indices), cmp, weightPolicy)
+        {}
 
+        //! Take ownership of the points (e.g. those made by a triangulation) without copying them.
+        template <typename Indices, typename NumberComparisonPolicy, typename WeightPolicy>
+        mesh_2d_base(point_container_t&& points, Indices indices, const NumberComparisonPolicy& cmp, const WeightPolicy& weightPolicy)
+            : m_points(std::move(points))
+        {
             std::size_t numberTriangles = indices.size() / 3;
             auto totalWeight = weightPolicy.initial_weight();
             weight_container_t triWeights;
@@ -194,12 +220,18 @@ namespace geometrix
             }
 
             auto last = normalized_weight_t{};
+            normalized_weight_container_t normalized;
+            normalized.reserve(triWeights.size());
             for (auto a : triWeights)
             {
 				auto r = weightPolicy.normalize(a, totalWeight);
                 last += r;
                 m_integral.push_back(last);
+                normalized.push_back(r);
             }
+
+            if (!normalized.empty())
+                m_sampler = alias_sampler(normalized);
         }
 
         //! Calculate a random interior position. Parameters rT, r1, and r2 should be uniformly distributed random numbers in the range of [0., 1.].
@@ -215,11 +247,47 @@ namespace geometrix
             auto it(std::lower_bound(m_integral.begin(), m_integral.end(), rT));
             std::size_t iTri = std::distance(m_integral.begin(), it);
             GEOMETRIX_ASSERT(iTri < m_triangles.size());
+            return get_triangle_position(iTri, r1, r2);
+        }
+
+        //! Calculate a uniformly distributed position in triangle iTri from r1 and r2 in the range of [0., 1.].
+        point_t get_triangle_position(std::size_t iTri, double r1, double r2) const
+        {
+            using std::sqrt;
+
             const auto& points = get_triangle_vertices( iTri );
             double sqrt_r1 = sqrt(r1);
             return (1 - sqrt_r1) * as_vector(points[0]) + sqrt_r1 * (1 - r2) * as_vector(points[1]) + sqrt_r1 * r2 * as_vector(points[2]);
         }
 
+        //! Draw a triangle with probability proportional to its weight in constant time. Parameter u should be uniformly distributed in [0., 1.).
+        std::size_t get_random_triangle(double u) const
+        {
+            GEOMETRIX_ASSERT(!m_sampler.empty());
+            return m_sampler(u);
+        }
+
+        //! \brief Fill a random access range with random interior positions drawn from a counter based random stream.
+
+        //! Position i is made from draw firstCounter + i of counter_based_random_generator(seed) with the triangle chosen by
+        //! the alias sampler, so the output is the same for any number of threads and a long run can be produced in pieces
+        //! by advancing firstCounter. The positions have the distribution of get_random_position.
+        template <typename Positions>
+        void get_random_positions(Positions& positions, std::uint64_t seed, std::uint64_t firstCounter = 0, std::size_t nThreads = get_default_concurrency()) const
+        {
+            GEOMETRIX_ASSERT(!m_sampler.empty());
+            counter_based_random_generator rng(seed);
+            parallel_for_batches(positions.size(), 4096, [&](std::size_t, std::size_t begin, std::size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto r = rng(firstCounter + i);
+                    auto iTri = m_sampler(counter_based_random_generator::to_unit(r[0], r[1]));
+                    positions[i] = get_triangle_position(iTri, counter_based_random_generator::to_unit(r[2]), counter_based_random_generator::to_unit(r[3]));
+                }
+            }, nThreads);
+        }
+
         std::size_t get_number_triangles() const { return m_triangles.size(); }
         std::size_t get_number_vertices() const { return m_points.size(); }
         const std::vector<point_t>& get_vertices() const { return m_points; }
@@ -227,12 +295,62 @@ namespace geometrix
         const std::array<std::size_t,3>& get_triangle_indices( std::size_t i ) const { return m_indices[i]; }
         const std::array<point_t, 3>& get_triangle_vertices( std::size_t i ) const { return m_triangles[i]; }
 
+    private:
+
+        template <typename Structure>
+        friend struct binary_image_access;
+
+        template <typename Points>
+        static point_container_t copy_points(const Points& points)
+        {
+            point_container_t result;
+            for( auto const& p : points )
+                result.push_back( construct< point_t >( p ) );
+            return result;
+        }
+
     protected:
 
+        //! Renumber the vertices by position and the triangles by centroid along a space filling curve. Returns the
+        //! triangle permutation (element i is the old index of triangle i.)
+        std::vector<std::size_t> reorder_elements(space_filling_curve curve, std::size_t nThreads)
+        {
+            auto vertexOrder = get_space_filling_curve_order(m_points, curve, nThreads);
+            auto newVertex = invert_permutation(vertexOrder);
+            permute_sequence(m_points, vertexOrder);
+            for (auto& indices : m_indices)
+                for (auto& i : indices)
+                    i = newVertex[i];
+
+            std::vector<point_t> centroids;
+            centroids.reserve(m_triangles.size());
+            for (auto const& trig : m_triangles)
+                centroids.push_back(construct<point_t>((get<0>(trig[0]) + get<0>(trig[1]) + get<0>(trig[2])) / 3, (get<1>(trig[0]) + get<1>(trig[1]) + get<1>(trig[2])) / 3));
+            auto triangleOrder = get_space_filling_curve_order(centroids, curve, nThreads);
+            permute_sequence(m_indices, triangleOrder);
+            permute_sequence(m_triangles, triangleOrder);
+
+            //! The integral is rebuilt from the normalized weights of the triangles in their new order.
+            normalized_weight_container_t weights(m_integral.size());
+            for (std::size_t i = 0; i < m_integral.size(); ++i)
+                weights[i] = m_integral[triangleOrder[i]] - (triangleOrder[i] ? m_integral[triangleOrder[i] - 1] : normalized_weight_t{});
+            auto last = normalized_weight_t{};
+            for (std::size_t i = 0; i < weights.size(); ++i)
+            {
+                last += weights[i];
+                m_integral[i] = last;
+            }
+            if (!weights.empty())
+                m_sampler = alias_sampler(weights);
+
+            return triangleOrder;
+        }
+
         point_container_t m_points;
         index_container_t m_indices;
         triangle_container_t m_triangles;
         normalized_weight_container_t m_integral;
+        alias_sampler m_sampler;
     };
 
     template <typename Cache, typename Points, typename Triangles>
@@ -251,6 +369,7 @@ namespace geometrix
         using adjacency_matrix_t = std::vector<std::array<std::size_t, 3>>;
         using point_container_t = typename base_t::point_container_t;
         using triangle_container_t = typename base_t::triangle_container_t;
+        using point_t = typename base_t::point_t;
 
         template <typename Points, typename Indices, typename NumberComparisonPolicy, typename WeightPolicy = triangle_area_weight_policy<CoordinateType>>
         mesh_2d(const Points& points, Indices indices, const NumberComparisonPolicy& cmp, const std::function<cache_t(const point_container_t&, const triangle_container_t&)>& cacheBuilder = make_triangle_cache<cache_t, point_container_t, triangle_container_t>, const WeightPolicy& weightPolicy = WeightPolicy())
@@ -260,11 +379,25 @@ namespace geometrix
             create_adjacency_matrix();
         }
 
+        template <typename Indices, typename NumberComparisonPolicy, typename WeightPolicy = triangle_area_weight_policy<CoordinateType>>
+        mesh_2d(point_container_t&& points, Indices indices, const NumberComparisonPolicy& cmp, const std::function<cache_t(const point_container_t&, const triangle_container_t&)>& cacheBuilder = make_triangle_cache<cache_t, point_container_t, triangle_container_t>, const WeightPolicy& weightPolicy = WeightPolicy())
+            : base_t(std::move(points), std::move(indices), cmp, weightPolicy)
+            , m_cache(cacheBuilder(base_t::m_points, base_t::m_triangles))
+        {
+            create_adjacency_matrix();
+        }
+
         const adjacency_matrix_t& get_adjacency_matrix() const
         {
             return *m_adjMatrix;
         }
 
+        //! The triangles across sides 0, 1 and 2 of triangle i (as in mesh_2d_view and compact_mesh_2d.)
+        const std::array<std::size_t, 3>& get_adjacent_triangles(std::size_t i) const
+        {
+            return (*m_adjMatrix)[i];
+        }
+
         template <typename Point, typename NumberComparisonPolicy>
         boost::optional<std::size_t> find_triangle(const Point& p, const NumberComparisonPolicy& cmp) const
         {
@@ -281,6 +414,138 @@ namespace geometrix
 
         const cache_t& get_triangle_cache() const { return m_cache; }
 
+        //! \brief Random interior positions which are at least radius apart (Poisson disk sampling.)
+
+        //! Darts thrown with the area weighted sampler seed Bridson's method which grows the sample from active positions by
+        //! trying candidates in the annulus [radius, 2 radius) until `attempts` candidates in a row fail. Once no position is
+        //! active, darts are thrown again (reaching other components of the mesh) until `attempts` darts in a row miss, so
+        //! the result is close to maximal. The positions are a function of the seed.
+        template <typename NumberComparisonPolicy>
+        std::vector<point_t> get_poisson_disk_positions(double radius, const NumberComparisonPolicy& cmp, std::uint64_t seed = 42, std::size_t attempts = 30) const
+        {
+            GEOMETRIX_ASSERT(radius > 0);
+            using std::sqrt;
+            using std::cos;
+            using std::sin;
+
+            auto const& vertices = base_t::get_vertices();
+            double xmin = (std::numeric_limits<double>::max)(), ymin = xmin;
+            for (auto const& v : vertices)
+            {
+                xmin = (std::min)(xmin, static_cast<double>(get<0>(v)));
+                ymin = (std::min)(ymin, static_cast<double>(get<1>(v)));
+            }
+
+            //! A cell is small enough to hold at most one position so a position's neighbours are in the 5x5 cells around it.
+            const double cellSize = radius / constants::sqrt_2<double>();
+            auto get_cell = [&](double x, double y)
+            {
+                return std::make_pair(static_cast<std::int64_t>(std::floor((x - xmin) / cellSize)), static_cast<std::int64_t>(std::floor((y - ymin) / cellSize)));
+            };
+            auto get_key = [](std::int64_t i, std::int64_t j)
+            {
+                return (static_cast<std::uint64_t>(i) << 32) ^ static_cast<std::uint64_t>(j & 0xFFFFFFFF);
+            };
+
+            std::vector<point_t> positions;
+            std::unordered_map<std::uint64_t, std::size_t> grid;
+            auto is_free = [&](double x, double y)
+            {
+                auto c = get_cell(x, y);
+                for (auto i = c.first - 2; i <= c.first + 2; ++i)
+                {
+                    for (auto j = c.second - 2; j <= c.second + 2; ++j)
+                    {
+                        auto it = grid.find(get_key(i, j));
+                        if (it == grid.end())
+                            continue;
+                        auto dx = static_cast<double>(get<0>(positions[it->second])) - x;
+                        auto dy = static_cast<double>(get<1>(positions[it->second])) - y;
+                        if (dx * dx + dy * dy < radius * radius)
+                            return false;
+                    }
+                }
+                return true;
+            };
+            auto add = [&](const point_t& p)
+            {
+                auto c = get_cell(get<0>(p), get<1>(p));
+                grid[get_key(c.first, c.second)] = positions.size();
+                positions.push_back(p);
+            };
+
+            counter_based_random_generator rng(seed);
+            std::uint64_t counter = 0;
+            std::vector<std::size_t> active;
+            std::size_t misses = 0;
+            while (!active.empty() || misses < attempts)
+            {
+                if (active.empty())
+                {
+                    auto r = rng(counter++);
+                    auto p = base_t::get_triangle_position(base_t::get_random_triangle(counter_based_random_generator::to_unit(r[0], r[1])), counter_based_random_generator::to_unit(r[2]), counter_based_random_generator::to_unit(r[3]));
+                    if (is_free(get<0>(p), get<1>(p)))
+                    {
+                        active.push_back(positions.size());
+                        add(p);
+                        misses = 0;
+                    }
+                    else
+                        ++misses;
+                    continue;
+                }
+
+                auto k = (std::min)(static_cast<std::size_t>(counter_based_random_generator::to_unit(rng(counter++)[0]) * active.size()), active.size() - 1);
+                auto center = positions[active[k]];
+                bool found = false;
+                for (std::size_t a = 0; a < attempts && !found; ++a)
+                {
+                    auto r = rng(counter++);
+                    auto rho = radius * sqrt(1.0 + 3.0 * counter_based_random_generator::to_unit(r[0]));
+                    auto theta = constants::two_pi<double>() * counter_based_random_generator::to_unit(r[1]);
+                    auto x = static_cast<double>(get<0>(center)) + rho * cos(theta), y = static_cast<double>(get<1>(center)) + rho * sin(theta);
+                    auto p = construct<point_t>(x, y);
+                    if (is_free(x, y) && find_triangle(p, cmp))
+                    {
+                        active.push_back(positions.size());
+                        add(p);
+                        found = true;
+                    }
+                }
+
+                if (!found)
+                {
+                    active[k] = active.back();
+                    active.pop_back();
+                }
+            }
+
+            return positions;
+        }
+
+        //! \brief Renumber the vertices and triangles along a space filling curve.
+
+        //! Triangles which are close in the plane end up close in memory which improves the locality of find_triangle and
+        //! of searches over the adjacency matrix. The adjacency matrix and the triangle cache are remapped rather than rebuilt.
+        //! Returns the triangle permutation (element i is the old index of triangle i) so that data kept per triangle can be
+        //! rearranged with permute_sequence.
+        std::vector<std::size_t> reorder(space_filling_curve curve = e_hilbert_curve, std::size_t nThreads = get_default_concurrency())
+        {
+            auto triangleOrder = base_t::reorder_elements(curve, nThreads);
+            auto newTriangle = invert_permutation(triangleOrder);
+
+            const auto none = (std::numeric_limits<std::size_t>::max)();
+            auto& adjMatrix = *m_adjMatrix;
+            permute_sequence(adjMatrix, triangleOrder);
+            for (auto& adj : adjMatrix)
+                for (auto& t : adj)
+                    if (t != none)
+                        t = newTriangle[t];
+
+            m_cache.remap_indices(newTriangle);
+            return triangleOrder;
+        }
+
         //! search the mesh graph in a DFS fashion.
         template <typename MeshSearch >
         void search(MeshSearch&& visitor) const
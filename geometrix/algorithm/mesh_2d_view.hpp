@@ -0,0 +1,294 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_MESH_2D_VIEW_HPP
+#define GEOMETRIX_MESH_2D_VIEW_HPP
+#pragma once
+
+#include <geometrix/algorithm/mesh_2d.hpp>
+#include <geometrix/utility/binary_image.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace geometrix {
+
+    namespace mesh_2d_image_detail
+    {
+        enum section_id : std::uint32_t
+        {
+            vertices_section = 1
+          , triangles_section = 2
+          , adjacency_section = 3
+          , integral_section = 4
+          , grid_section = 5
+          , cell_keys_section = 6
+          , cell_offsets_section = 7
+          , cell_triangles_section = 8
+        };
+
+        const std::uint32_t no_index = static_cast<std::uint32_t>(-1);
+
+        struct triangle
+        {
+            std::uint32_t indices[3];
+        };
+
+        //! The bounds and cell size of the triangle cache grid. The cells are stored sparsely: the keys of the non-empty cells
+        //! (column in the low and row in the high 32 bits) sorted ascending, and each cell's triangles as a run in
+        //! cell_triangles delimited by cell_offsets.
+        template <typename T>
+        struct grid
+        {
+            T xmin;
+            T xmax;
+            T ymin;
+            T ymax;
+            T cell_size;
+        };
+
+        inline std::uint64_t cell_key(std::uint32_t i, std::uint32_t j)
+        {
+            return (static_cast<std::uint64_t>(j) << 32) | i;
+        }
+    }//! namespace mesh_2d_image_detail;
+
+    //! The mesh's triangle cache must be a triangle_grid_cache (either dense or sparse).
+    template <typename CoordinateType, typename Traits>
+    struct binary_image_access< mesh_2d<CoordinateType, Traits> >
+    {
+        using mesh_type = mesh_2d<CoordinateType, Traits>;
+        using base_type = mesh_2d_base<CoordinateType>;
+        using vertex_type = binary_image_detail::stored_point<CoordinateType, 2>;
+        using triangle_type = mesh_2d_image_detail::triangle;
+        using grid_type = mesh_2d_image_detail::grid<CoordinateType>;
+
+        static binary_image_writer make_image(const mesh_type& mesh)
+        {
+            using namespace mesh_2d_image_detail;
+            const base_type& base = mesh;
+
+            if (mesh.get_number_vertices() >= no_index || mesh.get_number_triangles() >= no_index)
+                throw binary_image_error("mesh_2d is too large for 32 bit indices.");
+
+            std::vector<vertex_type> vertices(mesh.get_number_vertices());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+                binary_image_detail::store_coordinates<2>(mesh.get_vertices()[i], vertices[i].coordinates);
+
+            std::vector<triangle_type> triangles(mesh.get_number_triangles()), adjacency(mesh.get_number_triangles());
+            for (std::size_t i = 0; i < triangles.size(); ++i)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    triangles[i].indices[k] = static_cast<std::uint32_t>(mesh.get_triangle_indices(i)[k]);
+                    auto adj = mesh.get_adjacency_matrix()[i][k];
+                    adjacency[i].indices[k] = adj == (std::numeric_limits<std::size_t>::max)() ? no_index : static_cast<std::uint32_t>(adj);
+                }
+            }
+
+            std::vector<grid_type> grids;
+            std::vector<std::uint64_t> cellKeys;
+            std::vector<std::uint32_t> cellOffsets, cellTriangles;
+            if (auto pGrid = mesh.get_triangle_cache().get_grid())
+            {
+                auto const& traits = pGrid->get_traits();
+                grids.push_back(grid_type{ traits.get_min_x(), traits.get_max_x(), traits.get_min_y(), traits.get_max_y(), traits.get_cell_size() });
+
+                std::vector<std::pair<std::uint64_t, const typename std::decay<decltype(*pGrid)>::type::data_type*>> cells;
+                pGrid->for_each_cell([&cells](std::uint32_t i, std::uint32_t j, const auto& data)
+                {
+                    if (!data.empty())
+                        cells.emplace_back(cell_key(i, j), &data);
+                });
+                std::sort(cells.begin(), cells.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+                for (auto const& cell : cells)
+                {
+                    cellKeys.push_back(cell.first);
+                    cellOffsets.push_back(static_cast<std::uint32_t>(cellTriangles.size()));
+                    for (auto t : *cell.second)
+                        cellTriangles.push_back(static_cast<std::uint32_t>(t));
+                }
+                cellOffsets.push_back(static_cast<std::uint32_t>(cellTriangles.size()));
+            }
+
+            binary_image_writer image(binary_image_kind::mesh_2d, binary_image_scalar_code<CoordinateType>(), 2);
+            image.add_section(vertices_section, vertices);
+            image.add_section(triangles_section, triangles);
+            image.add_section(adjacency_section, adjacency);
+            image.add_section(integral_section, base.m_integral);
+            image.add_section(grid_section, grids);
+            image.add_section(cell_keys_section, cellKeys);
+            image.add_section(cell_offsets_section, cellOffsets);
+            image.add_section(cell_triangles_section, cellTriangles);
+            return image;
+        }
+    };
+
+    //! \brief A read-only mesh_2d queried in place from a binary image (see binary_image.hpp).
+
+    //! The image is written with make_binary_image(mesh) and holds the vertices, triangles, adjacency, area integral and the
+    //! triangle cache grid. The view has the query interface of mesh_2d (so mesh_search visitors run on it) and gives the same
+    //! results. Triangles and vertices are returned by value. The view does not own the image memory.
+    template <typename CoordinateType>
+    class mesh_2d_view
+    {
+        using access = binary_image_access< mesh_2d<CoordinateType> >;
+        using vertex_type = typename access::vertex_type;
+        using triangle_type = typename access::triangle_type;
+        using grid_type = typename access::grid_type;
+
+    public:
+
+        using coordinate_t = CoordinateType;
+        using point_t = point<coordinate_t, 2>;
+        using vector_t = vector<coordinate_t, 2>;
+
+        mesh_2d_view(const void* data, std::size_t size)
+            : mesh_2d_view(binary_image_view(data, size, binary_image_kind::mesh_2d, binary_image_scalar_code<coordinate_t>(), 2))
+        {}
+
+        explicit mesh_2d_view(const mapped_binary_image& image)
+            : mesh_2d_view(image.data(), image.size())
+        {}
+
+        std::size_t get_number_triangles() const { return m_triangles.size(); }
+        std::size_t get_number_vertices() const { return m_vertices.size(); }
+
+        point_t get_vertex(std::size_t i) const
+        {
+            return binary_image_detail::load_coordinates<point_t, 2>(m_vertices[i].coordinates);
+        }
+
+        std::array<std::size_t, 3> get_triangle_indices(std::size_t i) const
+        {
+            auto const& t = m_triangles[i].indices;
+            return {{ t[0], t[1], t[2] }};
+        }
+
+        std::array<point_t, 3> get_triangle_vertices(std::size_t i) const
+        {
+            auto const& t = m_triangles[i].indices;
+            return {{ get_vertex(t[0]), get_vertex(t[1]), get_vertex(t[2]) }};
+        }
+
+        //! The triangles across sides 0, 1 and 2 of triangle i (as in mesh_2d::get_adjacency_matrix()[i]).
+        std::array<std::size_t, 3> get_adjacent_triangles(std::size_t i) const
+        {
+            std::array<std::size_t, 3> r;
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                auto adj = m_adjacency[i].indices[k];
+                r[k] = adj == mesh_2d_image_detail::no_index ? (std::numeric_limits<std::size_t>::max)() : adj;
+            }
+            return r;
+        }
+
+        //! Calculate a random interior position. Parameters rT, r1, and r2 should be uniformly distributed random numbers in the range of [0., 1.].
+        point_t get_random_position(double rT, double r1, double r2) const
+        {
+            GEOMETRIX_ASSERT(!m_triangles.empty());
+            using std::sqrt;
+
+            auto it(std::lower_bound(m_integral.begin(), m_integral.end(), rT));
+            std::size_t iTri = std::distance(m_integral.begin(), it);
+            GEOMETRIX_ASSERT(iTri < m_triangles.size());
+            const auto points = get_triangle_vertices(iTri);
+            double sqrt_r1 = sqrt(r1);
+            return (1 - sqrt_r1) * as_vector(points[0]) + sqrt_r1 * (1 - r2) * as_vector(points[1]) + sqrt_r1 * r2 * as_vector(points[2]);
+        }
+
+        template <typename Point, typename NumberComparisonPolicy>
+        boost::optional<std::size_t> find_triangle(const Point& p, const NumberComparisonPolicy& cmp) const
+        {
+            if (!m_traits || !m_traits->is_contained(p))
+                return boost::none;
+
+            auto key = mesh_2d_image_detail::cell_key(m_traits->get_x_index(get<0>(p)), m_traits->get_y_index(get<1>(p)));
+            auto it = std::lower_bound(m_cellKeys.begin(), m_cellKeys.end(), key);
+            if (it == m_cellKeys.end() || *it != key)
+                return boost::none;
+
+            auto cell = static_cast<std::size_t>(it - m_cellKeys.begin());
+            for (auto i = m_cellOffsets[cell]; i < m_cellOffsets[cell + 1]; ++i)
+            {
+                std::size_t ti = m_cellTriangles[i];
+                const auto points = get_triangle_vertices(ti);
+                if (point_in_triangle(p, points[0], points[1], points[2], cmp))
+                    return ti;
+            }
+
+            return boost::none;
+        }
+
+        //! search the mesh graph in a DFS fashion.
+        template <typename MeshSearch >
+        void search(MeshSearch&& visitor) const
+        {
+            typedef typename remove_const_ref<MeshSearch>::type::edge_item edge_item;
+            std::vector<edge_item> Q;
+            Q.reserve(100);
+            Q.push_back(visitor.get_start());
+
+            while (!Q.empty())
+            {
+                edge_item item = Q.back();
+                Q.pop_back();
+
+                //! return value indicates if the search should continue.
+                if (!visitor.visit(item))
+                    return;
+
+                for (auto adjTrig : get_adjacent_triangles(item.get_triangle_index()))
+                {
+                    if (adjTrig != (std::numeric_limits<std::size_t>::max)() && adjTrig != item.from)
+                    {
+                        boost::optional<edge_item> newItem = visitor.prepare_adjacent_traversal(adjTrig, item);
+                        if (newItem)
+                            Q.push_back(*newItem);
+                    }
+                }
+            }
+        }
+
+    private:
+
+        explicit mesh_2d_view(const binary_image_view& image)
+            : m_vertices(image.section<vertex_type>(mesh_2d_image_detail::vertices_section))
+            , m_triangles(image.section<triangle_type>(mesh_2d_image_detail::triangles_section))
+            , m_adjacency(image.section<triangle_type>(mesh_2d_image_detail::adjacency_section))
+            , m_integral(image.section<double>(mesh_2d_image_detail::integral_section))
+            , m_cellKeys(image.section<std::uint64_t>(mesh_2d_image_detail::cell_keys_section))
+            , m_cellOffsets(image.section<std::uint32_t>(mesh_2d_image_detail::cell_offsets_section))
+            , m_cellTriangles(image.section<std::uint32_t>(mesh_2d_image_detail::cell_triangles_section))
+        {
+            if (m_adjacency.size() != m_triangles.size() || m_integral.size() != m_triangles.size())
+                throw binary_image_error("mesh_2d image sections have inconsistent sizes.");
+
+            auto grid = image.section<grid_type>(mesh_2d_image_detail::grid_section);
+            if (!grid.empty())
+            {
+                if (m_cellOffsets.size() != m_cellKeys.size() + 1)
+                    throw binary_image_error("mesh_2d image sections have inconsistent sizes.");
+                m_traits.emplace(grid[0].xmin, grid[0].xmax, grid[0].ymin, grid[0].ymax, grid[0].cell_size);
+            }
+        }
+
+        binary_image_array<vertex_type>             m_vertices;
+        binary_image_array<triangle_type>           m_triangles;
+        binary_image_array<triangle_type>           m_adjacency;
+        binary_image_array<double>                  m_integral;
+        binary_image_array<std::uint64_t>           m_cellKeys;
+        binary_image_array<std::uint32_t>           m_cellOffsets;
+        binary_image_array<std::uint32_t>           m_cellTriangles;
+        boost::optional<grid_traits<coordinate_t>>  m_traits;
+    };
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_MESH_2D_VIEW_HPP
@@ -0,0 +1,373 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_MESH_PATH_HPP
+#define GEOMETRIX_ALGORITHM_MESH_PATH_HPP
+#pragma once
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <geometrix/utility/construction_policy.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//! Shortest paths through a triangle mesh (mesh_2d, mesh_2d_view or compact_mesh_2d.) An A* search over the triangle
+//! adjacency finds a corridor of triangles from the start to the goal and the simple stupid funnel algorithm (Mononen)
+//! pulls the path taut through the shared edges (portals) of the corridor. Each triangle is costed at the point where the
+//! line from its parent's entry point toward the goal crosses the portal (or the portal end nearest that line), so the
+//! corridor follows the portals rather than the triangle centers.
+namespace geometrix {
+
+    namespace mesh_path_detail {
+
+        struct vec2
+        {
+            double x;
+            double y;
+        };
+
+        inline bool operator==(const vec2& a, const vec2& b) { return a.x == b.x && a.y == b.y; }
+
+        inline double distance(const vec2& a, const vec2& b) { return std::hypot(b.x - a.x, b.y - a.y); }
+
+        //! Twice the signed area of (a, b, c) with the sign of Mononen's funnel: negative when c is left of a->b.
+        inline double triarea2(const vec2& a, const vec2& b, const vec2& c)
+        {
+            return (c.x - a.x) * (b.y - a.y) - (b.x - a.x) * (c.y - a.y);
+        }
+
+        //! The point of the portal a-b where a path from p toward q crosses it.
+        inline vec2 get_portal_entry(const vec2& a, const vec2& b, const vec2& p, const vec2& q)
+        {
+            double ex = b.x - a.x, ey = b.y - a.y;
+            double dx = q.x - p.x, dy = q.y - p.y;
+            double denom = ex * dy - ey * dx;
+            double sp = ex * (p.y - a.y) - ey * (p.x - a.x);
+            double sq = ex * (q.y - a.y) - ey * (q.x - a.x);
+            if (denom != 0 && sp * sq <= 0)
+            {
+                double s = ((p.x - a.x) * dy - (p.y - a.y) * dx) / denom;
+                s = (std::min)((std::max)(s, 0.0), 1.0);
+                return vec2{ a.x + s * ex, a.y + s * ey };
+            }
+
+            return distance(p, a) + distance(a, q) <= distance(p, b) + distance(b, q) ? a : b;
+        }
+
+        template <typename Point>
+        inline vec2 to_vec2(const Point& p)
+        {
+            using filtered_predicates_detail::to_double;
+            return vec2{ to_double(get<0>(p)), to_double(get<1>(p)) };
+        }
+
+        template <typename Mesh>
+        inline vec2 get_vertex(const Mesh& mesh, std::size_t triangle, std::size_t k)
+        {
+            return to_vec2(mesh.get_triangle_vertices(triangle)[k]);
+        }
+
+    }//! namespace mesh_path_detail;
+
+    class mesh_path_workspace;
+
+    namespace mesh_path_detail {
+
+        template <typename Mesh>
+        bool find_corridor(const Mesh& mesh, std::size_t startTri, std::size_t goalTri, const vec2& start, const vec2& goal, mesh_path_workspace& ws);
+
+        template <typename Mesh>
+        void get_portals(const Mesh& mesh, const vec2& start, const vec2& goal, mesh_path_workspace& ws);
+
+    }//! namespace mesh_path_detail;
+
+    //! \brief Reusable storage for find_mesh_path.
+
+    //! The per triangle costs are stamped with the generation of the query which wrote them, so starting a query is a
+    //! counter increment rather than a pass over the mesh. Once the storage has grown to the mesh and the longest path,
+    //! queries allocate nothing. A workspace may be used with one query at a time.
+    class mesh_path_workspace
+    {
+    public:
+
+        using vec2 = mesh_path_detail::vec2;
+
+        //! The triangles from the start to the goal found by the last successful query.
+        const std::vector<std::size_t>& get_corridor() const { return m_corridor; }
+
+        //! The (left, right) portals of the corridor found by the last successful query, starting and ending with degenerate
+        //! portals at the start and goal.
+        const std::vector<std::pair<vec2, vec2>>& get_portals() const { return m_portals; }
+
+    private:
+
+        template <typename Mesh>
+        friend bool mesh_path_detail::find_corridor(const Mesh& mesh, std::size_t startTri, std::size_t goalTri, const vec2& start, const vec2& goal, mesh_path_workspace& ws);
+
+        template <typename Mesh>
+        friend void mesh_path_detail::get_portals(const Mesh& mesh, const vec2& start, const vec2& goal, mesh_path_workspace& ws);
+
+        //! Start a query over a mesh with n triangles.
+        void prepare(std::size_t n)
+        {
+            if (m_cost.size() < n)
+            {
+                m_cost.resize(n);
+                m_entry.resize(n);
+                m_parent.resize(n);
+                m_seen.resize(n, 0);
+                m_closed.resize(n, 0);
+            }
+
+            if (++m_generation == 0)
+            {
+                std::fill(m_seen.begin(), m_seen.end(), 0);
+                std::fill(m_closed.begin(), m_closed.end(), 0);
+                m_generation = 1;
+            }
+            m_open.clear();
+        }
+
+        std::vector<double>                       m_cost;
+        std::vector<vec2>                         m_entry;
+        std::vector<std::size_t>                  m_parent;
+        std::vector<std::uint32_t>                m_seen;
+        std::vector<std::uint32_t>                m_closed;
+        std::vector<std::pair<double, std::size_t>> m_open;
+        std::vector<std::size_t>                  m_corridor;
+        std::vector<std::pair<vec2, vec2>>        m_portals;
+        std::uint32_t                             m_generation{ 0 };
+
+    };
+
+    namespace mesh_path_detail {
+
+        //! A* from the start triangle to the goal triangle. On success the workspace holds the corridor.
+        template <typename Mesh>
+        inline bool find_corridor(const Mesh& mesh, std::size_t startTri, std::size_t goalTri, const vec2& start, const vec2& goal, mesh_path_workspace& ws)
+        {
+            const auto none = (std::numeric_limits<std::size_t>::max)();
+            using entry_t = std::pair<double, std::size_t>;
+            std::greater<entry_t> heapOrder;
+
+            ws.prepare(mesh.get_number_triangles());
+            auto generation = ws.m_generation;
+            ws.m_cost[startTri] = 0;
+            ws.m_entry[startTri] = start;
+            ws.m_parent[startTri] = none;
+            ws.m_seen[startTri] = generation;
+            ws.m_open.emplace_back(distance(start, goal), startTri);
+
+            bool found = false;
+            while (!ws.m_open.empty())
+            {
+                std::pop_heap(ws.m_open.begin(), ws.m_open.end(), heapOrder);
+                auto t = ws.m_open.back().second;
+                ws.m_open.pop_back();
+
+                //! Entries left behind when a triangle's cost was lowered are skipped.
+                if (ws.m_closed[t] == generation)
+                    continue;
+                ws.m_closed[t] = generation;
+                if (t == goalTri)
+                {
+                    found = true;
+                    break;
+                }
+
+                auto const& adjacent = mesh.get_adjacent_triangles(t);
+                auto const vertices = mesh.get_triangle_vertices(t);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    std::size_t u = adjacent[k];
+                    if (u == none || ws.m_closed[u] == generation)
+                        continue;
+
+                    auto e = get_portal_entry(to_vec2(vertices[k]), to_vec2(vertices[(k + 1) % 3]), ws.m_entry[t], goal);
+                    auto c = ws.m_cost[t] + distance(ws.m_entry[t], e);
+                    if (ws.m_seen[u] != generation || c < ws.m_cost[u])
+                    {
+                        ws.m_seen[u] = generation;
+                        ws.m_cost[u] = c;
+                        ws.m_entry[u] = e;
+                        ws.m_parent[u] = t;
+                        ws.m_open.emplace_back(c + distance(e, goal), u);
+                        std::push_heap(ws.m_open.begin(), ws.m_open.end(), heapOrder);
+                    }
+                }
+            }
+
+            if (!found)
+                return false;
+
+            ws.m_corridor.clear();
+            for (auto t = goalTri; t != none; t = ws.m_parent[t])
+                ws.m_corridor.push_back(t);
+            std::reverse(ws.m_corridor.begin(), ws.m_corridor.end());
+            return true;
+        }
+
+        //! The (left, right) portals crossed by the corridor when walking from the start to the goal. The mesh triangles are
+        //! CCW so leaving a triangle through side k (vertex k to k + 1) has vertex k + 1 on the left.
+        template <typename Mesh>
+        inline void get_portals(const Mesh& mesh, const vec2& start, const vec2& goal, mesh_path_workspace& ws)
+        {
+            auto& portals = ws.m_portals;
+            portals.clear();
+            portals.emplace_back(start, start);
+            for (std::size_t i = 0; i + 1 < ws.m_corridor.size(); ++i)
+            {
+                auto t = ws.m_corridor[i];
+                auto const& adjacent = mesh.get_adjacent_triangles(t);
+                std::size_t k = adjacent[0] == ws.m_corridor[i + 1] ? 0 : (adjacent[1] == ws.m_corridor[i + 1] ? 1 : 2);
+                GEOMETRIX_ASSERT(adjacent[k] == ws.m_corridor[i + 1]);
+                portals.emplace_back(get_vertex(mesh, t, (k + 1) % 3), get_vertex(mesh, t, k));
+            }
+            portals.emplace_back(goal, goal);
+        }
+
+        //! The simple stupid funnel algorithm over the portals.
+        template <typename Path>
+        inline void string_pull(const std::vector<std::pair<vec2, vec2>>& portals, Path& path)
+        {
+            using point_t = typename Path::value_type;
+            GEOMETRIX_ASSERT(portals.size() >= 2);
+
+            auto apex = portals[0].first, portalLeft = portals[0].first, portalRight = portals[0].second;
+            std::size_t apexIndex = 0, leftIndex = 0, rightIndex = 0;
+            path.push_back(construct<point_t>(apex.x, apex.y));
+            vec2 last = apex;
+
+            for (std::size_t i = 1; i < portals.size(); ++i)
+            {
+                auto const& left = portals[i].first;
+                auto const& right = portals[i].second;
+
+                if (triarea2(apex, portalRight, right) <= 0.0)
+                {
+                    if (apex == portalRight || triarea2(apex, portalLeft, right) > 0.0)
+                    {
+                        portalRight = right;
+                        rightIndex = i;
+                    }
+                    else
+                    {
+                        //! The right side crossed the left; the left point is a corner of the path.
+                        apex = portalLeft;
+                        apexIndex = leftIndex;
+                        if (!(apex == last))
+                            path.push_back(construct<point_t>(apex.x, apex.y)), last = apex;
+                        portalLeft = portalRight = apex;
+                        leftIndex = rightIndex = apexIndex;
+                        i = apexIndex;
+                        continue;
+                    }
+                }
+
+                if (triarea2(apex, portalLeft, left) >= 0.0)
+                {
+                    if (apex == portalLeft || triarea2(apex, portalRight, left) < 0.0)
+                    {
+                        portalLeft = left;
+                        leftIndex = i;
+                    }
+                    else
+                    {
+                        apex = portalRight;
+                        apexIndex = rightIndex;
+                        if (!(apex == last))
+                            path.push_back(construct<point_t>(apex.x, apex.y)), last = apex;
+                        portalLeft = portalRight = apex;
+                        leftIndex = rightIndex = apexIndex;
+                        i = apexIndex;
+                        continue;
+                    }
+                }
+            }
+
+            auto const& goal = portals.back().first;
+            if (!(goal == last) || path.size() == 1)
+                path.push_back(construct<point_t>(goal.x, goal.y));
+        }
+
+    }//! namespace mesh_path_detail;
+
+    //! \brief Find a taut path from start to goal through the triangles of a mesh.
+
+    //! The path is written to path (cleared first) as the start, the mesh vertices it bends around and the goal. Returns
+    //! false, leaving path empty, when the start or goal is not in the mesh or they are in parts of the mesh which are not
+    //! connected. The corridor is available from workspace.get_corridor().
+    template <typename Mesh, typename Point, typename NumberComparisonPolicy, typename Path>
+    inline bool find_mesh_path(const Mesh& mesh, const Point& start, const Point& goal, const NumberComparisonPolicy& cmp, mesh_path_workspace& workspace, Path& path)
+    {
+        using namespace mesh_path_detail;
+
+        path.clear();
+        auto startTri = mesh.find_triangle(start, cmp);
+        auto goalTri = mesh.find_triangle(goal, cmp);
+        if (!startTri || !goalTri)
+            return false;
+
+        auto s = to_vec2(start), g = to_vec2(goal);
+        if (!find_corridor(mesh, *startTri, *goalTri, s, g, workspace))
+            return false;
+
+        get_portals(mesh, s, g, workspace);
+        string_pull(workspace.get_portals(), path);
+        return true;
+    }
+
+    template <typename Mesh, typename Point, typename NumberComparisonPolicy>
+    inline std::vector<typename Mesh::point_t> find_mesh_path(const Mesh& mesh, const Point& start, const Point& goal, const NumberComparisonPolicy& cmp)
+    {
+        mesh_path_workspace workspace;
+        std::vector<typename Mesh::point_t> path;
+        find_mesh_path(mesh, start, goal, cmp, workspace, path);
+        return path;
+    }
+
+    //! \brief Find the paths for many (start, goal) pairs in parallel.
+
+    //! The queries are split into one batch per workspace and each batch runs on one thread with its own workspace, so
+    //! reusing the workspaces and paths across calls allocates nothing once they have grown. Path i is empty when query i
+    //! has no path. The results do not depend on the number of workspaces.
+    template <typename Mesh, typename Points, typename NumberComparisonPolicy, typename Path>
+    inline void find_mesh_paths(const Mesh& mesh, const Points& starts, const Points& goals, const NumberComparisonPolicy& cmp, std::vector<mesh_path_workspace>& workspaces, std::vector<Path>& paths)
+    {
+        GEOMETRIX_ASSERT(starts.size() == goals.size());
+        GEOMETRIX_ASSERT(!workspaces.empty());
+        std::size_t n = starts.size();
+        paths.resize(n);
+        auto batchSize = (std::max<std::size_t>)(1, (n + workspaces.size() - 1) / workspaces.size());
+        parallel_for_batches(n, batchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+                find_mesh_path(mesh, starts[i], goals[i], cmp, workspaces[b], paths[i]);
+        }, workspaces.size());
+    }
+
+    template <typename Mesh, typename Points, typename NumberComparisonPolicy>
+    inline std::vector<std::vector<typename Mesh::point_t>> find_mesh_paths(const Mesh& mesh, const Points& starts, const Points& goals, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        std::vector<mesh_path_workspace> workspaces((std::max<std::size_t>)(1, nThreads));
+        std::vector<std::vector<typename Mesh::point_t>> paths;
+        find_mesh_paths(mesh, starts, goals, cmp, workspaces, paths);
+        return paths;
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_MESH_PATH_HPP
@@ -47,7 +47,7 @@ namespace geometrix
                     if( fromIndices[0] == toIndices[i] || fromIndices[1] == toIndices[i] || fromIndices[2] == toIndices[i] )
                         continue;
 
-                    const auto& point = mesh.get_triangle_vertices( edge.to )[i];
+                    const auto point = mesh.get_triangle_vertices( edge.to )[i];
                     if( is_vector_between( edge.lo, edge.hi, point-origin, true, cmp ) )
                         m_vertices.push_back( toIndices[i] );
                 }
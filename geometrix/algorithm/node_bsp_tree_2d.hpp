@@ -20,6 +20,7 @@
 #include <geometrix/algorithm/intersection/ray_aabb_intersection.hpp>
 #include <geometrix/algorithm/point_location_classification.hpp>
 #include <geometrix/algorithm/orientation/point_segment_orientation.hpp>
+#include <geometrix/utility/binary_image_fwd.hpp>
 
 #include <boost/range.hpp>
 #include <boost/noncopyable.hpp>
@@ -357,6 +358,9 @@ namespace geometrix {
 */
     private:
 
+        template <typename Structure>
+        friend struct binary_image_access;
+
         enum classification
         {
             e_crosses,
@@ -0,0 +1,225 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BSPTREE2D_VIEW_HPP
+#define GEOMETRIX_BSPTREE2D_VIEW_HPP
+#pragma once
+
+#include <geometrix/algorithm/node_bsp_tree_2d.hpp>
+#include <geometrix/utility/binary_image.hpp>
+
+namespace geometrix {
+
+    namespace node_bsp_image_detail
+    {
+        enum section_id : std::uint32_t
+        {
+            nodes_section = 1
+          , edges_section = 2
+        };
+
+        const std::uint32_t no_index = static_cast<std::uint32_t>(-1);
+
+        //! Nodes are stored in pre-order. The coincident edges of a node are a contiguous run in the edges section.
+        template <typename T>
+        struct node
+        {
+            std::uint32_t positive;
+            std::uint32_t negative;
+            std::uint32_t first_edge;
+            std::uint32_t number_edges;
+            binary_image_detail::stored_segment<T, 2> splitting_segment;
+        };
+    }//! namespace node_bsp_image_detail;
+
+    template <typename Segment>
+    struct binary_image_access< node_bsp_tree_2d<Segment> >
+    {
+        using tree_type = node_bsp_tree_2d<Segment>;
+        using length_type = typename arithmetic_type_of<Segment>::type;
+        using node_type = node_bsp_image_detail::node<length_type>;
+        using edge_type = binary_image_detail::stored_segment<length_type, 2>;
+
+        static binary_image_writer make_image(const tree_type& tree)
+        {
+            using namespace node_bsp_image_detail;
+            std::vector<node_type> nodes;
+            std::vector<edge_type> edges;
+            add_node(tree, nodes, edges);
+
+            binary_image_writer image(binary_image_kind::node_bsp_tree_2d, binary_image_scalar_code<length_type>(), 2);
+            image.add_section(nodes_section, nodes);
+            image.add_section(edges_section, edges);
+            return image;
+        }
+
+    private:
+
+        static void store(const Segment& s, edge_type& e)
+        {
+            binary_image_detail::store_coordinates<2>(get_start(s), e.start);
+            binary_image_detail::store_coordinates<2>(get_end(s), e.end);
+        }
+
+        static std::uint32_t add_node(const tree_type& tree, std::vector<node_type>& nodes, std::vector<edge_type>& edges)
+        {
+            using namespace node_bsp_image_detail;
+            auto id = static_cast<std::uint32_t>(nodes.size());
+            node_type n = {};
+            store(tree.m_splittingSegment, n.splitting_segment);
+            n.first_edge = static_cast<std::uint32_t>(edges.size());
+            n.number_edges = static_cast<std::uint32_t>(tree.m_coincidentEdges.size());
+            for (const Segment& s : tree.m_coincidentEdges)
+            {
+                edges.emplace_back();
+                store(s, edges.back());
+            }
+            nodes.push_back(n);
+
+            auto positive = tree.m_positiveChild ? add_node(*tree.m_positiveChild, nodes, edges) : no_index;
+            auto negative = tree.m_negativeChild ? add_node(*tree.m_negativeChild, nodes, edges) : no_index;
+            nodes[id].positive = positive;
+            nodes[id].negative = negative;
+            return id;
+        }
+    };
+
+    //! \brief A read-only node_bsp_tree_2d queried in place from a binary image (see binary_image.hpp).
+
+    //! The image is written with make_binary_image(tree). locate_point and painters_traversal give the same results as the tree.
+    //! The view does not own the image memory.
+    template <typename Segment>
+    class node_bsp_tree_2d_view
+    {
+        using access = binary_image_access< node_bsp_tree_2d<Segment> >;
+        using node_type = typename access::node_type;
+        using edge_type = typename access::edge_type;
+        using point_type = typename point_type_of<Segment>::type;
+        using length_type = typename arithmetic_type_of<Segment>::type;
+
+    public:
+
+        node_bsp_tree_2d_view( const void* data, std::size_t size )
+            : node_bsp_tree_2d_view( binary_image_view( data, size, binary_image_kind::node_bsp_tree_2d, binary_image_scalar_code<length_type>(), 2 ) )
+        {}
+
+        explicit node_bsp_tree_2d_view( const mapped_binary_image& image )
+            : node_bsp_tree_2d_view( image.data(), image.size() )
+        {}
+
+        //! Method to detect if a point is inside, on the boundary our outside the shape represented by the partition.
+        template <typename Point, typename NumberComparisonPolicy>
+        point_location_classification locate_point( const Point& point, const NumberComparisonPolicy& compare ) const
+        {
+            GEOMETRIX_ASSERT( !m_nodes.empty() );
+            return locate_point( 0, point, compare );
+        }
+
+        //! Method to to a 'painters algorithm' traversal of the BSP for a specified point.
+        template <typename Point, typename Visitor, typename NumberComparisonPolicy>
+        void painters_traversal( const Point& point, Visitor&& visitor, const NumberComparisonPolicy& compare ) const
+        {
+            if( !m_nodes.empty() )
+                painters_traversal( 0, point, visitor, compare );
+        }
+
+    private:
+
+        explicit node_bsp_tree_2d_view( const binary_image_view& image )
+            : m_nodes( image.section<node_type>( node_bsp_image_detail::nodes_section ) )
+            , m_edges( image.section<edge_type>( node_bsp_image_detail::edges_section ) )
+        {}
+
+        Segment get_segment( const edge_type& e ) const
+        {
+            using binary_image_detail::load_coordinates;
+            return construct<Segment>( load_coordinates<point_type, 2>( e.start ), load_coordinates<point_type, 2>( e.end ) );
+        }
+
+        point_type get_start_point( std::uint32_t n ) const { return binary_image_detail::load_coordinates<point_type, 2>( m_nodes[n].splitting_segment.start ); }
+        point_type get_end_point( std::uint32_t n ) const { return binary_image_detail::load_coordinates<point_type, 2>( m_nodes[n].splitting_segment.end ); }
+
+        template <typename Point, typename NumberComparisonPolicy>
+        point_location_classification locate_point( std::uint32_t n, const Point& point, const NumberComparisonPolicy& compare ) const
+        {
+            using node_bsp_image_detail::no_index;
+            const node_type& node = m_nodes[n];
+            orientation_type orientation_point = get_orientation( get_start_point( n ), get_end_point( n ), point, compare );
+
+            if( orientation_point == oriented_left )
+                return node.positive != no_index ? locate_point( node.positive, point, compare ) : e_inside;
+            else if( orientation_point == oriented_right )
+                return node.negative != no_index ? locate_point( node.negative, point, compare ) : e_outside;
+
+            for( std::uint32_t i = node.first_edge; i < node.first_edge + node.number_edges; ++i )
+            {
+                using binary_image_detail::load_coordinates;
+                if( is_between( load_coordinates<point_type, 2>( m_edges[i].start ), load_coordinates<point_type, 2>( m_edges[i].end ), point, true, compare ) )
+                    return e_boundary;
+            }
+
+            if( node.positive != no_index )
+                return locate_point( node.positive, point, compare );
+            else if( node.negative != no_index )
+                return locate_point( node.negative, point, compare );
+
+            //! As in node_bsp_tree_2d this happens for points collinear with a polyline.
+            return e_boundary;
+        }
+
+        template <typename Visitor>
+        void visit_coincident_edges( const node_type& node, Visitor& visitor ) const
+        {
+            for( std::uint32_t i = node.first_edge; i < node.first_edge + node.number_edges; ++i )
+                visitor( get_segment( m_edges[i] ) );
+        }
+
+        template <typename Point, typename Visitor, typename NumberComparisonPolicy>
+        void painters_traversal( std::uint32_t n, const Point& point, Visitor& visitor, const NumberComparisonPolicy& compare ) const
+        {
+            using node_bsp_image_detail::no_index;
+            const node_type& node = m_nodes[n];
+            if( node.positive == no_index && node.negative == no_index )
+            {
+                visit_coincident_edges( node, visitor );
+                return;
+            }
+
+            orientation_type orientation_point = get_orientation( get_start_point( n ), get_end_point( n ), point, compare );
+            if( orientation_point == oriented_left )
+            {
+                if( node.negative != no_index )
+                    painters_traversal( node.negative, point, visitor, compare );
+                visit_coincident_edges( node, visitor );
+                if( node.positive != no_index )
+                    painters_traversal( node.positive, point, visitor, compare );
+            }
+            else if( orientation_point == oriented_right )
+            {
+                if( node.positive != no_index )
+                    painters_traversal( node.positive, point, visitor, compare );
+                visit_coincident_edges( node, visitor );
+                if( node.negative != no_index )
+                    painters_traversal( node.negative, point, visitor, compare );
+            }
+            else
+            {
+                if( node.positive != no_index )
+                    painters_traversal( node.positive, point, visitor, compare );
+                if( node.negative != no_index )
+                    painters_traversal( node.negative, point, visitor, compare );
+            }
+        }
+
+        binary_image_array<node_type> m_nodes;
+        binary_image_array<edge_type> m_edges;
+    };
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_BSPTREE2D_VIEW_HPP
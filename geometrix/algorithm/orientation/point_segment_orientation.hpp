@@ -10,14 +10,40 @@
 
 #include <geometrix/algorithm/orientation/orientation_enum.hpp>
 #include <geometrix/algorithm/orientation/vector_vector_orientation.hpp>
+#include <geometrix/tensor/contiguous_sequence.hpp>
 
 namespace geometrix {
 
+    namespace detail {
+
+        template <typename Point1, typename Point2, typename Point3>
+        struct is_contiguous_2d_orientation
+            : std::integral_constant<bool, are_contiguous_sequences<Point1, Point2, Point3>::value && dimension_of<Point1>::value == 2>
+        {};
+
+        template <typename Point1, typename Point2, typename Point3, typename NumberComparisonPolicy>
+        inline orientation_type point_segment_orientation(const Point1& A, const Point2& B, const Point3& C, const NumberComparisonPolicy& cmp, std::false_type)
+        {
+            return vector_vector_orientation(A-B, C-B, cmp);
+        }
+
+        //! The same products as vector_vector_orientation(A-B, C-B) evaluated directly on the coordinates.
+        template <typename Point1, typename Point2, typename Point3, typename NumberComparisonPolicy>
+        inline orientation_type point_segment_orientation(const Point1& A, const Point2& B, const Point3& C, const NumberComparisonPolicy& cmp, std::true_type)
+        {
+            auto a = contiguous_sequence_kernels::data(A);
+            auto b = contiguous_sequence_kernels::data(B);
+            auto c = contiguous_sequence_kernels::data(C);
+            return orientation((a[1] - b[1]) * (c[0] - b[0]), (a[0] - b[0]) * (c[1] - b[1]), cmp);
+        }
+
+    }//! namespace detail;
+
     //! Orientation test to check if point A is left, collinear, or right of the line formed by B-C.
     template <typename Point1, typename Point2, typename Point3, typename NumberComparisonPolicy>
     inline orientation_type point_segment_orientation( const Point1& A, const Point2& B, const Point3& C, const NumberComparisonPolicy& cmp )
     {
-        return vector_vector_orientation(A-B, C-B, cmp);
+        return detail::point_segment_orientation(A, B, C, cmp, typename detail::is_contiguous_2d_orientation<Point1, Point2, Point3>::type());
     }
     
     //! Orientation test to check if point A is left, collinear, or right of the line formed by seg.
@@ -32,7 +58,7 @@ namespace geometrix {
     template <typename Point1, typename Point2, typename Point3, typename NumberComparisonPolicy>
     inline orientation_type get_orientation( const Point1& A, const Point2& B, const Point3& C, const NumberComparisonPolicy& cmp )
     {
-        return vector_vector_orientation(C-A, B-A, cmp);
+        return detail::point_segment_orientation(C, A, B, cmp, typename detail::is_contiguous_2d_orientation<Point1, Point2, Point3>::type());
     }
 
 }//! namespace geometrix;
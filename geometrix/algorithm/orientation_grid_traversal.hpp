@@ -83,9 +83,10 @@ namespace geometrix
             if (j == j_end)
                 return;
 
+            //! The points are ordered by x, so the strip may run down as well as up.
             while (j != j_end)
             {
-                ++j;
+                j = signDeltaY > 0 ? j + 1 : j - 1;
                 visitor(i, j);
             }
             return;
@@ -10,6 +10,8 @@
 
 #include <geometrix/algebra/expression.hpp>
 #include <geometrix/primitive/point_traits.hpp>
+#include <geometrix/numeric/number_comparison_policy.hpp>
+#include <geometrix/numeric/constants.hpp>
 #include <boost/concept_check.hpp>
 
 namespace geometrix {
@@ -17,10 +19,11 @@ namespace geometrix {
     enum class point_circle_orientation
     {
         outside = -1
-        cocircular = 0
-        inside = 1
+      , cocircular = 0
+      , inside = 1
     };
 
+    //! The position of p relative to the circumcircle of the CCW triangle abc.
     template <typename Point1, typename Point2, typename Point3, typename Point4, typename NumberComparisonPolicy>
     inline point_circle_orientation point_in_circumcircle(const Point1& a, const Point2& b, const Point3& c, const Point4& p, const NumberComparisonPolicy& cmp)
     {
@@ -35,7 +38,7 @@ namespace geometrix {
         static_assert(dimension_of<Point4>::value == 2, "point_in_cicumcircle is 2D only.");
 
         using length_t = typename arithmetic_type_of<Point1>::type;
-        using area_t = decltype(std::declval<length_t>()*std::declval<length_t>);
+        using area_t = decltype(std::declval<length_t>()*std::declval<length_t>());
 
         length_t apx = get<0>(a) - get<0>(p);
         length_t apy = get<1>(a) - get<1>(p);
@@ -44,18 +47,18 @@ namespace geometrix {
         length_t cpx = get<0>(c) - get<0>(p);
         length_t cpy = get<1>(c) - get<1>(p);
 
-        area_t abdet = adx * bdy - bdx * ady;
-        area_t bcdet = bdx * cdy - cdx * bdy;
-        area_t cadet = cdx * ady - adx * cdy;
-        area_t alift = adx * adx + ady * ady;
-        area_t blift = bdx * bdx + bdy * bdy;
-        area_t clift = cdx * cdx + cdy * cdy;
+        area_t abdet = apx * bpy - bpx * apy;
+        area_t bcdet = bpx * cpy - cpx * bpy;
+        area_t cadet = cpx * apy - apx * cpy;
+        area_t alift = apx * apx + apy * apy;
+        area_t blift = bpx * bpx + bpy * bpy;
+        area_t clift = cpx * cpx + cpy * cpy;
 
-        area_t r = alift * bcdet + blift * cadet + clift * abdet;
-        if(cmp.greater_than(r, constants::zero<area_t>())
+        auto r = alift * bcdet + blift * cadet + clift * abdet;
+        if(cmp.greater_than(r, constants::zero<decltype(r)>()))
             return point_circle_orientation::inside;
 
-        if(cmp.less_than(r, constants::zero<area_t>())
+        if(cmp.less_than(r, constants::zero<decltype(r)>()))
             return point_circle_orientation::outside;
          
         return point_circle_orientation::cocircular;
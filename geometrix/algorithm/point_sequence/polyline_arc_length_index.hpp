@@ -0,0 +1,324 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_POLYLINE_ARC_LENGTH_INDEX_HPP
+#define GEOMETRIX_POLYLINE_ARC_LENGTH_INDEX_HPP
+#pragma once
+
+#include <geometrix/algorithm/point_sequence/polyline_split.hpp>
+#include <geometrix/algorithm/bounding_volume_hierarchy.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/algebra/dot_product.hpp>
+#include <geometrix/arithmetic/vector/magnitude.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief A cumulative arc length (station) index over the vertices of a polyline.
+
+    //! The station of a vertex is the length of the polyline from its first vertex. With the stations precomputed, locating
+    //! a position along the polyline is a binary search and the segment lengths are never recomputed. The index refers to the
+    //! polyline and stays valid when vertices are appended to it after a call to update. Queries take positions in [0, get_length()]
+    //! and clamp positions outside of that range. The boxes of the segments are kept in a bounding volume hierarchy alongside the
+    //! stations for the closest point queries.
+    template <typename Polyline>
+    class polyline_arc_length_index
+    {
+        using access = point_sequence_traits<Polyline>;
+
+    public:
+
+        using length_type = typename geometric_traits<typename access::point_type>::arithmetic_type;
+        using point_type = point<length_type, dimension_of<typename access::point_type>::value>;
+        using polyline_type = polyline<point_type>;
+        using segment_index_type = bounding_volume_hierarchy<point_type>;
+
+        //! Polylines with more vertices than this have their segment lengths computed in parallel batches of this size.
+        static const std::size_t batch_size = 4096;
+
+        explicit polyline_arc_length_index(const Polyline& poly, std::size_t nThreads = get_default_concurrency())
+            : m_polyline(&poly)
+        {
+            rebuild(nThreads);
+        }
+
+        //! Recompute the stations of all vertices.
+        void rebuild(std::size_t nThreads = get_default_concurrency())
+        {
+            m_stations.clear();
+            m_segments.clear();
+            extend(nThreads);
+        }
+
+        //! Index the vertices appended to the polyline since the last update. If the polyline has shrunk the index is rebuilt.
+        void update(std::size_t nThreads = get_default_concurrency())
+        {
+            if (access::size(*m_polyline) < m_stations.size())
+            {
+                m_stations.clear();
+                m_segments.clear();
+            }
+            extend(nThreads);
+        }
+
+        const Polyline& get_polyline() const { return *m_polyline; }
+
+        //! The number of indexed vertices.
+        std::size_t size() const { return m_stations.size(); }
+        bool empty() const { return m_stations.empty(); }
+
+        length_type get_length() const { return m_stations.empty() ? constants::zero<length_type>() : m_stations.back(); }
+
+        //! The station of vertex i.
+        length_type get_station(std::size_t i) const
+        {
+            GEOMETRIX_ASSERT(i < m_stations.size());
+            return m_stations[i];
+        }
+
+        const std::vector<length_type>& get_stations() const { return m_stations; }
+
+        //! The index i of the segment [i, i + 1] which contains the position s such that get_station(i) <= s < get_station(i + 1).
+        //! Positions at or beyond the end are on the last segment.
+        std::size_t find_segment(const length_type& s) const
+        {
+            GEOMETRIX_ASSERT(m_stations.size() > 1);
+            return find_segment(s, 0);
+        }
+
+        point_type get_point_at(const length_type& s) const
+        {
+            GEOMETRIX_ASSERT(!m_stations.empty());
+            if (m_stations.size() == 1)
+                return construct<point_type>(access::get_point(*m_polyline, 0));
+            return get_point_on_segment(find_segment(s), s);
+        }
+
+        //! Evaluate the points at a sorted range of positions writing them to out. The search for each position starts from the
+        //! segment of the previous one.
+        template <typename Stations, typename OutputIterator>
+        OutputIterator get_points_at(const Stations& stations, OutputIterator out) const
+        {
+            GEOMETRIX_ASSERT(!m_stations.empty());
+            std::size_t i = 0;
+            for (auto const& s : stations)
+            {
+                if (m_stations.size() == 1)
+                    *out++ = construct<point_type>(access::get_point(*m_polyline, 0));
+                else
+                {
+                    i = find_segment(s, i);
+                    *out++ = get_point_on_segment(i, s);
+                }
+            }
+            return out;
+        }
+
+        //! The station of the projection of p onto segment i.
+        template <typename Point>
+        length_type get_station_of(const Point& p, std::size_t i) const
+        {
+            GEOMETRIX_ASSERT(i + 1 < m_stations.size());
+            auto d = m_stations[i + 1] - m_stations[i];
+            if (!(d > constants::zero<length_type>()))
+                return m_stations[i];
+
+            auto const& A = access::get_point(*m_polyline, i);
+            auto const& B = access::get_point(*m_polyline, i + 1);
+            auto t = dot_product(p - A, B - A) / (d * d);
+            t = (std::max)(constants::zero<decltype(t)>(), (std::min)(constants::one<decltype(t)>(), t));
+            return m_stations[i] + t * d;
+        }
+
+        //! The station of the point on the polyline closest to p and the index of the segment on which it lies. The search descends
+        //! the hierarchy of segment boxes nearest first and only projects p onto the segments whose boxes are closer than the best so far.
+        template <typename Point>
+        std::pair<length_type, std::size_t> get_station_of_closest_point(const Point& p) const
+        {
+            GEOMETRIX_ASSERT(m_stations.size() > 1);
+            auto q = construct<point_type>(p);
+            auto nearest = m_segments.nearest(q, [this, &q](std::uint32_t i)
+            {
+                return magnitude_sqrd(q - get_point_on_segment(i, get_station_of(q, i)));
+            });
+            GEOMETRIX_ASSERT(nearest.first != segment_index_type::null_proxy);
+            return std::make_pair(get_station_of(q, nearest.first), static_cast<std::size_t>(nearest.first));
+        }
+
+        //! The part of the polyline between positions s0 <= s1. The vertices at s0 and s1 are interpolated when they fall inside segments.
+        polyline_type get_sub_polyline(length_type s0, length_type s1) const
+        {
+            GEOMETRIX_ASSERT(!m_stations.empty());
+            s0 = clamp(s0);
+            s1 = clamp(s1);
+            GEOMETRIX_ASSERT(!(s1 < s0));
+
+            polyline_type result;
+            result.push_back(get_point_at(s0));
+            if (!(s0 < s1))
+                return result;
+
+            auto first = std::upper_bound(m_stations.begin(), m_stations.end(), s0);
+            auto last = std::lower_bound(first, m_stations.end(), s1);
+            for (auto it = first; it != last; ++it)
+                result.push_back(construct<point_type>(access::get_point(*m_polyline, std::distance(m_stations.begin(), it))));
+            result.push_back(get_point_at(s1));
+            return result;
+        }
+
+        //! Locate position s as polyline_point_at_position does on the polyline: the index i of the segment containing s
+        //! and the point at s if it lies strictly inside the segment (i.e. it is not vertex i).
+        template <typename Length>
+        typename result_of::polyline_point_at_position<Polyline, Length>::type find_position(const Length& s) const
+        {
+            typename result_of::polyline_point_at_position<Polyline, Length>::type result;
+            if (m_stations.size() < 2)
+                return result;
+
+            auto it = std::upper_bound(m_stations.begin(), m_stations.end(), s);
+            if (it == m_stations.begin() || it == m_stations.end())
+            {
+                std::get<0>(result) = it == m_stations.begin() ? 0 : m_stations.size() - 2;
+                return result;
+            }
+
+            auto i = static_cast<std::size_t>(std::distance(m_stations.begin(), it)) - 1;
+            std::get<0>(result) = i;
+            if (m_stations[i] < s)
+                std::get<1>(result) = get_point_on_segment(i, s);
+            return result;
+        }
+
+        //! Split the polyline at position s. The split point ends the first part and starts the second.
+        std::tuple<polyline_type, polyline_type> split(const length_type& s) const
+        {
+            return std::tuple<polyline_type, polyline_type>{ get_sub_polyline(constants::zero<length_type>(), s), get_sub_polyline(s, get_length()) };
+        }
+
+        //! Split the polyline at a sorted range of positions into one more part than there are positions.
+        template <typename Stations>
+        std::vector<polyline_type> split_at(const Stations& stations) const
+        {
+            std::vector<polyline_type> result;
+            auto s0 = constants::zero<length_type>();
+            for (auto const& s : stations)
+            {
+                auto s1 = (std::max)(s0, clamp(s));
+                result.push_back(get_sub_polyline(s0, s1));
+                s0 = s1;
+            }
+            result.push_back(get_sub_polyline(s0, get_length()));
+            return result;
+        }
+
+    private:
+
+        length_type clamp(const length_type& s) const
+        {
+            return (std::max)(constants::zero<length_type>(), (std::min)(get_length(), s));
+        }
+
+        //! Find the segment containing s searching from segment hint onwards.
+        std::size_t find_segment(const length_type& s, std::size_t hint) const
+        {
+            auto it = std::upper_bound(m_stations.begin() + hint, m_stations.end(), s);
+            auto i = static_cast<std::size_t>(std::distance(m_stations.begin(), it));
+            return i == 0 ? 0 : (std::min)(i - 1, m_stations.size() - 2);
+        }
+
+        point_type get_point_on_segment(std::size_t i, const length_type& s) const
+        {
+            auto t = s - m_stations[i];
+            auto d = m_stations[i + 1] - m_stations[i];
+            if (!(t > constants::zero<length_type>()) || !(d > constants::zero<length_type>()))
+                return construct<point_type>(access::get_point(*m_polyline, i));
+            if (!(t < d))
+                return construct<point_type>(access::get_point(*m_polyline, i + 1));
+
+            auto const& A = access::get_point(*m_polyline, i);
+            auto const& B = access::get_point(*m_polyline, i + 1);
+            return construct<point_type>(A + (t / d) * (B - A));
+        }
+
+        //! Compute the stations of the vertices after the last indexed one and add the boxes of their segments to the hierarchy.
+        //! Each batch is summed locally and then offset by the total of the preceding batches, so the result does not depend on
+        //! the number of threads.
+        void extend(std::size_t nThreads)
+        {
+            auto size = access::size(*m_polyline);
+            if (size == 0 || size == m_stations.size())
+                return;
+
+            std::size_t first = m_stations.size();
+            if (first == 0)
+            {
+                m_stations.push_back(constants::zero<length_type>());
+                first = 1;
+            }
+
+            m_stations.resize(size);
+            auto n = size - first;
+            auto p0 = construct<point_type>(access::get_point(*m_polyline, 0));
+            std::vector<typename segment_index_type::aabb_type> boxes(n, typename segment_index_type::aabb_type(p0, p0));
+            parallel_for_batches(n, batch_size, [this, first, &boxes](std::size_t, std::size_t begin, std::size_t end)
+            {
+                auto sum = constants::zero<length_type>();
+                for (auto k = first + begin; k < first + end; ++k)
+                {
+                    auto const& A = access::get_point(*m_polyline, k - 1);
+                    auto const& B = access::get_point(*m_polyline, k);
+                    sum += point_point_distance(A, B);
+                    m_stations[k] = sum;
+                    boxes[k - first] = make_aabb<point_type>(segment<point_type>(construct<point_type>(A), construct<point_type>(B)));
+                }
+            }, nThreads);
+
+            //! Segment k - 1 ends at vertex k. A new index is built in bulk and an extended one has the new segments inserted.
+            if (m_segments.empty())
+                m_segments.build(boxes);
+            else
+            {
+                for (std::size_t j = 0; j < n; ++j)
+                    m_segments.insert(boxes[j], static_cast<std::uint32_t>(first - 1 + j));
+            }
+
+            //! Offset each batch by the station preceding it.
+            auto nBatches = get_number_batches(n, batch_size);
+            std::vector<length_type> offsets(nBatches);
+            auto offset = m_stations[first - 1];
+            for (std::size_t b = 0; b < nBatches; ++b)
+            {
+                offsets[b] = offset;
+                offset += m_stations[first + (std::min)(n, (b + 1) * batch_size) - 1];
+            }
+
+            parallel_for_batches(n, batch_size, [this, first, &offsets](std::size_t b, std::size_t begin, std::size_t end)
+            {
+                for (auto k = first + begin; k < first + end; ++k)
+                    m_stations[k] += offsets[b];
+            }, nThreads);
+        }
+
+        const Polyline* m_polyline;
+        std::vector<length_type> m_stations;
+        segment_index_type m_segments;
+
+    };
+
+    template <typename Polyline>
+    const std::size_t polyline_arc_length_index<Polyline>::batch_size;
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_POLYLINE_ARC_LENGTH_INDEX_HPP
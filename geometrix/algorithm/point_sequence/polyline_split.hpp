@@ -11,6 +11,7 @@
 #include <geometrix/primitive/point_sequence_traits.hpp>
 #include <geometrix/utility/utilities.hpp>
 #include <geometrix/primitive/point.hpp>
+#include <geometrix/primitive/polyline.hpp>
 #include <geometrix/tensor/vector.hpp>
 #include <geometrix/algorithm/distance/point_point_distance.hpp>
 #include <boost/optional.hpp>
@@ -0,0 +1,700 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_POLYGON_BOOLEAN_OPERATIONS_HPP
+#define GEOMETRIX_ALGORITHM_POLYGON_BOOLEAN_OPERATIONS_HPP
+#pragma once
+
+#include <geometrix/algorithm/all_segment_intersections.hpp>
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/primitive/polygon.hpp>
+#include <geometrix/primitive/polygon_with_holes.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/utility/utilities.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! Boolean operations on polygonal regions. The operands may be a polygon, a polygon_with_holes or a std::vector of either;
+//! rings may have either orientation and the polygons of an operand may overlap (the region of an operand is the set of
+//! points with a nonzero winding number once the outers are made counter-clockwise and the holes clockwise). The result is
+//! a set of polygon_with_holes with counter-clockwise outers and clockwise holes.
+namespace geometrix {
+
+    enum polygon_boolean_operation
+    {
+        e_polygon_union = 0
+      , e_polygon_intersection = 1
+      , e_polygon_difference = 2 //! a - b
+      , e_polygon_xor = 3
+    };
+
+    namespace polygon_boolean_detail {
+
+        template <typename T>
+        struct operand_point
+        {
+            using type = typename geometric_traits<T>::point_type;
+        };
+
+        template <typename T, typename Alloc>
+        struct operand_point<std::vector<T, Alloc>> : operand_point<T>
+        {};
+
+        inline bool is_inside(polygon_boolean_operation op, bool a, bool b)
+        {
+            switch (op)
+            {
+            case e_polygon_union:
+                return a || b;
+            case e_polygon_intersection:
+                return a && b;
+            case e_polygon_difference:
+                return a && !b;
+            case e_polygon_xor:
+                return a != b;
+            };
+
+            GEOMETRIX_ASSERT(false);
+            return false;
+        }
+
+        //! The edges of both operands with the operand of each edge.
+        template <typename Point>
+        struct operand_edges
+        {
+            std::vector<segment<Point>> segments;
+            std::vector<std::uint8_t>   operands;
+        };
+
+        //! Append the edges of a ring oriented counter-clockwise if ccw is true and clockwise otherwise. Degenerate rings are skipped.
+        template <typename Point, typename Ring>
+        inline void append_ring(operand_edges<Point>& edges, const Ring& ring, bool ccw, std::uint8_t operand)
+        {
+            std::size_t n = ring.size();
+            if (n < 3)
+                return;
+
+            auto area = get_signed_area(ring);
+            if (area == constants::zero<decltype(area)>())
+                return;
+
+            bool reverse = (area > constants::zero<decltype(area)>()) != ccw;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto const& a = ring[i];
+                auto const& b = ring[(i + 1) % n];
+                if (reverse)
+                    edges.segments.emplace_back(b, a);
+                else
+                    edges.segments.emplace_back(a, b);
+                edges.operands.push_back(operand);
+            }
+        }
+
+        template <typename Point, typename Alloc>
+        inline void append_operand(operand_edges<Point>& edges, const polygon<Point, Alloc>& pgon, std::uint8_t operand)
+        {
+            append_ring(edges, pgon, true, operand);
+        }
+
+        template <typename Point, typename Alloc>
+        inline void append_operand(operand_edges<Point>& edges, const polygon_with_holes<Point, Alloc>& pgon, std::uint8_t operand)
+        {
+            append_ring(edges, pgon.get_outer(), true, operand);
+            for (auto const& hole : pgon.get_holes())
+                append_ring(edges, hole, false, operand);
+        }
+
+        template <typename Point, typename T, typename Alloc>
+        inline void append_operand(operand_edges<Point>& edges, const std::vector<T, Alloc>& pgons, std::uint8_t operand)
+        {
+            for (auto const& pgon : pgons)
+                append_operand(edges, pgon, operand);
+        }
+
+        template <typename Point, typename Alloc>
+        inline const polygon<Point, Alloc>& get_outer_ring(const polygon<Point, Alloc>& pgon) { return pgon; }
+
+        template <typename Point, typename Alloc>
+        inline const polygon<Point, Alloc>& get_outer_ring(const polygon_with_holes<Point, Alloc>& pgon) { return pgon.get_outer(); }
+
+        //! An undirected edge of the arrangement (lo < hi) with the net number of times each operand runs along it from lo to hi.
+        struct arrangement_edge
+        {
+            std::uint32_t lo;
+            std::uint32_t hi;
+            int           winding[2];
+        };
+
+        //! The planar arrangement of the edges of both operands split at their intersections. Vertices closer than the tolerance
+        //! of the comparison policy are merged.
+        template <typename Point>
+        struct arrangement
+        {
+            std::vector<Point>            vertices;
+            std::vector<arrangement_edge> edges;
+        };
+
+        template <typename Point, typename NumberComparisonPolicy>
+        inline arrangement<Point> make_arrangement(const operand_edges<Point>& input, const NumberComparisonPolicy& cmp, std::size_t nThreads)
+        {
+            using length_t = typename geometric_traits<Point>::arithmetic_type;
+
+            auto const& segments = input.segments;
+            auto records = find_segment_intersections(segments, make_segment_intersection_grid(segments), cmp, nThreads);
+
+            std::vector<std::vector<Point>> splits(segments.size());
+            for (auto const& r : records)
+            {
+                std::size_t nPoints = r.type == e_overlapping ? 2 : 1;
+                for (std::size_t i = 0; i < nPoints; ++i)
+                {
+                    splits[r.first].push_back(r.xPoints[i]);
+                    splits[r.second].push_back(r.xPoints[i]);
+                }
+            }
+            records.clear();
+
+            arrangement<Point> result;
+            std::map<Point, std::uint32_t, lexicographical_comparer<NumberComparisonPolicy>> vertexMap(cmp);
+            auto get_vertex = [&](const Point& p)
+            {
+                auto iter = vertexMap.lower_bound(p);
+                if (iter != vertexMap.end() && !vertexMap.key_comp()(p, iter->first))
+                    return iter->second;
+                auto id = static_cast<std::uint32_t>(result.vertices.size());
+                result.vertices.push_back(p);
+                vertexMap.emplace_hint(iter, p, id);
+                return id;
+            };
+
+            std::unordered_map<std::uint64_t, std::size_t> edgeMap;
+            auto add_edge = [&](std::uint32_t a, std::uint32_t b, std::uint8_t operand)
+            {
+                auto lo = (std::min)(a, b), hi = (std::max)(a, b);
+                auto key = (static_cast<std::uint64_t>(lo) << 32) | hi;
+                auto iter = edgeMap.find(key);
+                if (iter == edgeMap.end())
+                {
+                    iter = edgeMap.emplace(key, result.edges.size()).first;
+                    result.edges.push_back(arrangement_edge{ lo, hi, { 0, 0 } });
+                }
+                result.edges[iter->second].winding[operand] += a < b ? 1 : -1;
+            };
+
+            std::vector<std::pair<length_t, Point>> points;
+            for (std::size_t i = 0; i < segments.size(); ++i)
+            {
+                auto const& s = get_start(segments[i]);
+                auto const& e = get_end(segments[i]);
+                auto dx = get<0>(e) - get<0>(s);
+                auto dy = get<1>(e) - get<1>(s);
+
+                points.clear();
+                points.emplace_back(constants::zero<length_t>(), s);
+                for (auto const& p : splits[i])
+                    points.emplace_back((get<0>(p) - get<0>(s)) * dx + (get<1>(p) - get<1>(s)) * dy, p);
+                points.emplace_back(dx * dx + dy * dy, e);
+                std::stable_sort(points.begin() + 1, points.end() - 1, [](const std::pair<length_t, Point>& lhs, const std::pair<length_t, Point>& rhs) { return lhs.first < rhs.first; });
+
+                auto previous = get_vertex(points.front().second);
+                for (std::size_t j = 1; j < points.size(); ++j)
+                {
+                    auto next = get_vertex(points[j].second);
+                    if (next != previous)
+                    {
+                        add_edge(previous, next, input.operands[i]);
+                        previous = next;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        //! Winding numbers of both operands at a point computed by casting a ray along +x over the edges of the arrangement.
+        //! The edges are bucketed into horizontal strips so a query only visits the edges whose y extent covers the point.
+        template <typename Point>
+        class winding_index
+        {
+        public:
+
+            winding_index(const arrangement<Point>& arr)
+                : m_arrangement(arr)
+            {
+                using namespace filtered_predicates_detail;
+                m_ymin = (std::numeric_limits<double>::max)();
+                double ymax = -(std::numeric_limits<double>::max)();
+                std::size_t nEdges = 0;
+                for (auto const& e : arr.edges)
+                {
+                    if (e.winding[0] == 0 && e.winding[1] == 0)
+                        continue;
+                    ++nEdges;
+                    for (auto v : { e.lo, e.hi })
+                    {
+                        double y = to_double(get<1>(arr.vertices[v]));
+                        m_ymin = (std::min)(m_ymin, y);
+                        ymax = (std::max)(ymax, y);
+                    }
+                }
+
+                std::size_t nRows = (std::max)(std::size_t{ 1 }, static_cast<std::size_t>(std::sqrt(static_cast<double>(nEdges))));
+                m_rowHeight = ymax > m_ymin ? (ymax - m_ymin) / nRows : 1.0;
+                m_offsets.assign(nRows + 1, 0);
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    std::vector<std::size_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+                    if (pass == 1)
+                        m_items.resize(m_offsets.back());
+                    for (std::uint32_t i = 0; i < arr.edges.size(); ++i)
+                    {
+                        auto const& e = arr.edges[i];
+                        if (e.winding[0] == 0 && e.winding[1] == 0)
+                            continue;
+                        double y0 = to_double(get<1>(arr.vertices[e.lo])), y1 = to_double(get<1>(arr.vertices[e.hi]));
+                        auto r1 = get_row((std::max)(y0, y1));
+                        for (auto r = get_row((std::min)(y0, y1)); r <= r1; ++r)
+                        {
+                            if (pass == 0)
+                                ++m_offsets[r + 1];
+                            else
+                                m_items[cursor[r]++] = i;
+                        }
+                    }
+
+                    if (pass == 0)
+                        std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+                }
+            }
+
+            //! The winding numbers at p of the arrangement without the edge skip (pass the edge p lies on). Points on the ray's
+            //! line are treated as if they were infinitesimally above it.
+            void get_winding_numbers(const Point& p, std::size_t skip, int winding[2]) const
+            {
+                using namespace filtered_predicates_detail;
+                winding[0] = winding[1] = 0;
+                auto py = get<1>(p);
+                auto r = get_row(to_double(py));
+                for (auto k = m_offsets[r]; k < m_offsets[r + 1]; ++k)
+                {
+                    auto i = m_items[k];
+                    if (i == skip)
+                        continue;
+
+                    auto const& e = m_arrangement.edges[i];
+                    auto const& lo = m_arrangement.vertices[e.lo];
+                    auto const& hi = m_arrangement.vertices[e.hi];
+                    if (!(get<1>(lo) <= py) != !(get<1>(hi) <= py))
+                    {
+                        auto o = filtered_orientation(lo, hi, p);
+                        if (get<1>(lo) <= py && o == oriented_left)
+                        {
+                            winding[0] += e.winding[0];
+                            winding[1] += e.winding[1];
+                        }
+                        else if (get<1>(hi) <= py && o == oriented_right)
+                        {
+                            winding[0] -= e.winding[0];
+                            winding[1] -= e.winding[1];
+                        }
+                    }
+                }
+            }
+
+        private:
+
+            std::size_t get_row(double y) const
+            {
+                auto r = (y - m_ymin) / m_rowHeight;
+                if (!(r > 0.0))
+                    return 0;
+                return (std::min)(static_cast<std::size_t>(r), m_offsets.size() - 2);
+            }
+
+            const arrangement<Point>&  m_arrangement;
+            double                     m_ymin;
+            double                     m_rowHeight;
+            std::vector<std::size_t>   m_offsets;
+            std::vector<std::uint32_t> m_items;
+
+        };
+
+        //! True if the direction from v to b is further counter-clockwise than the direction from v to a with angles measured
+        //! counter-clockwise from the direction from v to u in [0, 2pi).
+        template <typename Point>
+        inline bool is_further_ccw(const Point& v, const Point& u, const Point& a, const Point& b)
+        {
+            auto get_half = [&](const Point& p) { return filtered_orientation(v, u, p) == oriented_left ? 0 : 1; };
+            auto ha = get_half(a), hb = get_half(b);
+            if (ha != hb)
+                return ha < hb;
+            return filtered_orientation(v, a, b) == oriented_left;
+        }
+
+        //! Trace the directed edges of the result into rings. At each vertex the ring turns onto the outgoing edge which is
+        //! first clockwise from the edge it arrived on so that rings touching at a vertex are kept apart.
+        template <typename Point>
+        inline std::vector<polygon<Point>> trace_rings(const arrangement<Point>& arr, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& directed)
+        {
+            std::vector<std::vector<std::size_t>> outgoing(arr.vertices.size());
+            for (std::size_t i = 0; i < directed.size(); ++i)
+                outgoing[directed[i].first].push_back(i);
+
+            std::vector<bool> used(directed.size(), false);
+            std::vector<polygon<Point>> rings;
+            std::vector<std::uint32_t> ring;
+            for (std::size_t start = 0; start < directed.size(); ++start)
+            {
+                if (used[start])
+                    continue;
+
+                ring.clear();
+                auto e = start;
+                do
+                {
+                    used[e] = true;
+                    ring.push_back(directed[e].first);
+                    auto u = directed[e].first, v = directed[e].second;
+                    std::size_t next = directed.size();
+                    for (auto candidate : outgoing[v])
+                    {
+                        if (used[candidate] && candidate != start)
+                            continue;
+                        if (next == directed.size() || is_further_ccw(arr.vertices[v], arr.vertices[u], arr.vertices[directed[next].second], arr.vertices[directed[candidate].second]))
+                            next = candidate;
+                    }
+                    GEOMETRIX_ASSERT(next != directed.size());
+                    e = next;
+                } while (e != start);
+
+                //! Drop the vertices between collinear edges including across the start of the ring.
+                std::vector<std::uint32_t> kept;
+                auto is_collinear = [&](std::uint32_t i, std::uint32_t j, std::uint32_t k) { return filtered_orientation(arr.vertices[i], arr.vertices[j], arr.vertices[k]) == oriented_collinear; };
+                for (auto id : ring)
+                {
+                    while (kept.size() > 1 && is_collinear(kept[kept.size() - 2], kept.back(), id))
+                        kept.pop_back();
+                    kept.push_back(id);
+                }
+
+                std::size_t first = 0;
+                bool changed = true;
+                while (changed && kept.size() - first >= 3)
+                {
+                    changed = false;
+                    if (is_collinear(kept[kept.size() - 2], kept.back(), kept[first]))
+                    {
+                        kept.pop_back();
+                        changed = true;
+                    }
+                    else if (is_collinear(kept.back(), kept[first], kept[first + 1]))
+                    {
+                        ++first;
+                        changed = true;
+                    }
+                }
+
+                if (kept.size() - first < 3)
+                    continue;
+
+                polygon<Point> pgon;
+                pgon.reserve(kept.size() - first);
+                for (auto i = first; i < kept.size(); ++i)
+                    pgon.push_back(arr.vertices[kept[i]]);
+                rings.push_back(std::move(pgon));
+            }
+
+            return rings;
+        }
+
+        //! Winding number of a closed ring at a point which is not on the ring.
+        template <typename Point>
+        inline int get_ring_winding_number(const polygon<Point>& ring, const Point& p)
+        {
+            int winding = 0;
+            auto py = get<1>(p);
+            for (std::size_t i = 0, n = ring.size(); i < n; ++i)
+            {
+                auto const& a = ring[i];
+                auto const& b = ring[(i + 1) % n];
+                if (get<1>(a) <= py)
+                {
+                    if (py < get<1>(b) && filtered_orientation(a, b, p) == oriented_left)
+                        ++winding;
+                }
+                else if (get<1>(b) <= py && filtered_orientation(a, b, p) == oriented_right)
+                    --winding;
+            }
+            return winding;
+        }
+
+        //! Group counter-clockwise rings as outers and clockwise rings as holes of the smallest outer containing them.
+        template <typename Point>
+        inline std::vector<polygon_with_holes<Point>> assemble_polygons(std::vector<polygon<Point>>&& rings)
+        {
+            using area_t = decltype(get_signed_area(rings.front()));
+            using length_t = typename geometric_traits<Point>::arithmetic_type;
+
+            std::vector<std::pair<area_t, std::size_t>> outers;
+            std::vector<std::size_t> holes;
+            for (std::size_t i = 0; i < rings.size(); ++i)
+            {
+                auto area = get_signed_area(rings[i]);
+                if (area > constants::zero<area_t>())
+                    outers.emplace_back(area, i);
+                else if (area < constants::zero<area_t>())
+                    holes.push_back(i);
+            }
+            std::sort(outers.begin(), outers.end(), [](const std::pair<area_t, std::size_t>& lhs, const std::pair<area_t, std::size_t>& rhs) { return lhs.first < rhs.first; });
+
+            std::vector<polygon_with_holes<Point>> result;
+            result.reserve(outers.size());
+            for (auto const& item : outers)
+                result.emplace_back(std::move(rings[item.second]));
+
+            std::vector<std::pair<Point, Point>> bounds;
+            bounds.reserve(result.size());
+            for (auto const& pgon : result)
+            {
+                auto const& outer = pgon.get_outer();
+                length_t xmin = get<0>(outer[0]), xmax = xmin, ymin = get<1>(outer[0]), ymax = ymin;
+                for (auto const& p : outer)
+                {
+                    xmin = (std::min)(xmin, get<0>(p));
+                    xmax = (std::max)(xmax, get<0>(p));
+                    ymin = (std::min)(ymin, get<1>(p));
+                    ymax = (std::max)(ymax, get<1>(p));
+                }
+                bounds.emplace_back(construct<Point>(xmin, ymin), construct<Point>(xmax, ymax));
+            }
+
+            for (auto h : holes)
+            {
+                auto& hole = rings[h];
+                auto two = constants::two<length_t>();
+                auto p = construct<Point>((get<0>(hole[0]) + get<0>(hole[1])) / two, (get<1>(hole[0]) + get<1>(hole[1])) / two);
+                for (std::size_t o = 0; o < result.size(); ++o)
+                {
+                    auto const& lo = bounds[o].first;
+                    auto const& hi = bounds[o].second;
+                    if (get<0>(p) < get<0>(lo) || get<0>(hi) < get<0>(p) || get<1>(p) < get<1>(lo) || get<1>(hi) < get<1>(p))
+                        continue;
+                    if (get_ring_winding_number(result[o].get_outer(), p) != 0)
+                    {
+                        result[o].add_hole(std::move(hole));
+                        break;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+    }//! namespace polygon_boolean_detail;
+
+    //! \brief Compute a boolean operation on two polygonal regions.
+
+    //! The edges of both operands are split at their intersections (see find_segment_intersections) into a planar arrangement.
+    //! Each edge of the arrangement is classified by the winding numbers of both operands on either side of it: along an edge
+    //! of an operand the difference is the net number of times the operand runs along it, and the winding number on one side
+    //! is found by casting a ray over a strip index of the arrangement with exact orientation tests (see filtered_orientation).
+    //! The edges with the result's interior on exactly one side are traced into rings which are grouped into polygons. The
+    //! classification runs in parallel.
+    template <typename OperandA, typename OperandB, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<OperandA>::type>> polygon_boolean(const OperandA& a, const OperandB& b, polygon_boolean_operation op, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace polygon_boolean_detail;
+        using point_t = typename operand_point<OperandA>::type;
+        using length_t = typename geometric_traits<point_t>::arithmetic_type;
+
+        operand_edges<point_t> input;
+        append_operand(input, a, 0);
+        append_operand(input, b, 1);
+        if (input.segments.empty())
+            return {};
+
+        auto arr = make_arrangement(input, cmp, nThreads);
+        input = operand_edges<point_t>();
+
+        //! The direction in which to keep each edge: 1 from lo to hi, -1 from hi to lo and 0 if it is not on the boundary.
+        winding_index<point_t> index(arr);
+        std::vector<std::int8_t> directions(arr.edges.size(), 0);
+        parallel_for(arr.edges.size(), [&](std::size_t i)
+        {
+            auto const& e = arr.edges[i];
+            auto const& lo = arr.vertices[e.lo];
+            auto const& hi = arr.vertices[e.hi];
+            auto two = constants::two<length_t>();
+            auto m = construct<point_t>((get<0>(lo) + get<0>(hi)) / two, (get<1>(lo) + get<1>(hi)) / two);
+
+            //! The ray from the midpoint samples the side of the edge towards +x, or the side above it when the edge is horizontal.
+            int sampled[2];
+            index.get_winding_numbers(m, i, sampled);
+            bool sampledIsLeft = get<1>(lo) == get<1>(hi) ? get<0>(lo) < get<0>(hi) : get<1>(hi) < get<1>(lo);
+            bool left[2], right[2];
+            for (std::size_t k = 0; k < 2; ++k)
+            {
+                auto l = sampledIsLeft ? sampled[k] : sampled[k] + e.winding[k];
+                auto r = sampledIsLeft ? sampled[k] - e.winding[k] : sampled[k];
+                left[k] = l != 0;
+                right[k] = r != 0;
+            }
+
+            bool insideLeft = is_inside(op, left[0], left[1]);
+            bool insideRight = is_inside(op, right[0], right[1]);
+            if (insideLeft != insideRight)
+                directions[i] = insideLeft ? 1 : -1;
+        }, 256, nThreads);
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> directed;
+        for (std::size_t i = 0; i < arr.edges.size(); ++i)
+        {
+            if (directions[i] > 0)
+                directed.emplace_back(arr.edges[i].lo, arr.edges[i].hi);
+            else if (directions[i] < 0)
+                directed.emplace_back(arr.edges[i].hi, arr.edges[i].lo);
+        }
+
+        return assemble_polygons(trace_rings(arr, directed));
+    }
+
+    template <typename OperandA, typename OperandB, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<OperandA>::type>> polygon_union(const OperandA& a, const OperandB& b, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        return polygon_boolean(a, b, e_polygon_union, cmp, nThreads);
+    }
+
+    template <typename OperandA, typename OperandB, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<OperandA>::type>> polygon_intersection(const OperandA& a, const OperandB& b, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        return polygon_boolean(a, b, e_polygon_intersection, cmp, nThreads);
+    }
+
+    template <typename OperandA, typename OperandB, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<OperandA>::type>> polygon_difference(const OperandA& a, const OperandB& b, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        return polygon_boolean(a, b, e_polygon_difference, cmp, nThreads);
+    }
+
+    template <typename OperandA, typename OperandB, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<OperandA>::type>> polygon_xor(const OperandA& a, const OperandB& b, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        return polygon_boolean(a, b, e_polygon_xor, cmp, nThreads);
+    }
+
+    //! \brief Compute the union of a random access range of polygons or polygon_with_holes.
+
+    //! The polygons are ordered by recursively splitting their bounding box centers at the median of the wider axis (as a kd tree)
+    //! so that neighbouring polygons are merged first, and the union is then computed as a cascade of pairwise unions in which
+    //! the pairs of each level run in parallel. Each union then only deals with the boundary left over from its two halves,
+    //! which is much cheaper than adding the polygons one at a time.
+    template <typename Polygons, typename NumberComparisonPolicy>
+    inline std::vector<polygon_with_holes<typename polygon_boolean_detail::operand_point<typename Polygons::value_type>::type>> cascaded_polygon_union(const Polygons& polygons, const NumberComparisonPolicy& cmp, std::size_t nThreads = get_default_concurrency())
+    {
+        using namespace polygon_boolean_detail;
+        using point_t = typename operand_point<typename Polygons::value_type>::type;
+        using result_t = std::vector<polygon_with_holes<point_t>>;
+
+        std::size_t n = polygons.size();
+        if (n == 0)
+            return {};
+        if (n == 1)
+            return polygon_union(polygons[0], result_t(), cmp, nThreads);
+
+        std::vector<std::pair<double, double>> centers(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            using namespace filtered_predicates_detail;
+            auto const& outer = get_outer_ring(polygons[i]);
+            double xmin = (std::numeric_limits<double>::max)(), ymin = xmin, xmax = -xmin, ymax = -xmin;
+            for (auto const& p : outer)
+            {
+                xmin = (std::min)(xmin, to_double(get<0>(p)));
+                xmax = (std::max)(xmax, to_double(get<0>(p)));
+                ymin = (std::min)(ymin, to_double(get<1>(p)));
+                ymax = (std::max)(ymax, to_double(get<1>(p)));
+            }
+            centers[i] = std::make_pair(0.5 * (xmin + xmax), 0.5 * (ymin + ymax));
+        }
+
+        //! Split each range so that its first half is a power of two in size. The blocks merged at each level of the cascade
+        //! are then exactly the cells of the kd tree.
+        std::vector<std::size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::vector<std::pair<std::size_t, std::size_t>> stack(1, std::make_pair(std::size_t{ 0 }, n));
+        while (!stack.empty())
+        {
+            auto range = stack.back();
+            stack.pop_back();
+            auto size = range.second - range.first;
+            if (size <= 2)
+                continue;
+
+            std::size_t half = 1;
+            while (2 * half < size)
+                half *= 2;
+
+            double xmin = (std::numeric_limits<double>::max)(), ymin = xmin, xmax = -xmin, ymax = -xmin;
+            for (auto i = range.first; i < range.second; ++i)
+            {
+                xmin = (std::min)(xmin, centers[order[i]].first);
+                xmax = (std::max)(xmax, centers[order[i]].first);
+                ymin = (std::min)(ymin, centers[order[i]].second);
+                ymax = (std::max)(ymax, centers[order[i]].second);
+            }
+
+            bool splitX = (xmax - xmin) >= (ymax - ymin);
+            std::nth_element(order.begin() + range.first, order.begin() + range.first + half, order.begin() + range.second, [&](std::size_t lhs, std::size_t rhs)
+            {
+                return splitX ? centers[lhs].first < centers[rhs].first : centers[lhs].second < centers[rhs].second;
+            });
+            stack.emplace_back(range.first, range.first + half);
+            stack.emplace_back(range.first + half, range.second);
+        }
+
+        //! The first level unions the input polygons directly.
+        std::vector<result_t> level((n + 1) / 2);
+        parallel_for(level.size(), [&](std::size_t i)
+        {
+            if (2 * i + 1 < n)
+                level[i] = polygon_union(polygons[order[2 * i]], polygons[order[2 * i + 1]], cmp, 1);
+            else
+                level[i] = polygon_union(polygons[order[2 * i]], result_t(), cmp, 1);
+        }, 1, nThreads);
+
+        while (level.size() > 1)
+        {
+            auto innerThreads = (std::max)(std::size_t{ 1 }, nThreads / (level.size() / 2));
+            std::vector<result_t> next((level.size() + 1) / 2);
+            parallel_for(next.size(), [&](std::size_t i)
+            {
+                if (2 * i + 1 < level.size())
+                    next[i] = polygon_union(level[2 * i], level[2 * i + 1], cmp, innerThreads);
+                else
+                    next[i] = std::move(level[2 * i]);
+            }, 1, nThreads);
+            level = std::move(next);
+        }
+
+        return std::move(level.front());
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_POLYGON_BOOLEAN_OPERATIONS_HPP
@@ -0,0 +1,426 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_ROTATING_CALIPERS_HPP
+#define GEOMETRIX_ALGORITHM_ROTATING_CALIPERS_HPP
+#pragma once
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/primitive/oriented_bounding_box.hpp>
+#include <geometrix/utility/utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//! Linear time queries on convex polygons in 2D by rotating calipers (G. Toussaint, Solving geometric problems with the rotating
+//! calipers, 1983): the distance between two convex polygons, the diameter and width of a convex polygon and the minimum area and
+//! minimum width oriented bounding boxes of a point set. The polygons may be given in either orientation. The measures are computed
+//! in double precision.
+namespace geometrix {
+
+    namespace rotating_calipers_detail {
+
+        struct vec2
+        {
+            double x, y;
+        };
+
+        inline vec2 sub(const vec2& a, const vec2& b) { return vec2{ a.x - b.x, a.y - b.y }; }
+        inline vec2 lerp(const vec2& a, const vec2& b, double t) { return vec2{ a.x + t * (b.x - a.x), a.y + t * (b.y - a.y) }; }
+        inline double dot(const vec2& a, const vec2& b) { return a.x * b.x + a.y * b.y; }
+        inline double cross(const vec2& a, const vec2& b) { return a.x * b.y - a.y * b.x; }
+
+        template <typename Point>
+        inline vec2 to_vec2(const Point& p)
+        {
+            using filtered_predicates_detail::to_double;
+            return vec2{ to_double(get<0>(p)), to_double(get<1>(p)) };
+        }
+
+        //! The vertices of a convex polygon in counter-clockwise order without repeated vertices.
+        template <typename Polygon>
+        inline std::vector<vec2> get_ccw_vertices(const Polygon& poly)
+        {
+            std::vector<vec2> v;
+            v.reserve(poly.size());
+            for (auto const& p : poly)
+            {
+                auto q = to_vec2(p);
+                if (v.empty() || q.x != v.back().x || q.y != v.back().y)
+                    v.push_back(q);
+            }
+
+            while (v.size() > 1 && v.front().x == v.back().x && v.front().y == v.back().y)
+                v.pop_back();
+
+            double area = 0;
+            for (std::size_t i = 0, j = v.size() - 1; i < v.size(); j = i++)
+                area += cross(v[j], v[i]);
+            if (area < 0)
+                std::reverse(v.begin(), v.end());
+            return v;
+        }
+
+        //! The index of the vertex with the least y and then least x.
+        inline std::size_t get_lowest_vertex(const std::vector<vec2>& v)
+        {
+            std::size_t r = 0;
+            for (std::size_t i = 1; i < v.size(); ++i)
+                if (v[i].y < v[r].y || (v[i].y == v[r].y && v[i].x < v[r].x))
+                    r = i;
+            return r;
+        }
+
+        //! The index of the vertex with the greatest y and then greatest x.
+        inline std::size_t get_highest_vertex(const std::vector<vec2>& v)
+        {
+            std::size_t r = 0;
+            for (std::size_t i = 1; i < v.size(); ++i)
+                if (v[i].y > v[r].y || (v[i].y == v[r].y && v[i].x > v[r].x))
+                    r = i;
+            return r;
+        }
+
+        //! Compare the polar angles of a and b taken in [0, 2pi).
+        inline int compare_angle(const vec2& a, const vec2& b)
+        {
+            auto get_half = [](const vec2& v) { return (v.y < 0 || (v.y == 0 && v.x < 0)) ? 1 : 0; };
+            auto ha = get_half(a), hb = get_half(b);
+            if (ha != hb)
+                return ha < hb ? -1 : 1;
+            auto c = cross(a, b);
+            return c > 0 ? -1 : (c < 0 ? 1 : 0);
+        }
+
+        //! The parameter of the point of segment [a, b] closest to p.
+        inline double get_closest_parameter(const vec2& p, const vec2& a, const vec2& b)
+        {
+            auto ab = sub(b, a);
+            auto ll = dot(ab, ab);
+            if (!(ll > 0))
+                return 0;
+            return (std::min)((std::max)(dot(sub(p, a), ab) / ll, 0.0), 1.0);
+        }
+
+        //! The signed distance of p from the line through a with unit direction u (positive on the left).
+        inline double get_line_offset(const vec2& p, const vec2& a, const vec2& u)
+        {
+            return cross(u, sub(p, a));
+        }
+
+        //! An oriented box over a hull edge: the box spans [lo, hi] along the unit edge direction u from the edge start and [0, height]
+        //! along its left normal.
+        struct caliper_box
+        {
+            vec2   origin;
+            vec2   u;
+            double lo;
+            double hi;
+            double height;
+        };
+
+        //! Visit the box over every edge of a counter-clockwise hull with no collinear vertices.
+        template <typename Visitor>
+        inline void for_each_caliper_box(const std::vector<vec2>& h, Visitor&& visitor)
+        {
+            auto n = h.size();
+            if (n == 1)
+            {
+                visitor(caliper_box{ h[0], vec2{ 1.0, 0.0 }, 0.0, 0.0, 0.0 });
+                return;
+            }
+
+            std::size_t r = 0, t = 0, l = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto j = (i + 1) % n;
+                auto e = sub(h[j], h[i]);
+                auto length = std::sqrt(dot(e, e));
+                vec2 u{ e.x / length, e.y / length };
+                if (i == 0)
+                    r = j;
+                while (dot(sub(h[(r + 1) % n], h[r]), u) > 0)
+                    r = (r + 1) % n;
+                if (i == 0)
+                    t = r;
+                while (get_line_offset(h[(t + 1) % n], h[i], u) > get_line_offset(h[t], h[i], u))
+                    t = (t + 1) % n;
+                if (i == 0)
+                    l = t;
+                while (dot(sub(h[(l + 1) % n], h[l]), u) < 0)
+                    l = (l + 1) % n;
+
+                visitor(caliper_box{ h[i], u, dot(sub(h[l], h[i]), u), dot(sub(h[r], h[i]), u), get_line_offset(h[t], h[i], u) });
+            }
+        }
+
+        template <typename Point, typename Vector>
+        inline oriented_bounding_box<Point, Vector> make_obb(const caliper_box& b)
+        {
+            using length_t = typename oriented_bounding_box<Point, Vector>::length_type;
+            vec2 v{ -b.u.y, b.u.x };
+            auto hu = 0.5 * (b.hi - b.lo), hv = 0.5 * b.height;
+            auto cu = 0.5 * (b.hi + b.lo);
+            auto c = vec2{ b.origin.x + cu * b.u.x + hv * v.x, b.origin.y + cu * b.u.y + hv * v.y };
+            return oriented_bounding_box<Point, Vector>(construct<Point>(c.x, c.y), construct<Vector>(b.u.x, b.u.y), construct<Vector>(v.x, v.y), length_t(hu), length_t(hv));
+        }
+
+    }//! namespace rotating_calipers_detail;
+
+    //! \brief The convex hull of a point set by Andrew's monotone chain in counter-clockwise order without collinear vertices.
+
+    //! Points which are equal under cmp are merged; the orientation tests are exact (see filtered_orientation).
+    template <typename Polygon, typename PointSequence, typename NumberComparisonPolicy>
+    inline Polygon monotone_chain_convex_hull(const PointSequence& points, const NumberComparisonPolicy& cmp)
+    {
+        using point_t = typename std::decay<decltype(*std::begin(points))>::type;
+        lexicographical_comparer<NumberComparisonPolicy> less(cmp);
+        std::vector<point_t> sorted(std::begin(points), std::end(points));
+        std::sort(sorted.begin(), sorted.end(), less);
+        sorted.erase(std::unique(sorted.begin(), sorted.end(), [&](const point_t& a, const point_t& b) { return !less(a, b) && !less(b, a); }), sorted.end());
+
+        Polygon hull;
+        if (sorted.size() < 3)
+        {
+            for (auto const& p : sorted)
+                hull.push_back(p);
+            return hull;
+        }
+
+        std::vector<point_t> chain;
+        chain.reserve(2 * sorted.size());
+        auto add_point = [&](const point_t& p, std::size_t lowerSize)
+        {
+            while (chain.size() > lowerSize && filtered_orientation(chain[chain.size() - 2], chain.back(), p) != oriented_left)
+                chain.pop_back();
+            chain.push_back(p);
+        };
+
+        for (auto const& p : sorted)
+            add_point(p, 1);
+        auto lowerSize = chain.size();
+        for (auto i = sorted.size() - 1; i-- > 0;)
+            add_point(sorted[i], lowerSize);
+        chain.pop_back();
+
+        for (auto const& p : chain)
+            hull.push_back(p);
+        return hull;
+    }
+
+    //! \brief The squared distance between two convex polygons and their closest points in O(n + m).
+
+    //! The calipers sweep merges the edges of A and of -B by angle to walk the Minkowski difference A - B, whose distance from the
+    //! origin is the distance of the polygons. Unlike polygon_polygon_distance_sqrd, which measures the distance between the
+    //! boundaries, this is zero when one polygon contains the other. If the polygons overlap the closest points are not set.
+    template <typename Polygon1, typename Polygon2, typename Point>
+    inline double convex_polygon_closest_points(const Polygon1& p1, const Polygon2& p2, Point& c1, Point& c2)
+    {
+        using namespace rotating_calipers_detail;
+        auto A = get_ccw_vertices(p1);
+        auto B = get_ccw_vertices(p2);
+        GEOMETRIX_ASSERT(!A.empty() && !B.empty());
+
+        auto n = A.size(), m = B.size();
+        auto ia = get_lowest_vertex(A), jb = get_highest_vertex(B);
+        auto get_a = [&](std::size_t i) -> const vec2& { return A[(ia + i) % n]; };
+        auto get_b = [&](std::size_t j) -> const vec2& { return B[(jb + j) % m]; };
+
+        //! The vertices of A - B with the vertices of A and B they come from.
+        struct difference_vertex
+        {
+            vec2        w;
+            std::size_t i;
+            std::size_t j;
+        };
+        std::vector<difference_vertex> D;
+        D.reserve(n + m);
+        std::size_t i = 0, j = 0;
+        while (i < n || j < m)
+        {
+            D.push_back(difference_vertex{ sub(get_a(i), get_b(j)), i, j });
+            if (i == n)
+                ++j;
+            else if (j == m)
+                ++i;
+            else
+            {
+                auto c = compare_angle(sub(get_a(i + 1), get_a(i)), sub(get_b(j), get_b(j + 1)));
+                if (c <= 0)
+                    ++i;
+                if (c >= 0)
+                    ++j;
+            }
+        }
+
+        bool inside = D.size() > 2;
+        double best = (std::numeric_limits<double>::max)();
+        std::size_t bestEdge = 0;
+        double bestT = 0;
+        vec2 origin{ 0.0, 0.0 };
+        for (std::size_t k = 0; k < D.size(); ++k)
+        {
+            auto const& p = D[k].w;
+            auto const& q = D[(k + 1) % D.size()].w;
+            if (cross(sub(q, p), sub(origin, p)) < 0)
+                inside = false;
+            auto t = get_closest_parameter(origin, p, q);
+            auto c = lerp(p, q, t);
+            auto d2 = dot(c, c);
+            if (d2 < best)
+            {
+                best = d2;
+                bestEdge = k;
+                bestT = t;
+            }
+        }
+
+        if (inside)
+            return 0;
+
+        auto const& s = D[bestEdge];
+        auto const& e = D[(bestEdge + 1) % D.size()];
+        auto a = lerp(get_a(s.i), get_a(e.i), bestT);
+        auto b = lerp(get_b(s.j), get_b(e.j), bestT);
+        c1 = construct<Point>(a.x, a.y);
+        c2 = construct<Point>(b.x, b.y);
+        return best;
+    }
+
+    //! The squared distance between two convex polygons in O(n + m) (zero if they overlap).
+    template <typename Polygon1, typename Polygon2>
+    inline double convex_polygon_distance_sqrd(const Polygon1& p1, const Polygon2& p2)
+    {
+        typename std::decay<decltype(*std::begin(p1))>::type c1, c2;
+        return convex_polygon_closest_points(p1, p2, c1, c2);
+    }
+
+    template <typename Polygon1, typename Polygon2>
+    inline double convex_polygon_distance(const Polygon1& p1, const Polygon2& p2)
+    {
+        return std::sqrt(convex_polygon_distance_sqrd(p1, p2));
+    }
+
+    //! \brief The diameter of a convex polygon with no collinear vertices (e.g. from monotone_chain_convex_hull) and a pair of vertices at that distance.
+
+    //! The calipers visit the O(n) antipodal vertex pairs of the polygon.
+    template <typename Polygon, typename Point>
+    inline double convex_polygon_diameter(const Polygon& poly, Point& a, Point& b)
+    {
+        using namespace rotating_calipers_detail;
+        auto h = get_ccw_vertices(poly);
+        GEOMETRIX_ASSERT(!h.empty());
+
+        auto n = h.size();
+        std::size_t bi = 0, bj = 0;
+        double best = 0;
+        auto update = [&](std::size_t i, std::size_t j)
+        {
+            auto d = sub(h[j], h[i]);
+            auto d2 = dot(d, d);
+            if (d2 > best)
+            {
+                best = d2;
+                bi = i;
+                bj = j;
+            }
+        };
+
+        if (n == 2)
+            update(0, 1);
+        else if (n > 2)
+        {
+            std::size_t j = 1;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto ni = (i + 1) % n;
+                while (cross(sub(h[ni], h[i]), sub(h[(j + 1) % n], h[j])) > 0)
+                    j = (j + 1) % n;
+                update(i, j);
+                update(ni, j);
+            }
+        }
+
+        a = construct<Point>(h[bi].x, h[bi].y);
+        b = construct<Point>(h[bj].x, h[bj].y);
+        return std::sqrt(best);
+    }
+
+    template <typename Polygon>
+    inline double convex_polygon_diameter(const Polygon& poly)
+    {
+        typename std::decay<decltype(*std::begin(poly))>::type a, b;
+        return convex_polygon_diameter(poly, a, b);
+    }
+
+    //! The width of a convex polygon with no collinear vertices (e.g. from monotone_chain_convex_hull): the least distance between two
+    //! parallel lines enclosing it.
+    template <typename Polygon>
+    inline double convex_polygon_width(const Polygon& poly)
+    {
+        using namespace rotating_calipers_detail;
+        auto h = get_ccw_vertices(poly);
+        GEOMETRIX_ASSERT(!h.empty());
+        if (h.size() < 3)
+            return 0;
+
+        double width = (std::numeric_limits<double>::max)();
+        for_each_caliper_box(h, [&](const caliper_box& b) { width = (std::min)(width, b.height); });
+        return width;
+    }
+
+    namespace rotating_calipers_detail {
+
+        template <typename Point, typename Vector, typename PointSequence, typename NumberComparisonPolicy, typename Cost>
+        inline oriented_bounding_box<Point, Vector> fit_obb(const PointSequence& points, const NumberComparisonPolicy& cmp, Cost&& cost)
+        {
+            static_assert(dimension_of<Point>::value == 2, "fit_obb requires 2D points.");
+            using point_t = typename std::decay<decltype(*std::begin(points))>::type;
+            auto hull = monotone_chain_convex_hull<std::vector<point_t>>(points, cmp);
+            GEOMETRIX_ASSERT(!hull.empty());
+            auto h = get_ccw_vertices(hull);
+
+            caliper_box best{ h[0], vec2{ 1.0, 0.0 }, 0.0, 0.0, 0.0 };
+            double bestCost = (std::numeric_limits<double>::max)();
+            for_each_caliper_box(h, [&](const caliper_box& b)
+            {
+                auto c = cost(b);
+                if (c < bestCost)
+                {
+                    bestCost = c;
+                    best = b;
+                }
+            });
+
+            return make_obb<Point, Vector>(best);
+        }
+
+    }//! namespace rotating_calipers_detail;
+
+    //! \brief The oriented bounding box of least area enclosing a point set in O(n log n).
+
+    //! The optimal box has a side collinear with an edge of the convex hull (H. Freeman, R. Shapira, Determining the minimum-area
+    //! encasing rectangle for an arbitrary closed curve, 1975), so the calipers try the box over every hull edge in linear time.
+    template <typename Point, typename Vector, typename PointSequence, typename NumberComparisonPolicy>
+    inline oriented_bounding_box<Point, Vector> make_minimum_area_obb(const PointSequence& points, const NumberComparisonPolicy& cmp)
+    {
+        return rotating_calipers_detail::fit_obb<Point, Vector>(points, cmp, [](const rotating_calipers_detail::caliper_box& b) { return (b.hi - b.lo) * b.height; });
+    }
+
+    //! The oriented bounding box enclosing a point set whose smaller side is least (the side is the width of the point set).
+    template <typename Point, typename Vector, typename PointSequence, typename NumberComparisonPolicy>
+    inline oriented_bounding_box<Point, Vector> make_minimum_width_obb(const PointSequence& points, const NumberComparisonPolicy& cmp)
+    {
+        return rotating_calipers_detail::fit_obb<Point, Vector>(points, cmp, [](const rotating_calipers_detail::caliper_box& b) { return b.height; });
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_ROTATING_CALIPERS_HPP
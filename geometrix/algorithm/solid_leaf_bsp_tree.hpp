@@ -18,7 +18,9 @@
 #include <geometrix/primitive/hyperplane_traits.hpp>
 #include <geometrix/algorithm/intersection/ray_segment_intersection.hpp>
 #include <geometrix/algorithm/point_in_solid_classification.hpp>
+#include <geometrix/algorithm/filtered_predicates.hpp>
 #include <geometrix/utility/ignore_unused_warnings.hpp>
+#include <geometrix/utility/binary_image_fwd.hpp>
 
 #include <boost/range/concepts.hpp>
 #include <boost/range/algorithm_ext/iota.hpp>
@@ -259,10 +261,315 @@ namespace geometrix {
         static const node_orientation solid_side = node_orientation::back;
     };
 
+    namespace bsp_detail
+    {
+        template <typename Simplex>
+        using solid_leaf_bsp_length_type = typename hyperplane_access_traits<typename result_of::make_hyperplane<Simplex>::type>::arithmetic_type;
+
+        //! The queries of a solid leaf BSP tree written against its node arrays. They are shared by solid_leaf_bsp_tree and
+        //! solid_leaf_bsp_tree_view (which reads the same arrays from a binary image). Derived provides get_root(),
+        //! get_front_child(n), get_back_child(n), get_normal_vector(n), get_distance_to_origin(n), get_node_simplex_indices(n),
+        //! get_number_simplices(), get_simplex(i) and in_solid_classification(n).
+        template <typename Derived, typename Length>
+        class solid_leaf_bsp_queries
+        {
+            using length_type = Length;
+            using index_type = std::uint32_t;
+            using undefined_index = std::integral_constant<index_type, static_cast<index_type>(-1)>;
+
+        public:
+
+            template <typename Point, typename NumberComparisonPolicy>
+            point_in_solid_classification point_in_solid_space(const Point& p, const NumberComparisonPolicy& cmp) const
+            {
+                return point_in_solid_space(derived().get_root(), p, cmp);
+            }
+
+            //! Classify the point using exact plane side tests (see filtered_predicates.hpp). The result is exact with respect to the stored planes.
+            template <typename Point>
+            point_in_solid_classification point_in_solid_space(const Point& p) const
+            {
+                return point_in_solid_space_exact(derived().get_root(), p);
+            }
+
+            template <typename Point, typename Vector, typename NumberComparisonPolicy>
+            solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection(const Point& p, const Vector& d, const NumberComparisonPolicy& cmp) const
+            {
+                return ray_intersection_impl(p, d, false, cmp);
+            }
+
+            template <typename Point, typename Vector, typename NumberComparisonPolicy>
+            solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection_only_border(const Point& p, const Vector& d, const NumberComparisonPolicy& cmp) const
+            {
+                return ray_intersection_impl(p, d, true, cmp);
+            }
+
+            template <typename Point, typename NumberComparisonPolicy>
+            typename bsp_detail::square_type<typename arithmetic_type_of<Point>::type>::type get_min_distance_sqrd_to_solid(const Point& p, std::size_t& simplexIndex, const NumberComparisonPolicy& cmp) const
+            {
+                return get_min_distance_sqrd_to_solid_impl(p, simplexIndex, cmp);
+            }
+
+            template <typename Point, typename NumberComparisonPolicy>
+            typename arithmetic_type_of<Point>::type get_min_distance_to_solid(const Point& p, std::size_t& simplexIndex, const NumberComparisonPolicy& cmp) const
+            {
+                using std::sqrt;
+                return sqrt(get_min_distance_sqrd_to_solid_impl(p, simplexIndex, cmp));
+            }
+
+            //! Call visitor(simplex) for each simplex of the partition (the input simplices as split by the partitioning planes).
+            template <typename Visitor>
+            void for_each_simplex(Visitor&& visitor) const
+            {
+                for (std::size_t i = 0, n = derived().get_number_simplices(); i < n; ++i)
+                    visitor(derived().get_simplex(static_cast<index_type>(i)));
+            }
+
+        private:
+
+            const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+            template <typename Point, typename NumberComparisonPolicy>
+            point_in_solid_classification point_in_solid_space(index_type node, const Point& p, const NumberComparisonPolicy& cmp) const
+            {
+                while (!is_leaf(node))
+                {
+                    //! Compute distance of point to dividing plane
+                    auto dist = scalar_projection(as_vector(p), derived().get_normal_vector(node)) - derived().get_distance_to_origin(node);
+                    auto zero = constants::zero<typename std::decay<decltype(dist)>::type>();
+                    if (cmp.greater_than(dist, zero))
+                    {
+                        // Point in front of plane, so traverse front of tree
+                        node = derived().get_front_child(node);
+                    }
+                    else if (cmp.less_than(dist, zero))
+                    {
+                        //! Point behind of plane, so traverse back of tree
+                        node = derived().get_back_child(node);
+                    }
+                    else
+                    {
+                        //! Point on dividing plane; must traverse both sides
+                        auto front = point_in_solid_space(derived().get_front_child(node), p, cmp);
+                        auto back = point_in_solid_space(derived().get_back_child(node), p, cmp);
+                        //! If results agree, return that, else point is on boundary
+                        return (front == back) ? front : point_in_solid_classification::on_boundary;
+                    }
+
+                    GEOMETRIX_ASSERT(node != undefined_index::value);
+                }
+
+                //! Now at a leaf, inside/outside status determined by solid flag
+
+                return derived().in_solid_classification(node);
+            }
+
+            template <typename Point>
+            point_in_solid_classification point_in_solid_space_exact(index_type node, const Point& p) const
+            {
+                while (!is_leaf(node))
+                {
+                    auto side = filtered_plane_side(p, derived().get_normal_vector(node), derived().get_distance_to_origin(node));
+                    if (side > 0)
+                        node = derived().get_front_child(node);
+                    else if (side < 0)
+                        node = derived().get_back_child(node);
+                    else
+                    {
+                        //! Point on dividing plane; must traverse both sides
+                        auto front = point_in_solid_space_exact(derived().get_front_child(node), p);
+                        auto back = point_in_solid_space_exact(derived().get_back_child(node), p);
+                        return (front == back) ? front : point_in_solid_classification::on_boundary;
+                    }
+
+                    GEOMETRIX_ASSERT(node != undefined_index::value);
+                }
+
+                return derived().in_solid_classification(node);
+            }
+
+            template <typename Point, typename NumberComparisonPolicy>
+            typename bsp_detail::square_type<typename arithmetic_type_of<Point>::type>::type get_min_distance_sqrd_to_solid_impl(const Point& p, std::size_t& closestSimplex, const NumberComparisonPolicy& cmp) const
+            {
+                using length_t = typename arithmetic_type_of<Point>::type;
+                using area_t = decltype(std::declval<length_t>()*std::declval<length_t>());
+                auto minDist2 = constants::infinity<area_t>();
+                auto calc_orientation = [&cmp](length_t dist) -> plane_orientation
+                {
+                    const auto zero = constants::zero<length_t>();
+                    if (cmp.greater_than(dist, zero))
+                        return plane_orientation::in_front_of_plane;
+                    else if (cmp.less_than(dist, zero))
+                        return plane_orientation::in_back_of_plane;
+                    //! Point on dividing plane; must traverse both sides
+                    return plane_orientation::straddling_plane;
+                };
+
+                std::stack<index_type> nodeStack;
+                nodeStack.push(derived().get_root());
+                while (!nodeStack.empty())
+                {
+                    auto node = nodeStack.top();
+                    nodeStack.pop();
+
+                    for(auto idx : derived().get_node_simplex_indices(node))
+                    {
+                        auto d2 = bsp_detail::point_simplex_distance_squared(p, derived().get_simplex(idx), cmp);
+                        if(d2 < minDist2)
+                        {
+                            closestSimplex = idx;
+                            minDist2 = d2;
+                        }
+                    }
+
+                    if(!is_leaf(node))
+                    {
+                        //! Compute distance of point to dividing plane
+                        auto dist = scalar_projection(as_vector(p), derived().get_normal_vector(node)) - derived().get_distance_to_origin(node);
+                        auto dist2 = dist * dist;
+                        auto orientation = calc_orientation(dist);
+
+                        //! back
+                        if (dist2 < minDist2 || orientation != plane_orientation::in_front_of_plane )
+                            nodeStack.push(derived().get_back_child(node));
+
+                        //! front
+                        if (dist2 < minDist2 || orientation != plane_orientation::in_back_of_plane )
+                            nodeStack.push(derived().get_front_child(node));
+                    }
+                }
+
+                return minDist2;
+            }
+
+            template <typename Point, typename NumberComparisonPolicy>
+            point_in_solid_classification point_in_solid_space_no_boundary(index_type node, const Point& p, const NumberComparisonPolicy& cmp) const
+            {
+                while (!is_leaf(node))
+                {
+                    //! Compute distance of point to dividing plane
+                    auto dist = scalar_projection(as_vector(p), derived().get_normal_vector(node)) - derived().get_distance_to_origin(node);
+                    //! Traverse front of tree when point in front of plane, else back of tree
+                    auto zero = constants::zero<typename std::decay<decltype(dist)>::type>();
+                    node = cmp.less_than_or_equal(dist, zero) ? derived().get_back_child(node) : derived().get_front_child(node);
+                }
+
+                //! Now at a leaf, inside/outside status determined by solid flag
+                return derived().in_solid_classification(node);
+            }
+
+            template <typename Point, typename Vector, typename Indices, typename NumberComparisonPolicy>
+            index_type find_closest_hit(const Point& p, const Vector& d, const Indices& sIndices, const NumberComparisonPolicy& cmp) const
+            {
+                auto minDist = (std::numeric_limits<length_type>::max)();
+                length_type t;
+                index_type minIndex = undefined_index::value;
+                for (auto i : sIndices)
+                {
+                    if (bsp_detail::ray_simplex_intersect(p, d, derived().get_simplex(i), t, cmp) && t < minDist)
+                    {
+                        minDist = t;
+                        minIndex = i;
+                    }
+                }
+
+                return minIndex;
+            }
+
+            //! Intersect ray/segment R(t)=p+t*d, tmin <= t <= tmax, against bsp tree
+            //! ’node’, returning distance along the ray thit of first intersection with a solid leaf, if any
+            template <typename Point, typename Vector, typename NumberComparisonPolicy>
+            solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection_impl(const Point& p, const Vector& d, bool onlyBorder, const NumberComparisonPolicy& cmp) const
+            {
+                using length_t = typename arithmetic_type_of<Point>::type;
+                auto tmax = (std::numeric_limits<length_t>::max)();
+                auto tmin = constants::zero<length_t>();
+
+                using elem_t = std::tuple<index_type, length_t, std::set<index_type>/*, std::vector<simplex_type>*/>;
+                std::stack<elem_t> nodeStack;
+                auto node = derived().get_root();
+                std::set<index_type> maxIndices, minIndices;
+                //std::vector<simplex_type> maxS, minS;
+                while (1)
+                {
+                    if (!is_leaf(node))
+                    {
+                        auto denom = scalar_projection(d, derived().get_normal_vector(node));
+                        //! Compute distance from dividing plane to p.
+                        auto dist = derived().get_distance_to_origin(node) - scalar_projection(as_vector(p), derived().get_normal_vector(node));
+                        auto nearIndex = dist > constants::zero<length_t>();
+                        //! If denom is zero, ray runs parallel to plane. In this case,
+                        //! just fall through to visit the near side (the one p lies on)
+                        if (denom != constants::zero<decltype(denom)>())
+                        {
+                            auto t = dist / denom;
+                            if (constants::zero<length_t>() <= t && t <= tmax)
+                            {
+                                if (t >= tmin)
+                                {
+                                    //! Straddling, push far side onto stack,then visit near side
+                                    auto farNode = (1 ^ nearIndex) ? derived().get_back_child(node) : derived().get_front_child(node);
+                                    nodeStack.push(std::make_tuple(farNode, tmax, std::move(maxIndices)/*, std::move(maxS)*/));
+
+                                    maxIndices.insert(derived().get_node_simplex_indices(node).begin(), derived().get_node_simplex_indices(node).end());
+                                    //using boost::adaptors::transformed;
+                                    //boost::copy(node->indices | transformed([this](index_type i) { return derived().get_simplex(i); }), std::back_inserter(maxS));
+                                    tmax = t;
+                                }
+                                else
+                                    nearIndex = 1 ^ nearIndex;//! 0 <= t < tmin, visit far side
+                            }
+                        }
+                        node = nearIndex ? derived().get_back_child(node) : derived().get_front_child(node);
+                    }
+                    else
+                    {
+                        //! Now at a leaf. If it is solid, there’s a hit at time tmin, so exit
+                        if (is_solid(node))
+                        {
+                            //! Look at geometry in sIndices and find the closest hit.
+    						if (!minIndices.empty() || !onlyBorder)
+    						{
+    							auto sIndex = find_closest_hit(p, d, minIndices, cmp);
+    							return solid_bsp_ray_tracing_result<length_t>(true, tmin, sIndex);
+    						}
+
+    						auto sIndex = find_closest_hit(p, d, maxIndices, cmp);
+    						return solid_bsp_ray_tracing_result<length_t>(true, tmax, sIndex);
+                        }
+
+                        //! Exit if no more subtrees to visit, else pop off a node and continue
+                        if (nodeStack.empty())
+                            break;
+                        tmin = tmax;
+                        minIndices = std::move(maxIndices);
+                        //minS = maxS;
+                        std::tie(node, tmax, maxIndices/*, maxS*/) = nodeStack.top();
+                        nodeStack.pop();
+                    }
+
+                    GEOMETRIX_ASSERT(node != undefined_index::value);
+                }
+
+                //! No hit
+                return solid_bsp_ray_tracing_result<length_t>(false);
+            }
+
+            bool is_leaf(index_type n) const { return derived().get_front_child(n) == undefined_index::value && derived().get_back_child(n) == undefined_index::value; }
+            bool is_solid(index_type n) const { return derived().in_solid_classification(n) == point_in_solid_classification::in_solid; }
+        };
+    }//! namespace bsp_detail;
+
     //! From Real Time Collision Detection:
     template <typename Simplex, typename Traits = back_solid_leaf_bsp_traits<Simplex> >
-    class solid_leaf_bsp_tree
+    class solid_leaf_bsp_tree : public bsp_detail::solid_leaf_bsp_queries<solid_leaf_bsp_tree<Simplex, Traits>, bsp_detail::solid_leaf_bsp_length_type<Simplex>>
     {
+        using base_type = bsp_detail::solid_leaf_bsp_queries<solid_leaf_bsp_tree<Simplex, Traits>, bsp_detail::solid_leaf_bsp_length_type<Simplex>>;
+        friend base_type;
+
+        template <typename Structure>
+        friend struct binary_image_access;
+
         using traits_type = Traits;
         using simplex_type = Simplex;
         using plane_type = typename result_of::make_hyperplane<simplex_type>::type;
@@ -330,37 +637,6 @@ namespace geometrix {
             return *this;
         }
 
-        template <typename Point, typename NumberComparisonPolicy>
-        point_in_solid_classification point_in_solid_space(const Point& p, const NumberComparisonPolicy& cmp) const
-        {
-            return point_in_solid_space(m_root, p, cmp);
-        }
-
-        template <typename Point, typename Vector, typename NumberComparisonPolicy>
-        solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection(const Point& p, const Vector& d, const NumberComparisonPolicy& cmp) const
-        {
-            return ray_intersection_impl(p, d, false, cmp);
-        }
-
-        template <typename Point, typename Vector, typename NumberComparisonPolicy>
-        solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection_only_border(const Point& p, const Vector& d, const NumberComparisonPolicy& cmp) const
-        {
-            return ray_intersection_impl(p, d, true, cmp);
-        }
-
-        template <typename Point, typename NumberComparisonPolicy>
-        typename bsp_detail::square_type<typename arithmetic_type_of<Point>::type>::type get_min_distance_sqrd_to_solid(const Point& p, std::size_t& simplexIndex, const NumberComparisonPolicy& cmp) const
-        {
-            return get_min_distance_sqrd_to_solid_impl(p, simplexIndex, cmp);
-        }
-
-        template <typename Point, typename NumberComparisonPolicy>
-        typename arithmetic_type_of<Point>::type get_min_distance_to_solid(const Point& p, std::size_t& simplexIndex, const NumberComparisonPolicy& cmp) const
-        {
-            using std::sqrt;
-            return sqrt(get_min_distance_sqrd_to_solid_impl(p, simplexIndex, cmp));
-        }
-
     private:
 
         index_type create_leaf(bool isSolid)
@@ -512,211 +788,12 @@ namespace geometrix {
             return plane_access::get_distance_to_origin(m_planes[m_node_planes[node]]);
         }
 
-        template <typename Point, typename NumberComparisonPolicy>
-        point_in_solid_classification point_in_solid_space(index_type node, const Point& p, const NumberComparisonPolicy& cmp) const
-        {
-            while (!is_leaf(node))
-            {
-                //! Compute distance of point to dividing plane
-                auto dist = scalar_projection(as_vector(p), get_normal_vector(node)) - get_distance_to_origin(node);
-                auto zero = constants::zero<typename std::decay<decltype(dist)>::type>();
-                if (cmp.greater_than(dist, zero))
-                {
-                    // Point in front of plane, so traverse front of tree
-                    node = m_front[node];
-                }
-                else if (cmp.less_than(dist, zero))
-                {
-                    //! Point behind of plane, so traverse back of tree
-                    node = m_back[node];
-                }
-                else
-                {
-                    //! Point on dividing plane; must traverse both sides
-                    auto front = point_in_solid_space(m_front[node], p, cmp);
-                    auto back = point_in_solid_space(m_back[node], p, cmp);
-                    //! If results agree, return that, else point is on boundary
-                    return (front == back) ? front : point_in_solid_classification::on_boundary;
-                }
-
-                GEOMETRIX_ASSERT(node != -1);
-            }
-
-            //! Now at a leaf, inside/outside status determined by solid flag
-
-            return in_solid_classification(node);
-        }
-
-        template <typename Point, typename NumberComparisonPolicy>
-        typename bsp_detail::square_type<typename arithmetic_type_of<Point>::type>::type get_min_distance_sqrd_to_solid_impl(const Point& p, std::size_t& closestSimplex, const NumberComparisonPolicy& cmp) const
-        {
-            using length_t = typename arithmetic_type_of<Point>::type;
-            using area_t = decltype(std::declval<length_t>()*std::declval<length_t>());
-            auto minDist2 = constants::infinity<area_t>();
-            auto calc_orientation = [&cmp](length_t dist) -> plane_orientation
-            {
-                const auto zero = constants::zero<length_t>();
-                if (cmp.greater_than(dist, zero))
-                    return plane_orientation::in_front_of_plane;
-                else if (cmp.less_than(dist, zero))
-                    return plane_orientation::in_back_of_plane;
-                //! Point on dividing plane; must traverse both sides
-                return plane_orientation::straddling_plane;
-            };
-
-            std::stack<index_type> nodeStack;
-            nodeStack.push(m_root);
-            while (!nodeStack.empty())
-            {
-                auto node = nodeStack.top();
-                nodeStack.pop();
-
-                for(auto idx : m_indices[node])
-                {
-                    auto d2 = bsp_detail::point_simplex_distance_squared(p, m_simplices[idx], cmp);
-                    if(d2 < minDist2)
-                    {
-                        closestSimplex = idx;
-                        minDist2 = d2;
-                    }
-                }
-
-                if(!is_leaf(node))
-                {
-                    //! Compute distance of point to dividing plane
-                    auto dist = scalar_projection(as_vector(p), get_normal_vector(node)) - get_distance_to_origin(node);
-                    auto dist2 = dist * dist;
-                    auto orientation = calc_orientation(dist);
-
-                    //! back
-                    if (dist2 < minDist2 || orientation != plane_orientation::in_front_of_plane )
-                        nodeStack.push(m_back[node]);
-
-                    //! front
-                    if (dist2 < minDist2 || orientation != plane_orientation::in_back_of_plane )
-                        nodeStack.push(m_front[node]);
-                }
-            }
-
-            return minDist2;
-        }
-
-        template <typename Point, typename NumberComparisonPolicy>
-        point_in_solid_classification point_in_solid_space_no_boundary(index_type node, const Point& p, const NumberComparisonPolicy& cmp) const
-        {
-            while (!is_leaf(node))
-            {
-                //! Compute distance of point to dividing plane
-                auto dist = scalar_projection(as_vector(p), get_normal_vector(node)) - get_distance_to_origin(node);
-                //! Traverse front of tree when point in front of plane, else back of tree
-                auto zero = constants::zero<typename std::decay<decltype(dist)>::type>();
-                node = cmp.less_than_or_equal(dist, zero) ? m_back[node] : m_front[node];
-            }
-
-            //! Now at a leaf, inside/outside status determined by solid flag
-            return in_solid_classification(node);
-        }
-
-        template <typename Point, typename Vector, typename Indices, typename NumberComparisonPolicy>
-        index_type find_closest_hit(const Point& p, const Vector& d, const Indices& sIndices, const NumberComparisonPolicy& cmp) const
-        {
-            auto minDist = (std::numeric_limits<length_type>::max)();
-            length_type t;
-            index_type minIndex = undefined_index::value;
-            for (auto i : sIndices)
-            {
-                if (bsp_detail::ray_simplex_intersect(p, d, m_simplices[i], t, cmp) && t < minDist)
-                {
-                    minDist = t;
-                    minIndex = i;
-                }
-            }
-
-            return minIndex;
-        }
-
-        //! Intersect ray/segment R(t)=p+t*d, tmin <= t <= tmax, against bsp tree
-        //! ’node’, returning distance along the ray thit of first intersection with a solid leaf, if any
-        template <typename Point, typename Vector, typename NumberComparisonPolicy>
-        solid_bsp_ray_tracing_result<typename arithmetic_type_of<Point>::type> ray_intersection_impl(const Point& p, const Vector& d, bool onlyBorder, const NumberComparisonPolicy& cmp) const
-        {
-            using length_t = typename arithmetic_type_of<Point>::type;
-            auto tmax = (std::numeric_limits<length_t>::max)();
-            auto tmin = constants::zero<length_t>();
-
-            using elem_t = std::tuple<index_type, length_t, std::set<index_type>/*, std::vector<simplex_type>*/>;
-            std::stack<elem_t> nodeStack;
-            auto node = m_root;
-            std::set<index_type> maxIndices, minIndices;
-            //std::vector<simplex_type> maxS, minS;
-            while (1)
-            {
-                if (!is_leaf(node))
-                {
-                    auto denom = scalar_projection(d, get_normal_vector(node));
-                    //! Compute distance from dividing plane to p.
-                    auto dist = get_distance_to_origin(node) - scalar_projection(as_vector(p), get_normal_vector(node));
-                    auto nearIndex = dist > constants::zero<length_t>();
-                    //! If denom is zero, ray runs parallel to plane. In this case,
-                    //! just fall through to visit the near side (the one p lies on)
-                    if (denom != constants::zero<decltype(denom)>())
-                    {
-                        auto t = dist / denom;
-                        if (constants::zero<length_t>() <= t && t <= tmax)
-                        {
-                            if (t >= tmin)
-                            {
-                                //! Straddling, push far side onto stack,then visit near side
-                                auto farNode = (1 ^ nearIndex) ? m_back[node] : m_front[node];
-                                nodeStack.push(std::make_tuple(farNode, tmax, std::move(maxIndices)/*, std::move(maxS)*/));
-
-                                maxIndices.insert(m_indices[node].begin(), m_indices[node].end());
-                                //using boost::adaptors::transformed;
-                                //boost::copy(node->indices | transformed([this](index_type i) { return m_simplices[i]; }), std::back_inserter(maxS));
-                                tmax = t;
-                            }
-                            else
-                                nearIndex = 1 ^ nearIndex;//! 0 <= t < tmin, visit far side
-                        }
-                    }
-                    node = nearIndex ? m_back[node] : m_front[node];
-                }
-                else
-                {
-                    //! Now at a leaf. If it is solid, there’s a hit at time tmin, so exit
-                    if (is_solid(node))
-                    {
-                        //! Look at geometry in sIndices and find the closest hit.
-						if (!minIndices.empty() || !onlyBorder)
-						{
-							auto sIndex = find_closest_hit(p, d, minIndices, cmp);
-							return solid_bsp_ray_tracing_result<length_t>(true, tmin, sIndex);
-						}
-
-						auto sIndex = find_closest_hit(p, d, maxIndices, cmp);
-						return solid_bsp_ray_tracing_result<length_t>(true, tmax, sIndex);
-                    }
-
-                    //! Exit if no more subtrees to visit, else pop off a node and continue
-                    if (nodeStack.empty())
-                        break;
-                    tmin = tmax;
-                    minIndices = std::move(maxIndices);
-                    //minS = maxS;
-                    std::tie(node, tmax, maxIndices/*, maxS*/) = nodeStack.top();
-                    nodeStack.pop();
-                }
-
-                GEOMETRIX_ASSERT(node != undefined_index::value);
-            }
-
-            //! No hit
-            return solid_bsp_ray_tracing_result<length_t>(false);
-        }
-
-        bool is_leaf(index_type n) const { return m_front[n] == undefined_index::value && m_back[n] == undefined_index::value; }
-        bool is_solid(index_type n) const { return m_in_solid[n] == point_in_solid_classification::in_solid; }
-        bool is_solid_leaf(index_type n) const { return is_solid(n) && is_leaf(n); }
+        index_type get_root() const { return m_root; }
+        index_type get_front_child(index_type n) const { return m_front[n]; }
+        index_type get_back_child(index_type n) const { return m_back[n]; }
+        const index_vector& get_node_simplex_indices(index_type n) const { return m_indices[n]; }
+        std::size_t get_number_simplices() const { return m_simplices.size(); }
+        const simplex_type& get_simplex(index_type i) const { return m_simplices[i]; }
         point_in_solid_classification in_solid_classification(index_type n) const { return m_in_solid[n]; }
 
         index_vector m_front;
@@ -0,0 +1,180 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_SOLID_LEAF_BSPTREE_VIEW_HPP
+#define GEOMETRIX_SOLID_LEAF_BSPTREE_VIEW_HPP
+#pragma once
+
+#include <geometrix/algorithm/solid_leaf_bsp_tree.hpp>
+#include <geometrix/utility/binary_image.hpp>
+
+#include <utility>
+
+namespace geometrix {
+
+    namespace solid_leaf_bsp_image_detail
+    {
+        enum section_id : std::uint32_t
+        {
+            root_section = 1
+          , nodes_section = 2
+          , node_simplices_section = 3
+          , simplices_section = 4
+        };
+
+        //! A node with its splitting plane inlined. Leaves have no plane; their simplices are those which were coplanar with the
+        //! planes above them.
+        template <typename T, std::size_t D>
+        struct node
+        {
+            std::uint32_t front;
+            std::uint32_t back;
+            std::uint32_t first_simplex;//! into the node_simplices section.
+            std::uint32_t number_simplices;
+            std::uint32_t classification;
+            std::uint32_t reserved;
+            T             normal[D];
+            T             distance;
+        };
+    }//! namespace solid_leaf_bsp_image_detail;
+
+    template <typename Simplex, typename Traits>
+    struct binary_image_access< solid_leaf_bsp_tree<Simplex, Traits> >
+    {
+        using tree_type = solid_leaf_bsp_tree<Simplex, Traits>;
+        using plane_type = typename result_of::make_hyperplane<Simplex>::type;
+        using plane_access = hyperplane_access_traits<plane_type>;
+        using length_type = typename plane_access::arithmetic_type;
+        static const std::size_t dimension = dimension_of<typename plane_access::vector_type>::value;
+        using node_type = solid_leaf_bsp_image_detail::node<length_type, dimension>;
+        using segment_type = binary_image_detail::stored_segment<length_type, dimension>;
+
+        static_assert(is_segment<Simplex>::value, "Only trees of segments have a fixed size binary image.");
+        static_assert(std::is_same<length_type, typename dimensionless_type_of<typename plane_access::vector_type>::type>::value, "Binary images store the plane normals and offsets with the same scalar type.");
+
+        static binary_image_writer make_image(const tree_type& tree)
+        {
+            using namespace solid_leaf_bsp_image_detail;
+            using binary_image_detail::store_coordinates;
+            using index_type = std::uint32_t;
+
+            std::vector<node_type> nodes(tree.m_front.size());
+            std::vector<index_type> nodeSimplices;
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+            {
+                auto& n = nodes[i];
+                n = node_type{};
+                n.front = tree.m_front[i];
+                n.back = tree.m_back[i];
+                n.first_simplex = static_cast<index_type>(nodeSimplices.size());
+                n.number_simplices = static_cast<index_type>(tree.m_indices[i].size());
+                n.classification = static_cast<std::uint32_t>(tree.m_in_solid[i]);
+                nodeSimplices.insert(nodeSimplices.end(), tree.m_indices[i].begin(), tree.m_indices[i].end());
+                if (tree.m_node_planes[i] != static_cast<index_type>(-1))
+                {
+                    auto const& plane = tree.m_planes[tree.m_node_planes[i]];
+                    store_coordinates<dimension>(plane_access::get_normal_vector(plane), n.normal);
+                    n.distance = plane_access::get_distance_to_origin(plane);
+                }
+            }
+
+            std::vector<segment_type> simplices(tree.m_simplices.size());
+            for (std::size_t i = 0; i < simplices.size(); ++i)
+            {
+                store_coordinates<dimension>(get_start(tree.m_simplices[i]), simplices[i].start);
+                store_coordinates<dimension>(get_end(tree.m_simplices[i]), simplices[i].end);
+            }
+
+            binary_image_writer image(binary_image_kind::solid_leaf_bsp_tree, binary_image_scalar_code<length_type>(), dimension);
+            image.add_section(root_section, &tree.m_root, 1);
+            image.add_section(nodes_section, nodes);
+            image.add_section(node_simplices_section, nodeSimplices);
+            image.add_section(simplices_section, simplices);
+            return image;
+        }
+    };
+
+    //! \brief A read-only solid_leaf_bsp_tree of segments queried in place from a binary image (see binary_image.hpp).
+
+    //! The image is written with make_binary_image(tree). The view runs the same queries as the tree (point classification, ray
+    //! intersection and closest simplex) and gives the same results. It does not own the image memory.
+    template <typename Simplex, typename Traits = back_solid_leaf_bsp_traits<Simplex> >
+    class solid_leaf_bsp_tree_view : public bsp_detail::solid_leaf_bsp_queries<solid_leaf_bsp_tree_view<Simplex, Traits>, bsp_detail::solid_leaf_bsp_length_type<Simplex>>
+    {
+        using base_type = bsp_detail::solid_leaf_bsp_queries<solid_leaf_bsp_tree_view<Simplex, Traits>, bsp_detail::solid_leaf_bsp_length_type<Simplex>>;
+        friend base_type;
+
+        using access = binary_image_access< solid_leaf_bsp_tree<Simplex, Traits> >;
+        using node_type = typename access::node_type;
+        using segment_type = typename access::segment_type;
+        using simplex_type = Simplex;
+        using plane_access = typename access::plane_access;
+        using dimensionless_type = typename dimensionless_type_of<typename plane_access::vector_type>::type;
+        using vector_type = vector<dimensionless_type, access::dimension>;
+        using length_type = typename access::length_type;
+        using point_type = point<length_type, access::dimension>;
+        using index_type = std::uint32_t;
+
+    public:
+
+        solid_leaf_bsp_tree_view(const void* data, std::size_t size)
+            : solid_leaf_bsp_tree_view(binary_image_view(data, size, binary_image_kind::solid_leaf_bsp_tree, binary_image_scalar_code<length_type>(), access::dimension))
+        {}
+
+        explicit solid_leaf_bsp_tree_view(const mapped_binary_image& image)
+            : solid_leaf_bsp_tree_view(image.data(), image.size())
+        {}
+
+    private:
+
+        explicit solid_leaf_bsp_tree_view(const binary_image_view& image)
+            : m_nodes(image.section<node_type>(solid_leaf_bsp_image_detail::nodes_section))
+            , m_nodeSimplices(image.section<index_type>(solid_leaf_bsp_image_detail::node_simplices_section))
+            , m_simplices(image.section<segment_type>(solid_leaf_bsp_image_detail::simplices_section))
+        {
+            auto root = image.section<index_type>(solid_leaf_bsp_image_detail::root_section);
+            if (root.size() != 1 || (!m_nodes.empty() && root[0] >= m_nodes.size()))
+                throw binary_image_error("solid_leaf_bsp_tree image has an invalid root.");
+            m_root = root[0];
+        }
+
+        index_type get_root() const { return m_root; }
+        index_type get_front_child(index_type n) const { return m_nodes[n].front; }
+        index_type get_back_child(index_type n) const { return m_nodes[n].back; }
+
+        vector_type get_normal_vector(index_type n) const
+        {
+            return binary_image_detail::load_coordinates<vector_type, access::dimension>(m_nodes[n].normal);
+        }
+
+        length_type get_distance_to_origin(index_type n) const { return m_nodes[n].distance; }
+
+        binary_image_array<index_type> get_node_simplex_indices(index_type n) const
+        {
+            return binary_image_array<index_type>(m_nodeSimplices.data() + m_nodes[n].first_simplex, m_nodes[n].number_simplices);
+        }
+
+        std::size_t get_number_simplices() const { return m_simplices.size(); }
+
+        simplex_type get_simplex(index_type i) const
+        {
+            auto const& s = m_simplices[i];
+            return construct<simplex_type>(binary_image_detail::load_coordinates<point_type, access::dimension>(s.start), binary_image_detail::load_coordinates<point_type, access::dimension>(s.end));
+        }
+
+        point_in_solid_classification in_solid_classification(index_type n) const { return static_cast<point_in_solid_classification>(m_nodes[n].classification); }
+
+        binary_image_array<node_type>    m_nodes;
+        binary_image_array<index_type>   m_nodeSimplices;
+        binary_image_array<segment_type> m_simplices;
+        index_type                       m_root{ static_cast<index_type>(-1) };
+    };
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_SOLID_LEAF_BSPTREE_VIEW_HPP
@@ -0,0 +1,386 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_SPACE_FILLING_CURVE_HPP
+#define GEOMETRIX_ALGORITHM_SPACE_FILLING_CURVE_HPP
+#pragma once
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/primitive/point_traits.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+//! Morton (Z-order) and Hilbert keys for quantized coordinates, a parallel radix sort for keyed items and functions which
+//! put point sequences into curve order. Elements which are close along the curve are close in space, so storing data in
+//! curve order makes spatial queries and traversals touch fewer cache lines.
+namespace geometrix {
+
+    //! \brief The space filling curves used to order spatial data.
+    enum space_filling_curve
+    {
+        e_morton_curve
+      , e_hilbert_curve
+    };
+
+    namespace space_filling_curve_detail {
+
+        //! Spread the low 32 bits of v to the even bits of the result.
+        inline std::uint64_t spread_bits_2(std::uint64_t v)
+        {
+            v &= 0x00000000FFFFFFFFull;
+            v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+            v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+            v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+            v = (v | (v << 2)) & 0x3333333333333333ull;
+            v = (v | (v << 1)) & 0x5555555555555555ull;
+            return v;
+        }
+
+        inline std::uint32_t compact_bits_2(std::uint64_t v)
+        {
+            v &= 0x5555555555555555ull;
+            v = (v | (v >> 1)) & 0x3333333333333333ull;
+            v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+            v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+            v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+            v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+            return static_cast<std::uint32_t>(v);
+        }
+
+        //! Spread the low 21 bits of v to every third bit of the result.
+        inline std::uint64_t spread_bits_3(std::uint64_t v)
+        {
+            v &= 0x1FFFFFull;
+            v = (v | (v << 32)) & 0x1F00000000FFFFull;
+            v = (v | (v << 16)) & 0x1F0000FF0000FFull;
+            v = (v | (v << 8)) & 0x100F00F00F00F00Full;
+            v = (v | (v << 4)) & 0x10C30C30C30C30C3ull;
+            v = (v | (v << 2)) & 0x1249249249249249ull;
+            return v;
+        }
+
+        inline std::uint32_t compact_bits_3(std::uint64_t v)
+        {
+            v &= 0x1249249249249249ull;
+            v = (v | (v >> 2)) & 0x10C30C30C30C30C3ull;
+            v = (v | (v >> 4)) & 0x100F00F00F00F00Full;
+            v = (v | (v >> 8)) & 0x1F0000FF0000FFull;
+            v = (v | (v >> 16)) & 0x1F00000000FFFFull;
+            v = (v | (v >> 32)) & 0x1FFFFFull;
+            return static_cast<std::uint32_t>(v);
+        }
+
+    }//! namespace space_filling_curve_detail;
+
+    //! \brief The Morton key of the cell (x, y) which interleaves the bits of x (even) and y (odd).
+    inline std::uint64_t morton_encode_2d(std::uint32_t x, std::uint32_t y)
+    {
+#if defined(__BMI2__)
+        return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#else
+        using namespace space_filling_curve_detail;
+        return spread_bits_2(x) | (spread_bits_2(y) << 1);
+#endif
+    }
+
+    inline void morton_decode_2d(std::uint64_t key, std::uint32_t& x, std::uint32_t& y)
+    {
+#if defined(__BMI2__)
+        x = static_cast<std::uint32_t>(_pext_u64(key, 0x5555555555555555ull));
+        y = static_cast<std::uint32_t>(_pext_u64(key, 0xAAAAAAAAAAAAAAAAull));
+#else
+        using namespace space_filling_curve_detail;
+        x = compact_bits_2(key);
+        y = compact_bits_2(key >> 1);
+#endif
+    }
+
+    //! \brief The Morton key of the cell (x, y, z) from the low 21 bits of each coordinate.
+    inline std::uint64_t morton_encode_3d(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+    {
+#if defined(__BMI2__)
+        return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#else
+        using namespace space_filling_curve_detail;
+        return spread_bits_3(x) | (spread_bits_3(y) << 1) | (spread_bits_3(z) << 2);
+#endif
+    }
+
+    inline void morton_decode_3d(std::uint64_t key, std::uint32_t& x, std::uint32_t& y, std::uint32_t& z)
+    {
+#if defined(__BMI2__)
+        x = static_cast<std::uint32_t>(_pext_u64(key, 0x1249249249249249ull));
+        y = static_cast<std::uint32_t>(_pext_u64(key, 0x2492492492492492ull));
+        z = static_cast<std::uint32_t>(_pext_u64(key, 0x4924924924924924ull));
+#else
+        using namespace space_filling_curve_detail;
+        x = compact_bits_3(key);
+        y = compact_bits_3(key >> 1);
+        z = compact_bits_3(key >> 2);
+#endif
+    }
+
+    //! \brief The distance along a Hilbert curve over a 2^order x 2^order grid of the cell (x, y).
+
+    //! The coordinates must be less than 2^order. Unlike Morton order, consecutive cells along the curve always share an edge.
+    inline std::uint64_t hilbert_encode_2d(std::uint32_t x, std::uint32_t y, unsigned order = 32)
+    {
+        GEOMETRIX_ASSERT(order > 0 && order <= 32);
+        const std::uint32_t mask = order == 32 ? 0xFFFFFFFFu : (1u << order) - 1;
+        GEOMETRIX_ASSERT(x <= mask && y <= mask);
+        std::uint64_t d = 0;
+        for (std::uint32_t s = 1u << (order - 1); s > 0; s /= 2)
+        {
+            std::uint32_t rx = (x & s) > 0;
+            std::uint32_t ry = (y & s) > 0;
+            d += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+            if (ry == 0)
+            {
+                if (rx == 1)
+                {
+                    x = mask ^ x;
+                    y = mask ^ y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return d;
+    }
+
+    inline void hilbert_decode_2d(std::uint64_t d, std::uint32_t& x, std::uint32_t& y, unsigned order = 32)
+    {
+        GEOMETRIX_ASSERT(order > 0 && order <= 32);
+        x = y = 0;
+        for (std::uint64_t s = 1; s >> order == 0; s *= 2)
+        {
+            auto rx = static_cast<std::uint32_t>(1 & (d / 2));
+            auto ry = static_cast<std::uint32_t>(1 & (d ^ rx));
+            if (ry == 0)
+            {
+                if (rx == 1)
+                {
+                    x = static_cast<std::uint32_t>(s - 1 - x);
+                    y = static_cast<std::uint32_t>(s - 1 - y);
+                }
+                std::swap(x, y);
+            }
+            x += static_cast<std::uint32_t>(s * rx);
+            y += static_cast<std::uint32_t>(s * ry);
+            d /= 4;
+        }
+    }
+
+    namespace space_filling_curve_detail {
+
+        //! Quantize v in [lo, lo + extent] to an integer in [0, maxCell].
+        inline std::uint32_t quantize(double v, double lo, double scale, double maxCell)
+        {
+            return static_cast<std::uint32_t>((std::min)((std::max)((v - lo) * scale, 0.0), maxCell));
+        }
+
+        template <typename Points, typename Keys>
+        inline void get_curve_keys(const Points& points, space_filling_curve curve, Keys& keys, std::size_t nThreads, dimension<2>)
+        {
+            using filtered_predicates_detail::to_double;
+
+            std::size_t n = points.size();
+            std::array<double, 2> lo = { { (std::numeric_limits<double>::max)(), (std::numeric_limits<double>::max)() } };
+            std::array<double, 2> hi = { { -(std::numeric_limits<double>::max)(), -(std::numeric_limits<double>::max)() } };
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                double x = to_double(get<0>(points[i])), y = to_double(get<1>(points[i]));
+                lo[0] = (std::min)(lo[0], x), hi[0] = (std::max)(hi[0], x);
+                lo[1] = (std::min)(lo[1], y), hi[1] = (std::max)(hi[1], y);
+            }
+
+            //! Both axes share a scale so the curve is not stretched.
+            const double maxCell = 4294967295.0;
+            auto extent = (std::max)(hi[0] - lo[0], hi[1] - lo[1]);
+            auto scale = extent > 0 ? maxCell / extent : 0.0;
+            parallel_for(n, [&](std::size_t i)
+            {
+                auto x = quantize(to_double(get<0>(points[i])), lo[0], scale, maxCell);
+                auto y = quantize(to_double(get<1>(points[i])), lo[1], scale, maxCell);
+                keys[i].first = curve == e_hilbert_curve ? hilbert_encode_2d(x, y) : morton_encode_2d(x, y);
+                keys[i].second = i;
+            }, 4096, nThreads);
+        }
+
+        template <typename Points, typename Keys>
+        inline void get_curve_keys(const Points& points, space_filling_curve, Keys& keys, std::size_t nThreads, dimension<3>)
+        {
+            using filtered_predicates_detail::to_double;
+
+            std::size_t n = points.size();
+            std::array<double, 3> lo, hi;
+            lo.fill((std::numeric_limits<double>::max)());
+            hi.fill(-(std::numeric_limits<double>::max)());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                double c[3] = { to_double(get<0>(points[i])), to_double(get<1>(points[i])), to_double(get<2>(points[i])) };
+                for (std::size_t k = 0; k < 3; ++k)
+                    lo[k] = (std::min)(lo[k], c[k]), hi[k] = (std::max)(hi[k], c[k]);
+            }
+
+            const double maxCell = 2097151.0;
+            auto extent = (std::max)((std::max)(hi[0] - lo[0], hi[1] - lo[1]), hi[2] - lo[2]);
+            auto scale = extent > 0 ? maxCell / extent : 0.0;
+            parallel_for(n, [&](std::size_t i)
+            {
+                auto x = quantize(to_double(get<0>(points[i])), lo[0], scale, maxCell);
+                auto y = quantize(to_double(get<1>(points[i])), lo[1], scale, maxCell);
+                auto z = quantize(to_double(get<2>(points[i])), lo[2], scale, maxCell);
+                keys[i].first = morton_encode_3d(x, y, z);
+                keys[i].second = i;
+            }, 4096, nThreads);
+        }
+
+    }//! namespace space_filling_curve_detail;
+
+    //! \brief Stable sort of items by their 64 bit keys using a parallel least significant digit radix sort.
+
+    //! Each pass histograms one byte of the keys over batches in parallel and then scatters every batch into its own
+    //! range of the output, so the result does not depend on the number of threads. Bytes which are the same in all keys
+    //! (e.g. the high bytes of keys from a coarse grid) are skipped.
+    template <typename Value>
+    inline void parallel_radix_sort(std::vector<std::pair<std::uint64_t, Value>>& items, std::size_t nThreads = get_default_concurrency())
+    {
+        using item_t = std::pair<std::uint64_t, Value>;
+        std::size_t n = items.size();
+        if (n < 1024)
+        {
+            std::stable_sort(items.begin(), items.end(), [](const item_t& a, const item_t& b) { return a.first < b.first; });
+            return;
+        }
+
+        nThreads = (std::max<std::size_t>)(1, nThreads);
+        std::size_t batchSize = (std::max<std::size_t>)(16384, (n + nThreads - 1) / nThreads);
+        std::size_t nBatches = get_number_batches(n, batchSize);
+
+        std::vector<std::uint64_t> batchDiff(nBatches, 0);
+        auto first = items[0].first;
+        parallel_for_batches(n, batchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+        {
+            std::uint64_t diff = 0;
+            for (auto i = begin; i < end; ++i)
+                diff |= items[i].first ^ first;
+            batchDiff[b] = diff;
+        }, nThreads);
+        std::uint64_t diff = 0;
+        for (auto d : batchDiff)
+            diff |= d;
+
+        std::vector<item_t> buffer(n);
+        auto* src = &items;
+        auto* dst = &buffer;
+        std::vector<std::array<std::size_t, 256>> offsets(nBatches);
+        for (unsigned shift = 0; shift < 64; shift += 8)
+        {
+            if (((diff >> shift) & 0xFF) == 0)
+                continue;
+
+            auto& from = *src;
+            auto& to = *dst;
+            parallel_for_batches(n, batchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+            {
+                auto& count = offsets[b];
+                count.fill(0);
+                for (auto i = begin; i < end; ++i)
+                    ++count[(from[i].first >> shift) & 0xFF];
+            }, nThreads);
+
+            std::size_t total = 0;
+            for (std::size_t digit = 0; digit < 256; ++digit)
+            {
+                for (std::size_t b = 0; b < nBatches; ++b)
+                {
+                    auto count = offsets[b][digit];
+                    offsets[b][digit] = total;
+                    total += count;
+                }
+            }
+
+            parallel_for_batches(n, batchSize, [&](std::size_t b, std::size_t begin, std::size_t end)
+            {
+                auto& offset = offsets[b];
+                for (auto i = begin; i < end; ++i)
+                    to[offset[(from[i].first >> shift) & 0xFF]++] = std::move(from[i]);
+            }, nThreads);
+            std::swap(src, dst);
+        }
+
+        if (src != &items)
+            items.swap(buffer);
+    }
+
+    //! \brief The permutation which puts points into the order of a space filling curve over their bounds.
+
+    //! Element i of the result is the index of the point which goes to position i. Points are quantized to 2^32 cells per
+    //! axis in 2D and 2^21 in 3D. Hilbert order is only defined in 2D; 3D points are always put in Morton order.
+    template <typename Points>
+    inline std::vector<std::size_t> get_space_filling_curve_order(const Points& points, space_filling_curve curve = e_hilbert_curve, std::size_t nThreads = get_default_concurrency())
+    {
+        using point_t = typename std::decay<decltype(points[0])>::type;
+        std::vector<std::pair<std::uint64_t, std::size_t>> keys(points.size());
+        space_filling_curve_detail::get_curve_keys(points, curve, keys, nThreads, typename dimension_of<point_t>::type());
+        parallel_radix_sort(keys, nThreads);
+
+        std::vector<std::size_t> order(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            order[i] = keys[i].second;
+        return order;
+    }
+
+    //! \brief Rearrange a random access sequence so that element i is the old element order[i].
+    template <typename Sequence>
+    inline void permute_sequence(Sequence& items, const std::vector<std::size_t>& order)
+    {
+        using value_t = typename std::decay<decltype(items[0])>::type;
+        GEOMETRIX_ASSERT(order.size() == items.size());
+        std::vector<value_t> permuted;
+        permuted.reserve(order.size());
+        for (auto i : order)
+            permuted.push_back(std::move(items[i]));
+        std::move(permuted.begin(), permuted.end(), items.begin());
+    }
+
+    //! \brief The inverse of a permutation, i.e. the new position of each old element.
+    inline std::vector<std::size_t> invert_permutation(const std::vector<std::size_t>& order)
+    {
+        std::vector<std::size_t> inverse(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            inverse[order[i]] = i;
+        return inverse;
+    }
+
+    //! \brief Put a sequence of points into space filling curve order (e.g. before building a kd_tree over them.)
+
+    //! Returns the permutation applied so that data stored alongside the points can be rearranged with permute_sequence.
+    template <typename Points>
+    inline std::vector<std::size_t> reorder_by_space_filling_curve(Points& points, space_filling_curve curve = e_hilbert_curve, std::size_t nThreads = get_default_concurrency())
+    {
+        auto order = get_space_filling_curve_order(points, curve, nThreads);
+        permute_sequence(points, order);
+        return order;
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_SPACE_FILLING_CURVE_HPP
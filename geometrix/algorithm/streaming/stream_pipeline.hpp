@@ -0,0 +1,195 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_STREAMING_STREAM_PIPELINE_HPP
+#define GEOMETRIX_ALGORITHM_STREAMING_STREAM_PIPELINE_HPP
+#pragma once
+
+#include <geometrix/utility/bounded_queue.hpp>
+#include <geometrix/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//! A streaming pipeline runs a source, a stage and a sink over a stream of records which need not fit in memory:
+//!
+//! - a source is called as source(records) with an empty std::vector<record_type>. It fills it with the next chunk of
+//!   records and returns false at the end of the stream (see stream_sources.hpp). Sources are called from one thread.
+//! - a stage is called as stage(chunk) with a const stream_chunk<record_type>& and returns a result for the chunk. Stages are
+//!   called concurrently on several chunks and must not modify shared state (see stream_stages.hpp).
+//! - a sink is called as sink(std::move(result)) for the results in the order of the chunks in the stream on the calling thread.
+//!
+//! Reading, processing and consuming overlap across threads. At most options.chunks_in_flight chunks (and their results) are
+//! held at any time, so memory is bounded by the chunk size of the source.
+namespace geometrix {
+
+    //! \brief A chunk of records read from a stream.
+    template <typename Record>
+    struct stream_chunk
+    {
+        std::size_t         sequence;     //! position of the chunk in the stream.
+        std::size_t         first_record; //! position of the first record of the chunk in the stream.
+        std::vector<Record> records;
+    };
+
+    struct stream_pipeline_options
+    {
+        //! The number of chunks which may be read and not yet consumed by the sink.
+        std::size_t chunks_in_flight = 8;
+
+        //! The number of threads running the stage (the source and sink each run on a thread of their own).
+        std::size_t threads = get_default_concurrency();
+    };
+
+    //! Run source -> stage -> sink until the source is exhausted. Returns the number of records read.
+    //! The first exception thrown by the source, the stage or the sink stops the pipeline and is rethrown on the calling thread.
+    template <typename Source, typename Stage, typename Sink>
+    inline std::size_t run_stream_pipeline(Source&& source, Stage&& stage, Sink&& sink, const stream_pipeline_options& options = stream_pipeline_options())
+    {
+        using record_t = typename std::decay<Source>::type::record_type;
+        using chunk_t = stream_chunk<record_t>;
+        using result_t = typename std::decay<decltype(stage(std::declval<const chunk_t&>()))>::type;
+
+        const auto nInFlight = (std::max<std::size_t>)(1, options.chunks_in_flight);
+        const auto nWorkers = (std::max<std::size_t>)(1, options.threads);
+
+        bounded_queue<chunk_t> chunks(nInFlight);
+        std::map<std::size_t, result_t> results;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::size_t inFlight = 0;
+        std::size_t nChunks = 0;
+        std::size_t nRecords = 0;
+        bool readerDone = false;
+        std::exception_ptr error;
+
+        auto fail = [&]()
+        {
+            {
+                std::lock_guard<std::mutex> lk(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+            chunks.cancel();
+            changed.notify_all();
+        };
+
+        auto reader = [&]()
+        {
+            try
+            {
+                for (std::size_t sequence = 0;; ++sequence)
+                {
+                    {
+                        std::unique_lock<std::mutex> lk(mutex);
+                        changed.wait(lk, [&]() { return error || inFlight < nInFlight; });
+                        if (error)
+                            return;
+                        ++inFlight;
+                    }
+
+                    chunk_t chunk{ sequence, nRecords, {} };
+                    if (!source(chunk.records))
+                    {
+                        {
+                            std::lock_guard<std::mutex> lk(mutex);
+                            --inFlight;
+                            nChunks = sequence;
+                            readerDone = true;
+                        }
+                        changed.notify_all();
+                        break;
+                    }
+
+                    nRecords += chunk.records.size();
+                    if (!chunks.push(std::move(chunk)))
+                        return;
+                }
+            }
+            catch (...)
+            {
+                fail();
+            }
+            chunks.close();
+        };
+
+        auto worker = [&]()
+        {
+            while (auto chunk = chunks.pop())
+            {
+                try
+                {
+                    auto result = stage(static_cast<const chunk_t&>(*chunk));
+                    {
+                        std::lock_guard<std::mutex> lk(mutex);
+                        results.emplace(chunk->sequence, std::move(result));
+                    }
+                    changed.notify_all();
+                }
+                catch (...)
+                {
+                    fail();
+                    return;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nWorkers + 1);
+        threads.emplace_back(reader);
+        for (std::size_t i = 0; i < nWorkers; ++i)
+            threads.emplace_back(worker);
+
+        for (std::size_t next = 0;; ++next)
+        {
+            std::unique_lock<std::mutex> lk(mutex);
+            changed.wait(lk, [&]() { return error || results.count(next) || (readerDone && next == nChunks); });
+            auto it = results.find(next);
+            if (error || it == results.end())
+                break;
+
+            auto result = std::move(it->second);
+            results.erase(it);
+            lk.unlock();
+
+            try
+            {
+                sink(std::move(result));
+            }
+            catch (...)
+            {
+                fail();
+                break;
+            }
+
+            lk.lock();
+            --inFlight;
+            lk.unlock();
+            changed.notify_all();
+        }
+
+        for (auto& t : threads)
+            t.join();
+
+        if (error)
+            std::rethrow_exception(error);
+
+        return nRecords;
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_STREAMING_STREAM_PIPELINE_HPP
@@ -0,0 +1,472 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_STREAMING_STREAM_SOURCES_HPP
+#define GEOMETRIX_ALGORITHM_STREAMING_STREAM_SOURCES_HPP
+#pragma once
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/primitive/point_sequence_traits.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <boost/mpl/assert.hpp>
+#include <boost/optional.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//! Sources and sinks of point, segment and polyline records for run_stream_pipeline (see stream_pipeline.hpp).
+namespace geometrix {
+
+    //! \brief Encoding of a point or segment as a fixed number of coordinates in binary record files.
+    template <typename Record, typename EnableIf = void>
+    struct stream_record_traits
+    {
+        BOOST_MPL_ASSERT_MSG(
+              ( false )
+            , STREAM_RECORD_TRAITS_NOT_DEFINED
+            , (Record) );
+    };
+
+    template <typename Point>
+    struct stream_record_traits<Point, typename std::enable_if<is_point<Point>::value>::type>
+    {
+        using arithmetic_type = typename arithmetic_type_of<Point>::type;
+        static const std::size_t dimension = dimension_of<Point>::value;
+        static const std::size_t number_coordinates = dimension;
+
+        static void store(const Point& p, arithmetic_type* c)
+        {
+            store(p, c, std::make_index_sequence<dimension>());
+        }
+
+        static Point load(const arithmetic_type* c)
+        {
+            return load(c, std::make_index_sequence<dimension>());
+        }
+
+    private:
+
+        template <std::size_t... I>
+        static void store(const Point& p, arithmetic_type* c, std::index_sequence<I...>)
+        {
+            using expander = int[];
+            (void)expander{ 0, ((c[I] = get<I>(p)), 0)... };
+        }
+
+        template <std::size_t... I>
+        static Point load(const arithmetic_type* c, std::index_sequence<I...>)
+        {
+            return construct<Point>(c[I]...);
+        }
+    };
+
+    template <typename Segment>
+    struct stream_record_traits<Segment, typename std::enable_if<is_segment<Segment>::value>::type>
+    {
+        using point_type = typename geometric_traits<Segment>::point_type;
+        using point_traits = stream_record_traits<point_type>;
+        using arithmetic_type = typename point_traits::arithmetic_type;
+        static const std::size_t dimension = point_traits::dimension;
+        static const std::size_t number_coordinates = 2 * dimension;
+
+        static void store(const Segment& s, arithmetic_type* c)
+        {
+            point_traits::store(get_start(s), c);
+            point_traits::store(get_end(s), c + dimension);
+        }
+
+        static Segment load(const arithmetic_type* c)
+        {
+            return construct<Segment>(point_traits::load(c), point_traits::load(c + dimension));
+        }
+    };
+
+    //! \brief Source of chunks of at most chunkSize records copied from an iterator range.
+    template <typename Iterator>
+    class range_stream_source
+    {
+    public:
+
+        using record_type = typename std::iterator_traits<Iterator>::value_type;
+
+        range_stream_source(Iterator first, Iterator last, std::size_t chunkSize)
+            : m_it(first)
+            , m_end(last)
+            , m_chunkSize(chunkSize)
+        {
+            GEOMETRIX_ASSERT(chunkSize > 0);
+        }
+
+        bool operator()(std::vector<record_type>& records)
+        {
+            records.clear();
+            for (; m_it != m_end && records.size() < m_chunkSize; ++m_it)
+                records.push_back(*m_it);
+            return !records.empty();
+        }
+
+    private:
+
+        Iterator    m_it;
+        Iterator    m_end;
+        std::size_t m_chunkSize;
+
+    };
+
+    template <typename Iterator>
+    inline range_stream_source<Iterator> make_range_stream_source(Iterator first, Iterator last, std::size_t chunkSize)
+    {
+        return range_stream_source<Iterator>(first, last, chunkSize);
+    }
+
+    //! \brief Source of chunks of at most chunkSize points or segments read from a binary file of packed coordinates (see stream_record_traits).
+    template <typename Record>
+    class binary_record_file_source
+    {
+        using traits = stream_record_traits<Record>;
+        using arithmetic_type = typename traits::arithmetic_type;
+
+    public:
+
+        using record_type = Record;
+
+        binary_record_file_source(const std::string& fileName, std::size_t chunkSize)
+            : m_file(fileName, std::ios::binary)
+            , m_chunkSize(chunkSize)
+            , m_buffer(chunkSize * traits::number_coordinates)
+        {
+            GEOMETRIX_ASSERT(chunkSize > 0);
+            if (!m_file)
+                throw std::runtime_error("cannot open record file " + fileName + ".");
+        }
+
+        bool operator()(std::vector<record_type>& records)
+        {
+            records.clear();
+            m_file.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size() * sizeof(arithmetic_type));
+            auto nBytes = static_cast<std::size_t>(m_file.gcount());
+            if (nBytes % (traits::number_coordinates * sizeof(arithmetic_type)) != 0)
+                throw std::runtime_error("record file ends with a partial record.");
+
+            auto n = nBytes / (traits::number_coordinates * sizeof(arithmetic_type));
+            records.reserve(n);
+            for (std::size_t i = 0; i < n; ++i)
+                records.push_back(traits::load(m_buffer.data() + i * traits::number_coordinates));
+            return n != 0;
+        }
+
+    private:
+
+        std::ifstream                m_file;
+        std::size_t                  m_chunkSize;
+        std::vector<arithmetic_type> m_buffer;
+
+    };
+
+    //! \brief Sink appending the points or segments of each result to a binary file of packed coordinates.
+    template <typename Record>
+    class binary_record_file_sink
+    {
+        using traits = stream_record_traits<Record>;
+        using arithmetic_type = typename traits::arithmetic_type;
+
+    public:
+
+        explicit binary_record_file_sink(const std::string& fileName)
+            : m_file(fileName, std::ios::binary | std::ios::trunc)
+        {
+            if (!m_file)
+                throw std::runtime_error("cannot open record file " + fileName + ".");
+        }
+
+        void operator()(const std::vector<Record>& records)
+        {
+            m_buffer.resize(records.size() * traits::number_coordinates);
+            for (std::size_t i = 0; i < records.size(); ++i)
+                traits::store(records[i], m_buffer.data() + i * traits::number_coordinates);
+            m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size() * sizeof(arithmetic_type));
+            if (!m_file)
+                throw std::runtime_error("failed to write record file.");
+        }
+
+        void flush() { m_file.flush(); }
+
+    private:
+
+        std::ofstream                m_file;
+        std::vector<arithmetic_type> m_buffer;
+
+    };
+
+    //! \brief A run of consecutive vertices of a polyline in a stream.
+
+    //! Polylines with more vertices than the chunk size of a polyline_stream_source are split into pieces which share their end vertices:
+    //! the last vertex of a piece which is not the last of its polyline is the first vertex of the next piece.
+    template <typename Polyline>
+    struct polyline_piece
+    {
+        std::size_t polyline;//! position of the polyline in the stream.
+        bool        first;   //! the piece starts the polyline.
+        bool        last;    //! the piece ends the polyline.
+        Polyline    points;
+
+        bool is_whole() const { return first && last; }
+    };
+
+    //! \brief Source of chunks of polyline pieces read from a text stream.
+
+    //! The text has one vertex per line with its coordinates separated by white space. Blank lines separate polylines.
+    //! A chunk holds at most chunkSize vertices. A polyline which does not fit in the rest of a chunk starts the next one, so
+    //! only polylines of more than chunkSize vertices are split (see polyline_piece).
+    template <typename Polyline>
+    class polyline_stream_source
+    {
+        using access = point_sequence_traits<Polyline>;
+        using point_type = typename access::point_type;
+        using point_traits = stream_record_traits<point_type>;
+
+    public:
+
+        using record_type = polyline_piece<Polyline>;
+
+        //! The stream must outlive the source.
+        polyline_stream_source(std::istream& is, std::size_t chunkSize)
+            : m_is(is)
+            , m_chunkSize(chunkSize)
+        {
+            GEOMETRIX_ASSERT(chunkSize > 1);
+        }
+
+        bool operator()(std::vector<record_type>& records)
+        {
+            records.clear();
+            std::size_t n = 0;
+            while (n < m_chunkSize)
+            {
+                record_type piece;
+                if (m_pending)
+                {
+                    piece = std::move(*m_pending);
+                    m_pending = boost::none;
+                }
+                else if (!read_piece(piece))
+                    break;
+
+                if (n + access::size(piece.points) > m_chunkSize)
+                {
+                    m_pending = std::move(piece);
+                    break;
+                }
+
+                n += access::size(piece.points);
+                records.push_back(std::move(piece));
+            }
+
+            return !records.empty();
+        }
+
+    private:
+
+        //! Read the next piece of at most chunkSize vertices. Returns false at the end of the stream.
+        bool read_piece(record_type& piece)
+        {
+            piece = record_type{ m_nextPolyline, true, true, Polyline{} };
+            point_type p;
+            if (m_carry)
+            {
+                piece.polyline = m_nextPolyline - 1;
+                piece.first = false;
+                access::push_back(piece.points, *m_carry);
+                m_carry = boost::none;
+            }
+            else
+            {
+                if (!read_first_vertex(p))
+                    return false;
+                ++m_nextPolyline;
+                access::push_back(piece.points, p);
+            }
+
+            while (read_vertex(p))
+            {
+                if (access::size(piece.points) == m_chunkSize)
+                {
+                    m_lookahead = p;
+                    m_carry = access::back(piece.points);
+                    piece.last = false;
+                    break;
+                }
+                access::push_back(piece.points, p);
+            }
+
+            return true;
+        }
+
+        //! Skip separating blank lines to the first vertex of the next polyline.
+        bool read_first_vertex(point_type& p)
+        {
+            while (std::getline(m_is, m_line))
+            {
+                ++m_lineNumber;
+                if (parse_vertex(p))
+                    return true;
+            }
+
+            return false;
+        }
+
+        //! Read the next vertex of the current polyline. Returns false at its end.
+        bool read_vertex(point_type& p)
+        {
+            if (m_lookahead)
+            {
+                p = *m_lookahead;
+                m_lookahead = boost::none;
+                return true;
+            }
+
+            if (!std::getline(m_is, m_line))
+                return false;
+            ++m_lineNumber;
+            return parse_vertex(p);
+        }
+
+        //! Returns false for a blank line.
+        bool parse_vertex(point_type& p)
+        {
+            if (m_line.find_first_not_of(" \t\r") == std::string::npos)
+                return false;
+
+            typename point_traits::arithmetic_type c[point_traits::dimension];
+            std::istringstream ss(m_line);
+            for (auto& x : c)
+                ss >> x;
+            if (!ss)
+                throw std::runtime_error("malformed vertex on line " + std::to_string(m_lineNumber) + ".");
+            p = point_traits::load(c);
+            return true;
+        }
+
+        std::istream&               m_is;
+        std::size_t                 m_chunkSize;
+        std::size_t                 m_nextPolyline{ 0 };
+        std::size_t                 m_lineNumber{ 0 };
+        std::string                 m_line;
+        boost::optional<point_type>  m_carry;
+        boost::optional<point_type>  m_lookahead;
+        boost::optional<record_type> m_pending;
+
+    };
+
+    //! \brief Sink writing polyline pieces as text in the format read by polyline_stream_source.
+
+    //! Pieces must arrive in stream order; the vertex shared by consecutive pieces of a polyline is written once.
+    template <typename Polyline>
+    class polyline_stream_sink
+    {
+        using access = point_sequence_traits<Polyline>;
+
+    public:
+
+        //! The stream must outlive the sink.
+        explicit polyline_stream_sink(std::ostream& os)
+            : m_os(os)
+        {}
+
+        void operator()(const std::vector<polyline_piece<Polyline>>& pieces)
+        {
+            for (auto const& piece : pieces)
+            {
+                for (std::size_t i = piece.first ? 0 : 1; i < access::size(piece.points); ++i)
+                    write_vertex(access::get_point(piece.points, i));
+                if (piece.last)
+                    m_os << '\n';
+            }
+
+            if (!m_os)
+                throw std::runtime_error("failed to write polyline stream.");
+        }
+
+    private:
+
+        template <typename Point>
+        void write_vertex(const Point& p)
+        {
+            using point_traits = stream_record_traits<Point>;
+            typename point_traits::arithmetic_type c[point_traits::dimension];
+            point_traits::store(p, c);
+            for (std::size_t d = 0; d < point_traits::dimension; ++d)
+                m_os << (d ? " " : "") << c[d];
+            m_os << '\n';
+        }
+
+        std::ostream& m_os;
+
+    };
+
+    //! \brief Sink joining polyline pieces and calling visitor(polylineIndex, polyline) once each polyline is complete.
+
+    //! Only the polyline being joined is held in memory.
+    template <typename Polyline, typename Visitor>
+    class polyline_joining_sink
+    {
+        using access = point_sequence_traits<Polyline>;
+
+    public:
+
+        explicit polyline_joining_sink(Visitor visitor)
+            : m_visitor(std::move(visitor))
+        {}
+
+        void operator()(std::vector<polyline_piece<Polyline>>&& pieces)
+        {
+            for (auto& piece : pieces)
+            {
+                if (piece.first)
+                    m_polyline = std::move(piece.points);
+                else
+                {
+                    for (std::size_t i = 1; i < access::size(piece.points); ++i)
+                        access::push_back(m_polyline, access::get_point(piece.points, i));
+                }
+
+                if (piece.last)
+                {
+                    m_visitor(piece.polyline, std::move(m_polyline));
+                    m_polyline = Polyline{};
+                }
+            }
+        }
+
+    private:
+
+        Visitor  m_visitor;
+        Polyline m_polyline;
+
+    };
+
+    template <typename Polyline, typename Visitor>
+    inline polyline_joining_sink<Polyline, typename std::decay<Visitor>::type> make_polyline_joining_sink(Visitor&& visitor)
+    {
+        return polyline_joining_sink<Polyline, typename std::decay<Visitor>::type>(std::forward<Visitor>(visitor));
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_STREAMING_STREAM_SOURCES_HPP
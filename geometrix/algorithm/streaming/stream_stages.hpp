@@ -0,0 +1,374 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_STREAMING_STREAM_STAGES_HPP
+#define GEOMETRIX_ALGORITHM_STREAMING_STREAM_STAGES_HPP
+#pragma once
+
+#include <geometrix/algorithm/streaming/stream_pipeline.hpp>
+#include <geometrix/algorithm/streaming/stream_sources.hpp>
+#include <geometrix/algorithm/point_sequence/ramer_douglas_peucker_algorithm.hpp>
+#include <geometrix/algorithm/point_sequence/polyline_offset.hpp>
+#include <geometrix/algorithm/all_segment_intersections.hpp>
+#include <geometrix/algorithm/grid_traits.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+//! Stages wrapping geometrix algorithms for run_stream_pipeline (see stream_pipeline.hpp).
+namespace geometrix {
+
+    //! \brief Stage simplifying each polyline piece with ramer_douglas_peucker_algorithm.
+
+    //! The end vertices of the pieces are kept, so each removed vertex of a split polyline is still within epsilon of the line
+    //! through the kept vertices on either side of it.
+    template <typename Length>
+    struct ramer_douglas_peucker_stream_stage
+    {
+        explicit ramer_douglas_peucker_stream_stage(const Length& epsilon)
+            : epsilon(epsilon)
+        {}
+
+        template <typename Polyline>
+        std::vector<polyline_piece<Polyline>> operator()(const stream_chunk<polyline_piece<Polyline>>& chunk) const
+        {
+            std::vector<polyline_piece<Polyline>> result;
+            result.reserve(chunk.records.size());
+            for (auto const& piece : chunk.records)
+            {
+                auto points = point_sequence_traits<Polyline>::size(piece.points) > 1 ? ramer_douglas_peucker_algorithm(piece.points, epsilon) : piece.points;
+                result.push_back(polyline_piece<Polyline>{ piece.polyline, piece.first, piece.last, std::move(points) });
+            }
+            return result;
+        }
+
+        Length epsilon;
+    };
+
+    //! \brief Stage offsetting each polyline with polyline_offset.
+
+    //! The offset of a polyline depends on all of its vertices so the source must not split polylines (give it a chunk size of
+    //! at least the number of vertices of the longest polyline). Throws std::invalid_argument for a piece of a split polyline.
+    template <typename Length, typename NumberComparisonPolicy>
+    struct polyline_offset_stream_stage
+    {
+        polyline_offset_stream_stage(orientation_type side, const Length& offset, const NumberComparisonPolicy& cmp)
+            : side(side)
+            , offset(offset)
+            , cmp(cmp)
+        {}
+
+        template <typename Polyline>
+        std::vector<polyline_piece<Polyline>> operator()(const stream_chunk<polyline_piece<Polyline>>& chunk) const
+        {
+            std::vector<polyline_piece<Polyline>> result;
+            result.reserve(chunk.records.size());
+            for (auto const& piece : chunk.records)
+            {
+                if (!piece.is_whole())
+                    throw std::invalid_argument("polyline_offset_stream_stage: polyline " + std::to_string(piece.polyline) + " was split; increase the chunk size of the source.");
+                result.push_back(polyline_piece<Polyline>{ piece.polyline, true, true, polyline_offset(piece.points, side, offset, cmp) });
+            }
+            return result;
+        }
+
+        orientation_type       side;
+        Length                 offset;
+        NumberComparisonPolicy cmp;
+    };
+
+    template <typename Length, typename NumberComparisonPolicy>
+    inline polyline_offset_stream_stage<Length, NumberComparisonPolicy> make_polyline_offset_stream_stage(orientation_type side, const Length& offset, const NumberComparisonPolicy& cmp)
+    {
+        return polyline_offset_stream_stage<Length, NumberComparisonPolicy>(side, offset, cmp);
+    }
+
+    //! \brief A segment with its position in the stream.
+    template <typename Segment>
+    struct indexed_segment
+    {
+        std::size_t index;
+        Segment     segment;
+    };
+
+    //! \brief The segments overlapping the tile in column i and row j of a tiling grid, in stream order.
+    template <typename Segment>
+    struct segment_tile
+    {
+        std::uint32_t                         i;
+        std::uint32_t                         j;
+        std::vector<indexed_segment<Segment>> segments;
+    };
+
+    namespace stream_detail {
+
+        template <typename Coordinate>
+        inline std::uint32_t clamped_x_index(const grid_traits<Coordinate>& grid, Coordinate x)
+        {
+            return grid.get_x_index((std::min)((std::max)(x, grid.get_min_x()), grid.get_max_x()));
+        }
+
+        template <typename Coordinate>
+        inline std::uint32_t clamped_y_index(const grid_traits<Coordinate>& grid, Coordinate y)
+        {
+            return grid.get_y_index((std::min)((std::max)(y, grid.get_min_y()), grid.get_max_y()));
+        }
+
+        //! The tiles overlapped by the bounds of a segment as (imin, imax, jmin, jmax). Segments outside the grid are assigned to the border tiles.
+        template <typename Coordinate, typename Segment>
+        inline std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t> get_tile_range(const grid_traits<Coordinate>& grid, const Segment& s)
+        {
+            auto const& a = get_start(s);
+            auto const& b = get_end(s);
+            return std::make_tuple(clamped_x_index(grid, (std::min)(get<0>(a), get<0>(b))), clamped_x_index(grid, (std::max)(get<0>(a), get<0>(b)))
+                                 , clamped_y_index(grid, (std::min)(get<1>(a), get<1>(b))), clamped_y_index(grid, (std::max)(get<1>(a), get<1>(b))));
+        }
+
+    }//! namespace stream_detail;
+
+    //! \brief Stage bucketing a chunk of 2D segments into the tiles of a grid overlapped by their bounds.
+    template <typename Coordinate>
+    class segment_tiling_stream_stage
+    {
+    public:
+
+        explicit segment_tiling_stream_stage(const grid_traits<Coordinate>& tiles)
+            : m_tiles(tiles)
+        {}
+
+        template <typename Segment>
+        std::vector<segment_tile<Segment>> operator()(const stream_chunk<Segment>& chunk) const
+        {
+            std::map<std::pair<std::uint32_t, std::uint32_t>, std::vector<indexed_segment<Segment>>> buckets;
+            for (std::size_t k = 0; k < chunk.records.size(); ++k)
+            {
+                std::uint32_t imin, imax, jmin, jmax;
+                std::tie(imin, imax, jmin, jmax) = stream_detail::get_tile_range(m_tiles, chunk.records[k]);
+                for (auto j = jmin; j <= jmax; ++j)
+                    for (auto i = imin; i <= imax; ++i)
+                        buckets[std::make_pair(j, i)].push_back(indexed_segment<Segment>{ chunk.first_record + k, chunk.records[k] });
+            }
+
+            std::vector<segment_tile<Segment>> result;
+            result.reserve(buckets.size());
+            for (auto& item : buckets)
+                result.push_back(segment_tile<Segment>{ item.first.second, item.first.first, std::move(item.second) });
+            return result;
+        }
+
+        const grid_traits<Coordinate>& get_tiles() const { return m_tiles; }
+
+    private:
+
+        grid_traits<Coordinate> m_tiles;
+
+    };
+
+    //! The name of the file holding the segments of tile (i, j) written by segment_tile_writer.
+    inline std::string get_segment_tile_file_name(const std::string& pathPrefix, std::uint32_t i, std::uint32_t j)
+    {
+        return pathPrefix + "tile_" + std::to_string(i) + "_" + std::to_string(j) + ".bin";
+    }
+
+    //! \brief Sink appending the segments of each tile to a binary file per tile (see get_segment_tile_file_name).
+
+    //! Each record is the 64 bit index of the segment in the stream followed by its coordinates (see stream_record_traits).
+    //! Files of tiles which are not written are left alone; those which are written are truncated first.
+    template <typename Segment>
+    class segment_tile_writer
+    {
+        using traits = stream_record_traits<Segment>;
+        using arithmetic_type = typename traits::arithmetic_type;
+
+    public:
+
+        explicit segment_tile_writer(std::string pathPrefix)
+            : m_pathPrefix(std::move(pathPrefix))
+        {}
+
+        void operator()(const std::vector<segment_tile<Segment>>& tiles)
+        {
+            for (auto const& tile : tiles)
+            {
+                auto key = std::make_pair(tile.j, tile.i);
+                auto mode = std::ios::binary | (m_tiles.insert(key).second ? std::ios::trunc : std::ios::app);
+                std::ofstream file(get_file_name(tile.i, tile.j), mode);
+                arithmetic_type c[traits::number_coordinates];
+                for (auto const& s : tile.segments)
+                {
+                    std::uint64_t index = s.index;
+                    traits::store(s.segment, c);
+                    file.write(reinterpret_cast<const char*>(&index), sizeof(index));
+                    file.write(reinterpret_cast<const char*>(c), sizeof(c));
+                }
+
+                if (!file)
+                    throw std::runtime_error("failed to write tile file " + get_file_name(tile.i, tile.j) + ".");
+            }
+        }
+
+        //! The tiles which have been written as (i, j) in row major order.
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> get_tiles() const
+        {
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> result;
+            result.reserve(m_tiles.size());
+            for (auto const& key : m_tiles)
+                result.emplace_back(key.second, key.first);
+            return result;
+        }
+
+        std::string get_file_name(std::uint32_t i, std::uint32_t j) const
+        {
+            return get_segment_tile_file_name(m_pathPrefix, i, j);
+        }
+
+    private:
+
+        std::string                                       m_pathPrefix;
+        std::set<std::pair<std::uint32_t, std::uint32_t>> m_tiles;
+
+    };
+
+    //! \brief Source reading the tiles written by a segment_tile_writer (as listed by its get_tiles()), one tile per chunk.
+
+    //! Tiles are read whole so the tiling grid should be fine enough for each tile to fit in memory.
+    template <typename Segment>
+    class segment_tile_source
+    {
+        using traits = stream_record_traits<Segment>;
+        using arithmetic_type = typename traits::arithmetic_type;
+
+    public:
+
+        using record_type = segment_tile<Segment>;
+
+        segment_tile_source(std::string pathPrefix, std::vector<std::pair<std::uint32_t, std::uint32_t>> tiles)
+            : m_pathPrefix(std::move(pathPrefix))
+            , m_tiles(std::move(tiles))
+        {}
+
+        bool operator()(std::vector<record_type>& records)
+        {
+            records.clear();
+            if (m_next == m_tiles.size())
+                return false;
+
+            auto i = m_tiles[m_next].first, j = m_tiles[m_next].second;
+            ++m_next;
+            auto fileName = get_segment_tile_file_name(m_pathPrefix, i, j);
+            std::ifstream file(fileName, std::ios::binary);
+            if (!file)
+                throw std::runtime_error("cannot open tile file " + fileName + ".");
+
+            record_type tile{ i, j, {} };
+            std::uint64_t index;
+            arithmetic_type c[traits::number_coordinates];
+            while (file.read(reinterpret_cast<char*>(&index), sizeof(index)))
+            {
+                if (!file.read(reinterpret_cast<char*>(c), sizeof(c)))
+                    throw std::runtime_error("tile file " + fileName + " ends with a partial record.");
+                tile.segments.push_back(indexed_segment<Segment>{ static_cast<std::size_t>(index), traits::load(c) });
+            }
+
+            records.push_back(std::move(tile));
+            return true;
+        }
+
+    private:
+
+        std::string                                          m_pathPrefix;
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> m_tiles;
+        std::size_t                                          m_next{ 0 };
+
+    };
+
+    //! \brief Stage computing the segment intersections in each tile with find_segment_intersections.
+
+    //! Segments are identified by their position in the original stream. A pair of segments which overlap several tiles is
+    //! reported only by the tile containing its (first) intersection point, so running segment_tiling_stream_stage ->
+    //! segment_tile_writer and then segment_tile_source -> this stage with the same grid reports every intersecting pair of the
+    //! stream exactly once. The records of each tile are sorted by segment index.
+    template <typename Coordinate, typename NumberComparisonPolicy>
+    class tiled_segment_intersection_stream_stage
+    {
+    public:
+
+        tiled_segment_intersection_stream_stage(const grid_traits<Coordinate>& tiles, const NumberComparisonPolicy& cmp)
+            : m_tiles(tiles)
+            , m_cmp(cmp)
+        {}
+
+        template <typename Segment>
+        std::vector<segment_intersection_record<typename geometric_traits<Segment>::point_type>> operator()(const stream_chunk<segment_tile<Segment>>& chunk) const
+        {
+            using point_t = typename geometric_traits<Segment>::point_type;
+            std::vector<segment_intersection_record<point_t>> result;
+            for (auto const& tile : chunk.records)
+            {
+                if (tile.segments.size() < 2)
+                    continue;
+
+                std::vector<Segment> segments;
+                segments.reserve(tile.segments.size());
+                for (auto const& s : tile.segments)
+                    segments.push_back(s.segment);
+
+                //! Parallelism comes from the pipeline running several tiles at once.
+                auto records = find_segment_intersections(segments, make_segment_intersection_grid(segments), m_cmp, 1);
+                for (auto r : records)
+                {
+                    if (!is_owner(tile, segments[r.first], segments[r.second], r.xPoints[0]))
+                        continue;
+
+                    r.first = tile.segments[r.first].index;
+                    r.second = tile.segments[r.second].index;
+                    result.push_back(r);
+                }
+            }
+
+            return result;
+        }
+
+    private:
+
+        //! The owner is the tile containing the point, clamped to the tiles overlapped by both segments so rounding of the point cannot lose the pair.
+        template <typename Segment, typename Point>
+        bool is_owner(const segment_tile<Segment>& tile, const Segment& a, const Segment& b, const Point& p) const
+        {
+            std::uint32_t aimin, aimax, ajmin, ajmax, bimin, bimax, bjmin, bjmax;
+            std::tie(aimin, aimax, ajmin, ajmax) = stream_detail::get_tile_range(m_tiles, a);
+            std::tie(bimin, bimax, bjmin, bjmax) = stream_detail::get_tile_range(m_tiles, b);
+            auto i = stream_detail::clamped_x_index(m_tiles, static_cast<Coordinate>(get<0>(p)));
+            auto j = stream_detail::clamped_y_index(m_tiles, static_cast<Coordinate>(get<1>(p)));
+            i = (std::min)((std::max)(i, (std::max)(aimin, bimin)), (std::min)(aimax, bimax));
+            j = (std::min)((std::max)(j, (std::max)(ajmin, bjmin)), (std::min)(ajmax, bjmax));
+            return i == tile.i && j == tile.j;
+        }
+
+        grid_traits<Coordinate> m_tiles;
+        NumberComparisonPolicy  m_cmp;
+
+    };
+
+    template <typename Coordinate, typename NumberComparisonPolicy>
+    inline tiled_segment_intersection_stream_stage<Coordinate, NumberComparisonPolicy> make_tiled_segment_intersection_stream_stage(const grid_traits<Coordinate>& tiles, const NumberComparisonPolicy& cmp)
+    {
+        return tiled_segment_intersection_stream_stage<Coordinate, NumberComparisonPolicy>(tiles, cmp);
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_ALGORITHM_STREAMING_STREAM_STAGES_HPP
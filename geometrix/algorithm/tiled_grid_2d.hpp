@@ -0,0 +1,313 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_TILED_GRID_2D_HPP
+#define GEOMETRIX_ALGORITHM_TILED_GRID_2D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <boost/functional/hash.hpp>
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace geometrix
+{
+    //! \brief A sparse grid of cells stored in dense square tiles of 2^TileBits x 2^TileBits cells.
+
+    //! Tiles are allocated on the first mutable access to one of their cells and filled with the background value, so memory
+    //! follows the extent of the data rather than the extent of the grid. The tile directory is hashed while the cells of a tile
+    //! are contiguous, so lookups pay for one hash per tile instead of one per cell as with hash_grid_2d.
+    //!
+    //! Copies share their tiles. A tile is copied on the first mutable access to it while it is shared (copy-on-write), so
+    //! snapshot() is cheap and a snapshot is not affected by later writes to the grid. References to cells returned from
+    //! mutable accessors are not protected: they must not be used to write after a snapshot is taken.
+    template <typename Data, typename GridTraits, unsigned int TileBits = 6>
+    class tiled_grid_2d
+    {
+        static_assert(TileBits > 0 && TileBits < 16, "TileBits must be in [1, 15].");
+
+    public:
+
+        typedef Data data_type;
+        typedef GridTraits traits_type;
+        typedef std::pair<boost::uint32_t, boost::uint32_t> tile_key;
+
+        static const boost::uint32_t tile_bits = TileBits;
+        static const boost::uint32_t tile_size = 1u << TileBits;
+        static const boost::uint32_t tile_mask = tile_size - 1;
+
+        typedef std::array<data_type, tile_size * tile_size> tile_type;
+        typedef std::unordered_map<tile_key, std::shared_ptr<tile_type>, boost::hash<tile_key>> directory_type;
+
+        tiled_grid_2d(const GridTraits& traits, const data_type& background = data_type())
+            : m_gridTraits(traits)
+            , m_background(background)
+        {}
+
+        //! A copy of the grid which shares all tiles with it.
+        tiled_grid_2d snapshot() const { return *this; }
+
+        template <typename Point>
+        data_type const* find_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)));
+        }
+
+        template <typename Point>
+        data_type* find_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)));
+        }
+
+        //! Returns nullptr if the tile of the cell has not been allocated.
+        data_type const* find_cell(boost::uint32_t i, boost::uint32_t j) const
+        {
+            auto iter = m_tiles.find(get_tile_key(i, j));
+            if (iter != m_tiles.end())
+                return &(*iter->second)[get_tile_offset(i, j)];
+            return nullptr;
+        }
+
+        data_type* find_cell(boost::uint32_t i, boost::uint32_t j)
+        {
+            auto iter = m_tiles.find(get_tile_key(i, j));
+            if (iter != m_tiles.end())
+                return &get_unique_tile(iter->second)[get_tile_offset(i, j)];
+            return nullptr;
+        }
+
+        //! Returns the background value if the tile of the cell has not been allocated.
+        template <typename Point>
+        data_type const& get_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)));
+        }
+
+        data_type const& get_cell(boost::uint32_t i, boost::uint32_t j) const
+        {
+            auto pCell = find_cell(i, j);
+            return pCell ? *pCell : m_background;
+        }
+
+        //! Allocates the tile of the cell if needed.
+        template <typename Point>
+        data_type& get_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)));
+        }
+
+        data_type& get_cell(boost::uint32_t i, boost::uint32_t j)
+        {
+            GEOMETRIX_ASSERT(i < m_gridTraits.get_width() && j < m_gridTraits.get_height());
+            return get_tile(get_tile_key(i, j))[get_tile_offset(i, j)];
+        }
+
+        const traits_type& get_traits() const { return m_gridTraits; }
+        const data_type& get_background() const { return m_background; }
+
+        template <typename Point>
+        bool is_contained(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point2DConcept<Point>));
+            return m_gridTraits.is_contained(p);
+        }
+
+        //! Reset the cell to the background value. Tiles are kept.
+        void erase(boost::uint32_t i, boost::uint32_t j)
+        {
+            if (auto pCell = find_cell(i, j))
+                *pCell = m_background;
+        }
+
+        void clear() { m_tiles.clear(); }
+
+        std::size_t get_number_tiles() const { return m_tiles.size(); }
+
+        static tile_key get_tile_key(boost::uint32_t i, boost::uint32_t j) { return tile_key(i >> tile_bits, j >> tile_bits); }
+
+        //! Call visitor(i, j, data) for every cell in the allocated tiles (tiles in no particular order).
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (auto const& item : m_tiles)
+            {
+                auto const& tile = *item.second;
+                auto i0 = item.first.first << tile_bits;
+                auto j0 = item.first.second << tile_bits;
+                auto imax = (std::min)(tile_size, m_gridTraits.get_width() - i0);
+                auto jmax = (std::min)(tile_size, m_gridTraits.get_height() - j0);
+                for (boost::uint32_t a = 0; a < imax; ++a)
+                    for (boost::uint32_t b = 0; b < jmax; ++b)
+                        visitor(i0 + a, j0 + b, tile[(a << tile_bits) | b]);
+            }
+        }
+
+        //! Build the grid one level coarser, whose cells are twice as wide and hold reduce(parent, child) folded over the four
+        //! cells they cover (starting from the background value). Only the cells of allocated tiles are folded.
+        template <typename Reduce>
+        tiled_grid_2d get_coarser_grid(Reduce&& reduce) const
+        {
+            auto coarseCellSize = m_gridTraits.get_cell_size() + m_gridTraits.get_cell_size();
+            tiled_grid_2d coarse(traits_type(m_gridTraits.get_min_x(), m_gridTraits.get_max_x(), m_gridTraits.get_min_y(), m_gridTraits.get_max_y(), coarseCellSize), m_background);
+            const auto half = tile_size / 2;
+            for (auto const& item : m_tiles)
+            {
+                auto const& tile = *item.second;
+                auto& parent = coarse.get_tile(tile_key(item.first.first >> 1, item.first.second >> 1));
+                auto i0 = item.first.first << tile_bits;
+                auto j0 = item.first.second << tile_bits;
+                auto imax = (std::min)(tile_size, m_gridTraits.get_width() - i0);
+                auto jmax = (std::min)(tile_size, m_gridTraits.get_height() - j0);
+                auto pa = (item.first.first & 1) * half;
+                auto pb = (item.first.second & 1) * half;
+                for (boost::uint32_t a = 0; a < imax; ++a)
+                {
+                    for (boost::uint32_t b = 0; b < jmax; ++b)
+                    {
+                        auto& p = parent[((pa + (a >> 1)) << tile_bits) | (pb + (b >> 1))];
+                        p = reduce(p, tile[(a << tile_bits) | b]);
+                    }
+                }
+            }
+
+            return coarse;
+        }
+
+    private:
+
+        static std::size_t get_tile_offset(boost::uint32_t i, boost::uint32_t j) { return ((i & tile_mask) << tile_bits) | (j & tile_mask); }
+
+        tile_type& get_unique_tile(std::shared_ptr<tile_type>& pTile)
+        {
+            if (pTile.use_count() > 1)
+                pTile = std::make_shared<tile_type>(*pTile);
+            return *pTile;
+        }
+
+        tile_type& get_tile(const tile_key& key)
+        {
+            auto iter = m_tiles.find(key);
+            if (iter != m_tiles.end())
+                return get_unique_tile(iter->second);
+
+            auto pTile = std::make_shared<tile_type>();
+            pTile->fill(m_background);
+            return *m_tiles.emplace_hint(iter, key, std::move(pTile))->second;
+        }
+
+        traits_type    m_gridTraits;
+        data_type      m_background;
+        directory_type m_tiles;
+
+    };
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_2d<Data, GridTraits, TileBits>::tile_bits;
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_2d<Data, GridTraits, TileBits>::tile_size;
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_2d<Data, GridTraits, TileBits>::tile_mask;
+
+    //! \brief A stack of tiled grids where each level is one coarser than the last, for hierarchical queries.
+
+    //! Level 0 is a snapshot of the source grid. The cells of level k are 2^k times as wide and hold the reduction of the cells of
+    //! level 0 they cover, e.g. the max of an occupancy grid. A query descends from the coarsest level only into cells which may
+    //! contain an answer.
+    template <typename Data, typename GridTraits, unsigned int TileBits = 6>
+    class tiled_grid_pyramid
+    {
+    public:
+
+        using grid_type = tiled_grid_2d<Data, GridTraits, TileBits>;
+        using data_type = Data;
+
+        template <typename Reduce>
+        tiled_grid_pyramid(const grid_type& grid, std::size_t numberLevels, Reduce&& reduce)
+        {
+            GEOMETRIX_ASSERT(numberLevels > 0);
+            m_levels.reserve(numberLevels);
+            m_levels.push_back(grid.snapshot());
+            while (m_levels.size() < numberLevels)
+                m_levels.push_back(m_levels.back().get_coarser_grid(reduce));
+        }
+
+        std::size_t get_number_levels() const { return m_levels.size(); }
+
+        const grid_type& get_level(std::size_t level) const
+        {
+            GEOMETRIX_ASSERT(level < m_levels.size());
+            return m_levels[level];
+        }
+
+        //! Descend from the cells of the coarsest level into the four cells covered by each cell for which
+        //! descend(level, i, j, data) is true and call visitor(i, j, data) for the cells of level 0 reached.
+        //! Only cells of allocated tiles are visited.
+        template <typename Descend, typename Visitor>
+        void traverse(Descend&& descend, Visitor&& visitor) const
+        {
+            auto top = m_levels.size() - 1;
+            m_levels[top].for_each_cell([&](boost::uint32_t i, boost::uint32_t j, const data_type& data)
+            {
+                traverse(top, i, j, data, descend, visitor);
+            });
+        }
+
+    private:
+
+        template <typename Descend, typename Visitor>
+        void traverse(std::size_t level, boost::uint32_t i, boost::uint32_t j, const data_type& data, Descend& descend, Visitor& visitor) const
+        {
+            if (!descend(level, i, j, data))
+                return;
+
+            if (level == 0)
+            {
+                visitor(i, j, data);
+                return;
+            }
+
+            auto const& child = m_levels[level - 1];
+            auto const& traits = child.get_traits();
+            for (auto ci = 2 * i; ci < (std::min)(2 * i + 2, traits.get_width()); ++ci)
+                for (auto cj = 2 * j; cj < (std::min)(2 * j + 2, traits.get_height()); ++cj)
+                    if (auto pCell = child.find_cell(ci, cj))
+                        traverse(level - 1, ci, cj, *pCell, descend, visitor);
+        }
+
+        std::vector<grid_type> m_levels;
+
+    };
+
+    struct tiled_grid_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = tiled_grid_2d<Data, Traits>;
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_TILED_GRID_2D_HPP
@@ -0,0 +1,214 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_TILED_GRID_3D_HPP
+#define GEOMETRIX_ALGORITHM_TILED_GRID_3D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <boost/functional/hash.hpp>
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace geometrix
+{
+    //! \brief A sparse 3D grid of cells stored in dense cubic tiles of 2^TileBits cells on a side.
+
+    //! The 3D counterpart of tiled_grid_2d: tiles are allocated on the first mutable access to one of their cells and filled
+    //! with the background value, lookups hash once per tile, and copies share their tiles until one of them writes to a tile
+    //! (copy-on-write), so snapshot() is cheap.
+    template <typename Data, typename GridTraits, unsigned int TileBits = 4>
+    class tiled_grid_3d
+    {
+        static_assert(TileBits > 0 && TileBits < 10, "TileBits must be in [1, 9].");
+
+    public:
+
+        typedef Data data_type;
+        typedef GridTraits traits_type;
+        typedef std::tuple<boost::uint32_t, boost::uint32_t, boost::uint32_t> tile_key;
+
+        static const boost::uint32_t tile_bits = TileBits;
+        static const boost::uint32_t tile_size = 1u << TileBits;
+        static const boost::uint32_t tile_mask = tile_size - 1;
+
+        typedef std::array<data_type, tile_size * tile_size * tile_size> tile_type;
+        typedef std::unordered_map<tile_key, std::shared_ptr<tile_type>, boost::hash<tile_key>> directory_type;
+
+        tiled_grid_3d(const GridTraits& traits, const data_type& background = data_type())
+            : m_gridTraits(traits)
+            , m_background(background)
+        {}
+
+        //! A copy of the grid which shares all tiles with it.
+        tiled_grid_3d snapshot() const { return *this; }
+
+        template <typename Point>
+        data_type const* find_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        template <typename Point>
+        data_type* find_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return find_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        //! Returns nullptr if the tile of the cell has not been allocated.
+        data_type const* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            auto iter = m_tiles.find(get_tile_key(i, j, k));
+            if (iter != m_tiles.end())
+                return &(*iter->second)[get_tile_offset(i, j, k)];
+            return nullptr;
+        }
+
+        data_type* find_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            auto iter = m_tiles.find(get_tile_key(i, j, k));
+            if (iter != m_tiles.end())
+                return &get_unique_tile(iter->second)[get_tile_offset(i, j, k)];
+            return nullptr;
+        }
+
+        //! Returns the background value if the tile of the cell has not been allocated.
+        template <typename Point>
+        data_type const& get_cell(const Point& point) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type const& get_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) const
+        {
+            auto pCell = find_cell(i, j, k);
+            return pCell ? *pCell : m_background;
+        }
+
+        //! Allocates the tile of the cell if needed.
+        template <typename Point>
+        data_type& get_cell(const Point& point)
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            GEOMETRIX_ASSERT(is_contained(point));
+            return get_cell(m_gridTraits.get_x_index(get<0>(point)), m_gridTraits.get_y_index(get<1>(point)), m_gridTraits.get_z_index(get<2>(point)));
+        }
+
+        data_type& get_cell(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            GEOMETRIX_ASSERT(i < m_gridTraits.get_width() && j < m_gridTraits.get_height() && k < m_gridTraits.get_depth());
+            return get_tile(get_tile_key(i, j, k))[get_tile_offset(i, j, k)];
+        }
+
+        const traits_type& get_traits() const { return m_gridTraits; }
+        const data_type& get_background() const { return m_background; }
+
+        template <typename Point>
+        bool is_contained(const Point& p) const
+        {
+            BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+            return m_gridTraits.is_contained(p);
+        }
+
+        //! Reset the cell to the background value. Tiles are kept.
+        void erase(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            if (auto pCell = find_cell(i, j, k))
+                *pCell = m_background;
+        }
+
+        void clear() { m_tiles.clear(); }
+
+        std::size_t get_number_tiles() const { return m_tiles.size(); }
+
+        static tile_key get_tile_key(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k) { return tile_key(i >> tile_bits, j >> tile_bits, k >> tile_bits); }
+
+        //! Call visitor(i, j, k, data) for every cell in the allocated tiles (tiles in no particular order).
+        template <typename Visitor>
+        void for_each_cell(Visitor&& visitor) const
+        {
+            for (auto const& item : m_tiles)
+            {
+                auto const& tile = *item.second;
+                auto i0 = std::get<0>(item.first) << tile_bits;
+                auto j0 = std::get<1>(item.first) << tile_bits;
+                auto k0 = std::get<2>(item.first) << tile_bits;
+                auto imax = (std::min)(tile_size, m_gridTraits.get_width() - i0);
+                auto jmax = (std::min)(tile_size, m_gridTraits.get_height() - j0);
+                auto kmax = (std::min)(tile_size, m_gridTraits.get_depth() - k0);
+                for (boost::uint32_t a = 0; a < imax; ++a)
+                    for (boost::uint32_t b = 0; b < jmax; ++b)
+                        for (boost::uint32_t c = 0; c < kmax; ++c)
+                            visitor(i0 + a, j0 + b, k0 + c, tile[(((a << tile_bits) | b) << tile_bits) | c]);
+            }
+        }
+
+    private:
+
+        static std::size_t get_tile_offset(boost::uint32_t i, boost::uint32_t j, boost::uint32_t k)
+        {
+            return (((std::size_t(i & tile_mask) << tile_bits) | (j & tile_mask)) << tile_bits) | (k & tile_mask);
+        }
+
+        tile_type& get_unique_tile(std::shared_ptr<tile_type>& pTile)
+        {
+            if (pTile.use_count() > 1)
+                pTile = std::make_shared<tile_type>(*pTile);
+            return *pTile;
+        }
+
+        tile_type& get_tile(const tile_key& key)
+        {
+            auto iter = m_tiles.find(key);
+            if (iter != m_tiles.end())
+                return get_unique_tile(iter->second);
+
+            auto pTile = std::make_shared<tile_type>();
+            pTile->fill(m_background);
+            return *m_tiles.emplace_hint(iter, key, std::move(pTile))->second;
+        }
+
+        traits_type    m_gridTraits;
+        data_type      m_background;
+        directory_type m_tiles;
+
+    };
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_3d<Data, GridTraits, TileBits>::tile_bits;
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_3d<Data, GridTraits, TileBits>::tile_size;
+
+    template <typename Data, typename GridTraits, unsigned int TileBits>
+    const boost::uint32_t tiled_grid_3d<Data, GridTraits, TileBits>::tile_mask;
+
+    struct tiled_grid_3d_type_generator
+    {
+        template <typename Data, typename Traits>
+        using type = tiled_grid_3d<Data, Traits>;
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_TILED_GRID_3D_HPP
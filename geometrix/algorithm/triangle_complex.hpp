@@ -10,7 +10,16 @@
 
 #include <geometrix/utility/utilities.hpp>
 #include <geometrix/primitive/point_traits.hpp>
+#include <geometrix/arithmetic/vector.hpp>
+#include <geometrix/algorithm/orientation/point_segment_orientation.hpp>
+#include <geometrix/algorithm/point_in_circumcircle.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
 #include <boost/functional/hash.hpp>
+#include <array>
+#include <limits>
+#include <map>
+#include <stack>
+#include <tuple>
 #include <unordered_map>
 
 namespace geometrix {
@@ -34,7 +43,7 @@ namespace geometrix {
 
 		using vertex_handle = std::uint32_t;
 		using invalid_handle = std::integral_constant<vertex_handle, static_cast<vertex_handle>(-1)>;
-		using vertex_handle_map = std::map<Point, vertex_handle>;
+		using vertex_handle_map = std::map<Point, vertex_handle, point_compare>;
 		using vertex_point_map = std::vector<Point>;
 		using edge_key = std::tuple<vertex_handle, vertex_handle>;
 		using trig_key = std::tuple<vertex_handle, vertex_handle, vertex_handle>;
@@ -74,33 +83,108 @@ namespace geometrix {
 		{
 			auto u = get_vertex_handle(a);
 			auto v = get_vertex_handle(b);
-			auto it = m_edgeVertexMap.find(edge_key(u, v));
-			if (it != m_edgeVertexMap.end()) {
-				it->second.constrained = c;
-
-				it = m_edgeVertexMap.find(edge_key(v, u));
+			bool found = false;
+			for (auto key : { edge_key(u, v), edge_key(v, u) })
+			{
+				auto it = m_edgeVertexMap.find(key);
 				if (it != m_edgeVertexMap.end()) {
 					it->second.constrained = c;
-					return true;
+					found = true;
 				}
 			}
 
-			return false;
+			return found;
 		}
 
-		template <typename EncroachSegmentPredicate, typename TrianglePredicate>
-		void refine(const stk::units::angle& minAngle, EncroachSegmentPredicate&& is_encroached, TrianglePredicate&& is_bad)
+		//! Refine the complex until no triangle has an angle less than minAngle (in radians) or an area greater than maxArea
+		//! (Ruppert/Chew, see constrained_delaunay_triangulation::refine.) The region covered by the triangles is kept and the
+		//! constrained edges are split as needed. The boundary of the region becomes constrained. The triangles are replaced by
+		//! the refined constrained Delaunay triangulation of the region. Returns the number of Steiner points inserted.
+		std::size_t refine(double minAngle, double maxArea = (std::numeric_limits<double>::max)(), std::size_t maxSteinerPoints = (std::numeric_limits<std::size_t>::max)())
 		{
-			auto badSegs = get_encroaching_segments(std::forward<EncroachSegmentPredicate>(is_encroached));
-			split_encroaching_segments(badSegs);
+			using length_t = typename arithmetic_type_of<Point>::type;
+			using cdt_t = constrained_delaunay_triangulation<length_t>;
+			using cdt_point_t = typename cdt_t::point_type;
+
+			if (m_triangleMap.empty())
+				return 0;
 
-			std::deque<trig_key> badTrigs;
+			auto xmin = get<0>(m_points[std::get<0>(m_triangleMap.begin()->first)]), xmax = xmin;
+			auto ymin = get<1>(m_points[std::get<0>(m_triangleMap.begin()->first)]), ymax = ymin;
+			std::unordered_map<vertex_handle, typename cdt_t::vertex_handle> handles;
+			for (auto const& item : m_triangleMap)
+			{
+				for (auto const& p : item.second)
+				{
+					xmin = (std::min)(xmin, get<0>(p));
+					xmax = (std::max)(xmax, get<0>(p));
+					ymin = (std::min)(ymin, get<1>(p));
+					ymax = (std::max)(ymax, get<1>(p));
+				}
+			}
 
-			for(auto item : m_triangleMap)
+			cdt_t cdt(cdt_point_t(xmin, ymin), cdt_point_t(xmax, ymax));
+			auto get_handle = [&](vertex_handle v)
+			{
+				auto it = handles.find(v);
+				if (it == handles.end())
+					it = handles.emplace(v, cdt.insert_point(construct<cdt_point_t>(m_points[v]))).first;
+				return it->second;
+			};
+
+			//! The boundary selects the region and the interior constraints are added within it.
+			std::vector<std::pair<vertex_handle, vertex_handle>> constraints;
+			for (auto const& item : m_edgeVertexMap)
 			{
-				if (is_bad(item.first, item.second))
-					badTrigs.emplace_back(item.first);
+				vertex_handle u, v;
+				std::tie(u, v) = item.first;
+				auto hu = get_handle(u), hv = get_handle(v);
+				if (m_edgeVertexMap.find(edge_key(v, u)) == m_edgeVertexMap.end())
+					cdt.insert_constraint(hu, hv);
+				else if (item.second.constrained && u < v)
+					constraints.emplace_back(u, v);
 			}
+			cdt.mark_domain(delaunay_domain::even_odd);
+			for (auto const& e : constraints)
+				cdt.insert_constraint(handles[e.first], handles[e.second]);
+
+			auto nSteinerPoints = cdt.refine(minAngle, maxArea, maxSteinerPoints);
+
+			m_edgeVertexMap.clear();
+			m_triangleMap.clear();
+			cdt.for_each_triangle([&](typename cdt_t::vertex_handle a, typename cdt_t::vertex_handle b, typename cdt_t::vertex_handle c)
+			{
+				add_triangle(construct<Point>(cdt.get_vertex(a)), construct<Point>(cdt.get_vertex(b)), construct<Point>(cdt.get_vertex(c)));
+			});
+			cdt.for_each_constraint([&](typename cdt_t::vertex_handle a, typename cdt_t::vertex_handle b)
+			{
+				set_constraint(construct<Point>(cdt.get_vertex(a)), construct<Point>(cdt.get_vertex(b)), true);
+			});
+
+			return nSteinerPoints;
+		}
+
+		std::size_t get_number_triangles() const { return m_triangleMap.size(); }
+
+		//! Visit the CCW triangles as visitor(a, b, c).
+		template <typename Visitor>
+		void for_each_triangle(Visitor&& visitor) const
+		{
+			for (auto const& item : m_triangleMap)
+				visitor(item.second[0], item.second[1], item.second[2]);
+		}
+
+		//! True if the edge between a and b is constrained.
+		bool is_constrained(const Point& a, const Point& b) const
+		{
+			auto u = find_vertex_handle(a);
+			auto v = find_vertex_handle(b);
+			if (u == invalid_handle::value || v == invalid_handle::value)
+				return false;
+			auto x = adjacent(u, v);
+			if (x.opposite == invalid_handle::value)
+				x = adjacent(v, u);
+			return x.constrained;
 		}
 
 		/*
@@ -127,7 +211,7 @@ namespace geometrix {
             auto key = find_triangle_key(a, b, c);
 
             GEOMETRIX_ASSERT(is_valid(key));
-            GEOMETRIX_ASSERT(point_in_circumcircle(p, a, b, c, m_cmp) == point_circle_orientation::inside);
+            GEOMETRIX_ASSERT(point_in_circumcircle(a, b, c, p, m_cmp) == point_circle_orientation::inside);
 
             vertex_handle u = get_vertex_handle(p), v, w, x;
             std::tie(v,w,x) = key;
@@ -136,50 +220,19 @@ namespace geometrix {
 
     private:
 
-		template <typename EncroachSegmentPredicate>
-		std::deque<edge_key> get_encroaching_segments(EncroachSegmentPredicate&& is_encroached) const
-		{
-			std::deque<edge_key> badSegs;
-
-			for (auto item : m_edgeVertexMap) 
-			{
-				vertex_handle u, v;
-				std::tie(u, v) = item.first;
-				auto w = item.second.opposite;
-
-				if (is_encroached(m_points[w], m_points[u], m_points[v]))
-					badSegs.push_back(item.first);
-			}
-
-			return std::move(badSegs);
-		}
-
-		bool in_diametral_circle(Point const& p, Point const& o, Point const& d)
-		{
-			//! If the angle between OP and DP is obtuse, then P is inside the diametral circle of OD.
-			//! two vectors have obtuse angle if dot product is negative.
-			auto dp = dot_product(o - p, d - p);
-			return dp < constants::zero<decltype(dp)>();
-		}
-
-		//bool in_diametral_lens(Angle const& theta, Point const& o, Point const& d, const Point& p)
-		bool in_diametral_lens(Point const& p, Point const& o, Point const& d)
-		{
-			using std::cos;
-
-			static const stk::units::angle theta = 0.523599 * units::si::radians;
-
-			stk::vector2 op = o - p;
-			stk::vector2 dp = d - p;
-			auto dt = dot_product(op, dp);
-			auto cos_theta = cos(theta);
-			auto v2_cos_theta2_1 = 2.0 * cos_theta * cos_theta - 1.0;
-			return (dt * dt) >= (v2_cos_theta2_1 * v2_cos_theta2_1 * magnitude_sqrd(op) * magnitude_sqrd(dp));
-		}
+        //! The key of a CCW triangle starts with its lexicographically lowest vertex.
+        trig_key make_key(vertex_handle u, vertex_handle v, vertex_handle w) const
+        {
+            if (lexicographically_less_than(m_points[v], m_points[u], m_cmp) && lexicographically_less_than(m_points[v], m_points[w], m_cmp))
+                return trig_key(v, w, u);
+            if (lexicographically_less_than(m_points[w], m_points[u], m_cmp) && lexicographically_less_than(m_points[w], m_points[v], m_cmp))
+                return trig_key(w, u, v);
+            return trig_key(u, v, w);
+        }
 
         bool add_triangle(vertex_handle u, vertex_handle v, vertex_handle w)
         {
-            auto key = trig_key(u,v,w);
+            auto key = make_key(u,v,w);
             auto it = m_triangleMap.find(key);
             if(it == m_triangleMap.end())
             {
@@ -187,6 +240,7 @@ namespace geometrix {
                 m_edgeVertexMap[edge_key(v,w)] = u;
                 m_edgeVertexMap[edge_key(w,u)] = v;
 
+                std::tie(u, v, w) = key;
                 std::array<Point,3> trig = {m_points[u],m_points[v],m_points[w]};
                 m_triangleMap.emplace_hint(it, key, trig);
                 return true;
@@ -197,11 +251,7 @@ namespace geometrix {
 
         void delete_triangle(vertex_handle u, vertex_handle v, vertex_handle w, bool& uvConstrained, bool& vwConstrained, bool& wuConstrained)
         {
-            m_triangleMap.erase(trig_key(u,v,w));
-            m_edgeVertexMap.erase(edge_key(u,v));
-            m_edgeVertexMap.erase(edge_key(v,w));
-            m_edgeVertexMap.erase(edge_key(w,u));
-            m_triangleMap.erase(trig_key(u,v,w));
+            m_triangleMap.erase(make_key(u,v,w));
 
 			auto it = m_edgeVertexMap.find(edge_key(u,v));
 			if(it != m_edgeVertexMap.end())
@@ -337,27 +387,25 @@ namespace geometrix {
                 std::get<2>(key) != invalid_handle::value;
         }
 
+        //! Grow the cavity of u across the edge (v, w) or close it with the triangle (u, v, w).
         void dig_cavity(vertex_handle u, vertex_handle v, vertex_handle w, bool vwConstrained)
         {
             auto x = adjacent(w,v);
-            if(x.opposite != invalid_handle::value)
+            if(x.opposite != invalid_handle::value && !x.constrained && point_in_circumcircle(m_points[w], m_points[v], m_points[x.opposite], m_points[u], m_cmp) == point_circle_orientation::inside)
             {
-                if(!x.constrained && point_in_circumcircle(m_points[v], m_points[w], m_points[x], u, m_cmp) == point_circle_orientation::inside)
-                {
-					bool wvConstrained = false, vxConstrained = false, xwConstrained = false;
-                    delete_triangle(w,v,x, wvConstrained, vxConstrained, xwConstrained);
-                    dig_cavity(u,v,x, vxConstrained);
-                    dig_cavity(u,x,w, xwConstrained);
-                }
-				else 
-				{
-					add_triangle(u, v, w);
-					auto it = m_edgeVertexMap.find(edge_key(v, w));
-					GEOMETRIX_ASSERT(it != m_edgeVertexMap.end());
-					if (it != m_edgeVertexMap.end())
-						it->second.constrained = vwConstrained;
-				}
+				bool wvConstrained = false, vxConstrained = false, xwConstrained = false;
+                delete_triangle(w,v,x.opposite, wvConstrained, vxConstrained, xwConstrained);
+                dig_cavity(u,v,x.opposite, vxConstrained);
+                dig_cavity(u,x.opposite,w, xwConstrained);
             }
+			else 
+			{
+				add_triangle(u, v, w);
+				auto it = m_edgeVertexMap.find(edge_key(v, w));
+				GEOMETRIX_ASSERT(it != m_edgeVertexMap.end());
+				if (it != m_edgeVertexMap.end())
+					it->second.constrained = vwConstrained;
+			}
         }
 
         NumberComparisonPolicy            m_cmp;
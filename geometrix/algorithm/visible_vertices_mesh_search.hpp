@@ -104,7 +104,7 @@ namespace geometrix
 					if( fromIndices[0] == toIndices[i] || fromIndices[1] == toIndices[i] || fromIndices[2] == toIndices[i] )
 						continue;
 
-					const auto& point = m_mesh.get_triangle_vertices( item.to )[i];
+					const auto point = m_mesh.get_triangle_vertices( item.to )[i];
 					vector_t vPoint = point - m_origin;
 					if( is_vector_between( item.lo, item.hi, vPoint, true, cmp ) )
 						m_vertices.push_back( toIndices[i] );
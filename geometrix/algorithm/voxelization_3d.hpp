@@ -0,0 +1,122 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_ALGORITHM_VOXELIZATION_3D_HPP
+#define GEOMETRIX_ALGORITHM_VOXELIZATION_3D_HPP
+#pragma once
+
+#include <geometrix/algorithm/grid_traits_3d.hpp>
+#include <geometrix/algorithm/grid_concept.hpp>
+#include <geometrix/primitive/axis_aligned_bounding_box.hpp>
+#include <geometrix/primitive/sphere_traits.hpp>
+#include <geometrix/numeric/constants.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+//! Solid voxelization of primitives: the visitor is called as visitor(i, j, k) for every cell of the grid whose closed box,
+//! clipped to the bounds of the grid, intersects the primitive. The grid may be a grid_traits_3d or any grid modeling
+//! Grid3DConcept.
+namespace geometrix
+{
+    namespace detail
+    {
+        //! The index range [first, last] of the cells overlapping [low, high] along an axis, or false if there are none.
+        template <typename Coordinate>
+        inline bool get_voxel_index_range(const Coordinate& low, const Coordinate& high, const Coordinate& gridMin, const Coordinate& gridMax, const Coordinate& cellSize, boost::uint32_t n, boost::uint32_t& first, boost::uint32_t& last)
+        {
+            if (high < gridMin || gridMax < low)
+                return false;
+            first = (std::min)(static_cast<boost::uint32_t>(((std::max)(low, gridMin) - gridMin) / cellSize), n - 1);
+            last = (std::min)(static_cast<boost::uint32_t>(((std::min)(high, gridMax) - gridMin) / cellSize), n - 1);
+            return true;
+        }
+
+        //! The distance from x to the interval [low, high].
+        template <typename Coordinate>
+        inline Coordinate get_distance_to_interval(const Coordinate& x, const Coordinate& low, const Coordinate& high)
+        {
+            if (x < low)
+                return low - x;
+            if (high < x)
+                return x - high;
+            return constants::zero<Coordinate>();
+        }
+    }//! namespace detail;
+
+    template <typename GridOrTraits, typename Point, typename Visitor>
+    inline void voxelize_aabb(const GridOrTraits& gridOrTraits, const axis_aligned_bounding_box<Point>& box, Visitor&& visitor)
+    {
+        BOOST_CONCEPT_ASSERT((Point3DConcept<Point>));
+        auto const& grid = get_grid_traits(gridOrTraits);
+        auto const& low = box.get_lower_bound();
+        auto const& high = box.get_upper_bound();
+        auto cellSize = grid.get_cell_size();
+
+        boost::uint32_t i0, i1, j0, j1, k0, k1;
+        if (!detail::get_voxel_index_range(get<0>(low), get<0>(high), grid.get_min_x(), grid.get_max_x(), cellSize, grid.get_width(), i0, i1) ||
+            !detail::get_voxel_index_range(get<1>(low), get<1>(high), grid.get_min_y(), grid.get_max_y(), cellSize, grid.get_height(), j0, j1) ||
+            !detail::get_voxel_index_range(get<2>(low), get<2>(high), grid.get_min_z(), grid.get_max_z(), cellSize, grid.get_depth(), k0, k1))
+            return;
+
+        for (auto i = i0; i <= i1; ++i)
+            for (auto j = j0; j <= j1; ++j)
+                for (auto k = k0; k <= k1; ++k)
+                    visitor(i, j, k);
+    }
+
+    //! For each column (i, j) of cells crossing the sphere the range of k is solved directly from the part of the radius
+    //! left over by the distance to the column, so only the cells which intersect the sphere are visited.
+    template <typename GridOrTraits, typename Sphere, typename Visitor>
+    inline void voxelize_sphere(const GridOrTraits& gridOrTraits, const Sphere& sphere, Visitor&& visitor)
+    {
+        auto const& grid = get_grid_traits(gridOrTraits);
+        using traits_t = typename std::decay<decltype(grid)>::type;
+        using coordinate_t = typename traits_t::coordinate_type;
+        using dimensionless_t = typename traits_t::dimensionless_type;
+        using std::sqrt;
+
+        auto const& c = get_center(sphere);
+        coordinate_t r = get_radius(sphere);
+        coordinate_t cx = get<0>(c), cy = get<1>(c), cz = get<2>(c);
+        auto cellSize = grid.get_cell_size();
+
+        boost::uint32_t i0, i1, j0, j1, k0, k1;
+        if (!detail::get_voxel_index_range(cx - r, cx + r, grid.get_min_x(), grid.get_max_x(), cellSize, grid.get_width(), i0, i1) ||
+            !detail::get_voxel_index_range(cy - r, cy + r, grid.get_min_y(), grid.get_max_y(), cellSize, grid.get_height(), j0, j1))
+            return;
+
+        auto r2 = r * r;
+        for (auto i = i0; i <= i1; ++i)
+        {
+            coordinate_t x0 = grid.get_min_x() + construct<dimensionless_t>(i) * cellSize;
+            auto dx = detail::get_distance_to_interval(cx, x0, (std::min)(coordinate_t(x0 + cellSize), grid.get_max_x()));
+            for (auto j = j0; j <= j1; ++j)
+            {
+                coordinate_t y0 = grid.get_min_y() + construct<dimensionless_t>(j) * cellSize;
+                auto dy = detail::get_distance_to_interval(cy, y0, (std::min)(coordinate_t(y0 + cellSize), grid.get_max_y()));
+                auto h2 = r2 - dx * dx - dy * dy;
+                if (h2 < constants::zero<decltype(h2)>())
+                    continue;
+
+                coordinate_t h = sqrt(h2);
+                if (!detail::get_voxel_index_range(cz - h, cz + h, grid.get_min_z(), grid.get_max_z(), cellSize, grid.get_depth(), k0, k1))
+                    continue;
+
+                for (auto k = k0; k <= k1; ++k)
+                    visitor(i, j, k);
+            }
+        }
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_ALGORITHM_VOXELIZATION_3D_HPP
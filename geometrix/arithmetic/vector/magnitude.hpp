@@ -14,6 +14,7 @@
 #include <geometrix/algebra/dot_product.hpp>
 #include <geometrix/arithmetic/vector/vector_arithmetic.hpp>
 #include <geometrix/arithmetic/arithmetic.hpp>
+#include <geometrix/tensor/contiguous_sequence.hpp>
 
 #include <boost/fusion/include/mpl.hpp>
 
@@ -113,6 +114,21 @@ namespace geometrix {
             }
         };        
 
+        template <typename Vector>
+        inline typename result_of::magnitude_sqrd<Vector>::type magnitude_sqrd_dispatch( const Vector& v, std::false_type )
+        {
+            return magnitude_sqrd<Vector,dimension_of<Vector>::value-1>::eval(v);
+        }
+
+        //! The contiguous kernel sums in the same order as the unrolled cases above (up to 4 dimensions).
+        template <typename Vector>
+        inline typename result_of::magnitude_sqrd<Vector>::type magnitude_sqrd_dispatch( const Vector& v, std::true_type )
+        {
+            using value_t = contiguous_sequence_value<Vector>;
+            auto p = contiguous_sequence_kernels::data( v );
+            return contiguous_sequence_kernels::dot<typename value_t::type, value_t::dimension>( p, p );
+        }
+
     }//namespace detail;
 
     //! \brief Return the sqrd magnitude of a vector.
@@ -120,7 +136,8 @@ namespace geometrix {
     inline typename result_of::magnitude_sqrd<Vector>::type magnitude_sqrd( const Vector& v )
     {
         BOOST_CONCEPT_ASSERT(( VectorConcept<Vector> ));
-        return detail::magnitude_sqrd<Vector,dimension_of<Vector>::value-1>::eval(v);
+        using is_fast = std::integral_constant<bool, is_contiguous_sequence<Vector>::value && dimension_of<Vector>::value <= 4>;
+        return detail::magnitude_sqrd_dispatch( v, is_fast() );
     }
 
     //! \brief Return the magnitude of a vector.
@@ -14,6 +14,7 @@
 #include <geometrix/tensor/vector.hpp>
 #include <geometrix/numeric/constants.hpp>
 #include <geometrix/utility/ignore_unused_warnings.hpp>
+#include <geometrix/tensor/contiguous_sequence.hpp>
 
 #include <boost/fusion/include/mpl.hpp>
 
@@ -29,6 +30,30 @@ namespace geometrix {
 			using type = vector<typename geometric_traits<Vector>::dimensionless_type, dimension_of<Vector>::value>;
 		};
     }//namespace result_of;
+
+    namespace detail
+    {
+        template <typename Vector>
+        inline typename result_of::normalize<Vector>::type normalize( const Vector& v, std::false_type )
+        {
+            using dimensionless_type = typename geometric_traits<Vector>::dimensionless_type;
+            auto factor = constants::one<dimensionless_type>() / magnitude( v );
+            return v * factor;
+        }
+
+        //! Scale the coordinates directly rather than constructing the result from the expression v * factor.
+        template <typename Vector>
+        inline typename result_of::normalize<Vector>::type normalize( const Vector& v, std::true_type )
+        {
+            using dimensionless_type = typename geometric_traits<Vector>::dimensionless_type;
+            auto factor = constants::one<dimensionless_type>() / magnitude( v );
+            typename result_of::normalize<Vector>::type result;
+            auto p = contiguous_sequence_kernels::data( v );
+            for( std::size_t i = 0; i < dimension_of<Vector>::value; ++i )
+                result[i] = p[i] * factor;
+            return result;
+        }
+    }//namespace detail;
     
     //! \brief Normalize a vector (returns a new unit vector with the same orientation as the original).
     template <typename Vector>
@@ -36,12 +61,10 @@ namespace geometrix {
     {
         BOOST_CONCEPT_ASSERT(( VectorConcept<Vector> ));
 		using scalar = decltype(magnitude(std::declval<Vector>()));
-		using dimensionless_type = typename geometric_traits<Vector>::dimensionless_type;
 
 		ignore_unused_warning_of<scalar>();
 		GEOMETRIX_ASSERT(magnitude(v) != constants::zero<scalar>());
-		auto factor = constants::one<dimensionless_type>() / magnitude( v );
-		return v * factor;
+		return detail::normalize( v, typename is_contiguous_sequence<Vector>::type() );
     }
         
 }//namespace geometrix;
@@ -0,0 +1,191 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_EXPANSION_ARITHMETIC_HPP
+#define GEOMETRIX_EXPANSION_ARITHMETIC_HPP
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+namespace geometrix {
+
+    //! Error free transformations of IEEE double arithmetic (round to nearest) after Shewchuk, "Adaptive Precision Floating-Point
+    //! Arithmetic and Fast Robust Geometric Predicates" (the routines in predicates.hpp). Each computes the rounded result x and the
+    //! exact roundoff y such that x + y is the exact result.
+    namespace expansion_detail {
+
+        inline void two_sum(double a, double b, double& x, double& y)
+        {
+            x = a + b;
+            double bv = x - a;
+            double av = x - bv;
+            y = (a - av) + (b - bv);
+        }
+
+        //! Requires |a| >= |b|.
+        inline void fast_two_sum(double a, double b, double& x, double& y)
+        {
+            x = a + b;
+            y = b - (x - a);
+        }
+
+        inline void two_product(double a, double b, double& x, double& y)
+        {
+            x = a * b;
+            y = std::fma(a, b, -x);
+        }
+
+    }//! namespace expansion_detail;
+
+    //! \brief An exact sum of doubles represented as a nonoverlapping sequence of components in increasing order of magnitude.
+
+    //! Sums, differences and products of expansions are exact (barring overflow and underflow). The sign of the expansion is
+    //! the sign of its largest component, which makes expansions suitable as the exact fallback stage of filtered predicates.
+    class expansion
+    {
+    public:
+
+        expansion() = default;
+
+        expansion(double a)
+        {
+            if (a != 0.0)
+                m_terms.push_back(a);
+        }
+
+        //! The exact difference a - b.
+        static expansion difference(double a, double b)
+        {
+            double x, y;
+            expansion_detail::two_sum(a, -b, x, y);
+            return expansion(y, x);
+        }
+
+        //! The exact product a * b.
+        static expansion product(double a, double b)
+        {
+            double x, y;
+            expansion_detail::two_product(a, b, x, y);
+            return expansion(y, x);
+        }
+
+        int sign() const
+        {
+            return m_terms.empty() ? 0 : (m_terms.back() > 0.0 ? 1 : -1);
+        }
+
+        //! An approximation of the value.
+        double estimate() const
+        {
+            double r = 0.0;
+            for (double t : m_terms)
+                r += t;
+            return r;
+        }
+
+        std::size_t size() const { return m_terms.size(); }
+        const std::vector<double>& terms() const { return m_terms; }
+
+        expansion operator -() const
+        {
+            expansion r(*this);
+            for (double& t : r.m_terms)
+                t = -t;
+            return r;
+        }
+
+        friend expansion operator +(const expansion& e, const expansion& f)
+        {
+            if (e.m_terms.size() < f.m_terms.size())
+                return f + e;
+
+            expansion r(e);
+            for (double b : f.m_terms)
+                r.grow(b);
+            return r;
+        }
+
+        friend expansion operator -(const expansion& e, const expansion& f)
+        {
+            return e + (-f);
+        }
+
+        friend expansion operator *(const expansion& e, const expansion& f)
+        {
+            if (e.m_terms.size() < f.m_terms.size())
+                return f * e;
+
+            expansion r;
+            for (double b : f.m_terms)
+                r = r + e.scale(b);
+            return r;
+        }
+
+    private:
+
+        //! Build from a two component result (low, high).
+        expansion(double low, double high)
+        {
+            if (low != 0.0)
+                m_terms.push_back(low);
+            if (high != 0.0)
+                m_terms.push_back(high);
+        }
+
+        //! Add a double to the expansion eliminating zero components (grow_expansion_zeroelim).
+        void grow(double b)
+        {
+            std::size_t n = 0;
+            double q = b;
+            for (double e : m_terms)
+            {
+                double h;
+                expansion_detail::two_sum(q, e, q, h);
+                if (h != 0.0)
+                    m_terms[n++] = h;
+            }
+            m_terms.resize(n);
+            if (q != 0.0)
+                m_terms.push_back(q);
+        }
+
+        //! Multiply the expansion by a double (scale_expansion_zeroelim).
+        expansion scale(double b) const
+        {
+            expansion r;
+            if (m_terms.empty() || b == 0.0)
+                return r;
+
+            r.m_terms.reserve(2 * m_terms.size());
+            double q, h;
+            expansion_detail::two_product(m_terms[0], b, q, h);
+            if (h != 0.0)
+                r.m_terms.push_back(h);
+            for (std::size_t i = 1; i < m_terms.size(); ++i)
+            {
+                double p1, p0, sum;
+                expansion_detail::two_product(m_terms[i], b, p1, p0);
+                expansion_detail::two_sum(q, p0, sum, h);
+                if (h != 0.0)
+                    r.m_terms.push_back(h);
+                expansion_detail::fast_two_sum(p1, sum, q, h);
+                if (h != 0.0)
+                    r.m_terms.push_back(h);
+            }
+            if (q != 0.0)
+                r.m_terms.push_back(q);
+            return r;
+        }
+
+        std::vector<double> m_terms;
+    };
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_EXPANSION_ARITHMETIC_HPP
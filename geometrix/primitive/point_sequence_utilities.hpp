@@ -11,6 +11,7 @@
 #pragma once
 
 #include <geometrix/primitive/point_sequence_traits.hpp>
+#include <geometrix/primitive/segment_range_view.hpp>
 #include <geometrix/algebra/exterior_product.hpp>
 #include <geometrix/tensor/numeric_sequence_compare.hpp>
 
@@ -434,32 +435,20 @@ namespace geometrix {
         return !(exterior_product_area( point - prevPoint, nextPoint - prevPoint ) > constants::zero<area_t>());
     }
 
+    //! Copy the edges of a polygon into a vector. Use polygon_segment_view to read them without copying.
     template <typename Segment, typename Polygon>
     inline std::vector< Segment > polygon_as_segment_range(const Polygon& p)
     {
-        typedef point_sequence_traits< Polygon > access;
-        std::vector< Segment > segments;
-        std::size_t size = access::size(p);
-        for (std::size_t i = 0, j = 1; i < size; ++i, j = (j + 1) % size) {
-            Segment segment = construction_policy< Segment >::construct(access::get_point(p, i), access::get_point(p, j));
-            segments.push_back(segment);
-        }
-
-        return std::move(segments);
+        auto view = make_polygon_segment_view<Segment>(p);
+        return std::vector< Segment >(view.begin(), view.end());
     }
 
+    //! Copy the edges of a polyline into a vector. Use polyline_segment_view to read them without copying.
     template <typename Segment, typename Polyline>
     inline std::vector< Segment > polyline_as_segment_range(const Polyline& p)
     {
-        typedef point_sequence_traits< Polyline > access;
-        std::vector< Segment > segments;
-        std::size_t size = access::size(p);
-        for (std::size_t i = 0, j = 1; j < size; i = j++) {
-            Segment segment = construction_policy< Segment >::construct(access::get_point(p, i), access::get_point(p, j));
-            segments.push_back(segment);
-        }
-
-        return std::move(segments);
+        auto view = make_polyline_segment_view<Segment>(p);
+        return std::vector< Segment >(view.begin(), view.end());
     }
 
     template <typename PointSequence1, typename PointSequence2, typename NumberComparisonPolicy>
@@ -0,0 +1,294 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_PRIMITIVE_SEGMENT_RANGE_VIEW_HPP
+#define GEOMETRIX_PRIMITIVE_SEGMENT_RANGE_VIEW_HPP
+#pragma once
+
+#include <geometrix/primitive/point_sequence_traits.hpp>
+#include <geometrix/primitive/polygon_with_holes.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/utility/assert.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+//! Random access ranges of the edges of point sequences which build each segment on access rather than copying the
+//! edges into a container. The views hold a pointer to the geometry, which must outlive them, and yield Segment by value,
+//! so they can be passed wherever a random access range of segments is read (the BSP tree constructors,
+//! all_segment_intersections etc.)
+namespace geometrix {
+
+    namespace segment_view_detail {
+
+        //! A random access iterator over a view which exposes a cursor type and dereference, advance and get_index for it.
+        template <typename View>
+        class segment_view_iterator
+        {
+            using cursor_type = typename View::cursor_type;
+
+        public:
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename View::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            segment_view_iterator() = default;
+            segment_view_iterator(const View* view, const cursor_type& cursor)
+                : m_view(view)
+                , m_cursor(cursor)
+            {}
+
+            reference operator*() const { return m_view->dereference(m_cursor); }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
+            segment_view_iterator& operator++() { m_view->advance(m_cursor, 1); return *this; }
+            segment_view_iterator& operator--() { m_view->advance(m_cursor, -1); return *this; }
+            segment_view_iterator operator++(int) { auto it = *this; ++*this; return it; }
+            segment_view_iterator operator--(int) { auto it = *this; --*this; return it; }
+            segment_view_iterator& operator+=(difference_type n) { m_view->advance(m_cursor, n); return *this; }
+            segment_view_iterator& operator-=(difference_type n) { m_view->advance(m_cursor, -n); return *this; }
+            friend segment_view_iterator operator+(segment_view_iterator it, difference_type n) { return it += n; }
+            friend segment_view_iterator operator+(difference_type n, segment_view_iterator it) { return it += n; }
+            friend segment_view_iterator operator-(segment_view_iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return static_cast<difference_type>(lhs.get_index()) - static_cast<difference_type>(rhs.get_index()); }
+
+            friend bool operator==(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return lhs.get_index() == rhs.get_index(); }
+            friend bool operator!=(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return lhs.get_index() != rhs.get_index(); }
+            friend bool operator<(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return lhs.get_index() < rhs.get_index(); }
+            friend bool operator>(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return rhs < lhs; }
+            friend bool operator<=(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return !(rhs < lhs); }
+            friend bool operator>=(const segment_view_iterator& lhs, const segment_view_iterator& rhs) { return !(lhs < rhs); }
+
+        private:
+
+            std::size_t get_index() const { return View::get_index(m_cursor); }
+
+            const View* m_view{ nullptr };
+            cursor_type m_cursor{};
+
+        };
+
+    }//! namespace segment_view_detail;
+
+    //! \brief A view of the edges of a point sequence as segments.
+
+    //! Edge i runs from point i to point i + 1. When Closed the last edge runs from the last point back to the first (a
+    //! polygon), otherwise the sequence is open (a polyline.)
+    template <typename PointSequence, typename Segment, bool Closed>
+    class point_sequence_segment_view
+    {
+        BOOST_CONCEPT_ASSERT((PointSequenceConcept<PointSequence>));
+        using access = point_sequence_traits<PointSequence>;
+        friend class segment_view_detail::segment_view_iterator<point_sequence_segment_view>;
+        using cursor_type = std::size_t;
+
+    public:
+
+        using value_type = Segment;
+        using reference = Segment;
+        using const_reference = Segment;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = segment_view_detail::segment_view_iterator<point_sequence_segment_view>;
+        using const_iterator = iterator;
+
+        explicit point_sequence_segment_view(const PointSequence& points)
+            : m_points(&points)
+        {}
+
+        std::size_t size() const
+        {
+            auto n = access::size(*m_points);
+            return n < 2 ? 0 : (Closed ? n : n - 1);
+        }
+
+        bool empty() const { return size() == 0; }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size()); }
+
+        Segment operator[](std::size_t i) const
+        {
+            GEOMETRIX_ASSERT(i < size());
+            auto j = i + 1;
+            if (Closed && j == access::size(*m_points))
+                j = 0;
+            return construct<Segment>(access::get_point(*m_points, i), access::get_point(*m_points, j));
+        }
+
+        Segment front() const { return (*this)[0]; }
+        Segment back() const { return (*this)[size() - 1]; }
+
+    private:
+
+        Segment dereference(std::size_t i) const { return (*this)[i]; }
+        void advance(std::size_t& i, std::ptrdiff_t n) const { i = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(i) + n); }
+        static std::size_t get_index(std::size_t i) { return i; }
+
+        const PointSequence* m_points;
+
+    };
+
+    template <typename Polygon, typename Segment = segment<typename point_sequence_traits<Polygon>::point_type>>
+    using polygon_segment_view = point_sequence_segment_view<Polygon, Segment, true>;
+
+    template <typename Polyline, typename Segment = segment<typename point_sequence_traits<Polyline>::point_type>>
+    using polyline_segment_view = point_sequence_segment_view<Polyline, Segment, false>;
+
+    template <typename Segment, typename Polygon>
+    inline polygon_segment_view<Polygon, Segment> make_polygon_segment_view(const Polygon& p)
+    {
+        return polygon_segment_view<Polygon, Segment>(p);
+    }
+
+    template <typename Segment, typename Polyline>
+    inline polyline_segment_view<Polyline, Segment> make_polyline_segment_view(const Polyline& p)
+    {
+        return polyline_segment_view<Polyline, Segment>(p);
+    }
+
+    //! \brief A view of the edges of the outer boundary followed by the edges of each hole of a polygon_with_holes.
+
+    //! Iterators track the boundary they are on so walking the view is constant time per segment. Indexing walks the
+    //! boundaries and is linear in the number of holes.
+    template <typename PolygonWithHoles, typename Segment = segment<typename PolygonWithHoles::point_type>>
+    class polygon_with_holes_segment_view
+    {
+        using polygon_type = typename PolygonWithHoles::polygon_type;
+        using access = point_sequence_traits<polygon_type>;
+        friend class segment_view_detail::segment_view_iterator<polygon_with_holes_segment_view>;
+
+        //! The boundary (0 is the outer, h + 1 is hole h), the edge on the boundary and the index in the view.
+        struct cursor_type
+        {
+            std::size_t boundary;
+            std::size_t edge;
+            std::size_t index;
+        };
+
+    public:
+
+        using value_type = Segment;
+        using reference = Segment;
+        using const_reference = Segment;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = segment_view_detail::segment_view_iterator<polygon_with_holes_segment_view>;
+        using const_iterator = iterator;
+
+        explicit polygon_with_holes_segment_view(const PolygonWithHoles& p)
+            : m_polygon(&p)
+        {}
+
+        std::size_t size() const
+        {
+            std::size_t n = get_boundary_size(0);
+            for (std::size_t h = 0, nHoles = m_polygon->get_holes().size(); h < nHoles; ++h)
+                n += get_boundary_size(h + 1);
+            return n;
+        }
+
+        bool empty() const { return size() == 0; }
+
+        const_iterator begin() const
+        {
+            cursor_type c{ 0, 0, 0 };
+            skip_empty(c);
+            return const_iterator(this, c);
+        }
+
+        const_iterator end() const { return const_iterator(this, cursor_type{ get_number_boundaries(), 0, size() }); }
+
+        Segment operator[](std::size_t i) const { return *(begin() + static_cast<std::ptrdiff_t>(i)); }
+
+    private:
+
+        std::size_t get_number_boundaries() const { return m_polygon->get_holes().size() + 1; }
+
+        const polygon_type& get_boundary(std::size_t b) const { return b == 0 ? m_polygon->get_outer() : m_polygon->get_holes()[b - 1]; }
+
+        std::size_t get_boundary_size(std::size_t b) const
+        {
+            auto n = access::size(get_boundary(b));
+            return n < 2 ? 0 : n;
+        }
+
+        //! Move a cursor at the end of its boundary to the start of the next boundary with edges.
+        void skip_empty(cursor_type& c) const
+        {
+            auto nBoundaries = get_number_boundaries();
+            while (c.boundary < nBoundaries && c.edge >= get_boundary_size(c.boundary))
+            {
+                c.edge = 0;
+                ++c.boundary;
+            }
+        }
+
+        Segment dereference(const cursor_type& c) const
+        {
+            auto const& boundary = get_boundary(c.boundary);
+            auto j = c.edge + 1 == access::size(boundary) ? 0 : c.edge + 1;
+            return construct<Segment>(access::get_point(boundary, c.edge), access::get_point(boundary, j));
+        }
+
+        void advance(cursor_type& c, std::ptrdiff_t n) const
+        {
+            c.index = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(c.index) + n);
+            for (; n > 0; )
+            {
+                auto remaining = get_boundary_size(c.boundary) - c.edge;
+                if (static_cast<std::size_t>(n) < remaining)
+                {
+                    c.edge += n;
+                    return;
+                }
+                n -= static_cast<std::ptrdiff_t>(remaining);
+                c.edge = get_boundary_size(c.boundary);
+                skip_empty(c);
+                if (c.boundary == get_number_boundaries())
+                {
+                    GEOMETRIX_ASSERT(n == 0);
+                    return;
+                }
+            }
+
+            for (; n < 0; )
+            {
+                if (static_cast<std::size_t>(-n) <= c.edge)
+                {
+                    c.edge -= static_cast<std::size_t>(-n);
+                    return;
+                }
+                n += static_cast<std::ptrdiff_t>(c.edge);
+                GEOMETRIX_ASSERT(c.boundary > 0);
+                do
+                {
+                    --c.boundary;
+                } while (get_boundary_size(c.boundary) == 0);
+                c.edge = get_boundary_size(c.boundary);
+            }
+        }
+
+        static std::size_t get_index(const cursor_type& c) { return c.index; }
+
+        const PolygonWithHoles* m_polygon;
+
+    };
+
+    template <typename Segment, typename Point, typename Allocator>
+    inline polygon_with_holes_segment_view<polygon_with_holes<Point, Allocator>, Segment> make_polygon_with_holes_segment_view(const polygon_with_holes<Point, Allocator>& p)
+    {
+        return polygon_with_holes_segment_view<polygon_with_holes<Point, Allocator>, Segment>(p);
+    }
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_PRIMITIVE_SEGMENT_RANGE_VIEW_HPP
@@ -28,18 +28,18 @@ public:
 
     triangle(const std::array<Point, 3>& a)
         : std::array<Point, 3>(a)
-    {}
+    {
+        static_assert(sizeof(triangle<Point>) == 3 * sizeof(Point), "Triangle should be the size of 3 points.");
+    }
 
-    template <typename Point1, typename Point2, typename Point3, typename Point4>
-    triangle(const Point1& p1, const Point2& p2, const Point3& p3, const Point4& p4)
-        : triangle(array_type{ {construct<Point>(p1), construct<Point>(p2), construct<Point>(p3), construct<Point>(p4)} })
+    template <typename Point1, typename Point2, typename Point3>
+    triangle(const Point1& p1, const Point2& p2, const Point3& p3)
+        : triangle(array_type{ {construct<Point>(p1), construct<Point>(p2), construct<Point>(p3)} })
     {}
 
     typedef Point                                                  point_type;
     typedef typename dimension_of< point_type >::type              dimension_type;
     typedef typename geometric_traits<point_type>::arithmetic_type arithmetic_type;
-
-    static_assert(sizeof(triangle<Point>) == 3 * sizeof(Point), "Triangle should be the size of 3 points.");
 };
 
 template <typename Point>
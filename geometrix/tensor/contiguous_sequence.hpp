@@ -0,0 +1,135 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_TENSOR_CONTIGUOUS_SEQUENCE_HPP
+#define GEOMETRIX_TENSOR_CONTIGUOUS_SEQUENCE_HPP
+#pragma once
+
+//! The forward declaration headers use std::size_t without including <cstddef>.
+#include <cstddef>
+#include <type_traits>
+
+#include <geometrix/primitive/point_forward.hpp>
+#include <geometrix/tensor/vector_forward.hpp>
+
+namespace geometrix {
+
+    template <typename NumericType, std::size_t D>
+    class numeric_sequence;
+
+    //! \brief Detect the sequences whose coordinates are D contiguous floats or doubles.
+
+    //! The built in numeric_sequence, point and vector types store their coordinates in a plain array. For these the algebra
+    //! functions (dot_product, magnitude, normalize, exterior_product_area, orientation) bypass the expression template and
+    //! fusion machinery and evaluate with the kernels in contiguous_sequence_kernels, which the compiler always inlines into
+    //! tight loops. The kernels evaluate in the same order as the generic code so the results are identical.
+    template <typename Sequence>
+    struct is_contiguous_sequence : std::false_type {};
+
+    template <typename T, std::size_t D>
+    struct is_contiguous_sequence<numeric_sequence<T, D>> : std::integral_constant<bool, std::is_same<T, double>::value || std::is_same<T, float>::value> {};
+
+    template <typename T, std::size_t D>
+    struct is_contiguous_sequence<point<T, D>> : is_contiguous_sequence<numeric_sequence<T, D>> {};
+
+    template <typename T, std::size_t D>
+    struct is_contiguous_sequence<vector<T, D>> : is_contiguous_sequence<numeric_sequence<T, D>> {};
+
+    template <typename Sequence>
+    struct is_contiguous_sequence<const Sequence> : is_contiguous_sequence<Sequence> {};
+
+    template <typename Sequence>
+    struct contiguous_sequence_value {};
+
+    template <typename T, std::size_t D>
+    struct contiguous_sequence_value<numeric_sequence<T, D>> { using type = T; static const std::size_t dimension = D; };
+
+    template <typename T, std::size_t D>
+    struct contiguous_sequence_value<point<T, D>> : contiguous_sequence_value<numeric_sequence<T, D>> {};
+
+    template <typename T, std::size_t D>
+    struct contiguous_sequence_value<vector<T, D>> : contiguous_sequence_value<numeric_sequence<T, D>> {};
+
+    namespace detail {
+        //! The value type and dimension are only looked up once both sequences are known to be contiguous.
+        template <bool BothContiguous, typename Sequence1, typename Sequence2>
+        struct same_contiguous_layout : std::false_type {};
+
+        template <typename Sequence1, typename Sequence2>
+        struct same_contiguous_layout<true, Sequence1, Sequence2>
+            : std::integral_constant
+              <
+                  bool
+                , std::is_same<typename contiguous_sequence_value<Sequence1>::type, typename contiguous_sequence_value<Sequence2>::type>::value
+               && contiguous_sequence_value<Sequence1>::dimension == contiguous_sequence_value<Sequence2>::dimension
+              >
+        {};
+    }//! namespace detail;
+
+    //! True when all the sequences are contiguous with the same value type and dimension.
+    template <typename Sequence, typename... Sequences>
+    struct are_contiguous_sequences : is_contiguous_sequence<typename std::decay<Sequence>::type> {};
+
+    template <typename Sequence1, typename Sequence2, typename... Sequences>
+    struct are_contiguous_sequences<Sequence1, Sequence2, Sequences...>
+        : std::integral_constant
+          <
+              bool
+            , detail::same_contiguous_layout
+              <
+                  is_contiguous_sequence<typename std::decay<Sequence1>::type>::value && is_contiguous_sequence<typename std::decay<Sequence2>::type>::value
+                , typename std::decay<Sequence1>::type
+                , typename std::decay<Sequence2>::type
+              >::value
+           && are_contiguous_sequences<Sequence2, Sequences...>::value
+          >
+    {};
+
+    namespace contiguous_sequence_kernels {
+
+        //! ((a0 * b0 + a1 * b1) + a2 * b2) ...
+        template <typename T, std::size_t D>
+        constexpr T dot(const T* a, const T* b)
+        {
+            T r = a[0] * b[0];
+            for (std::size_t i = 1; i < D; ++i)
+                r += a[i] * b[i];
+            return r;
+        }
+
+        template <typename T>
+        constexpr T exterior_product_area(const T* a, const T* b)
+        {
+            return a[0] * b[1] - a[1] * b[0];
+        }
+
+        template <typename T>
+        constexpr void cross_product(const T* a, const T* b, T* r)
+        {
+            r[0] = a[1] * b[2] - a[2] * b[1];
+            r[1] = a[2] * b[0] - a[0] * b[2];
+            r[2] = a[0] * b[1] - a[1] * b[0];
+        }
+
+        template <typename Sequence>
+        inline const typename contiguous_sequence_value<Sequence>::type* data(const Sequence& s)
+        {
+            return &s[0];
+        }
+
+        template <typename Sequence>
+        inline typename contiguous_sequence_value<Sequence>::type* data(Sequence& s)
+        {
+            return &s[0];
+        }
+
+    }//! namespace contiguous_sequence_kernels;
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_TENSOR_CONTIGUOUS_SEQUENCE_HPP
@@ -1,32 +1,4 @@
 //
-//! Copyright  2008-2011
-//! Brandon Kohn
-//
-//  Distributed under the Boost Software License, Version 1.0. (See
-//  accompanying file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt)
-//
-#if !defined( GEOMETRIX_COMPOSITION_MAX_ROWS )
-	#define GEOMETRIX_COMPOSITION_MAX_ROWS 10
-#endif            
-
-#if !defined(GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY)
-	#define GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY 10
-#endif
-
-#include <geometrix/utility/preprocessor.hpp>
-
-#if !defined(GEOMETRIX_DONT_USE_PREPROCESSED_FILES)
-	#if !defined(GEOMETRIX_COMPOSE_MATRIX_DETAILS_HPP)
-		#define GEOMETRIX_COMPOSE_MATRIX_DETAILS_HPP
-        #include <geometrix/tensor/detail/preprocessed/as_matrix.hpp>
-	#endif
-#else
-	#if !defined(BOOST_PP_IS_ITERATING)	
-		#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-			#pragma wave option(preserve: 2, line: 0, output: "preprocessed/as_matrix.hpp")
-		#endif
-//
 //! Copyright  2008-2013
 //! Brandon Kohn
 //
@@ -34,11 +6,20 @@
 //  accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 //
+#if !defined(GEOMETRIX_COMPOSE_MATRIX_DETAILS_HPP)
+#define GEOMETRIX_COMPOSE_MATRIX_DETAILS_HPP
+
+#include <limits>
+
 namespace geometrix { 
             
     template <typename Sequence, std::size_t Rows, std::size_t Columns>
     struct composite_matrix;
 
+    //! The types of the sub matrices from which a composite_matrix is composed (any number of them.)
+    template <typename... A>
+    struct composite_sequence {};
+
     namespace result_of { namespace detail {
 
         template <std::size_t Min, std::size_t Max>
@@ -65,6 +46,9 @@ namespace geometrix {
               >
         {};
 
+        //! A row index past any row of a composition. It bounds the start of the next row before any item in the current row does.
+        struct unbounded_row : boost::mpl::int_<(std::numeric_limits<int>::max)() / 2> {};
+
         template <typename Item, std::size_t RowOffset, std::size_t ColumnOffset, typename Index, typename RowItem = void>
         struct compose_element
         {
@@ -86,7 +70,7 @@ namespace geometrix {
           , typename Row = boost::mpl::vector<>                  
           , typename LastRow = boost::mpl::vector<> 
           , std::size_t Index = 0
-          , std::size_t NextRow = RowIndex + GEOMETRIX_COMPOSITION_MAX_ROWS//! Set this to an effective infinitiy by default (new rows)
+          , std::size_t NextRow = RowIndex + unbounded_row::value//! Set this to an effective infinitiy by default (new rows)
         >
         struct state
         {
@@ -108,7 +92,7 @@ namespace geometrix {
           , std::size_t ColIndex = 0                  
           , typename Row = boost::mpl::vector<>                  
           , std::size_t Index = 0
-          , std::size_t NextRow = GEOMETRIX_COMPOSITION_MAX_ROWS//! Set this to an effective infinitiy by default (new rows)
+          , std::size_t NextRow = unbounded_row::value//! Set this to an effective infinitiy by default (new rows)
         >
         struct first_state
             : state<Sequence, TransformedSequence, 0, ColIndex, boost::mpl::void_, Row, boost::mpl::vector<>, Index, NextRow>
@@ -401,77 +385,38 @@ namespace geometrix {
             template <typename Sig>
             struct result{};
 
-            #define BOOST_PP_LOCAL_MACRO(n)                              \
-            template <typename This, BOOST_PP_ENUM_PARAMS(n,typename A)> \
-            struct result<This(BOOST_PP_ENUM_PARAMS(n,A))>               \
-            {                                                            \
-                typedef composite_matrix                                 \
-                <                                                        \
-                    boost::mpl::vector<BOOST_PP_ENUM_PARAMS(n,A)>        \
-                  , Rows                                                 \
-                  , Columns                                              \
-                > type;                                                  \
-            };                                                           \
-            /***/
-
-    #if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-        #pragma wave option(preserve: 1)
-    #endif
-
-            #define BOOST_PP_LOCAL_LIMITS (2, GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY)
-            #include BOOST_PP_LOCAL_ITERATE()
-
-            
-    //#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-    //    #pragma wave option(preserve: 2)
-    //#endif
-
+            template <typename This, typename A0, typename A1, typename... A>
+            struct result<This(A0, A1, A...)>
+            {
+                typedef composite_matrix
+                <
+                    composite_sequence<A0, A1, A...>
+                  , Rows
+                  , Columns
+                > type;
+            };
         };
 
-        #define GEOMETRIX_NARY_ARGS_ENABLE_IF_(z, n, data) \
-            typename BOOST_PP_CAT(A,n) = void              \
-        /***/
-
-        template 
-            <
-                std::size_t Rows
-              , std::size_t Columns
-              , BOOST_PP_ENUM
-                (
-                    GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY
-                  , GEOMETRIX_NARY_ARGS_ENABLE_IF_
-                  , _
-                )
-              , typename EnableIf=void
-            >
-        struct as_matrix{};
-
-        #undef GEOMETRIX_NARY_ARGS_ENABLE_IF_
+        template <std::size_t Rows, std::size_t Columns, typename... A>
+        struct as_matrix
+            : boost::result_of
+              <
+                  result_of::compose_matrix_helper<Rows,Columns>
+                  (
+                      A...
+                  )
+              >
+        {};
 
     }//namespace result_of;
 
-    
-    #define GEOMETRIX_NARY_HOMOGENEOUS_ENABLE_IF_(z, n, data) \
-        typename BOOST_PP_CAT(IsHomogeneous,n) = void         \
-    /***/
-
-    template 
-        <
-            typename Sequence
-          , BOOST_PP_ENUM
-            (
-                GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY
-              , GEOMETRIX_NARY_HOMOGENEOUS_ENABLE_IF_
-              , _
-            )
-        >
+    //! TODO: Until a check for each type in the sequence is done, keep this hetero.
+    template <typename Sequence>
     struct composite_diversity_base
     {
         typedef void is_heterogeneous;
     };
 
-    #undef GEOMETRIX_NARY_HOMOGENEOUS_ENABLE_IF_
-
     template <typename Sequence, std::size_t Rows, std::size_t Columns>
     struct composite_matrix
     {
@@ -617,115 +562,23 @@ namespace geometrix {
         typedef void make_fusion_sequence;//Generate the fusion adaptor for the accesses to this.
     };
     
-    #if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-        #pragma wave option(preserve: 1)
-    #endif
-
-    #define BOOST_PP_ITERATION_PARAMS_1                                                            \
-        (3, (2, GEOMETRIX_COMPOSE_MATRIX_MAX_ARITY, <geometrix/tensor/detail/as_matrix.hpp>))
-    #include BOOST_PP_ITERATE()
-        
-    //#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-    //    #pragma wave option(preserve: 2)
-    //#endif
-
-    }//namespace geometrix;
-
-    //! Mark the column as an MPL type sequence.
-    namespace boost { namespace mpl {
-        template<typename>                              
-        struct sequence_tag;                            
-                                                
-        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Row>
-        struct sequence_tag< geometrix::row<geometrix::composite_matrix<Sequence, Rows, Columns>, Row> >
-        {                                               
-            typedef fusion::fusion_sequence_tag type;   
-        };                                              
-        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Row>
-        struct sequence_tag< geometrix::row<geometrix::composite_matrix<Sequence, Rows, Columns>, Row> const >
-        {                                               
-            typedef fusion::fusion_sequence_tag type;   
-        };                                              
-        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Column>
-        struct sequence_tag< geometrix::column<geometrix::composite_matrix<Sequence, Rows, Columns>, Column> >
-        {                                               
-            typedef fusion::fusion_sequence_tag type;   
-        };                                              
-        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Column>
-        struct sequence_tag< geometrix::column<geometrix::composite_matrix<Sequence, Rows, Columns>, Column> const >
-        {                                               
-            typedef fusion::fusion_sequence_tag type;   
-        };                                              
-    }}//namespace boost::mpl
-
-		#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-			#pragma wave option(output: null)
-		#endif      
-	#else
-
-		#define N BOOST_PP_ITERATION()
-
-		#define GEOMETRIX_REF_WRAPPER( z, n, T ) boost::reference_wrapper< BOOST_PP_CAT(T,n) >
-
-		#define GEOMETRIX_REF( z, n, T ) boost::ref(BOOST_PP_CAT(T,n))
-
-		#define GEOMETRIX_NARY_IS_HOMOGENEOUS_(z, n, data)                                                \
-			typename geometric_traits<typename remove_const_ref<BOOST_PP_CAT(A,n)>::type>::is_homogeneous \
-		/***/
-
-    namespace result_of {
-    
-        template <std::size_t Rows, std::size_t Columns, BOOST_PP_ENUM_PARAMS(N,typename A)>
-        struct as_matrix
-            <
-                Rows
-              , Columns
-              , BOOST_PP_ENUM_PARAMS(N,A)
-            >
-            : boost::result_of
-              <
-                  result_of::compose_matrix_helper<Rows,Columns>
-                  (
-                      BOOST_PP_ENUM_PARAMS(N,A)
-                  )
-              >    
-        {};
-
-    }//namespace result_of;
-
-    template <BOOST_PP_ENUM_PARAMS(N,typename A)>
-    struct composite_diversity_base
-        <
-            boost::mpl::vector<BOOST_PP_ENUM_PARAMS(N,A)>
-          , BOOST_PP_ENUM
-            (
-                N
-              , GEOMETRIX_NARY_IS_HOMOGENEOUS_
-              , _
-            )
-        >
-    {
-        //! TODO: Until a check for each type in the sequence is done, keep this hetero.
-        typedef void is_heterogeneous;
-    };
-    
-    template <BOOST_PP_ENUM_PARAMS(N, typename A), std::size_t Rows, std::size_t Columns>
-    struct composite_matrix<boost::mpl::vector<BOOST_PP_ENUM_PARAMS(N,A)>, Rows, Columns>
+    template <typename... A, std::size_t Rows, std::size_t Columns>
+    struct composite_matrix<composite_sequence<A...>, Rows, Columns>
     {
     private:
 
         struct schema 
             : result_of::detail::compose_matrix_schema
               <
-                  boost::mpl::vector<BOOST_PP_ENUM_PARAMS(N,A)>
+                  boost::mpl::vector<A...>
                 , Columns
               >::type 
         {};
 
     public:
 
-        composite_matrix( BOOST_PP_ENUM_BINARY_PARAMS(N, A, &a) )
-            : sequence( BOOST_PP_ENUM(N, GEOMETRIX_REF, a) )
+        composite_matrix( A&... a )
+            : sequence( boost::ref(a)... )
         {}
 
         template <std::size_t Row, std::size_t Column>
@@ -799,19 +652,42 @@ namespace geometrix {
 
     private:
         
-        boost::fusion::vector< BOOST_PP_ENUM(N, GEOMETRIX_REF_WRAPPER, A) > sequence;    
+        boost::fusion::vector< boost::reference_wrapper<A>... > sequence;    
     };
         
-    template <std::size_t Rows, std::size_t Columns, BOOST_PP_ENUM_PARAMS(N, typename A)>                  
-    composite_matrix<boost::mpl::vector<BOOST_PP_ENUM_PARAMS(N,A)>,Rows, Columns> as_matrix(BOOST_PP_ENUM_BINARY_PARAMS(N, A, &a))                                                    
-    {                                                                                                        
-        return composite_matrix<boost::mpl::vector<BOOST_PP_ENUM_PARAMS(N,A)>,Rows,Columns>(BOOST_PP_ENUM_PARAMS(N,a)); 
+    template <std::size_t Rows, std::size_t Columns, typename A0, typename A1, typename... A>
+    inline composite_matrix<composite_sequence<A0, A1, A...>, Rows, Columns> as_matrix( A0& a0, A1& a1, A&... a )
+    {
+        return composite_matrix<composite_sequence<A0, A1, A...>, Rows, Columns>( a0, a1, a... );
     }
-    
-		#undef N
-		#undef GEOMETRIX_REF
-		#undef GEOMETRIX_REF_WRAPPER
-		#undef GEOMETRIX_NARY_IS_HOMOGENEOUS_
 
-	#endif//BOOST_PP_IS_ITERATING
-#endif
+    }//namespace geometrix;
+
+    //! Mark the column as an MPL type sequence.
+    namespace boost { namespace mpl {
+        template<typename>                              
+        struct sequence_tag;                            
+                                                
+        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Row>
+        struct sequence_tag< geometrix::row<geometrix::composite_matrix<Sequence, Rows, Columns>, Row> >
+        {                                               
+            typedef fusion::fusion_sequence_tag type;   
+        };                                              
+        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Row>
+        struct sequence_tag< geometrix::row<geometrix::composite_matrix<Sequence, Rows, Columns>, Row> const >
+        {                                               
+            typedef fusion::fusion_sequence_tag type;   
+        };                                              
+        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Column>
+        struct sequence_tag< geometrix::column<geometrix::composite_matrix<Sequence, Rows, Columns>, Column> >
+        {                                               
+            typedef fusion::fusion_sequence_tag type;   
+        };                                              
+        template <typename Sequence, std::size_t Rows, std::size_t Columns, std::size_t Column>
+        struct sequence_tag< geometrix::column<geometrix::composite_matrix<Sequence, Rows, Columns>, Column> const >
+        {                                               
+            typedef fusion::fusion_sequence_tag type;   
+        };                                              
+    }}//namespace boost::mpl
+
+#endif//GEOMETRIX_COMPOSE_MATRIX_DETAILS_HPP
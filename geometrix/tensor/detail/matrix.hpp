@@ -1,15 +1,3 @@
-#if !defined(GEOMETRIX_DONT_USE_PREPROCESSED_FILES)
-    #include <geometrix/tensor/detail/preprocessed/matrix.hpp>
-#else
-	#if !defined(BOOST_PP_IS_ITERATING)
-	
-	#include <boost\preprocessor\iteration\iterate.hpp>
-    #include <boost\preprocessor\enum.hpp>
-    #include <boost\preprocessor\enum_params.hpp>
-
-		#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-			#pragma wave option(preserve: 2, line: 0, output: "preprocessed/matrix.hpp")
-		#endif
 //
 //! Copyright  2008-2011
 //! Brandon Kohn
@@ -18,19 +6,67 @@
 //  accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 //
-//! NOTE: This file is automatically generated. Any CHANGES made to this
-//! file will be LOST on the next generation.
-		#if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-			#pragma wave option(preserve: 1)
-		#endif
-
-    #define BOOST_PP_FILENAME_1 <geometrix/tensor/detail/matrix_m.hpp>
-    #define BOOST_PP_ITERATION_LIMITS (1, GEOMETRIX_MAX_MATRIX_ROWS)
-    #include BOOST_PP_ITERATE()
-
-    #if defined(__WAVE__) && defined(GEOMETRIX_CREATE_PREPROCESSED_FILES)
-        #pragma wave option(output: null)
-    #endif
-
-	#endif
-#endif
+#ifndef GEOMETRIX_TENSOR_DETAIL_MATRIX_HPP
+#define GEOMETRIX_TENSOR_DETAIL_MATRIX_HPP
+
+#include <cstddef>
+#include <utility>
+
+namespace geometrix { namespace detail {
+
+    //! Assign each element of an Rows x Columns matrix from another matrix (row by row.)
+    template <std::size_t Rows, std::size_t Columns>
+    struct matrix_assigner<Rows, Columns, void>
+    {
+        template <std::size_t Row, typename L, typename R>
+        static void assign_row(L& l, const R& r)
+        {
+            assign_row<Row>(l, r, std::make_index_sequence<Columns>());
+        }
+
+        template <typename L, typename R>
+        static L& assign(L& l, const R& r)
+        {
+            assign_rows(l, r, std::make_index_sequence<Rows>());
+            return l;
+        }
+
+    private:
+
+        template <std::size_t Row, typename L, typename R, std::size_t... Column>
+        static void assign_row(L& l, const R& r, std::index_sequence<Column...>)
+        {
+            (set<Row, Column>(l, get<Row, Column>(r)), ...);
+        }
+
+        template <typename L, typename R, std::size_t... Row>
+        static void assign_rows(L& l, const R& r, std::index_sequence<Row...>)
+        {
+            (assign_row<Row>(l, r), ...);
+        }
+    };
+
+    //! Aggregate initialize an Rows x Columns POD matrix from another matrix.
+    template <std::size_t Rows, std::size_t Columns>
+    struct matrix_pod_constructor<Rows, Columns, void>
+    {
+        template <typename M, typename R>
+        static M construct(const R& m)
+        {
+            return construct<M>(m, std::make_index_sequence<Rows * Columns>());
+        }
+
+    private:
+
+        //! The elements are listed in row major order and brace elision fills the rows of M::elems.
+        template <typename M, typename R, std::size_t... I>
+        static M construct(const R& m, std::index_sequence<I...>)
+        {
+            M r = {{ get<I / Columns, I % Columns>(m)... }};
+            return r;
+        }
+    };
+
+}}//namespace geometrix::detail;
+
+#endif//GEOMETRIX_TENSOR_DETAIL_MATRIX_HPP
@@ -16,8 +16,6 @@ namespace geometrix {
 template <typename T, std::size_t Rows, std::size_t Columns>
 struct matrix
 {
-    GEOMETRIX_STATIC_ASSERT(( Rows <= GEOMETRIX_MAX_MATRIX_ROWS && Columns <= GEOMETRIX_MAX_MATRIX_COLUMNS ));
-
     BOOST_STATIC_CONSTANT( std::size_t, RowCount = Rows );
     BOOST_STATIC_CONSTANT( std::size_t, ColCount = Columns );
 
@@ -1,3 +0,0 @@
-#define BOOST_PP_FILENAME_2 <geometrix/tensor/detail/matrix_mxn.hpp>
-#define BOOST_PP_ITERATION_LIMITS (1, GEOMETRIX_MAX_MATRIX_COLUMNS)
-#include BOOST_PP_ITERATE()
@@ -9,13 +9,6 @@
 #ifndef GEOMETRIX_MATRIX_HPP
 #define GEOMETRIX_MATRIX_HPP
 
-#if !defined( GEOMETRIX_MAX_MATRIX_ROWS )
-    #define GEOMETRIX_MAX_MATRIX_ROWS 16
-#endif
-#if !defined( GEOMETRIX_MAX_MATRIX_COLUMNS )
-    #define GEOMETRIX_MAX_MATRIX_COLUMNS 16
-#endif
-
 #include <geometrix/tensor/detail/matrix_base.hpp>
 #include <geometrix/tensor/matrix_traits.hpp>
 #include <geometrix/tensor/index_operator_matrix_access_policy.hpp>
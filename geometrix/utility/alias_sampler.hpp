@@ -0,0 +1,107 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_UTILITY_ALIAS_SAMPLER_HPP
+#define GEOMETRIX_UTILITY_ALIAS_SAMPLER_HPP
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometrix {
+
+    //! \brief Draws indices in proportion to a set of non-negative weights in constant time (Walker's alias method.)
+
+    //! The table is built with Vose's method in linear time. Each column holds the probability of keeping its own index and
+    //! the index it aliases otherwise, so a draw is one uniform number, one multiply and one comparison regardless of the
+    //! number of weights (an inverse CDF search is O(log n) and touches a cache line per step.)
+    class alias_sampler
+    {
+    public:
+
+        alias_sampler() = default;
+
+        template <typename Weights>
+        explicit alias_sampler(const Weights& weights)
+        {
+            std::size_t n = weights.size();
+            m_probability.resize(n);
+            m_alias.resize(n);
+            if (n == 0)
+                return;
+
+            double total = 0;
+            for (auto w : weights)
+            {
+                GEOMETRIX_ASSERT(w >= 0);
+                total += static_cast<double>(w);
+            }
+            GEOMETRIX_ASSERT(total > 0);
+
+            std::vector<std::uint32_t> small, large;
+            auto scale = static_cast<double>(n) / total;
+            std::size_t i = 0;
+            for (auto w : weights)
+            {
+                m_probability[i] = static_cast<double>(w) * scale;
+                (m_probability[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+                ++i;
+            }
+
+            while (!small.empty() && !large.empty())
+            {
+                auto s = small.back(); small.pop_back();
+                auto l = large.back();
+                m_alias[s] = l;
+                m_probability[l] -= 1.0 - m_probability[s];
+                if (m_probability[l] < 1.0)
+                {
+                    large.pop_back();
+                    small.push_back(l);
+                }
+            }
+
+            //! What is left is 1 up to rounding.
+            for (auto l : large)
+                m_probability[l] = 1.0, m_alias[l] = l;
+            for (auto s : small)
+                m_probability[s] = 1.0, m_alias[s] = s;
+        }
+
+        std::size_t size() const { return m_probability.size(); }
+        bool empty() const { return m_probability.empty(); }
+
+        //! Draw an index from a uniform number u in [0, 1).
+        std::size_t operator()(double u) const
+        {
+            GEOMETRIX_ASSERT(!empty());
+            GEOMETRIX_ASSERT(0. <= u && u < 1.);
+            auto x = u * static_cast<double>(size());
+            auto i = static_cast<std::size_t>(x);
+            if (i >= size())
+                i = size() - 1;
+            return x - static_cast<double>(i) < m_probability[i] ? i : m_alias[i];
+        }
+
+        //! The probability of keeping column i and the index drawn otherwise.
+        double get_probability(std::size_t i) const { return m_probability[i]; }
+        std::size_t get_alias(std::size_t i) const { return m_alias[i]; }
+
+    private:
+
+        std::vector<double> m_probability;
+        std::vector<std::uint32_t> m_alias;
+
+    };
+
+}//! namespace geometrix
+
+#endif//! GEOMETRIX_UTILITY_ALIAS_SAMPLER_HPP
@@ -0,0 +1,398 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BINARY_IMAGE_HPP
+#define GEOMETRIX_BINARY_IMAGE_HPP
+#pragma once
+
+#include <geometrix/utility/binary_image_fwd.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <geometrix/primitive/point.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//! A binary image is a versioned, position independent snapshot of a built structure which can be memory mapped read-only
+//! and queried in place (see kd_tree_view.hpp, solid_leaf_bsp_tree_view.hpp, node_bsp_tree_2d_view.hpp and mesh_2d_view.hpp).
+//!
+//! Layout (native byte order, checked on load):
+//! - header: magic "GXIMAGE", format version, byte order mark, structure kind, scalar type code, dimension, section count and
+//!   total size.
+//! - section table: one entry per section with its id, element size, offset from the start of the image and element count.
+//! - sections: arrays of trivially copyable elements aligned to binary_image_section_alignment. Links between elements are
+//!   32 bit indices into other sections, never pointers, so the image may be mapped at any address and shared between
+//!   processes.
+//!
+//! Example usage:
+//! \code
+//! make_binary_image(tree).write("tree.gx");
+//! ...
+//! mapped_binary_image file("tree.gx");
+//! kd_tree_view<point_double_3d> view(file);
+//! view.search(range, visitor, cmp);
+//! \endcode
+namespace geometrix {
+
+    //! \brief Thrown when an image cannot be read or written, is truncated, or was written for another version, structure or scalar type.
+    class binary_image_error : public std::runtime_error
+    {
+    public:
+        explicit binary_image_error(const std::string& what)
+            : std::runtime_error(what)
+        {}
+    };
+
+    enum class binary_image_kind : std::uint32_t
+    {
+        kd_tree = 1
+      , solid_leaf_bsp_tree = 2
+      , node_bsp_tree_2d = 3
+      , mesh_2d = 4
+    };
+
+    //! Bumped whenever the header or the layout of any structure's sections changes.
+    const std::uint32_t binary_image_format_version = 1;
+    const std::size_t binary_image_section_alignment = 64;
+
+    namespace binary_image_detail
+    {
+        const char magic[8] = { 'G', 'X', 'I', 'M', 'A', 'G', 'E', '\0' };
+        const std::uint32_t byte_order_mark = 0x01020304;
+
+        struct header
+        {
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint32_t kind;
+            std::uint32_t scalar_code;
+            std::uint32_t dimension;
+            std::uint32_t section_count;
+            std::uint64_t size;
+        };
+        static_assert(sizeof(header) == 40, "The image header must not have implementation defined padding.");
+
+        struct section_entry
+        {
+            std::uint32_t id;
+            std::uint32_t element_size;
+            std::uint64_t offset;
+            std::uint64_t count;
+        };
+        static_assert(sizeof(section_entry) == 24, "The section table must not have implementation defined padding.");
+
+        inline std::uint64_t align_offset(std::uint64_t offset)
+        {
+            return (offset + binary_image_section_alignment - 1) / binary_image_section_alignment * binary_image_section_alignment;
+        }
+
+        //! Points and vectors are stored as plain arrays of their coordinates.
+        template <typename T, std::size_t D>
+        struct stored_point
+        {
+            T coordinates[D];
+        };
+
+        template <typename T, std::size_t D>
+        struct stored_segment
+        {
+            T start[D];
+            T end[D];
+        };
+
+        template <typename Sequence, typename T, std::size_t... I>
+        inline void store_coordinates(const Sequence& p, T* c, std::index_sequence<I...>)
+        {
+            ((c[I] = get<I>(p)), ...);
+        }
+
+        template <std::size_t D, typename Sequence, typename T>
+        inline void store_coordinates(const Sequence& p, T* c)
+        {
+            store_coordinates(p, c, std::make_index_sequence<D>());
+        }
+
+        template <typename Sequence, typename T, std::size_t... I>
+        inline Sequence load_coordinates(const T* c, std::index_sequence<I...>)
+        {
+            return construct<Sequence>(c[I]...);
+        }
+
+        template <typename Sequence, std::size_t D, typename T>
+        inline Sequence load_coordinates(const T* c)
+        {
+            return load_coordinates<Sequence>(c, std::make_index_sequence<D>());
+        }
+    }//! namespace binary_image_detail;
+
+    //! Identifies the scalar type stored in an image so that a view instantiated on another type refuses to load it.
+    template <typename T>
+    inline std::uint32_t binary_image_scalar_code()
+    {
+        static_assert(std::is_arithmetic<T>::value, "Binary images store plain arithmetic scalars.");
+        return (std::is_floating_point<T>::value ? 0x100u : (std::is_signed<T>::value ? 0x200u : 0x300u)) | static_cast<std::uint32_t>(sizeof(T));
+    }
+
+    //! \brief A read-only array inside an image.
+    template <typename T>
+    class binary_image_array
+    {
+    public:
+
+        using value_type = T;
+        using const_iterator = const T*;
+        using iterator = const T*;
+
+        binary_image_array() = default;
+        binary_image_array(const T* data, std::size_t size)
+            : m_data(data)
+            , m_size(size)
+        {}
+
+        const T* begin() const { return m_data; }
+        const T* end() const { return m_data + m_size; }
+        const T* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        const T& operator[](std::size_t i) const
+        {
+            GEOMETRIX_ASSERT(i < m_size);
+            return m_data[i];
+        }
+
+    private:
+
+        const T*    m_data{ nullptr };
+        std::size_t m_size{ 0 };
+    };
+
+    //! \brief Collects the sections of an image and writes them out.
+    class binary_image_writer
+    {
+    public:
+
+        binary_image_writer(binary_image_kind kind, std::uint32_t scalarCode, std::uint32_t dimension)
+            : m_kind(kind)
+            , m_scalarCode(scalarCode)
+            , m_dimension(dimension)
+        {}
+
+        template <typename T>
+        void add_section(std::uint32_t id, const T* data, std::size_t count)
+        {
+            static_assert(std::is_trivially_copyable<T>::value && std::is_standard_layout<T>::value, "Sections hold trivially copyable, standard layout elements.");
+            GEOMETRIX_ASSERT(find(id) == nullptr);
+            section s;
+            s.entry.id = id;
+            s.entry.element_size = static_cast<std::uint32_t>(sizeof(T));
+            s.entry.offset = 0;
+            s.entry.count = count;
+            s.bytes.resize(count * sizeof(T));
+            if (count)
+                std::memcpy(s.bytes.data(), data, count * sizeof(T));
+            m_sections.emplace_back(std::move(s));
+        }
+
+        template <typename T, typename Alloc>
+        void add_section(std::uint32_t id, const std::vector<T, Alloc>& v)
+        {
+            add_section(id, v.data(), v.size());
+        }
+
+        void write(std::ostream& os) const
+        {
+            using namespace binary_image_detail;
+
+            header h;
+            std::memcpy(h.magic, magic, sizeof(magic));
+            h.version = binary_image_format_version;
+            h.byte_order = byte_order_mark;
+            h.kind = static_cast<std::uint32_t>(m_kind);
+            h.scalar_code = m_scalarCode;
+            h.dimension = m_dimension;
+            h.section_count = static_cast<std::uint32_t>(m_sections.size());
+
+            std::vector<section_entry> table;
+            std::uint64_t offset = sizeof(header) + m_sections.size() * sizeof(section_entry);
+            for (auto const& s : m_sections)
+            {
+                offset = align_offset(offset);
+                table.push_back(s.entry);
+                table.back().offset = offset;
+                offset += s.bytes.size();
+            }
+            h.size = offset;
+
+            os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            if (!table.empty())
+                os.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(section_entry));
+            std::uint64_t written = sizeof(header) + table.size() * sizeof(section_entry);
+            const char padding[binary_image_section_alignment] = {};
+            for (std::size_t i = 0; i < m_sections.size(); ++i)
+            {
+                os.write(padding, static_cast<std::streamsize>(table[i].offset - written));
+                os.write(m_sections[i].bytes.data(), static_cast<std::streamsize>(m_sections[i].bytes.size()));
+                written = table[i].offset + m_sections[i].bytes.size();
+            }
+
+            if (!os)
+                throw binary_image_error("failed to write binary image.");
+        }
+
+        void write(const std::string& fileName) const
+        {
+            std::ofstream os(fileName, std::ios::binary | std::ios::trunc);
+            if (!os)
+                throw binary_image_error("cannot open " + fileName + " for writing.");
+            write(os);
+        }
+
+    private:
+
+        struct section
+        {
+            binary_image_detail::section_entry entry;
+            std::vector<char> bytes;
+        };
+
+        const section* find(std::uint32_t id) const
+        {
+            for (auto const& s : m_sections)
+                if (s.entry.id == id)
+                    return &s;
+            return nullptr;
+        }
+
+        binary_image_kind    m_kind;
+        std::uint32_t        m_scalarCode;
+        std::uint32_t        m_dimension;
+        std::vector<section> m_sections;
+    };
+
+    //! \brief Validates an image in memory and gives access to its sections without copying them.
+
+    //! The view does not own the memory, which must outlive it and be at least 8 byte aligned (as both mapped files and heap
+    //! buffers are). The header and the section bounds are checked on construction. Indices stored inside sections are
+    //! trusted; images should only come from binary_image_writer.
+    class binary_image_view
+    {
+    public:
+
+        binary_image_view(const void* data, std::size_t size, binary_image_kind kind, std::uint32_t scalarCode, std::uint32_t dimension)
+            : m_data(static_cast<const char*>(data))
+            , m_size(size)
+        {
+            using namespace binary_image_detail;
+
+            if (m_size < sizeof(header))
+                throw binary_image_error("binary image is truncated.");
+
+            header h;
+            std::memcpy(&h, m_data, sizeof(h));
+            if (std::memcmp(h.magic, magic, sizeof(magic)) != 0)
+                throw binary_image_error("not a geometrix binary image.");
+            if (h.byte_order != byte_order_mark)
+                throw binary_image_error("binary image was written with another byte order.");
+            if (h.version != binary_image_format_version)
+                throw binary_image_error("binary image version " + std::to_string(h.version) + " is not supported (expected " + std::to_string(binary_image_format_version) + ").");
+            if (h.kind != static_cast<std::uint32_t>(kind))
+                throw binary_image_error("binary image holds another kind of structure.");
+            if (h.scalar_code != scalarCode || h.dimension != dimension)
+                throw binary_image_error("binary image holds another scalar type or dimension.");
+            if (h.size > m_size || (m_size - sizeof(header)) / sizeof(section_entry) < h.section_count)
+                throw binary_image_error("binary image is truncated.");
+
+            m_sectionCount = h.section_count;
+        }
+
+        //! Return the section with the given id. Throws if it is missing, holds elements of another size or lies outside of the image.
+        template <typename T>
+        binary_image_array<T> section(std::uint32_t id) const
+        {
+            using namespace binary_image_detail;
+
+            for (std::uint32_t i = 0; i < m_sectionCount; ++i)
+            {
+                section_entry e;
+                std::memcpy(&e, m_data + sizeof(header) + i * sizeof(section_entry), sizeof(e));
+                if (e.id != id)
+                    continue;
+
+                if (e.element_size != sizeof(T))
+                    throw binary_image_error("binary image section " + std::to_string(id) + " has an unexpected element size.");
+                if (e.offset > m_size || (m_size - e.offset) / sizeof(T) < e.count)
+                    throw binary_image_error("binary image section " + std::to_string(id) + " is truncated.");
+                auto p = m_data + e.offset;
+                if (reinterpret_cast<std::uintptr_t>(p) % alignof(T) != 0)
+                    throw binary_image_error("binary image section " + std::to_string(id) + " is misaligned.");
+                return binary_image_array<T>(reinterpret_cast<const T*>(p), static_cast<std::size_t>(e.count));
+            }
+
+            throw binary_image_error("binary image section " + std::to_string(id) + " is missing.");
+        }
+
+        const void* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+    private:
+
+        const char*   m_data;
+        std::size_t   m_size;
+        std::uint32_t m_sectionCount{ 0 };
+    };
+
+    //! \brief A read-only, shared memory mapping of an image file.
+
+    //! Pages are loaded on demand and shared by every process which maps the same file.
+    class mapped_binary_image
+    {
+    public:
+
+        explicit mapped_binary_image(const std::string& fileName)
+        {
+            using namespace boost::interprocess;
+            try
+            {
+                file_mapping file(fileName.c_str(), read_only);
+                mapped_region(file, read_only).swap(m_region);
+            }
+            catch (const interprocess_exception& e)
+            {
+                throw binary_image_error("cannot map " + fileName + ": " + e.what());
+            }
+        }
+
+        const void* data() const { return m_region.get_address(); }
+        std::size_t size() const { return m_region.get_size(); }
+
+    private:
+
+        boost::interprocess::mapped_region m_region;
+    };
+
+    //! \brief Snapshot a built structure into a writer. The structure must have a binary_image_access specialization.
+    template <typename Structure>
+    inline binary_image_writer make_binary_image(const Structure& s)
+    {
+        return binary_image_access<Structure>::make_image(s);
+    }
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_BINARY_IMAGE_HPP
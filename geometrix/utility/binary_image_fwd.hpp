@@ -0,0 +1,22 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BINARY_IMAGE_FWD_HPP
+#define GEOMETRIX_BINARY_IMAGE_FWD_HPP
+#pragma once
+
+namespace geometrix {
+
+    //! Specialized for each structure which can be written to a binary image (see binary_image.hpp). Structures befriend it
+    //! so the writer can read their internals.
+    template <typename Structure>
+    struct binary_image_access;
+
+}//namespace geometrix;
+
+#endif //GEOMETRIX_BINARY_IMAGE_FWD_HPP
@@ -0,0 +1,106 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_UTILITY_BOUNDED_QUEUE_HPP
+#define GEOMETRIX_UTILITY_BOUNDED_QUEUE_HPP
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+
+#include <boost/optional.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace geometrix {
+
+    //! \brief A blocking FIFO queue holding at most a fixed number of items.
+
+    //! push blocks while the queue is full and pop blocks while it is empty. After close() pushes fail and pop drains the
+    //! remaining items before returning none, which lets producers signal the end of a stream and lets any thread cancel it.
+    template <typename T>
+    class bounded_queue
+    {
+    public:
+
+        explicit bounded_queue(std::size_t capacity)
+            : m_capacity(capacity)
+        {
+            GEOMETRIX_ASSERT(capacity > 0);
+        }
+
+        bounded_queue(const bounded_queue&) = delete;
+        bounded_queue& operator=(const bounded_queue&) = delete;
+
+        //! Returns false (and drops the item) if the queue was closed.
+        bool push(T item)
+        {
+            std::unique_lock<std::mutex> lk(m_mutex);
+            m_notFull.wait(lk, [this]() { return m_closed || m_items.size() < m_capacity; });
+            if (m_closed)
+                return false;
+            m_items.push_back(std::move(item));
+            lk.unlock();
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        //! Returns none once the queue is closed and empty.
+        boost::optional<T> pop()
+        {
+            std::unique_lock<std::mutex> lk(m_mutex);
+            m_notEmpty.wait(lk, [this]() { return m_closed || !m_items.empty(); });
+            if (m_items.empty())
+                return boost::none;
+            boost::optional<T> item(std::move(m_items.front()));
+            m_items.pop_front();
+            lk.unlock();
+            m_notFull.notify_one();
+            return item;
+        }
+
+        void close()
+        {
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                m_closed = true;
+            }
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+        //! Drop the queued items and close.
+        void cancel()
+        {
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                m_items.clear();
+                m_closed = true;
+            }
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+        std::size_t capacity() const { return m_capacity; }
+
+    private:
+
+        std::size_t             m_capacity;
+        std::deque<T>           m_items;
+        bool                    m_closed{ false };
+        std::mutex              m_mutex;
+        std::condition_variable m_notEmpty;
+        std::condition_variable m_notFull;
+
+    };
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_UTILITY_BOUNDED_QUEUE_HPP
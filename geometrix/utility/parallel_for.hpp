@@ -0,0 +1,102 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_UTILITY_PARALLEL_FOR_HPP
+#define GEOMETRIX_UTILITY_PARALLEL_FOR_HPP
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geometrix {
+
+    //! Number of threads used by the parallel algorithms when the caller does not specify one.
+    inline std::size_t get_default_concurrency()
+    {
+        auto n = std::thread::hardware_concurrency();
+        return n ? static_cast<std::size_t>(n) : 1;
+    }
+
+    //! Number of batches of at most batchSize items needed to cover n items.
+    inline std::size_t get_number_batches(std::size_t n, std::size_t batchSize)
+    {
+        GEOMETRIX_ASSERT(batchSize > 0);
+        return (n + batchSize - 1) / batchSize;
+    }
+
+    //! Invoke fn(batchIndex, begin, end) for each contiguous batch [begin, end) of at most batchSize items in [0, n).
+    //! Batches are claimed by up to nThreads workers (the calling thread included) in no particular order. Callers which
+    //! need deterministic output should write each batch's results into storage indexed by batchIndex and merge them in
+    //! batch order afterwards. The first exception thrown by any batch is rethrown on the calling thread.
+    template <typename Fn>
+    inline void parallel_for_batches(std::size_t n, std::size_t batchSize, Fn&& fn, std::size_t nThreads = get_default_concurrency())
+    {
+        auto nBatches = get_number_batches(n, batchSize);
+        if (nBatches == 0)
+            return;
+
+        nThreads = (std::max<std::size_t>)(1, (std::min)(nThreads, nBatches));
+        if (nThreads == 1)
+        {
+            for (std::size_t b = 0; b < nBatches; ++b)
+                fn(b, b * batchSize, (std::min)(n, (b + 1) * batchSize));
+            return;
+        }
+
+        std::atomic<std::size_t> next{ 0 };
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto worker = [&]()
+        {
+            try
+            {
+                for (auto b = next++; b < nBatches; b = next++)
+                    fn(b, b * batchSize, (std::min)(n, (b + 1) * batchSize));
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lk(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+                next = nBatches;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads - 1);
+        for (std::size_t i = 1; i < nThreads; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for (auto& t : threads)
+            t.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    //! Invoke fn(i) for each i in [0, n) using parallel_for_batches.
+    template <typename Fn>
+    inline void parallel_for(std::size_t n, Fn&& fn, std::size_t batchSize = 1024, std::size_t nThreads = get_default_concurrency())
+    {
+        parallel_for_batches(n, batchSize, [&fn](std::size_t, std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+                fn(i);
+        }, nThreads);
+    }
+
+}//! namespace geometrix;
+
+#endif//! GEOMETRIX_UTILITY_PARALLEL_FOR_HPP
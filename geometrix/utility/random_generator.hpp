@@ -10,6 +10,8 @@
 #define GEOMETRIX_RANDOM_GENERATOR_HPP
 
 #include <boost/random.hpp>
+#include <array>
+#include <cstdint>
 
 namespace geometrix {
     template <typename RandomNumberGenerator>
@@ -101,6 +103,54 @@ namespace geometrix {
         mutable T m_value;
     };
     
+    //! \brief A counter based random number generator (Philox4x32-10, Salmon et al. 2011.)
+
+    //! The numbers are a keyed hash of a 64 bit counter and a 64 bit stream id rather than the next state of a sequence, so
+    //! the i-th draw can be computed directly. Parallel loops which use the item index as the counter produce the same
+    //! results for any number of threads.
+    class counter_based_random_generator
+    {
+    public:
+
+        using result_type = std::array<std::uint32_t, 4>;
+
+        counter_based_random_generator( std::uint64_t seed = 42 )
+            : m_key{ { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) } }
+        {}
+
+        //! Generate the four 32 bit numbers for a counter in a stream.
+        result_type operator()( std::uint64_t counter, std::uint64_t stream = 0 ) const
+        {
+            result_type c = { { static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32), static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) } };
+            auto k0 = m_key[0], k1 = m_key[1];
+            for( int round = 0; round < 10; ++round )
+            {
+                if( round > 0 )
+                {
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+                std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * c[0];
+                std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * c[2];
+                c = { { static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k0, static_cast<std::uint32_t>(p1), static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k1, static_cast<std::uint32_t>(p0) } };
+            }
+            return c;
+        }
+
+        //! Map a 32 bit number to a double on the interval [0.0,1.0).
+        static double to_unit( std::uint32_t v ) { return v * (1.0 / 4294967296.0); }
+
+        //! Map two 32 bit numbers to a double with 53 random bits on the interval [0.0,1.0).
+        static double to_unit( std::uint32_t hi, std::uint32_t lo ) { return ((static_cast<std::uint64_t>(hi) << 21) ^ (lo >> 11)) * (1.0 / 9007199254740992.0); }
+
+        void seed( std::uint64_t seed ) { m_key = { { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) } }; }
+
+    private:
+
+        std::array<std::uint32_t, 2> m_key;
+
+    };
+
     template <typename Range, typename RNG>
     inline typename boost::range_iterator<Range>::type random_element(const Range& r, const random_index_generator<RNG>& rng)
     {
@@ -0,0 +1,135 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef GEOMETRIX_BENCHMARK_DATA_HPP
+#define GEOMETRIX_BENCHMARK_DATA_HPP
+#pragma once
+
+#include <geometrix/numeric/number_comparison_policy.hpp>
+#include <geometrix/numeric/constants.hpp>
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/primitive/segment.hpp>
+#include <geometrix/primitive/polygon.hpp>
+#include <geometrix/primitive/polyline.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+//! Fixed seed data generators shared by the benchmarks. Every generator takes an explicit seed so that runs are comparable across builds.
+namespace geometrix { namespace benchmark_data {
+
+    using point2 = point<double, 2>;
+    using vector2 = vector<double, 2>;
+    using segment2 = segment<point2>;
+    using polygon2 = polygon<point2>;
+    using polyline2 = polyline<point2>;
+
+    const unsigned long default_seed = 42;
+
+    inline absolute_tolerance_comparison_policy<double> make_cmp()
+    {
+        return absolute_tolerance_comparison_policy<double>(1e-10);
+    }
+
+    //! n points uniformly distributed in [0, extent)^2.
+    inline std::vector<point2> random_points(std::size_t n, double extent = 1000.0, unsigned long seed = default_seed)
+    {
+        random_real_generator<> rnd(extent, seed);
+        std::vector<point2> points;
+        points.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            auto x = rnd();
+            points.emplace_back(x, rnd());
+        }
+        return points;
+    }
+
+    //! n segments with start points in [0, extent)^2 and lengths of at most maxLength along each axis.
+    inline std::vector<segment2> random_segments(std::size_t n, double extent = 1000.0, double maxLength = 20.0, unsigned long seed = default_seed)
+    {
+        random_real_generator<> rnd(1.0, seed);
+        std::vector<segment2> segments;
+        segments.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            auto x = extent * rnd();
+            auto y = extent * rnd();
+            auto dx = maxLength * (2.0 * rnd() - 1.0);
+            auto dy = maxLength * (2.0 * rnd() - 1.0);
+            segments.emplace_back(point2(x, y), point2(x + dx, y + dy));
+        }
+        return segments;
+    }
+
+    //! A simple star shaped polygon with n vertices about center with radii in [0.5 * radius, radius).
+    inline polygon2 random_star_polygon(std::size_t n, const point2& center = point2(500.0, 500.0), double radius = 500.0, unsigned long seed = default_seed)
+    {
+        random_real_generator<> rnd(1.0, seed);
+        polygon2 poly;
+        poly.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            auto theta = constants::two_pi<double>() * static_cast<double>(i) / static_cast<double>(n);
+            auto r = radius * (0.5 + 0.5 * rnd());
+            poly.emplace_back(get<0>(center) + r * std::cos(theta), get<1>(center) + r * std::sin(theta));
+        }
+        return poly;
+    }
+
+    //! A polyline with n vertices which advances along x with random steps in y.
+    inline polyline2 random_walk_polyline(std::size_t n, double step = 1.0, unsigned long seed = default_seed)
+    {
+        random_real_generator<> rnd(1.0, seed);
+        polyline2 pline;
+        pline.reserve(n);
+        double y = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            pline.emplace_back(step * static_cast<double>(i), y);
+            y += step * (2.0 * rnd() - 1.0);
+        }
+        return pline;
+    }
+
+    //! A regular triangulation of the square [0, n * size]^2 with 2 * n^2 triangles.
+    struct triangulated_grid
+    {
+        std::vector<point2>      points;
+        std::vector<std::size_t> indices;
+    };
+
+    inline triangulated_grid make_triangulated_grid(std::size_t n, double size = 1.0)
+    {
+        triangulated_grid result;
+        result.points.reserve((n + 1) * (n + 1));
+        for (std::size_t j = 0; j <= n; ++j)
+            for (std::size_t i = 0; i <= n; ++i)
+                result.points.emplace_back(size * static_cast<double>(i), size * static_cast<double>(j));
+
+        result.indices.reserve(6 * n * n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto v0 = j * (n + 1) + i;
+                auto v1 = v0 + 1;
+                auto v2 = v1 + n + 1;
+                auto v3 = v0 + n + 1;
+                result.indices.insert(result.indices.end(), { v0, v1, v2, v0, v2, v3 });
+            }
+        }
+        return result;
+    }
+
+}}//! namespace geometrix::benchmark_data;
+
+#endif//! GEOMETRIX_BENCHMARK_DATA_HPP
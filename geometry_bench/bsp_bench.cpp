@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// bsp_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/algorithm/solid_leaf_bsp_tree.hpp>
+#include <geometrix/algorithm/hyperplane_partition_policies.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+namespace {
+
+    using solid_bsp2 = solid_leaf_bsp_tree<segment2>;
+
+    solid_bsp2 make_star_bsp(std::size_t n)
+    {
+        auto cmp = make_cmp();
+        auto segs = polygon_as_segment_range<segment2>(random_star_polygon(n));
+        auto partitionPolicy = partition_policies::scored_selector_policy<identity_simplex_extractor, decltype(cmp)>(identity_simplex_extractor(), cmp);
+        return solid_bsp2(segs, partitionPolicy, cmp, identity_simplex_extractor());
+    }
+
+}//! namespace;
+
+static void solid_bsp_build(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto bsp = make_star_bsp(n);
+        benchmark::DoNotOptimize(&bsp);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(solid_bsp_build)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+static void solid_bsp_point_in_solid(benchmark::State& state)
+{
+    auto bsp = make_star_bsp(static_cast<std::size_t>(state.range(0)));
+    auto queries = random_points(1024);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = bsp.point_in_solid_space(queries[q++ % queries.size()], cmp);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(solid_bsp_point_in_solid)->RangeMultiplier(4)->Range(16, 1024)->Complexity(benchmark::oLogN);
+
+static void solid_bsp_min_distance(benchmark::State& state)
+{
+    auto bsp = make_star_bsp(static_cast<std::size_t>(state.range(0)));
+    auto queries = random_points(1024);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        std::size_t index;
+        auto d = bsp.get_min_distance_sqrd_to_solid(queries[q++ % queries.size()], index, cmp);
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(solid_bsp_min_distance)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+static void solid_bsp_ray_intersection(benchmark::State& state)
+{
+    auto bsp = make_star_bsp(static_cast<std::size_t>(state.range(0)));
+    auto origins = random_points(1024);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto const& o = origins[q++ % origins.size()];
+        auto theta = 0.001 * static_cast<double>(q);
+        auto r = bsp.ray_intersection(o, vector2(std::cos(theta), std::sin(theta)), cmp);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(solid_bsp_ray_intersection)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
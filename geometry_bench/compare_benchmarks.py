@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+#
+#  Copyright 2026 Brandon Kohn. Distributed under the Boost
+#  Software License, Version 1.0. (See accompanying file
+#  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+"""Compare two geometrix_bench JSON result files and flag regressions.
+
+Usage:
+    compare_benchmarks.py baseline.json contender.json [--threshold 0.10] [--metric cpu_time|real_time]
+
+Benchmarks are matched by name. When the files contain repetitions the median aggregate is
+used, otherwise the single run. The exit status is 1 if any benchmark slowed down by more
+than the threshold (a fraction of the baseline time) and 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path, metric):
+    with open(path) as f:
+        data = json.load(f)
+
+    runs = {}
+    medians = {}
+    for b in data.get("benchmarks", []):
+        if b.get("error_occurred"):
+            continue
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") == "median":
+                medians[b["run_name"]] = b[metric]
+        elif b.get("big_o") is None and b.get("rms") is None:
+            runs.setdefault(b.get("run_name", b["name"]), b[metric])
+
+    runs.update(medians)
+    return runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.10, help="relative slowdown flagged as a regression (default 0.10)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    regressions = []
+    width = max([len(name) for name in baseline] + [9])
+    print("{:<{w}}  {:>14}  {:>14}  {:>8}".format("benchmark", "baseline", "contender", "change", w=width))
+    for name in sorted(baseline):
+        if name not in contender:
+            print("{:<{w}}  {:>14.1f}  {:>14}  {:>8}".format(name, baseline[name], "missing", "", w=width))
+            continue
+        old, new = baseline[name], contender[name]
+        change = (new - old) / old if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        print("{:<{w}}  {:>14.1f}  {:>14.1f}  {:>+7.1%}{}".format(name, old, new, change, flag, w=width))
+
+    for name in sorted(set(contender) - set(baseline)):
+        print("{:<{w}}  {:>14}  {:>14.1f}  {:>8}".format(name, "new", contender[name], "", w=width))
+
+    if regressions:
+        print("\n{} benchmark(s) regressed by more than {:.0%}.".format(len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
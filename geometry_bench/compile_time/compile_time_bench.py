@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+#  Copyright 2026 Brandon Kohn. Distributed under the Boost
+#  Software License, Version 1.0. (See accompanying file
+#  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+"""Measure the compile time and peak compiler memory of translation units.
+
+Usage:
+    compile_time_bench.py --compiler c++ [--include dir ...] [--flag=f ...] [--repetitions 3]
+                          [--out result.json] source.cpp ...
+
+Each source is compiled (-c) the given number of times. The fastest wall time and the largest peak
+resident set size of the compiler are reported. With --out the results are written in the Google
+Benchmark JSON format so that compare_benchmarks.py can compare two runs, e.g. this tree against an
+older checkout passed with --include.
+
+Sources are compiled with -std=c++17 -O2 followed by the --flag values, so a later optimization flag
+overrides the default. Pass flags which begin with a dash as --flag=-O0 because argparse reads the
+value of --flag -O0 as another option.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def compile_once(cmd):
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd)
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter() - start
+    proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+    if proc.returncode != 0:
+        sys.exit("compilation failed: " + " ".join(cmd))
+    #! ru_maxrss is in kilobytes on Linux and bytes on macOS.
+    peak_kb = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    return elapsed, usage.ru_utime + usage.ru_stime, peak_kb
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("sources", nargs="+")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", action="append", default=[])
+    parser.add_argument("--flag", action="append", default=[])
+    parser.add_argument("--repetitions", type=int, default=3)
+    parser.add_argument("--out")
+    args = parser.parse_args()
+
+    flags = ["-std=c++17", "-O2", "-DBOOST_RESULT_OF_USE_TR1_WITH_DECLTYPE_FALLBACK"] + args.flag
+    flags += ["-I" + d for d in args.include]
+
+    results = []
+    with tempfile.TemporaryDirectory() as tmp:
+        for source in args.sources:
+            cmd = [args.compiler] + flags + ["-c", source, "-o", os.path.join(tmp, "out.o")]
+            runs = [compile_once(cmd) for _ in range(args.repetitions)]
+            wall = min(r[0] for r in runs)
+            cpu = min(r[1] for r in runs)
+            peak = max(r[2] for r in runs)
+            name = "compile/" + os.path.splitext(os.path.basename(source))[0]
+            print("%-40s %8.2f s %8.2f s cpu %8d MB" % (name, wall, cpu, peak // 1024))
+            results.append({
+                "name": name,
+                "run_name": name,
+                "run_type": "iteration",
+                "iterations": args.repetitions,
+                "real_time": wall * 1e3,
+                "cpu_time": cpu * 1e3,
+                "time_unit": "ms",
+                "peak_rss_kb": peak,
+            })
+
+    if args.out:
+        with open(args.out, "w") as f:
+            json.dump({"context": {"compiler": args.compiler, "flags": flags}, "benchmarks": results}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,14 @@
+///////////////////////////////////////////////////////////////////////////////
+// includes.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! A translation unit for compile_time_bench.py which only parses the core headers. Most translation units pay this cost.
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/tensor/matrix.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/algebra/algebra.hpp>
+#include <geometrix/algebra/lup_decomposition.hpp>
@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////
+// matrix_kernels.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! A translation unit for compile_time_bench.py: it instantiates the dot product, matrix construction, LUP and
+//! composite matrix kernels at the sizes used in practice. It only uses sizes which the older preprocessor
+//! generated kernels also supported, so the same file can be timed against an older checkout.
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/tensor/matrix.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/tensor/composite_matrix.hpp>
+#include <geometrix/algebra/algebra.hpp>
+#include <geometrix/algebra/lup_decomposition.hpp>
+#include <geometrix/arithmetic/matrix_arithmetic.hpp>
+
+namespace geometrix { namespace compile_time_bench {
+
+    template <std::size_t D>
+    double dot(const vector<double, D>& a, const vector<double, D>& b)
+    {
+        return dot_product(a, b);
+    }
+
+    template <std::size_t N>
+    matrix<double, N, N> square(const matrix<double, N, N>& m)
+    {
+        return construct<matrix<double, N, N>>(m * m);
+    }
+
+    template <std::size_t N>
+    double solve(matrix<double, N, N> m, const boost::array<double, N>& b)
+    {
+        boost::array<std::size_t, N> pi;
+        lup_decomposition(m, pi);
+        return lup_solve(m, pi, b)[0];
+    }
+
+    template double dot<2>(const vector<double, 2>&, const vector<double, 2>&);
+    template double dot<3>(const vector<double, 3>&, const vector<double, 3>&);
+    template double dot<4>(const vector<double, 4>&, const vector<double, 4>&);
+    template double dot<6>(const vector<double, 6>&, const vector<double, 6>&);
+    template double dot<8>(const vector<double, 8>&, const vector<double, 8>&);
+
+    template matrix<double, 2, 2> square<2>(const matrix<double, 2, 2>&);
+    template matrix<double, 3, 3> square<3>(const matrix<double, 3, 3>&);
+    template matrix<double, 4, 4> square<4>(const matrix<double, 4, 4>&);
+    template matrix<double, 6, 6> square<6>(const matrix<double, 6, 6>&);
+
+    template double solve<2>(matrix<double, 2, 2>, const boost::array<double, 2>&);
+    template double solve<3>(matrix<double, 3, 3>, const boost::array<double, 3>&);
+    template double solve<4>(matrix<double, 4, 4>, const boost::array<double, 4>&);
+    template double solve<6>(matrix<double, 6, 6>, const boost::array<double, 6>&);
+
+    matrix<double, 4, 4> compose(matrix<double, 3, 3>& m, vector_double_3d& t)
+    {
+        vector_double_4d last(0, 0, 0, 1);
+        column_vector<vector_double_3d> c(t);
+        row_vector<vector_double_4d> r(last);
+        return construct<matrix<double, 4, 4>>(as_matrix<4, 4>(m, c, r));
+    }
+
+}}//! namespace geometrix::compile_time_bench;
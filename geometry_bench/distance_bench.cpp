@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// distance_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/distance/point_segment_distance.hpp>
+#include <geometrix/algorithm/distance/segment_segment_distance.hpp>
+#include <geometrix/algorithm/distance/point_polyline_distance.hpp>
+#include <geometrix/algorithm/distance/segment_polyline_distance.hpp>
+#include <geometrix/algorithm/distance/polyline_polyline_distance.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void point_segment_distance(benchmark::State& state)
+{
+    auto points = random_points(1024);
+    auto segments = random_segments(1024);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto i = q++ % points.size();
+        auto d = point_segment_distance_sqrd(points[i], segments[i]);
+        benchmark::DoNotOptimize(d);
+    }
+}
+BENCHMARK(point_segment_distance);
+
+static void segment_segment_distance(benchmark::State& state)
+{
+    auto segments = random_segments(1025);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto i = q++ % (segments.size() - 1);
+        auto d = segment_segment_distance_sqrd(segments[i], segments[i + 1], cmp);
+        benchmark::DoNotOptimize(d);
+    }
+}
+BENCHMARK(segment_segment_distance);
+
+static void point_polyline_distance(benchmark::State& state)
+{
+    auto pline = random_walk_polyline(static_cast<std::size_t>(state.range(0)));
+    auto points = random_points(1024, static_cast<double>(state.range(0)));
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto d = point_polyline_distance_sqrd(points[q++ % points.size()], pline);
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(point_polyline_distance)->RangeMultiplier(4)->Range(16, 16384)->Complexity(benchmark::oN);
+
+static void segment_polyline_distance(benchmark::State& state)
+{
+    auto pline = random_walk_polyline(static_cast<std::size_t>(state.range(0)));
+    auto segments = random_segments(1024, static_cast<double>(state.range(0)));
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto d = segment_polyline_distance_sqrd(segments[q++ % segments.size()], pline, cmp);
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(segment_polyline_distance)->RangeMultiplier(4)->Range(16, 16384)->Complexity(benchmark::oN);
+
+static void polyline_polyline_distance(benchmark::State& state)
+{
+    auto a = random_walk_polyline(static_cast<std::size_t>(state.range(0)), 1.0, default_seed);
+    auto b = random_walk_polyline(static_cast<std::size_t>(state.range(0)), 1.0, default_seed + 1);
+    for (auto& p : b)
+        set<1>(p, get<1>(p) + 10.0);
+    auto cmp = make_cmp();
+    for (auto _ : state)
+    {
+        auto d = polyline_polyline_distance_sqrd(a, b, cmp);
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(polyline_polyline_distance)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
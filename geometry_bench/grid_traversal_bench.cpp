@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////
+// grid_traversal_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/grid_traits.hpp>
+#include <geometrix/algorithm/fast_voxel_grid_traversal.hpp>
+#include <geometrix/algorithm/orientation_grid_traversal.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+namespace {
+
+    //! Segments spanning up to length cells along each axis which lie inside a 1000 x 1000 grid of unit cells.
+    std::vector<segment2> make_traversal_segments(double length)
+    {
+        auto segments = random_segments(1024, 1000.0 - 2.0 * length, length);
+        for (auto& s : segments)
+            s = segment2(get_start(s) + vector2(length, length), get_end(s) + vector2(length, length));
+        return segments;
+    }
+
+}//! namespace;
+
+static void fast_voxel_traversal(benchmark::State& state)
+{
+    grid_traits<double> grid(0.0, 1000.0, 0.0, 1000.0, 1.0);
+    auto segments = make_traversal_segments(static_cast<double>(state.range(0)));
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    std::size_t cells = 0;
+    for (auto _ : state)
+        fast_voxel_grid_traversal(grid, segments[q++ % segments.size()], [&cells](std::uint32_t, std::uint32_t) { ++cells; }, cmp);
+    benchmark::DoNotOptimize(cells);
+    state.SetItemsProcessed(static_cast<std::int64_t>(cells));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(fast_voxel_traversal)->RangeMultiplier(4)->Range(4, 256)->Complexity(benchmark::oN);
+
+static void orientation_traversal(benchmark::State& state)
+{
+    grid_traits<double> grid(0.0, 1000.0, 0.0, 1000.0, 1.0);
+    auto segments = make_traversal_segments(static_cast<double>(state.range(0)));
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    std::size_t cells = 0;
+    for (auto _ : state)
+        orientation_segment_traversal(grid, segments[q++ % segments.size()], [&cells](std::uint32_t, std::uint32_t) { ++cells; }, cmp);
+    benchmark::DoNotOptimize(cells);
+    state.SetItemsProcessed(static_cast<std::int64_t>(cells));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(orientation_traversal)->RangeMultiplier(4)->Range(4, 256)->Complexity(benchmark::oN);
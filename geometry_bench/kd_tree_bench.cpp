@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// kd_tree_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/dynamic_spatial_index.hpp>
+#include <geometrix/algorithm/kd_tree.hpp>
+#include <geometrix/algorithm/median_partitioning_strategy.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void kd_tree_build(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    for (auto _ : state)
+    {
+        kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+        benchmark::DoNotOptimize(&tree);
+    }
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(kd_tree_build)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Complexity(benchmark::oNLogN);
+
+static void kd_tree_search(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+
+    //! Query windows covering about 1% of the domain.
+    auto corners = random_points(256, 900.0, default_seed + 1);
+    std::size_t q = 0;
+    std::size_t found = 0;
+    for (auto _ : state)
+    {
+        auto const& c = corners[q++ % corners.size()];
+        axis_aligned_bounding_box<point2> range(c, point2(get<0>(c) + 100.0, get<1>(c) + 100.0));
+        tree.search(range, [&found](const point2&) { ++found; }, cmp);
+    }
+    benchmark::DoNotOptimize(found);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(kd_tree_search)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Complexity();
+
+//! One update cycle of a tracked point set: every point moves by a small random step.
+static void dynamic_spatial_index_move_all(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto points = random_points(n);
+    dynamic_spatial_index<point2> index;
+    std::vector<dynamic_spatial_index<point2>::proxy_type> proxies;
+    for (std::uint32_t i = 0; i < n; ++i)
+        proxies.push_back(index.insert(points[i], i));
+
+    auto steps = random_points(n, 2.0, default_seed + 1);
+    std::size_t cycle = 0;
+    for (auto _ : state)
+    {
+        auto sign = (cycle++ % 2) ? -1.0 : 1.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            points[i] = point2(get<0>(points[i]) + sign * (get<0>(steps[i]) - 1.0), get<1>(points[i]) + sign * (get<1>(steps[i]) - 1.0));
+            index.move(proxies[i], points[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(dynamic_spatial_index_move_all)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void dynamic_spatial_index_search(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    dynamic_spatial_index<point2> index;
+    for (std::uint32_t i = 0; i < points.size(); ++i)
+        index.insert(points[i], i);
+
+    auto corners = random_points(256, 900.0, default_seed + 1);
+    std::size_t q = 0;
+    std::size_t found = 0;
+    for (auto _ : state)
+    {
+        auto const& c = corners[q++ % corners.size()];
+        axis_aligned_bounding_box<point2> range(c, point2(get<0>(c) + 100.0, get<1>(c) + 100.0));
+        index.search(range, [&found](const point2&) { ++found; }, cmp);
+    }
+    benchmark::DoNotOptimize(found);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(dynamic_spatial_index_search)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Complexity();
+
+static void dynamic_spatial_index_nearest_neighbors(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    dynamic_spatial_index<point2> index;
+    for (std::uint32_t i = 0; i < points.size(); ++i)
+        index.insert(points[i], i);
+
+    auto queries = random_points(256, 1000.0, default_seed + 1);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = index.nearest_neighbors(queries[q++ % queries.size()], 8);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(dynamic_spatial_index_nearest_neighbors)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Complexity(benchmark::oLogN);
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+// mesh_2d_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/mesh_2d.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void mesh_2d_construct(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto grid = make_triangulated_grid(n);
+    auto cmp = make_cmp();
+    for (auto _ : state)
+    {
+        mesh_2d<double> mesh(grid.points, grid.indices, cmp);
+        benchmark::DoNotOptimize(&mesh);
+    }
+    state.SetComplexityN(static_cast<std::int64_t>(2 * n * n));
+}
+BENCHMARK(mesh_2d_construct)->RangeMultiplier(2)->Range(8, 64)->Complexity();
+
+static void mesh_2d_find_triangle(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto grid = make_triangulated_grid(n);
+    auto cmp = make_cmp();
+    mesh_2d<double> mesh(grid.points, grid.indices, cmp);
+    auto queries = random_points(1024, static_cast<double>(n));
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto t = mesh.find_triangle(queries[q++ % queries.size()], cmp);
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetComplexityN(static_cast<std::int64_t>(2 * n * n));
+}
+BENCHMARK(mesh_2d_find_triangle)->RangeMultiplier(2)->Range(8, 128)->Complexity();
+
+static void delaunay_insert_points(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        constrained_delaunay_triangulation<double> cdt(point2(0.0, 0.0), point2(1000.0, 1000.0));
+        auto handles = cdt.insert_points(points);
+        benchmark::DoNotOptimize(handles.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(delaunay_insert_points)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void delaunay_triangulate_star_polygon(benchmark::State& state)
+{
+    auto poly = random_star_polygon(static_cast<std::size_t>(state.range(0)));
+    auto minAngle = state.range(1) ? 20.0 * constants::pi<double>() / 180.0 : 0.0;
+    for (auto _ : state)
+    {
+        constrained_delaunay_triangulation<double> cdt(point2(0.0, 0.0), point2(1000.0, 1000.0));
+        cdt.insert_polygon(poly);
+        cdt.mark_domain();
+        if (minAngle > 0.0)
+            cdt.refine(minAngle);
+        benchmark::DoNotOptimize(cdt.get_number_triangles());
+    }
+}
+BENCHMARK(delaunay_triangulate_star_polygon)->Args({ 1024, 0 })->Args({ 1024, 1 })->Args({ 16384, 0 })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,43 @@
+///////////////////////////////////////////////////////////////////////////////
+// point_in_polygon_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/point_in_polygon.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void point_in_polygon_star(benchmark::State& state)
+{
+    auto poly = random_star_polygon(static_cast<std::size_t>(state.range(0)));
+    auto queries = random_points(1024);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = point_in_polygon(queries[q++ % queries.size()], poly);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(point_in_polygon_star)->RangeMultiplier(4)->Range(16, 16384)->Complexity(benchmark::oN);
+
+static void point_polygon_containment_star(benchmark::State& state)
+{
+    auto poly = random_star_polygon(static_cast<std::size_t>(state.range(0)));
+    auto queries = random_points(1024);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = point_polygon_containment_or_on_border(queries[q++ % queries.size()], poly, cmp);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(point_polygon_containment_star)->RangeMultiplier(4)->Range(16, 16384)->Complexity(benchmark::oN);
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// polyline_station_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/point_sequence/polyline_arc_length_index.hpp>
+#include <geometrix/algorithm/point_sequence/length.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void polyline_point_at_position_walk(benchmark::State& state)
+{
+    auto pline = random_walk_polyline(static_cast<std::size_t>(state.range(0)));
+    auto length = polyline_length(pline);
+    random_real_generator<> rnd(length, default_seed);
+    for (auto _ : state)
+    {
+        auto r = polyline_point_at_position(pline, rnd());
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(polyline_point_at_position_walk)->RangeMultiplier(4)->Range(64, 16384)->Complexity(benchmark::oN);
+
+static void polyline_arc_length_index_point_at(benchmark::State& state)
+{
+    auto pline = random_walk_polyline(static_cast<std::size_t>(state.range(0)));
+    polyline_arc_length_index<polyline2> index(pline);
+    random_real_generator<> rnd(index.get_length(), default_seed);
+    for (auto _ : state)
+    {
+        auto r = index.get_point_at(rnd());
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(polyline_arc_length_index_point_at)->RangeMultiplier(4)->Range(64, 16384)->Complexity(benchmark::oLogN);
+
+static void polyline_arc_length_index_build(benchmark::State& state)
+{
+    auto pline = random_walk_polyline(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        polyline_arc_length_index<polyline2> index(pline);
+        benchmark::DoNotOptimize(index.get_length());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(polyline_arc_length_index_build)->RangeMultiplier(4)->Range(1024, 262144)->Complexity(benchmark::oNLogN);
+
+static void polyline_arc_length_index_closest_point(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto pline = random_walk_polyline(n);
+    polyline_arc_length_index<polyline2> index(pline);
+    random_real_generator<> rnd(1.0, default_seed);
+    for (auto _ : state)
+    {
+        auto r = index.get_station_of_closest_point(point2{ rnd() * static_cast<double>(n), 10.0 * rnd() - 5.0 });
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(polyline_arc_length_index_closest_point)->RangeMultiplier(4)->Range(64, 16384)->Complexity(benchmark::oLogN);
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+// predicates_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/arithmetic/vector.hpp>
+#include <geometrix/algorithm/orientation/point_segment_orientation.hpp>
+#include <geometrix/algorithm/filtered_predicates.hpp>
+
+#include <cmath>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+namespace {
+
+    //! Random triples, or triples on the line y = x perturbed by a few ulps which defeat the floating point filter.
+    std::vector<point2> orientation_triples(bool degenerate)
+    {
+        if (!degenerate)
+            return random_points(3 * 1024);
+
+        random_real_generator<> rnd(64.0);
+        std::vector<point2> points;
+        auto ulp = std::ldexp(1.0, -53);
+        for (std::size_t i = 0; i < 1024; ++i)
+        {
+            points.emplace_back(0.5 + std::floor(rnd()) * ulp, 0.5 + std::floor(rnd()) * ulp);
+            points.emplace_back(12.0, 12.0);
+            points.emplace_back(24.0, 24.0);
+        }
+        return points;
+    }
+
+}//! namespace;
+
+static void orientation_tolerance(benchmark::State& state)
+{
+    auto points = orientation_triples(state.range(0) != 0);
+    auto cmp = make_cmp();
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = get_orientation(points[q], points[q + 1], points[q + 2], cmp);
+        benchmark::DoNotOptimize(r);
+        q = (q + 3) % points.size();
+    }
+}
+BENCHMARK(orientation_tolerance)->Arg(0)->Arg(1);
+
+static void orientation_filtered(benchmark::State& state)
+{
+    auto points = orientation_triples(state.range(0) != 0);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = filtered_orientation(points[q], points[q + 1], points[q + 2]);
+        benchmark::DoNotOptimize(r);
+        q = (q + 3) % points.size();
+    }
+}
+BENCHMARK(orientation_filtered)->Arg(0)->Arg(1);
+
+static void in_circle_filtered(benchmark::State& state)
+{
+    auto points = random_points(4 * 1024);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = filtered_in_circle(points[q], points[q + 1], points[q + 2], points[q + 3]);
+        benchmark::DoNotOptimize(r);
+        q = (q + 4) % points.size();
+    }
+}
+BENCHMARK(in_circle_filtered);
+
+static void segment_classification_filtered(benchmark::State& state)
+{
+    auto segments = random_segments(1024);
+    std::size_t q = 0;
+    for (auto _ : state)
+    {
+        auto r = filtered_segment_segment_classification(segments[q], segments[q + 1]);
+        benchmark::DoNotOptimize(r);
+        q = (q + 2) % segments.size();
+    }
+}
+BENCHMARK(segment_classification_filtered);
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+// segment_intersection_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/all_segment_intersections.hpp>
+#include <geometrix/algorithm/bentley_ottmann_segment_intersection.hpp>
+#include <geometrix/algorithm/intersection/segment_segment_intersection.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+namespace {
+
+    struct counting_visitor
+    {
+        counting_visitor(std::size_t& count)
+            : count(&count)
+        {}
+
+        template <typename Point, typename SegmentIterator>
+        void operator()(const Point&, SegmentIterator, SegmentIterator) const
+        {
+            ++*count;
+        }
+
+        std::size_t* count;
+    };
+
+}//! namespace;
+
+static void bentley_ottmann(benchmark::State& state)
+{
+    auto segments = random_segments(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    std::size_t count = 0;
+    for (auto _ : state)
+        bentley_ottmann_segment_intersection(segments, counting_visitor(count), cmp);
+    benchmark::DoNotOptimize(count);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(bentley_ottmann)->RangeMultiplier(4)->Range(64, 4096)->Complexity(benchmark::oNLogN);
+
+//! The quadratic baseline which the sweep should beat.
+static void brute_force_segment_intersections(benchmark::State& state)
+{
+    auto segments = random_segments(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    std::size_t count = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < segments.size(); ++j)
+            {
+                point2 xPoints[2];
+                if (segment_segment_intersection(segments[i], segments[j], xPoints, cmp) != e_non_crossing)
+                    ++count;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(count);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(brute_force_segment_intersections)->RangeMultiplier(4)->Range(64, 4096)->Complexity(benchmark::oNSquared);
+
+//! Grid bucketed pairs tested in parallel; the argument is the number of threads.
+static void grid_all_segment_intersections(benchmark::State& state)
+{
+    auto segments = random_segments(static_cast<std::size_t>(state.range(0)));
+    auto cmp = make_cmp();
+    auto nThreads = static_cast<std::size_t>(state.range(1));
+    std::size_t count = 0;
+    for (auto _ : state)
+        count += all_segment_intersections(segments, [](std::size_t, std::size_t, intersection_type, const point2&, const point2&) {}, cmp, nThreads);
+    benchmark::DoNotOptimize(count);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(grid_all_segment_intersections)->ArgsProduct({ { 1024, 4096, 16384 }, { 1, 4 } })->UseRealTime();
@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+// transform_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algorithm/affine_transform.hpp>
+#include <geometrix/algorithm/rotation.hpp>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+static void rotate_translate_points_per_point(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    vector2 v1{ 1.0, 0.0 }, v2{ std::cos(0.3), std::sin(0.3) };
+    vector2 t{ 10.0, -5.0 };
+    point2 origin{ 3.0, 4.0 };
+    for (auto _ : state)
+    {
+        auto r = rotate_translate_points(points, v1, v2, t, origin);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(rotate_translate_points_per_point)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void affine_transform_points_serial(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    std::vector<point2> result(points.size());
+    auto xf = affine_transform_2d::translation(vector2{ 10.0, -5.0 }) * affine_transform_2d::rotation(0.3, point2{ 3.0, 4.0 });
+    for (auto _ : state)
+    {
+        transform_points(xf, points, result, 1);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(affine_transform_points_serial)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void affine_transform_points_parallel(benchmark::State& state)
+{
+    auto points = random_points(static_cast<std::size_t>(state.range(0)));
+    std::vector<point2> result(points.size());
+    auto xf = affine_transform_2d::translation(vector2{ 10.0, -5.0 }) * affine_transform_2d::rotation(0.3, point2{ 3.0, 4.0 });
+    for (auto _ : state)
+    {
+        transform_points(xf, points, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(affine_transform_points_parallel)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
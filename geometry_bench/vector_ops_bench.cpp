@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// vector_ops_bench.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//! Each geometrix operation is paired with the hand-written loop it should compile down to on contiguous double storage.
+
+#include <benchmark/benchmark.h>
+#include "./benchmark_data.hpp"
+
+#include <geometrix/algebra/cross_product.hpp>
+#include <geometrix/algebra/dot_product.hpp>
+#include <geometrix/algorithm/orientation/point_segment_orientation.hpp>
+#include <geometrix/arithmetic/vector/magnitude.hpp>
+#include <geometrix/arithmetic/vector/normalize.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace geometrix;
+using namespace geometrix::benchmark_data;
+
+namespace {
+
+    typedef vector_double_3d vector3;
+
+    std::vector<vector3> random_vectors3(std::size_t n)
+    {
+        random_real_generator<> rnd(1.0, default_seed);
+        std::vector<vector3> result;
+        result.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            result.emplace_back(rnd() - 0.5, rnd() - 0.5, rnd() - 0.5);
+        return result;
+    }
+
+    const std::size_t n_vectors = 4096;
+
+}//! namespace;
+
+static void dot_product_3d(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (std::size_t i = 1; i < v.size(); ++i)
+            sum += dot_product(v[i - 1], v[i]);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (v.size() - 1));
+}
+BENCHMARK(dot_product_3d);
+
+static void dot_product_3d_hand_written(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (std::size_t i = 1; i < v.size(); ++i)
+        {
+            const double* a = &v[i - 1][0];
+            const double* b = &v[i][0];
+            sum += a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (v.size() - 1));
+}
+BENCHMARK(dot_product_3d_hand_written);
+
+static void normalize_3d(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    std::vector<vector3> r(v.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < v.size(); ++i)
+            r[i] = normalize(v[i]);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+BENCHMARK(normalize_3d);
+
+static void normalize_3d_hand_written(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    std::vector<vector3> r(v.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            const double* a = &v[i][0];
+            double f = 1.0 / std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+            r[i][0] = a[0] * f;
+            r[i][1] = a[1] * f;
+            r[i][2] = a[2] * f;
+        }
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+BENCHMARK(normalize_3d_hand_written);
+
+static void cross_product_3d(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    std::vector<vector3> r(v.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 1; i < v.size(); ++i)
+            r[i] = cross_product(v[i - 1], v[i]);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (v.size() - 1));
+}
+BENCHMARK(cross_product_3d);
+
+static void cross_product_3d_hand_written(benchmark::State& state)
+{
+    auto v = random_vectors3(n_vectors);
+    std::vector<vector3> r(v.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 1; i < v.size(); ++i)
+        {
+            const double* a = &v[i - 1][0];
+            const double* b = &v[i][0];
+            r[i][0] = a[1] * b[2] - a[2] * b[1];
+            r[i][1] = a[2] * b[0] - a[0] * b[2];
+            r[i][2] = a[0] * b[1] - a[1] * b[0];
+        }
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (v.size() - 1));
+}
+BENCHMARK(cross_product_3d_hand_written);
+
+static void get_orientation_2d(benchmark::State& state)
+{
+    auto p = random_points(n_vectors);
+    auto cmp = make_cmp();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (std::size_t i = 2; i < p.size(); ++i)
+            sum += get_orientation(p[i - 2], p[i - 1], p[i], cmp);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (p.size() - 2));
+}
+BENCHMARK(get_orientation_2d);
+
+static void get_orientation_2d_hand_written(benchmark::State& state)
+{
+    auto p = random_points(n_vectors);
+    auto cmp = make_cmp();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (std::size_t i = 2; i < p.size(); ++i)
+        {
+            const double* a = &p[i - 2][0];
+            const double* b = &p[i - 1][0];
+            const double* c = &p[i][0];
+            double lhs = (c[1] - a[1]) * (b[0] - a[0]);
+            double rhs = (c[0] - a[0]) * (b[1] - a[1]);
+            sum += cmp.less_than(lhs, rhs) ? oriented_right : (cmp.greater_than(lhs, rhs) ? oriented_left : oriented_collinear);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (p.size() - 2));
+}
+BENCHMARK(get_orientation_2d_hand_written);
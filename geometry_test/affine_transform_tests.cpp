@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// affine_transform_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/affine_transform.hpp>
+#include <geometrix/algorithm/rotation.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cstring>
+#include <list>
+#include <vector>
+
+namespace {
+
+    template <typename Points>
+    Points make_random_points(std::size_t n)
+    {
+        geometrix::random_real_generator<> rnd(1000.0);
+        Points result;
+        for (std::size_t i = 0; i < n; ++i)
+            result.emplace_back(rnd(), rnd());
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, affine_transform_composition_matches_rotate_translate_points)
+{
+    using namespace geometrix;
+
+    auto points = make_random_points<polyline2>(100);
+    vector2 v1{ 1.0, 0.0 }, v2{ 0.0, 1.0 };
+    vector2 t{ 10.0, -5.0 };
+    point2 origin{ 3.0, 4.0 };
+    auto expected = rotate_translate_points(points, v1, v2, t, origin);
+
+    //! Translate to the origin, rotate, translate back and then by t fused into one transform.
+    auto xf = affine_transform_2d::translation(vector2{ -3.0, -4.0 })
+        .then(affine_transform_2d::linear(make_rotation_matrix(v1, v2)))
+        .then(affine_transform_2d::translation(vector2{ 3.0, 4.0 }))
+        .then(affine_transform_2d::translation(t));
+    auto rot = affine_transform_2d::translation(t) * affine_transform_2d::rotation(constants::pi<double>() / 2.0, origin);
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 15.0, 0.0 }, xf(point2{ 4.0, 2.0 }), cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 15.0, 0.0 }, rot(point2{ 4.0, 2.0 }), cmp));
+
+    polyline2 result(points.size());
+    transform_points(xf, points, result);
+    EXPECT_TRUE(point_sequences_equal(expected, result, cmp));
+
+    //! In place.
+    transform_points(xf, points);
+    EXPECT_TRUE(point_sequences_equal(expected, points, cmp));
+}
+
+TEST_F(geometry_kernel_2d_fixture, affine_transform_batches_match_single_point_transform)
+{
+    using namespace geometrix;
+
+    //! Long enough to be transformed in several batches, with an odd number of points for the vector kernel tail.
+    auto points = make_random_points<std::vector<point2>>(3 * affine_transform_detail::batch_size + 3);
+    auto xf = affine_transform_2d::rotation(0.3) * affine_transform_2d::scaling(2.0) * affine_transform_2d::translation(vector2{ 1.0, 2.0 });
+
+    std::vector<point2> serial(points.size()), parallel(points.size());
+    transform_points(xf, points, serial, 1);
+    transform_points(xf, points, parallel, 4);
+    EXPECT_EQ(0, std::memcmp(serial.data(), parallel.data(), serial.size() * sizeof(point2)));
+    for (std::size_t i = 0; i < points.size(); i += 97)
+        EXPECT_TRUE(numeric_sequence_equals(xf(points[i]), serial[i], cmp));
+
+    //! Ranges without contiguous storage take the generic path.
+    std::list<point2> list(points.begin(), points.begin() + 1001);
+    std::list<point2> listResult(list.size());
+    transform_points(xf, list, listResult);
+    auto it = listResult.begin();
+    for (std::size_t i = 0; i < list.size(); ++i, ++it)
+        ASSERT_TRUE(numeric_sequence_equals(serial[i], *it, cmp));
+
+    //! The inverse restores the points.
+    transform_points(xf.inverse(), serial);
+    EXPECT_TRUE(xf.inverse().is_affine());
+    for (std::size_t i = 0; i < points.size(); i += 97)
+        EXPECT_TRUE(numeric_sequence_equals(points[i], serial[i], absolute_tolerance_comparison_policy<double>(1e-9)));
+}
+
+TEST_F(geometry_kernel_2d_fixture, affine_transform_3d_and_projective)
+{
+    using namespace geometrix;
+
+    typedef point_double_3d point3;
+    std::vector<point3> points{ { 1.0, 2.0, 3.0 }, { -1.0, 0.5, 2.0 }, { 4.0, -3.0, 1.0 } };
+    auto xf = affine_transform_3d::rotation(constants::pi<double>() / 2.0) * affine_transform_3d::translation(vector_double_3d{ 1.0, 1.0, 1.0 });
+    transform_points(xf, points);
+    EXPECT_TRUE(numeric_sequence_equals(point3{ -3.0, 2.0, 4.0 }, points[0], cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point3{ 2.0, 5.0, 2.0 }, points[2], cmp));
+
+    //! A perspective projection onto the plane z = 1.
+    affine_transform_3d::matrix_type m = { { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 1, 0 } } };
+    affine_transform_3d proj(m);
+    EXPECT_FALSE(proj.is_affine());
+    std::vector<point3> projected(points.size());
+    transform_points(proj, points, projected);
+    EXPECT_TRUE(numeric_sequence_equals(point3{ -0.75, 0.5, 1.0 }, projected[0], cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point3{ 1.0, 2.5, 1.0 }, projected[2], cmp));
+}
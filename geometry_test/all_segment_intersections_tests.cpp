@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+// all_segment_intersections_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/all_segment_intersections.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <tuple>
+#include <vector>
+
+namespace {
+
+    template <typename Segments, typename NumberComparisonPolicy>
+    std::vector<std::tuple<std::size_t, std::size_t, geometrix::intersection_type>> brute_force_intersections(const Segments& segments, const NumberComparisonPolicy& cmp)
+    {
+        using namespace geometrix;
+        std::vector<std::tuple<std::size_t, std::size_t, intersection_type>> result;
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < segments.size(); ++j)
+            {
+                typename geometric_traits<typename Segments::value_type>::point_type xPoints[2];
+                auto iType = segment_segment_intersection(segments[i], segments[j], xPoints, cmp);
+                if (iType != e_non_crossing)
+                    result.emplace_back(i, j, iType);
+            }
+        }
+        return result;
+    }
+
+    template <typename Segments, typename NumberComparisonPolicy>
+    std::vector<std::tuple<std::size_t, std::size_t, geometrix::intersection_type>> grid_intersections(const Segments& segments, const NumberComparisonPolicy& cmp, std::size_t nThreads)
+    {
+        using namespace geometrix;
+        std::vector<std::tuple<std::size_t, std::size_t, intersection_type>> result;
+        auto n = all_segment_intersections(segments, [&](std::size_t i, std::size_t j, intersection_type iType, const typename geometric_traits<typename Segments::value_type>::point_type&, const typename geometric_traits<typename Segments::value_type>::point_type&)
+        {
+            result.emplace_back(i, j, iType);
+        }, cmp, nThreads);
+        EXPECT_EQ(n, result.size());
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, all_segment_intersections_matches_brute_force_on_random_segments)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<segment2> segments;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        auto p = point2{ rnd(), rnd() };
+        segments.emplace_back(p, point2{ p[0] + 0.1 * rnd() - 5.0, p[1] + 0.1 * rnd() - 5.0 });
+    }
+
+    auto expected = brute_force_intersections(segments, cmp);
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(expected, grid_intersections(segments, cmp, 1));
+    EXPECT_EQ(expected, grid_intersections(segments, cmp, 8));
+}
+
+TEST_F(geometry_kernel_2d_fixture, all_segment_intersections_matches_brute_force_on_grid_aligned_segments)
+{
+    using namespace geometrix;
+
+    //! Segments along cell boundaries and through cell corners of a grid with unit cells.
+    std::vector<segment2> segments;
+    for (int i = 0; i < 10; ++i)
+    {
+        segments.emplace_back(point2{ 0.0, double(i) }, point2{ 10.0, double(i) });
+        segments.emplace_back(point2{ double(i), 0.0 }, point2{ double(i), 10.0 });
+        segments.emplace_back(point2{ double(i), 0.0 }, point2{ 10.0, 10.0 - i });
+        segments.emplace_back(point2{ 10.0 - i, 0.0 }, point2{ 0.0, 10.0 - i });
+        segments.emplace_back(point2{ double(i), double(i) }, point2{ double(i) + 1.0, double(i) });
+    }
+    //! Collinear overlaps and a degenerate segment.
+    segments.emplace_back(point2{ 2.0, 3.0 }, point2{ 7.0, 3.0 });
+    segments.emplace_back(point2{ 5.0, 5.0 }, point2{ 5.0, 5.0 });
+
+    auto expected = brute_force_intersections(segments, cmp);
+    auto grid = make_segment_intersection_grid(segments, 1.0);
+    auto records = find_segment_intersections(segments, grid, cmp);
+    std::vector<std::tuple<std::size_t, std::size_t, intersection_type>> result;
+    for (auto const& r : records)
+        result.emplace_back(r.first, r.second, r.type);
+    EXPECT_EQ(expected, result);
+
+    //! The default grid gives the same result.
+    EXPECT_EQ(expected, grid_intersections(segments, cmp, 4));
+}
+
+TEST_F(geometry_kernel_2d_fixture, all_segment_intersections_reports_intersection_points)
+{
+    using namespace geometrix;
+
+    std::vector<segment2> segments{ segment2{ 0, 0, 2, 2 }, segment2{ 0, 2, 2, 0 }, segment2{ 3, 3, 4, 4 } };
+    std::vector<point2> points;
+    auto n = all_segment_intersections(segments, [&](std::size_t i, std::size_t j, intersection_type iType, const point2& x0, const point2&)
+    {
+        EXPECT_EQ(0, i);
+        EXPECT_EQ(1, j);
+        EXPECT_EQ(e_crossing, iType);
+        points.push_back(x0);
+    }, cmp);
+
+    ASSERT_EQ(1, n);
+    EXPECT_NEAR(1.0, points[0][0], 1e-10);
+    EXPECT_NEAR(1.0, points[0][1], 1e-10);
+
+    std::vector<segment2> empty;
+    EXPECT_EQ(0, all_segment_intersections(empty, [](std::size_t, std::size_t, intersection_type, const point2&, const point2&) {}, cmp));
+}
@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////
+// binary_image_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/kd_tree_view.hpp>
+#include <geometrix/algorithm/median_partitioning_strategy.hpp>
+#include <geometrix/algorithm/solid_leaf_bsp_tree_view.hpp>
+#include <geometrix/algorithm/node_bsp_tree_2d_view.hpp>
+#include <geometrix/algorithm/hyperplane_partition_policies.hpp>
+#include <geometrix/algorithm/intersection/ray_segment_intersection.hpp>
+#include <geometrix/algorithm/mesh_2d_view.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+    //! Copy the image into 8 byte aligned memory as a file mapping would provide.
+    template <typename Structure>
+    std::vector<std::uint64_t> to_buffer(const Structure& s, std::size_t& size)
+    {
+        std::ostringstream os;
+        geometrix::make_binary_image(s).write(os);
+        auto bytes = os.str();
+        size = bytes.size();
+        std::vector<std::uint64_t> buffer((size + 7) / 8);
+        std::memcpy(buffer.data(), bytes.data(), size);
+        return buffer;
+    }
+
+    std::vector<geometry_kernel_2d_fixture::segment2> square_with_hole()
+    {
+        using namespace geometrix;
+        using segment2 = geometry_kernel_2d_fixture::segment2;
+        using polygon2 = geometry_kernel_2d_fixture::polygon2;
+        polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } };
+        polygon2 hole{ { 3, 3 }, { 3, 7 }, { 7, 7 }, { 7, 3 } };
+        std::vector<segment2> segments;
+        for (auto const& s : polygon_as_segment_range<segment2>(outer))
+            segments.push_back(s);
+        for (auto const& s : polygon_as_segment_range<segment2>(hole))
+            segments.push_back(s);
+        return segments;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_kd_tree_view_search_matches_tree)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    std::vector<point2> points;
+    for (std::size_t i = 0; i < 300; ++i)
+        points.emplace_back(rnd(), rnd());
+
+    kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+    std::size_t size;
+    auto buffer = to_buffer(tree, size);
+    kd_tree_view<point2> sut(buffer.data(), size);
+    EXPECT_EQ(points.size(), sut.size());
+
+    for (int q = 0; q < 20; ++q)
+    {
+        auto p = point2{ rnd(), rnd() };
+        auto box = aabb2{ p, point2{ p[0] + 0.3 * rnd(), p[1] + 0.3 * rnd() } };
+        std::vector<point2> expected, result;
+        tree.search(box, [&](const point2& x) { expected.push_back(x); }, cmp);
+        sut.search(box, [&](const point2& x) { result.push_back(x); }, cmp);
+        ASSERT_EQ(expected.size(), result.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            EXPECT_TRUE(numeric_sequence_equals(expected[i], result[i], cmp));
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_solid_leaf_bsp_tree_view_queries_match_tree)
+{
+    using namespace geometrix;
+    using solid_bsp2 = solid_leaf_bsp_tree<segment2>;
+
+    auto segments = square_with_hole();
+    auto partitionPolicy = partition_policies::scored_selector_policy<identity_simplex_extractor, decltype(cmp)>(identity_simplex_extractor(), cmp);
+    solid_bsp2 tree(segments, partitionPolicy, cmp, identity_simplex_extractor());
+
+    std::size_t size;
+    auto buffer = to_buffer(tree, size);
+    solid_leaf_bsp_tree_view<segment2> sut(buffer.data(), size);
+
+    random_real_generator<> rnd(12.0);
+    for (int i = 0; i < 200; ++i)
+    {
+        auto p = point2{ rnd() - 1.0, rnd() - 1.0 };
+        EXPECT_EQ(tree.point_in_solid_space(p, cmp), sut.point_in_solid_space(p, cmp));
+
+        std::size_t treeIndex, viewIndex;
+        EXPECT_DOUBLE_EQ(tree.get_min_distance_sqrd_to_solid(p, treeIndex, cmp), sut.get_min_distance_sqrd_to_solid(p, viewIndex, cmp));
+        EXPECT_EQ(treeIndex, viewIndex);
+
+        auto v = vector2{ rnd() - 6.0, rnd() - 6.0 };
+        if (magnitude_sqrd(v) < 1e-6)
+            continue;
+        dimensionless2 d = normalize(v);
+        auto expected = tree.ray_intersection(p, d, cmp);
+        auto result = sut.ray_intersection(p, d, cmp);
+        ASSERT_EQ(static_cast<bool>(expected), static_cast<bool>(result));
+        if (expected)
+        {
+            EXPECT_DOUBLE_EQ(expected.intersection_distance(), result.intersection_distance());
+            EXPECT_EQ(expected.get_data(), result.get_data());
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_node_bsp_tree_2d_view_locate_point_matches_tree)
+{
+    using namespace geometrix;
+
+    auto segments = square_with_hole();
+    node_bsp_tree_2d<segment2> tree(segments, partition_policies::first_segment_selector_policy<segment2>(), cmp);
+
+    std::size_t size;
+    auto buffer = to_buffer(tree, size);
+    node_bsp_tree_2d_view<segment2> sut(buffer.data(), size);
+
+    random_real_generator<> rnd(12.0);
+    for (int i = 0; i < 200; ++i)
+    {
+        auto p = point2{ rnd() - 1.0, rnd() - 1.0 };
+        EXPECT_EQ(tree.locate_point(p, cmp), sut.locate_point(p, cmp));
+    }
+    EXPECT_EQ(e_boundary, sut.locate_point(point2{ 5, 0 }, cmp));
+    EXPECT_EQ(e_outside, sut.locate_point(point2{ 5, 5 }, cmp));
+    EXPECT_EQ(e_inside, sut.locate_point(point2{ 1, 1 }, cmp));
+}
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_mesh_2d_view_matches_mesh)
+{
+    using namespace geometrix;
+
+    polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 5, 6 }, { 0, 10 } };
+    std::vector<polygon2> holes{ polygon2{ { 2, 2 }, { 2, 4 }, { 4, 4 }, { 4, 2 } } };
+    auto mesh = make_delaunay_mesh(outer, holes, cmp, 25.0 * constants::pi<double>() / 180.0, 0.5);
+
+    std::size_t size;
+    auto buffer = to_buffer(mesh, size);
+    mesh_2d_view<double> sut(buffer.data(), size);
+    ASSERT_EQ(mesh.get_number_triangles(), sut.get_number_triangles());
+    ASSERT_EQ(mesh.get_number_vertices(), sut.get_number_vertices());
+
+    for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+    {
+        EXPECT_EQ(mesh.get_triangle_indices(i), sut.get_triangle_indices(i));
+        EXPECT_EQ(mesh.get_adjacency_matrix()[i], sut.get_adjacent_triangles(i));
+    }
+
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 200; ++i)
+    {
+        auto p = point2{ 11.0 * rnd() - 0.5, 11.0 * rnd() - 0.5 };
+        EXPECT_TRUE(mesh.find_triangle(p, cmp) == sut.find_triangle(p, cmp));
+
+        auto rT = rnd(), r1 = rnd(), r2 = rnd();
+        EXPECT_TRUE(numeric_sequence_equals(mesh.get_random_position(rT, r1, r2), sut.get_random_position(rT, r1, r2), cmp));
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_mapped_file_round_trip)
+{
+    using namespace geometrix;
+
+    std::vector<point2> points;
+    for (int i = 0; i < 10; ++i)
+        for (int j = 0; j < 10; ++j)
+            points.emplace_back(i, j);
+    kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+
+    auto fileName = ::testing::TempDir() + "geometrix_binary_image_test.gx";
+    make_binary_image(tree).write(fileName);
+    {
+        mapped_binary_image file(fileName);
+        kd_tree_view<point2> sut(file);
+        EXPECT_EQ(points.size(), sut.size());
+        std::size_t count = 0;
+        auto box = aabb2{ point2{ 2.5, 2.5 }, point2{ 5.5, 4.5 } };
+        sut.search(box, [&](const point2& x) { if (box.intersects(x)) ++count; }, cmp);
+        EXPECT_EQ(6, count);
+    }
+    std::remove(fileName.c_str());
+
+    EXPECT_THROW(mapped_binary_image("no/such/directory/image.gx"), binary_image_error);
+}
+
+TEST_F(geometry_kernel_2d_fixture, binary_image_rejects_mismatched_or_damaged_images)
+{
+    using namespace geometrix;
+
+    std::vector<point2> points{ { 0, 0 }, { 1, 1 }, { 2, 0 } };
+    kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+    std::size_t size;
+    auto buffer = to_buffer(tree, size);
+    EXPECT_NO_THROW(kd_tree_view<point2>(buffer.data(), size));
+
+    //! Another structure, scalar type or dimension.
+    EXPECT_THROW(mesh_2d_view<double>(buffer.data(), size), binary_image_error);
+    EXPECT_THROW(kd_tree_view<point_float_2d>(buffer.data(), size), binary_image_error);
+    EXPECT_THROW(kd_tree_view<point_double_3d>(buffer.data(), size), binary_image_error);
+
+    //! Truncated.
+    EXPECT_THROW(kd_tree_view<point2>(buffer.data(), 16), binary_image_error);
+    EXPECT_THROW(kd_tree_view<point2>(buffer.data(), size - 8), binary_image_error);
+
+    //! Another format version.
+    auto damaged = buffer;
+    reinterpret_cast<std::uint32_t*>(damaged.data())[2] += 1;
+    EXPECT_THROW(kd_tree_view<point2>(damaged.data(), size), binary_image_error);
+
+    //! Not an image.
+    damaged = buffer;
+    reinterpret_cast<char*>(damaged.data())[0] = 'X';
+    EXPECT_THROW(kd_tree_view<point2>(damaged.data(), size), binary_image_error);
+}
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+// bounding_volume_hierarchy_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/bounding_volume_hierarchy_queries.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <set>
+#include <vector>
+
+namespace {
+
+    template <typename Point>
+    std::set<std::uint32_t> query_all(const geometrix::bounding_volume_hierarchy<Point>& bvh, const geometrix::axis_aligned_bounding_box<Point>& box)
+    {
+        std::set<std::uint32_t> result;
+        bvh.query(box, [&](std::uint32_t i) { result.insert(i); return true; });
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, bounding_volume_hierarchy_overlap_query_matches_brute_force_after_build_and_updates)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<aabb2> boxes;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto p = point2{ rnd(), rnd() };
+        boxes.emplace_back(p, point2{ p[0] + 0.02 * rnd(), p[1] + 0.02 * rnd() });
+    }
+
+    bounding_volume_hierarchy<point2> sut(0.1);
+    auto proxies = sut.build(boxes);
+    EXPECT_EQ(boxes.size(), sut.size());
+
+    auto check = [&]()
+    {
+        for (int q = 0; q < 20; ++q)
+        {
+            auto p = point2{ rnd(), rnd() };
+            auto box = aabb2{ p, point2{ p[0] + 0.1 * rnd(), p[1] + 0.1 * rnd() } };
+            std::set<std::uint32_t> expected;
+            for (std::uint32_t i = 0; i < boxes.size(); ++i)
+                if (proxies[i] != bounding_volume_hierarchy<point2>::null_proxy && box.intersects(boxes[i]))
+                    expected.insert(i);
+
+            //! Leaves are fattened, so filter candidates by the exact boxes.
+            std::set<std::uint32_t> result;
+            for (auto i : query_all(sut, box))
+                if (box.intersects(boxes[i]))
+                    result.insert(i);
+            EXPECT_EQ(expected, result);
+        }
+    };
+
+    check();
+
+    //! Move everything, remove some and insert others.
+    for (std::uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        auto v = vector2{ 0.1 * rnd() - 5.0, 0.1 * rnd() - 5.0 };
+        boxes[i] = aabb2{ construct<point2>(boxes[i].get_lower_bound() + v), construct<point2>(boxes[i].get_upper_bound() + v) };
+        if (i % 7 == 0)
+        {
+            sut.erase(proxies[i]);
+            proxies[i] = bounding_volume_hierarchy<point2>::null_proxy;
+        }
+        else if (i % 2)
+            sut.move(proxies[i], boxes[i]);
+        else
+            sut.refit(proxies[i], boxes[i]);
+    }
+    check();
+
+    for (std::uint32_t i = 0; i < boxes.size(); i += 7)
+        proxies[i] = sut.insert(boxes[i], i);
+    EXPECT_EQ(boxes.size(), sut.size());
+    check();
+
+    //! Insertion keeps the tree balanced.
+    EXPECT_LT(sut.get_height(), 30);
+
+    sut.rebuild();
+    EXPECT_EQ(boxes.size(), sut.size());
+    check();
+}
+
+TEST_F(geometry_kernel_2d_fixture, bounding_volume_hierarchy_ray_cast_finds_first_segment)
+{
+    using namespace geometrix;
+
+    std::vector<segment2> segments;
+    for (int i = 1; i <= 100; ++i)
+        segments.emplace_back(point2{ double(i), -1.0 }, point2{ double(i), 1.0 });
+
+    auto bvh = make_bounding_volume_hierarchy<point2>(segments);
+
+    double t = 0;
+    auto hit = bvh_ray_cast(bvh, segments, point2{ 10.5, 0.0 }, vector2{ 1, 0 }, 1000.0, t, cmp);
+    EXPECT_EQ(10, hit);
+    EXPECT_NEAR(0.5, t, 1e-10);
+
+    hit = bvh_ray_cast(bvh, segments, point2{ 10.5, 0.0 }, vector2{ -1, 0 }, 1000.0, t, cmp);
+    EXPECT_EQ(9, hit);
+    EXPECT_NEAR(0.5, t, 1e-10);
+
+    //! Out of range.
+    hit = bvh_ray_cast(bvh, segments, point2{ 10.5, 0.0 }, vector2{ 1, 0 }, 0.25, t, cmp);
+    EXPECT_EQ(bounding_volume_hierarchy<point2>::null_proxy, hit);
+
+    hit = bvh_ray_cast(bvh, segments, point2{ 10.5, 2.0 }, vector2{ 1, 0 }, 1000.0, t, cmp);
+    EXPECT_EQ(bounding_volume_hierarchy<point2>::null_proxy, hit);
+}
+
+TEST_F(geometry_kernel_2d_fixture, bounding_volume_hierarchy_segment_query_matches_brute_force_on_triangles)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<triangle<point2>> triangles;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        auto p = point2{ rnd(), rnd() };
+        triangles.push_back(construct<triangle<point2>>(p, point2{ p[0] + 0.02 * rnd(), p[1] }, point2{ p[0], p[1] + 0.02 * rnd() }));
+    }
+
+    auto bvh = make_bounding_volume_hierarchy<point2>(triangles);
+    for (int q = 0; q < 50; ++q)
+    {
+        auto a = point2{ rnd(), rnd() };
+        auto b = point2{ rnd(), rnd() };
+        std::set<std::uint32_t> expected;
+        for (std::uint32_t i = 0; i < triangles.size(); ++i)
+            if (segment_triangle_intersect(a, b, triangles[i][0], triangles[i][1], triangles[i][2]))
+                expected.insert(i);
+
+        std::set<std::uint32_t> result;
+        bvh_segment_query(bvh, triangles, a, b, [&](std::uint32_t i) { result.insert(i); return true; }, cmp);
+        EXPECT_EQ(expected, result);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, bounding_volume_hierarchy_nearest_primitive_matches_brute_force)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<polygon2> polygons;
+    for (std::size_t i = 0; i < 300; ++i)
+    {
+        auto x = rnd(), y = rnd();
+        auto s = 0.01 * rnd() + 0.1;
+        polygons.push_back(polygon2{ { x, y }, { x + s, y }, { x + s, y + s }, { x, y + s } });
+    }
+
+    auto bvh = make_bounding_volume_hierarchy<point2>(polygons);
+    for (int q = 0; q < 100; ++q)
+    {
+        auto p = point2{ rnd(), rnd() };
+        auto expected = std::numeric_limits<double>::infinity();
+        for (auto const& poly : polygons)
+            expected = (std::min)(expected, point_in_polygon(p, poly) ? 0.0 : point_polygon_distance_sqrd(p, poly));
+
+        auto result = bvh_nearest_primitive(bvh, polygons, p, cmp);
+        ASSERT_NE(bounding_volume_hierarchy<point2>::null_proxy, result.first);
+        EXPECT_DOUBLE_EQ(expected, result.second);
+    }
+
+    //! Inside a polygon the distance is zero.
+    auto result = bvh_nearest_primitive(bvh, polygons, point2{ polygons[3][0][0] + 0.05, polygons[3][0][1] + 0.05 }, cmp);
+    EXPECT_EQ(0.0, result.second);
+}
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// broad_phase_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/broad_phase/sweep_and_prune.hpp>
+#include <geometrix/algorithm/broad_phase/moving_collision_detection.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <vector>
+
+namespace {
+
+    template <typename Boxes>
+    std::vector<geometrix::broad_phase_pair> brute_force_pairs(const Boxes& boxes)
+    {
+        std::vector<geometrix::broad_phase_pair> pairs;
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+            for (std::uint32_t j = i + 1; j < boxes.size(); ++j)
+                if (boxes[i].intersects(boxes[j]))
+                    pairs.push_back(geometrix::broad_phase_pair{ i, j });
+        return pairs;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, sweep_and_prune_matches_brute_force_over_moving_frames)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<aabb2> boxes;
+    std::vector<vector2> velocities;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        auto p = point2{ rnd(), rnd() };
+        boxes.emplace_back(p, point2{ p[0] + 0.01 * rnd() + 0.5, p[1] + 0.01 * rnd() + 0.5 });
+        velocities.push_back(vector2{ 0.02 * rnd() - 1.0, 0.02 * rnd() - 1.0 });
+    }
+
+    sweep_and_prune<point2> sut(64, 4);
+    for (auto const& b : boxes)
+        sut.insert(b);
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        EXPECT_EQ(brute_force_pairs(boxes), sut.update_pairs());
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i] = aabb2{ construct<point2>(boxes[i].get_lower_bound() + velocities[i]), construct<point2>(boxes[i].get_upper_bound() + velocities[i]) };
+            sut.update(i, boxes[i]);
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, sweep_and_prune_erase_and_reinsert_recycles_proxies)
+{
+    using namespace geometrix;
+
+    sweep_and_prune<point2> sut;
+    auto a = sut.insert(aabb2{ point2{ 0, 0 }, point2{ 1, 1 } });
+    auto b = sut.insert(aabb2{ point2{ 0.5, 0.5 }, point2{ 2, 2 } });
+    auto c = sut.insert(aabb2{ point2{ 1.5, 1.5 }, point2{ 3, 3 } });
+
+    EXPECT_EQ((std::vector<broad_phase_pair>{ { a, b }, { b, c } }), sut.update_pairs());
+
+    sut.erase(b);
+    EXPECT_TRUE(sut.update_pairs().empty());
+    EXPECT_EQ(2, sut.size());
+
+    auto d = sut.insert(aabb2{ point2{ 0.9, 0.9 }, point2{ 1.6, 1.6 } });
+    EXPECT_EQ(b, d);
+    EXPECT_EQ((std::vector<broad_phase_pair>{ { a, d }, { d, c } }), sut.update_pairs());
+}
+
+TEST_F(geometry_kernel_2d_fixture, sweep_and_prune_output_is_independent_of_thread_count)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(50.0);
+    sweep_and_prune<point2> serial(16, 1);
+    sweep_and_prune<point2> parallel(16, 8);
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        auto p = point2{ rnd(), rnd() };
+        auto box = aabb2{ p, point2{ p[0] + 1.0, p[1] + 1.0 } };
+        serial.insert(box);
+        parallel.insert(box);
+    }
+
+    EXPECT_EQ(serial.update_pairs(), parallel.update_pairs());
+}
+
+TEST_F(geometry_kernel_2d_fixture, moving_collision_detector_reports_time_of_impact_for_spheres)
+{
+    using namespace geometrix;
+
+    std::vector<circle2> circles = { circle2{ point2{ 0, 0 }, 1.0 }, circle2{ point2{ 10, 0 }, 1.0 }, circle2{ point2{ 0, 50 }, 1.0 } };
+    std::vector<vector2> velocities = { vector2{ 1, 0 }, vector2{ -1, 0 }, vector2{ 0, 1 } };
+
+    moving_collision_detector<point2> sut;
+    auto result = sut.detect(circles, velocities, 10.0, cmp);
+
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ(0, result[0].first);
+    EXPECT_EQ(1, result[0].second);
+    EXPECT_NEAR(4.0, result[0].time, 1e-10);
+
+    //! Too short a time step to collide.
+    result = sut.detect(circles, velocities, 3.0, cmp);
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(geometry_kernel_2d_fixture, moving_collision_detector_reports_time_of_impact_for_obbs)
+{
+    using namespace geometrix;
+
+    std::vector<obb2> boxes = {
+        obb2{ point2{ 0, 0 }, vector2{ 1, 0 }, vector2{ 0, 1 }, 1.0, 1.0 }
+      , obb2{ point2{ 0, 6 }, vector2{ 1, 0 }, vector2{ 0, 1 }, 1.0, 1.0 }
+    };
+    std::vector<vector2> velocities = { vector2{ 0, 0 }, vector2{ 0, -2 } };
+
+    moving_collision_detector<point2> sut;
+    auto result = sut.detect(boxes, velocities, 5.0, cmp);
+
+    ASSERT_EQ(1, result.size());
+    EXPECT_NEAR(2.0, result[0].time, 1e-10);
+}
+
+TEST_F(geometry_kernel_2d_fixture, find_times_of_impact_for_convex_polygons)
+{
+    using namespace geometrix;
+
+    std::vector<polygon2> polygons = {
+        polygon2{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } }
+      , polygon2{ { 3, 0 }, { 4, 0 }, { 4, 1 }, { 3, 1 } }
+    };
+    std::vector<vector2> velocities = { vector2{ 1, 0 }, vector2{ 0, 0 } };
+
+    sweep_and_prune<point2> sap;
+    for (std::size_t i = 0; i < polygons.size(); ++i)
+        sap.insert(make_swept_aabb(polygons[i], velocities[i], 5.0));
+
+    auto result = find_times_of_impact(sap.update_pairs(), polygons, velocities, 5.0, cmp);
+    ASSERT_EQ(1, result.size());
+    EXPECT_NEAR(2.0, result[0].time, 1e-10);
+}
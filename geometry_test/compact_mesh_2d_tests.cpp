@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// compact_mesh_2d_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/compact_mesh_2d.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/algorithm/mesh_search.hpp>
+#include <geometrix/algorithm/visible_vertices_mesh_search.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    geometrix::mesh_2d<double> make_mesh(double maxArea)
+    {
+        using namespace geometrix;
+        polygon2 outer{ { 0, 0 }, { 20, 0 }, { 20, 20 }, { 10, 12 }, { 0, 20 } };
+        std::vector<polygon2> holes{ polygon2{ { 4, 4 }, { 4, 8 }, { 8, 8 }, { 8, 4 } }, polygon2{ { 12, 3 }, { 12, 5 }, { 16, 5 }, { 16, 3 } } };
+        return make_delaunay_mesh(outer, holes, absolute_tolerance_comparison_policy<double>(1e-10), 25.0 * constants::pi<double>() / 180.0, maxArea);
+    }
+
+    template <typename Mesh>
+    std::vector<std::size_t> get_visible_vertices(const Mesh& mesh, const point2& origin, std::size_t start)
+    {
+        using namespace geometrix;
+        using traits = visible_vertices_mesh_search_traits<double, Mesh, absolute_tolerance_comparison_policy<double>>;
+        visible_vertices_mesh_search<traits> visitor(origin, start, mesh);
+        mesh.search(visitor);
+        return visitor.get_vertices();
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, compact_mesh_2d_matches_mesh_queries)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.1);
+    compact_mesh_2d<double> sut(mesh);
+    ASSERT_EQ(mesh.get_number_triangles(), sut.get_number_triangles());
+    ASSERT_EQ(mesh.get_number_vertices(), sut.get_number_vertices());
+    for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+    {
+        EXPECT_EQ(mesh.get_triangle_indices(i), sut.get_triangle_indices(i));
+        EXPECT_EQ(mesh.get_adjacency_matrix()[i], sut.get_adjacent_triangles(i));
+        for (std::size_t k = 0; k < 3; ++k)
+            EXPECT_TRUE(numeric_sequence_equals(mesh.get_triangle_vertices(i)[k], sut.get_triangle_vertices(i)[k], cmp));
+    }
+
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto p = point2{ 21.0 * rnd() - 0.5, 21.0 * rnd() - 0.5 };
+        EXPECT_TRUE(mesh.find_triangle(p, cmp) == sut.find_triangle(p, cmp));
+    }
+
+    //! Indices, adjacency and duplicated triangle coordinates alone take 96 bytes per triangle in mesh_2d.
+    auto meshBytes = mesh.get_number_vertices() * sizeof(point2) + mesh.get_number_triangles() * 96;
+    EXPECT_LT(2 * sut.get_memory_usage(), meshBytes);
+}
+
+TEST_F(geometry_kernel_2d_fixture, compact_mesh_2d_with_quantized_vertices)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.1);
+    compact_mesh_2d<double, quantized_vertex_storage<double, std::uint16_t>> sut(mesh);
+    auto resolution = sut.get_vertex_storage().get_resolution();
+    EXPECT_NEAR(20.0 / 65535.0, resolution, 1e-12);
+
+    compact_mesh_2d<double> full(mesh);
+    EXPECT_LT(sut.get_memory_usage(), full.get_memory_usage());
+
+    for (std::size_t i = 0; i < mesh.get_number_vertices(); ++i)
+    {
+        EXPECT_NEAR(get<0>(mesh.get_vertices()[i]), get<0>(sut.get_vertex(i)), 0.5 * resolution + 1e-12);
+        EXPECT_NEAR(get<1>(mesh.get_vertices()[i]), get<1>(sut.get_vertex(i)), 0.5 * resolution + 1e-12);
+    }
+
+    //! Points well inside a triangle are found in the same triangle.
+    for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+    {
+        auto const& t = mesh.get_triangle_vertices(i);
+        point2 c{ (get<0>(t[0]) + get<0>(t[1]) + get<0>(t[2])) / 3.0, (get<1>(t[0]) + get<1>(t[1]) + get<1>(t[2])) / 3.0 };
+        auto result = sut.find_triangle(c, cmp);
+        ASSERT_TRUE(result);
+        EXPECT_EQ(i, *result);
+    }
+
+    //! The mesh stays conforming, so every point in the domain is found.
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto p = point2{ 20.0 * rnd(), 20.0 * rnd() };
+        if (mesh.find_triangle(p, cmp))
+        {
+            EXPECT_TRUE(sut.find_triangle(p, cmp));
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, compact_mesh_2d_runs_mesh_searches)
+{
+    using namespace geometrix;
+
+    std::vector<point2> points{ point2{ 0., 0. }, point2{ 10., 0. }, point2{ 20., 10. }, point2{ 20., 20. }, point2{ 10., 20. }, point2{ 10., 10. }, point2{ 0., 10. } };
+    std::vector<std::size_t> indices{ 6, 1, 5, 6, 0, 1, 2, 5, 1, 4, 5, 2, 4, 2, 3 };
+    mesh_2d<double> mesh(points, indices, cmp);
+    compact_mesh_2d<double> sut(mesh);
+    compact_mesh_2d<double, quantized_vertex_storage<double>> quantized(mesh);
+
+    point2 origin(3., 8.);
+    auto triangle = sut.find_triangle(origin, cmp);
+    ASSERT_TRUE(triangle);
+    EXPECT_EQ(*mesh.find_triangle(origin, cmp), *triangle);
+
+    std::vector<std::size_t> expected{ 6, 1, 5, 2, 0 };
+    EXPECT_EQ(expected, get_visible_vertices(mesh, origin, *triangle));
+    EXPECT_EQ(expected, get_visible_vertices(sut, origin, *triangle));
+    EXPECT_EQ(expected, get_visible_vertices(quantized, origin, *triangle));
+
+    visible_vertices_visitor v;
+    auto search = make_mesh_search(*triangle, origin, sut, v);
+    sut.search(search);
+    EXPECT_EQ(expected, v.get_vertices());
+}
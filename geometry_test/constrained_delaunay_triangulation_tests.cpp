@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////////////////////
+// constrained_delaunay_triangulation_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/algorithm/triangle_complex.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using cdt2 = geometrix::constrained_delaunay_triangulation<double>;
+
+    //! Every vertex which is visible from a triangle is outside its circumcircle. Constraints block visibility, which is
+    //! approximated here by checking only the vertices of triangles across unconstrained edges.
+    bool is_constrained_delaunay(const cdt2& cdt)
+    {
+        using namespace geometrix;
+
+        std::set<std::pair<cdt2::vertex_handle, cdt2::vertex_handle>> constraints;
+        cdt.for_each_constraint([&](cdt2::vertex_handle a, cdt2::vertex_handle b)
+        {
+            constraints.emplace(a, b);
+            constraints.emplace(b, a);
+        });
+
+        std::map<std::pair<cdt2::vertex_handle, cdt2::vertex_handle>, cdt2::vertex_handle> opposite;
+        cdt.for_each_triangle([&](cdt2::vertex_handle a, cdt2::vertex_handle b, cdt2::vertex_handle c)
+        {
+            opposite[std::make_pair(a, b)] = c;
+            opposite[std::make_pair(b, c)] = a;
+            opposite[std::make_pair(c, a)] = b;
+        });
+
+        for (auto const& item : opposite)
+        {
+            auto twin = opposite.find(std::make_pair(item.first.second, item.first.first));
+            if (twin == opposite.end() || constraints.count(item.first))
+                continue;
+            auto const& a = cdt.get_vertex(item.first.first);
+            auto const& b = cdt.get_vertex(item.first.second);
+            if (filtered_in_circle(a, b, cdt.get_vertex(item.second), cdt.get_vertex(twin->second)) > 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    double min_angle(const cdt2& cdt)
+    {
+        using namespace geometrix;
+        double result = 4.0;
+        cdt.for_each_triangle([&](cdt2::vertex_handle a, cdt2::vertex_handle b, cdt2::vertex_handle c)
+        {
+            const cdt2::point_type* p[3] = { &cdt.get_vertex(a), &cdt.get_vertex(b), &cdt.get_vertex(c) };
+            for (int i = 0; i < 3; ++i)
+            {
+                auto u = *p[(i + 1) % 3] - *p[i];
+                auto v = *p[(i + 2) % 3] - *p[i];
+                auto cosA = (get<0>(u) * get<0>(v) + get<1>(u) * get<1>(v)) / std::sqrt((get<0>(u) * get<0>(u) + get<1>(u) * get<1>(u)) * (get<0>(v) * get<0>(v) + get<1>(v) * get<1>(v)));
+                result = (std::min)(result, std::acos((std::max)(-1.0, (std::min)(1.0, cosA))));
+            }
+        });
+        return result;
+    }
+
+    template <typename Mesh>
+    double mesh_area(const Mesh& mesh)
+    {
+        double result = 0;
+        for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+        {
+            auto const& t = mesh.get_triangle_vertices(i);
+            auto a = 0.5 * ((t[1][0] - t[0][0]) * (t[2][1] - t[0][1]) - (t[1][1] - t[0][1]) * (t[2][0] - t[0][0]));
+            EXPECT_GT(a, 0.0);
+            result += a;
+        }
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, constrained_delaunay_triangulation_of_random_points_is_delaunay)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<point2> points;
+    for (std::size_t i = 0; i < 5000; ++i)
+        points.emplace_back(rnd(), rnd());
+    //! Duplicates and a regular grid with many cocircular points.
+    points.push_back(points[10]);
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 20; ++j)
+            points.emplace_back(110.0 + i, 110.0 + j);
+
+    cdt2 cdt(point2{ 0, 0 }, point2{ 130, 130 });
+    auto handles = cdt.insert_points(points);
+    ASSERT_EQ(points.size(), handles.size());
+    EXPECT_EQ(handles[10], handles[5000]);
+    EXPECT_EQ(points.size() - 1, cdt.get_number_vertices());
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_TRUE(numeric_sequence_equals(points[i], cdt.get_vertex(handles[i]), cmp));
+
+    cdt.mark_domain(delaunay_domain::convex_hull);
+    EXPECT_TRUE(is_constrained_delaunay(cdt));
+
+    //! Euler: a triangulation of n points with h on the hull has 2n - 2 - h triangles, and with h >= 3 at most 2n - 5.
+    auto n = cdt.get_number_vertices();
+    EXPECT_LE(cdt.get_number_triangles(), 2 * n - 5);
+    EXPECT_GE(cdt.get_number_triangles(), n);
+}
+
+TEST_F(geometry_kernel_2d_fixture, constrained_delaunay_triangulation_recovers_crossing_constraints)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    cdt2 cdt(point2{ 0, 0 }, point2{ 10, 10 });
+    std::vector<point2> points;
+    for (std::size_t i = 0; i < 500; ++i)
+        points.emplace_back(rnd(), rnd());
+    auto handles = cdt.insert_points(points);
+
+    //! Two crossing constraints and one through collinear vertices.
+    auto a = cdt.insert_point(point2{ 0.5, 0.5 });
+    auto b = cdt.insert_point(point2{ 9.5, 9.5 });
+    auto c = cdt.insert_point(point2{ 0.5, 9.5 });
+    auto d = cdt.insert_point(point2{ 9.5, 0.5 });
+    auto e = cdt.insert_point(point2{ 5.0, 2.0 });
+    auto f = cdt.insert_point(point2{ 5.0, 8.0 });
+    cdt.insert_point(point2{ 5.0, 7.0 });
+    cdt.insert_constraint(a, b);
+    cdt.insert_constraint(c, d);
+    cdt.insert_constraint(e, f);
+    cdt.insert_constraint(handles[0], handles[1]);
+    cdt.mark_domain(delaunay_domain::convex_hull);
+    EXPECT_TRUE(is_constrained_delaunay(cdt));
+
+    //! Every constraint edge lies on one of the input segments.
+    std::size_t nDiagonal = 0;
+    cdt.for_each_constraint([&](cdt2::vertex_handle u, cdt2::vertex_handle v)
+    {
+        auto const& p = cdt.get_vertex(u);
+        auto const& q = cdt.get_vertex(v);
+        if (std::abs(p[0] - p[1]) < 1e-9 && std::abs(q[0] - q[1]) < 1e-9)
+            ++nDiagonal;
+    });
+    //! a-b is split at the crossing with c-d and at e-f.
+    EXPECT_GE(nDiagonal, 3);
+}
+
+TEST_F(geometry_kernel_2d_fixture, constrained_delaunay_mesh_of_polygon_with_hole)
+{
+    using namespace geometrix;
+
+    polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 5, 6 }, { 0, 10 } };
+    std::vector<polygon2> holes{ polygon2{ { 2, 2 }, { 2, 4 }, { 4, 4 }, { 4, 2 } } };
+    auto expectedArea = std::abs(get_signed_area(outer)) - std::abs(get_signed_area(holes[0]));
+
+    auto mesh = make_delaunay_mesh(outer, holes, cmp);
+    EXPECT_EQ(outer.size() + holes[0].size(), mesh.get_number_vertices());
+    EXPECT_NEAR(expectedArea, mesh_area(mesh), 1e-10);
+    EXPECT_FALSE(mesh.find_triangle(point2{ 3, 3 }, cmp));
+    EXPECT_FALSE(mesh.find_triangle(point2{ 5, 8 }, cmp));
+    EXPECT_TRUE(mesh.find_triangle(point2{ 1, 1 }, cmp));
+
+    //! Refinement keeps the domain and bounds the angles and areas.
+    auto refined = make_delaunay_mesh(outer, holes, cmp, 25.0 * constants::pi<double>() / 180.0, 0.5);
+    EXPECT_NEAR(expectedArea, mesh_area(refined), 1e-9);
+    EXPECT_GT(refined.get_number_triangles(), mesh.get_number_triangles());
+    for (std::size_t i = 0; i < refined.get_number_triangles(); ++i)
+    {
+        auto const& t = refined.get_triangle_vertices(i);
+        auto a = 0.5 * ((t[1][0] - t[0][0]) * (t[2][1] - t[0][1]) - (t[1][1] - t[0][1]) * (t[2][0] - t[0][0]));
+        EXPECT_LE(a, 0.5);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, constrained_delaunay_refinement_bounds_minimum_angle)
+{
+    using namespace geometrix;
+
+    //! A polygon with a sliver and no input angle below 60 degrees away from its convex corners.
+    polygon2 outer{ { 0, 0 }, { 20, 0 }, { 20, 1 }, { 10, 1.2 }, { 0, 1 } };
+    cdt2 cdt(point2{ 0, 0 }, point2{ 20, 1.2 });
+    cdt.insert_polygon(outer);
+    cdt.mark_domain();
+    EXPECT_LT(min_angle(cdt), 0.1);
+
+    auto minAngle = 20.0 * constants::pi<double>() / 180.0;
+    auto n = cdt.refine(minAngle);
+    EXPECT_GT(n, 0);
+    EXPECT_GE(min_angle(cdt), minAngle - 1e-9);
+    EXPECT_TRUE(is_constrained_delaunay(cdt));
+
+    auto mesh = cdt.make_mesh(cmp);
+    EXPECT_NEAR(20.0 + 0.2 * 10.0, mesh_area(mesh), 1e-9);
+
+    //! The cap is respected.
+    cdt2 capped(point2{ 0, 0 }, point2{ 20, 1.2 });
+    capped.insert_polygon(outer);
+    capped.mark_domain();
+    EXPECT_EQ(5, capped.refine(minAngle, (std::numeric_limits<double>::max)(), 5));
+}
+
+TEST_F(geometry_kernel_2d_fixture, triangle_complex_refine_keeps_region_and_constraints)
+{
+    using namespace geometrix;
+
+    triangle_complex<point2, absolute_tolerance_comparison_policy<double>> sut(cmp);
+    EXPECT_TRUE(sut.add_triangle(point2{ 0, 0 }, point2{ 4, 0 }, point2{ 4, 1 }));
+    EXPECT_TRUE(sut.add_triangle(point2{ 0, 0 }, point2{ 4, 1 }, point2{ 0, 1 }));
+    EXPECT_TRUE(sut.set_constraint(point2{ 0, 0 }, point2{ 4, 1 }, true));
+    EXPECT_TRUE(sut.is_constrained(point2{ 4, 1 }, point2{ 0, 0 }));
+
+    auto n = sut.refine(20.0 * constants::pi<double>() / 180.0, 0.25);
+    EXPECT_GT(n, 0);
+    EXPECT_GT(sut.get_number_triangles(), 2 + n);
+
+    double area = 0;
+    std::size_t nOnDiagonal = 0;
+    sut.for_each_triangle([&](const point2& a, const point2& b, const point2& c)
+    {
+        auto A = 0.5 * ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]));
+        EXPECT_GT(A, 0.0);
+        EXPECT_LE(A, 0.25);
+        area += A;
+        for (auto const& e : { std::make_pair(a, b), std::make_pair(b, c), std::make_pair(c, a) })
+            if (std::abs(e.first[0] - 4.0 * e.first[1]) < 1e-9 && std::abs(e.second[0] - 4.0 * e.second[1]) < 1e-9 && sut.is_constrained(e.first, e.second))
+                ++nOnDiagonal;
+    });
+    EXPECT_NEAR(4.0, area, 1e-9);
+    //! The diagonal is split into several constrained edges each with a triangle on either side.
+    EXPECT_GT(nOnDiagonal, 2);
+}
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+// contiguous_sequence_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/tensor/contiguous_sequence.hpp>
+#include <geometrix/algebra/exterior_product.hpp>
+#include <geometrix/algorithm/orientation/point_segment_orientation.hpp>
+#include <geometrix/arithmetic/vector/magnitude.hpp>
+#include <geometrix/arithmetic/vector/normalize.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+TEST_F(geometry_kernel_2d_fixture, contiguous_sequence_traits)
+{
+    using namespace geometrix;
+
+    static_assert(is_contiguous_sequence<point_double_2d>::value, "");
+    static_assert(is_contiguous_sequence<const vector_float_3d>::value, "");
+    static_assert(!is_contiguous_sequence<point_int_2d>::value, "");
+    static_assert(are_contiguous_sequences<point_double_2d, vector_double_2d, const point_double_2d&>::value, "");
+    static_assert(!are_contiguous_sequences<point_double_2d, vector_float_2d>::value, "");
+    static_assert(!are_contiguous_sequences<point_double_2d, point_double_3d>::value, "");
+    static_assert(!are_contiguous_sequences<vector_double_2d, decltype(std::declval<point2>() - std::declval<point2>())>::value, "Expressions take the generic path.");
+    static_assert(contiguous_sequence_kernels::dot<int, 3>(std::array<int, 3>{ { 1, 2, 3 } }.data(), std::array<int, 3>{ { 4, 5, 6 } }.data()) == 32, "The kernels are constexpr.");
+}
+
+TEST_F(geometry_kernel_2d_fixture, contiguous_sequence_fast_paths_match_generic_evaluation)
+{
+    using namespace geometrix;
+    typedef vector_double_3d vector3;
+
+    random_real_generator<> rnd(10.0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        vector2 a{ rnd() - 5.0, rnd() - 5.0 }, b{ rnd() - 5.0, rnd() - 5.0 };
+        point2 p{ rnd(), rnd() }, q{ rnd(), rnd() }, r{ rnd(), rnd() };
+        vector3 u{ rnd() - 5.0, rnd() - 5.0, rnd() - 5.0 }, v{ rnd() - 5.0, rnd() - 5.0, rnd() - 5.0 };
+
+        EXPECT_EQ((detail::dot_product<vector2, vector2>()(a, b)), dot_product(a, b));
+        EXPECT_EQ((detail::dot_product<vector3, vector3>()(u, v)), dot_product(u, v));
+        EXPECT_EQ(detail::magnitude_sqrd_dispatch(u, std::false_type()), magnitude_sqrd(u));
+        EXPECT_EQ(detail::exterior_product_area(a, b, dimension<2>(), std::false_type()), exterior_product_area(a, b));
+
+        auto n = normalize(u);
+        auto ng = detail::normalize(u, std::false_type());
+        EXPECT_TRUE(n[0] == ng[0] && n[1] == ng[1] && n[2] == ng[2]);
+
+        auto c = cross_product(u, v);
+        auto cg = detail::cross_product(u, v, std::false_type());
+        EXPECT_TRUE(c[0] == cg[0] && c[1] == cg[1] && c[2] == cg[2]);
+        EXPECT_EQ(get<0>(u ^ v), c[0]);
+        EXPECT_EQ(get<2>(u ^ v), c[2]);
+
+        EXPECT_EQ(vector_vector_orientation(p - q, r - q, cmp), point_segment_orientation(p, q, r, cmp));
+        EXPECT_EQ(vector_vector_orientation(r - p, q - p, cmp), get_orientation(p, q, r, cmp));
+    }
+
+    //! Collinear points.
+    EXPECT_EQ(oriented_collinear, get_orientation(point2{ 0, 0 }, point2{ 1, 1 }, point2{ 2, 2 }, cmp));
+    EXPECT_EQ(oriented_left, get_orientation(point2{ 0, 0 }, point2{ 1, 0 }, point2{ 1, 1 }, cmp));
+    EXPECT_EQ(oriented_right, get_orientation(point_float_2d{ 0, 0 }, point_float_2d{ 1, 0 }, point_float_2d{ 1, -1 }, cmp));
+}
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// distance_field_2d_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/distance_field_2d.hpp>
+#include <geometrix/algorithm/distance/point_segment_distance.hpp>
+#include <geometrix/algorithm/solid_leaf_bsp_tree.hpp>
+#include <geometrix/algorithm/hyperplane_partition_policies.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/primitive/deque_point_sequence.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    //! Signed distance to the square [lo, hi]^2, negative inside.
+    double square_sdf(double x, double y, double lo, double hi)
+    {
+        double c = 0.5 * (lo + hi), r = 0.5 * (hi - lo);
+        double dx = std::abs(x - c) - r, dy = std::abs(y - c) - r;
+        double outside = std::hypot((std::max)(dx, 0.0), (std::max)(dy, 0.0));
+        return outside + (std::min)((std::max)(dx, dy), 0.0);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, squared_euclidean_distance_transform_matches_brute_force)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 40.0, 0.0, 30.0, 1.0);
+    grid_2d<double, grid_traits<double>> grid(traits);
+    random_real_generator<> rnd(1.0);
+    std::vector<std::pair<int, int>> features;
+    for (boost::uint32_t i = 0; i < traits.get_width(); ++i)
+        for (boost::uint32_t j = 0; j < traits.get_height(); ++j)
+        {
+            bool isFeature = rnd() < 0.02;
+            grid.get_cell(i, j) = isFeature ? 0.0 : std::numeric_limits<double>::infinity();
+            if (isFeature)
+                features.emplace_back(i, j);
+        }
+    ASSERT_FALSE(features.empty());
+
+    squared_euclidean_distance_transform(grid, 4);
+
+    for (boost::uint32_t i = 0; i < traits.get_width(); ++i)
+        for (boost::uint32_t j = 0; j < traits.get_height(); ++j)
+        {
+            double expected = std::numeric_limits<double>::infinity();
+            for (auto const& f : features)
+                expected = (std::min)(expected, double((f.first - int(i)) * (f.first - int(i)) + (f.second - int(j)) * (f.second - int(j))));
+            EXPECT_EQ(expected, grid.get_cell(i, j));
+        }
+}
+
+TEST_F(geometry_kernel_2d_fixture, polygon_distance_field_is_signed_and_within_a_cell_of_the_true_distance)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 10.0, 0.0, 10.0, 0.05);
+    polygon2 square{ point2{ 2.0, 2.0 }, point2{ 8.0, 2.0 }, point2{ 8.0, 8.0 }, point2{ 2.0, 8.0 } };
+    auto sut = make_polygon_distance_field(traits, square, cmp);
+
+    random_real_generator<> rnd(10.0);
+    auto tolerance = traits.get_cell_size() * std::sqrt(2.0);
+    for (int n = 0; n < 1000; ++n)
+    {
+        double x = rnd(), y = rnd();
+        EXPECT_NEAR(square_sdf(x, y, 2.0, 8.0), sut.get_distance(point2{ x, y }), tolerance);
+    }
+
+    EXPECT_LT(sut.get_distance(point2{ 5.0, 5.0 }), 0.0);
+    EXPECT_GT(sut.get_distance(point2{ 9.0, 5.0 }), 0.0);
+
+    //! The gradient points away from the nearest edge.
+    auto g = sut.get_gradient(point2{ 9.0, 5.0 });
+    EXPECT_NEAR(1.0, get<0>(g), 0.05);
+    EXPECT_NEAR(0.0, get<1>(g), 0.05);
+    g = sut.get_gradient(point2{ 5.0, 3.0 });
+    EXPECT_NEAR(0.0, get<0>(g), 0.05);
+    EXPECT_NEAR(-1.0, get<1>(g), 0.05);
+
+    //! A hole makes its inside positive.
+    polygon_with_holes2 frame(square, { polygon2{ point2{ 4.0, 4.0 }, point2{ 6.0, 4.0 }, point2{ 6.0, 6.0 }, point2{ 4.0, 6.0 } } });
+    auto framed = make_polygon_distance_field(traits, std::vector<polygon_with_holes2>{ frame }, cmp, 1);
+    EXPECT_NEAR(1.0, framed.get_distance(point2{ 5.0, 5.0 }), tolerance);
+    EXPECT_NEAR(-1.0, framed.get_distance(point2{ 3.0, 5.0 }), tolerance);
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_distance_field_is_unsigned)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 10.0, 0.0, 10.0, 0.1);
+    std::vector<polyline2> plines = { polyline2{ point2{ 1.0, 1.0 }, point2{ 9.0, 5.0 } }, polyline2{ point2{ 2.0, 8.0 }, point2{ 5.0, 9.0 }, point2{ 8.0, 8.0 } } };
+    auto sut = make_polyline_distance_field(traits, plines, cmp);
+
+    random_real_generator<> rnd(10.0);
+    auto tolerance = traits.get_cell_size() * std::sqrt(2.0);
+    for (int n = 0; n < 1000; ++n)
+    {
+        point2 p{ rnd(), rnd() };
+        auto expected = (std::numeric_limits<double>::max)();
+        for (auto const& pline : plines)
+            for (std::size_t i = 0; i + 1 < pline.size(); ++i)
+                expected = (std::min)(expected, point_segment_distance(p, segment2(pline[i], pline[i + 1])));
+        auto d = sut.get_distance(p);
+        EXPECT_GE(d, 0.0);
+        EXPECT_NEAR(expected, d, tolerance);
+    }
+
+    //! Any point sequence adapted by point_sequence_traits.
+    std::vector<std::deque<point2>> dplines;
+    for (auto const& pline : plines)
+        dplines.emplace_back(pline.begin(), pline.end());
+    auto dsut = make_polyline_distance_field(traits, dplines, cmp);
+    for (int n = 0; n < 100; ++n)
+    {
+        point2 p{ rnd(), rnd() };
+        EXPECT_EQ(sut.get_distance(p), dsut.get_distance(p));
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, solid_bsp_distance_field_is_negative_in_solid_space)
+{
+    using namespace geometrix;
+
+    //! The interior of a counter-clockwise polygon is empty space.
+    polygon2 square{ point2{ 2.0, 2.0 }, point2{ 8.0, 2.0 }, point2{ 8.0, 8.0 }, point2{ 2.0, 8.0 } };
+    solid_leaf_bsp_tree<segment2> bsp(polygon_as_segment_range<segment2>(square), partition_policies::autopartition_policy(), cmp);
+
+    grid_traits<double> traits(0.0, 10.0, 0.0, 10.0, 0.1);
+    auto sut = make_solid_bsp_distance_field(traits, bsp, cmp);
+    auto expected = make_polygon_distance_field(traits, square, cmp);
+    for (boost::uint32_t i = 0; i < traits.get_width(); ++i)
+        for (boost::uint32_t j = 0; j < traits.get_height(); ++j)
+            EXPECT_DOUBLE_EQ(-expected.get_cell_distance(i, j), sut.get_cell_distance(i, j));
+}
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// dynamic_spatial_index_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/dynamic_spatial_index.hpp>
+#include <geometrix/algorithm/kd_tree.hpp>
+#include <geometrix/algorithm/median_partitioning_strategy.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace {
+
+    template <typename Point, typename NumberComparisonPolicy>
+    std::set<std::uint32_t> search_all(const geometrix::dynamic_spatial_index<Point>& index, const geometrix::axis_aligned_bounding_box<Point>& box, const NumberComparisonPolicy& cmp)
+    {
+        std::set<std::uint32_t> result;
+        index.search(box, [&](const Point&, std::uint32_t i) { EXPECT_TRUE(result.insert(i).second); }, cmp);
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, dynamic_spatial_index_matches_brute_force_under_insert_move_erase)
+{
+    using namespace geometrix;
+    using index_t = dynamic_spatial_index<point2>;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<point2> points;
+    std::vector<index_t::proxy_type> proxies;
+    index_t sut(8);
+    for (std::uint32_t i = 0; i < 2000; ++i)
+    {
+        points.emplace_back(rnd(), rnd());
+        proxies.push_back(sut.insert(points.back(), i));
+    }
+    EXPECT_EQ(points.size(), sut.size());
+    EXPECT_LT(sut.get_depth(), 16);
+
+    auto check = [&]()
+    {
+        for (int q = 0; q < 20; ++q)
+        {
+            auto p = point2{ 1.2 * rnd() - 10.0, 1.2 * rnd() - 10.0 };
+            auto box = aabb2{ p, point2{ p[0] + 0.2 * rnd(), p[1] + 0.2 * rnd() } };
+            std::set<std::uint32_t> expected;
+            for (std::uint32_t i = 0; i < points.size(); ++i)
+                if (proxies[i] != index_t::null_proxy && box.intersects(points[i]))
+                    expected.insert(i);
+            EXPECT_EQ(expected, search_all(sut, box, cmp));
+
+            std::vector<std::pair<double, std::uint32_t>> all;
+            for (std::uint32_t i = 0; i < points.size(); ++i)
+                if (proxies[i] != index_t::null_proxy)
+                    all.emplace_back(magnitude_sqrd(points[i] - p), i);
+            std::sort(all.begin(), all.end());
+            auto knn = sut.nearest_neighbors(p, 10);
+            ASSERT_EQ((std::min<std::size_t>)(10, all.size()), knn.size());
+            for (std::size_t k = 0; k < knn.size(); ++k)
+                EXPECT_EQ(all[k].first, knn[k].first);
+            if (!all.empty())
+            {
+                EXPECT_EQ(all[0].first, sut.nearest_neighbor(p).first);
+            }
+        }
+    };
+
+    check();
+
+    //! Move everything by small and large amounts (growing the root), remove some and reinsert others.
+    for (std::uint32_t step = 0; step < 5; ++step)
+    {
+        for (std::uint32_t i = 0; i < points.size(); ++i)
+        {
+            if (proxies[i] == index_t::null_proxy)
+            {
+                if (i % 3 == 0)
+                    proxies[i] = sut.insert(points[i], i);
+                continue;
+            }
+
+            if (i % 11 == step)
+            {
+                sut.erase(proxies[i]);
+                proxies[i] = index_t::null_proxy;
+                continue;
+            }
+
+            auto scale = i % 5 == 0 ? 0.2 : 0.001;
+            points[i] = point2{ points[i][0] + scale * (rnd() - 50.0), points[i][1] + scale * (rnd() - 50.0) };
+            sut.move(proxies[i], points[i]);
+            ASSERT_TRUE(numeric_sequence_equals(points[i], sut.get_point(proxies[i]), cmp));
+            ASSERT_EQ(i, sut.get_data(proxies[i]));
+        }
+        check();
+    }
+
+    //! Erase everything.
+    for (auto& p : proxies)
+    {
+        if (p != index_t::null_proxy)
+            sut.erase(p);
+        p = index_t::null_proxy;
+    }
+    EXPECT_TRUE(sut.empty());
+    EXPECT_EQ(0, sut.get_depth());
+    EXPECT_TRUE(sut.nearest_neighbors(point2{ 0, 0 }, 3).empty());
+}
+
+TEST_F(geometry_kernel_2d_fixture, dynamic_spatial_index_range_search_matches_kd_tree_and_handles_coincident_points)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    std::vector<point2> points;
+    for (std::size_t i = 0; i < 500; ++i)
+        points.emplace_back(rnd(), rnd());
+    //! Many coincident points exceed the leaf capacity at the maximum depth.
+    for (std::size_t i = 0; i < 100; ++i)
+        points.emplace_back(5.0, 5.0);
+
+    dynamic_spatial_index<point2> sut(aabb2{ point2{ 0, 0 }, point2{ 10, 10 } }, 4);
+    for (std::uint32_t i = 0; i < points.size(); ++i)
+        sut.insert(points[i], i);
+
+    kd_tree<point2> tree(points, cmp, median_partitioning_strategy());
+    for (int q = 0; q < 20; ++q)
+    {
+        auto p = point2{ rnd(), rnd() };
+        auto box = aabb2{ p, point2{ p[0] + 0.3 * rnd(), p[1] + 0.3 * rnd() } };
+        std::vector<point2> expected, result;
+        tree.search(box, [&](const point2& x) { if (box.intersects(x)) expected.push_back(x); }, cmp);
+        sut.search(box, [&](const point2& x) { result.push_back(x); }, cmp);
+        auto less = [](const point2& a, const point2& b) { return std::make_pair(a[0], a[1]) < std::make_pair(b[0], b[1]); };
+        std::sort(expected.begin(), expected.end(), less);
+        std::sort(result.begin(), result.end(), less);
+        ASSERT_EQ(expected.size(), result.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            EXPECT_TRUE(numeric_sequence_equals(expected[i], result[i], cmp));
+    }
+
+    auto knn = sut.nearest_neighbors(point2{ 5.0, 5.0 }, 50);
+    ASSERT_EQ(50, knn.size());
+    EXPECT_EQ(0.0, knn.back().first);
+    EXPECT_EQ(0, sut.nearest_neighbors(point2{ 5.0, 5.0 }, 200, 1e-6).size() - 100);
+}
+
+TEST_F(geometry_kernel_2d_fixture, dynamic_spatial_index_3d)
+{
+    using namespace geometrix;
+    typedef point_double_3d point3;
+
+    random_real_generator<> rnd(10.0);
+    std::vector<point3> points;
+    dynamic_spatial_index<point3> sut;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        points.emplace_back(rnd(), rnd(), rnd());
+        sut.insert(points.back(), i);
+    }
+
+    auto p = point3{ 5.0, 5.0, 5.0 };
+    std::vector<std::pair<double, std::uint32_t>> all;
+    for (std::uint32_t i = 0; i < points.size(); ++i)
+        all.emplace_back(magnitude_sqrd(points[i] - p), i);
+    std::sort(all.begin(), all.end());
+    auto knn = sut.nearest_neighbors(p, 5);
+    ASSERT_EQ(5, knn.size());
+    for (std::size_t k = 0; k < knn.size(); ++k)
+        EXPECT_EQ(all[k], knn[k]);
+
+    std::size_t count = 0;
+    sut.search(axis_aligned_bounding_box<point3>(point3{ 0, 0, 0 }, point3{ 5, 5, 5 }), [&](const point3& x) { ++count; EXPECT_TRUE(x[0] <= 5.0 && x[1] <= 5.0 && x[2] <= 5.0); }, cmp);
+    EXPECT_EQ(static_cast<std::size_t>(std::count_if(points.begin(), points.end(), [](const point3& x) { return x[0] <= 5.0 && x[1] <= 5.0 && x[2] <= 5.0; })), count);
+}
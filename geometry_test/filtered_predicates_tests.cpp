@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+// filtered_predicates_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/filtered_predicates.hpp>
+#include <geometrix/algorithm/solid_leaf_bsp_tree.hpp>
+#include <geometrix/algorithm/hyperplane_partition_policies.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <cmath>
+
+namespace {
+
+    int exact_orientation(double ax, double ay, double bx, double by, double cx, double cy)
+    {
+        using rational = boost::multiprecision::cpp_rational;
+        rational det = (rational(ax) - rational(cx)) * (rational(by) - rational(cy)) - (rational(ay) - rational(cy)) * (rational(bx) - rational(cx));
+        return det.sign();
+    }
+
+}//! namespace;
+
+TEST(filtered_predicates_test, expansion_arithmetic_is_exact)
+{
+    using namespace geometrix;
+
+    //! 1 + 2^-60 - 1 is lost in double arithmetic but not in an expansion.
+    auto e = expansion(1.0) + expansion(std::ldexp(1.0, -60)) - expansion(1.0);
+    EXPECT_EQ(1, e.sign());
+    EXPECT_EQ(std::ldexp(1.0, -60), e.estimate());
+
+    //! (1 + 2^-30)^2 - (1 + 2^-29) = 2^-60.
+    auto a = expansion::difference(1.0, -std::ldexp(1.0, -30));
+    auto f = a * a - expansion(1.0 + std::ldexp(1.0, -29));
+    EXPECT_EQ(std::ldexp(1.0, -60), f.estimate());
+
+    EXPECT_EQ(0, (a - a).sign());
+    EXPECT_EQ(0u, (a - a).size());
+    EXPECT_EQ(-1, (-a).sign());
+}
+
+TEST(filtered_predicates_test, orientation_matches_exact_arithmetic_near_degeneracy)
+{
+    using namespace geometrix;
+    using point2 = point<double, 2>;
+
+    //! Points on a fine grid around a point of the line y = x. Naive evaluation gets many of these wrong.
+    auto ulp = std::ldexp(1.0, -53);
+    point2 b{ 12.0, 12.0 }, c{ 24.0, 24.0 };
+    for (int i = 0; i < 64; ++i)
+    {
+        for (int j = 0; j < 64; ++j)
+        {
+            point2 a{ 0.5 + i * ulp, 0.5 + j * ulp };
+            auto expected = exact_orientation(a[0], a[1], b[0], b[1], c[0], c[1]);
+            EXPECT_EQ(expected, static_cast<int>(filtered_orientation(a, b, c)));
+            EXPECT_EQ(expected, static_cast<int>(filtered_orientation(b, c, a)));
+            EXPECT_EQ(-expected, static_cast<int>(filtered_orientation(b, a, c)));
+        }
+    }
+
+    EXPECT_EQ(oriented_left, filtered_orientation(point2{ 0, 0 }, point2{ 1, 0 }, point2{ 0, 1 }));
+    EXPECT_EQ(oriented_right, filtered_orientation(point2{ 0, 0 }, point2{ 1, 0 }, point2{ 0, -1 }));
+    EXPECT_EQ(oriented_collinear, filtered_orientation(point2{ 0, 0 }, point2{ 1, 0 }, point2{ 7, 0 }));
+}
+
+TEST(filtered_predicates_test, in_circle_classifies_cocircular_points_exactly)
+{
+    using namespace geometrix;
+    using point2 = point<double, 2>;
+
+    point2 a{ 1, 0 }, b{ 0, 1 }, c{ -1, 0 };
+    EXPECT_EQ(0, filtered_in_circle(a, b, c, point2{ 0, -1 }));
+    EXPECT_LT(0, filtered_in_circle(a, b, c, point2{ 0, 0 }));
+    EXPECT_GT(0, filtered_in_circle(a, b, c, point2{ 2, 2 }));
+
+    //! Clockwise order flips the sign.
+    EXPECT_GT(0, filtered_in_circle(c, b, a, point2{ 0, 0 }));
+
+    //! Perturbations below the resolution of the naive determinant are still resolved.
+    auto ulp = std::ldexp(1.0, -52);
+    EXPECT_GT(0, filtered_in_circle(a, b, c, point2{ 0, -1 - ulp }));
+    EXPECT_LT(0, filtered_in_circle(a, b, c, point2{ 0, -1 + ulp / 2 }));
+}
+
+TEST_F(geometry_kernel_2d_fixture, filtered_segment_segment_classification_cases)
+{
+    using namespace geometrix;
+
+    EXPECT_EQ(e_crossing, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 2 }, point2{ 0, 2 }, point2{ 2, 0 }));
+    EXPECT_EQ(e_endpoint, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 2 }, point2{ 1, 1 }, point2{ 2, 0 }));
+    EXPECT_EQ(e_endpoint, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 2, 0 }, point2{ 3, 1 }));
+    EXPECT_EQ(e_overlapping, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 1, 0 }, point2{ 3, 0 }));
+    EXPECT_EQ(e_endpoint, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 2, 0 }, point2{ 3, 0 }));
+    EXPECT_EQ(e_non_crossing, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 3, 0 }, point2{ 4, 0 }));
+    EXPECT_EQ(e_non_crossing, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 0, 1 }, point2{ 2, 1 }));
+    EXPECT_EQ(e_non_crossing, filtered_segment_segment_classification(point2{ 0, 0 }, point2{ 2, 0 }, point2{ 3, -1 }, point2{ 3, 1 }));
+
+    //! Degenerate segments.
+    EXPECT_EQ(e_endpoint, filtered_segment_segment_classification(point2{ 1, 0 }, point2{ 1, 0 }, point2{ 0, 0 }, point2{ 2, 0 }));
+    EXPECT_EQ(e_non_crossing, filtered_segment_segment_classification(point2{ 1, 1 }, point2{ 1, 1 }, point2{ 0, 0 }, point2{ 2, 0 }));
+
+    //! Segment overload.
+    EXPECT_EQ(e_crossing, filtered_segment_segment_classification(segment2{ 0, 0, 2, 2 }, segment2{ 0, 2, 2, 0 }));
+}
+
+TEST_F(geometry_kernel_2d_fixture, filtered_segment_segment_classification_matches_exact_orientations_on_random_segments)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        point2 a{ rnd(), rnd() }, b{ rnd(), rnd() }, c{ rnd(), rnd() };
+        //! A point on ab up to rounding makes the segments nearly touch.
+        auto t = rnd() / 10.0;
+        point2 d{ a[0] + t * (b[0] - a[0]), a[1] + t * (b[1] - a[1]) };
+
+        auto o1 = exact_orientation(a[0], a[1], b[0], b[1], c[0], c[1]);
+        auto o2 = exact_orientation(a[0], a[1], b[0], b[1], d[0], d[1]);
+        auto o3 = exact_orientation(c[0], c[1], d[0], d[1], a[0], a[1]);
+        auto o4 = exact_orientation(c[0], c[1], d[0], d[1], b[0], b[1]);
+        auto expected = (o1 * o2 > 0 || o3 * o4 > 0) ? e_non_crossing : (o2 == 0 ? e_endpoint : e_crossing);
+        EXPECT_EQ(expected, filtered_segment_segment_classification(a, b, c, d));
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, solid_leaf_bsp_point_in_solid_space_with_exact_plane_tests)
+{
+    using namespace geometrix;
+    using solid_bsp2 = solid_leaf_bsp_tree<segment2>;
+
+    polygon2 geometry{ point2{ 0, 0 }, point2{ 1, 0 }, point2{ 1, 1 }, point2{ 0, 1 } };
+    auto segs = polygon_as_segment_range<segment2>(geometry);
+    solid_bsp2 sut(segs, partition_policies::autopartition_policy(), cmp);
+
+    EXPECT_EQ(point_in_solid_classification::in_empty_space, sut.point_in_solid_space(point2{ 0.5, 0.5 }));
+    EXPECT_EQ(point_in_solid_classification::in_solid, sut.point_in_solid_space(point2{ 1.5, 1.5 }));
+    EXPECT_EQ(point_in_solid_classification::on_boundary, sut.point_in_solid_space(point2{ 1.0, 0.5 }));
+
+    //! No tolerance: points a rounding error away from the boundary are not on it.
+    auto ulp = std::ldexp(1.0, -52);
+    EXPECT_EQ(point_in_solid_classification::in_empty_space, sut.point_in_solid_space(point2{ 1.0 - ulp, 0.5 }));
+    EXPECT_EQ(point_in_solid_classification::in_solid, sut.point_in_solid_space(point2{ 1.0 + 2 * ulp, 0.5 }));
+}
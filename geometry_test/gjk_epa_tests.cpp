@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////
+// gjk_epa_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/gjk_epa.hpp>
+#include <geometrix/algorithm/distance/segment_segment_distance.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using point3 = geometrix::point_double_3d;
+    using polygon2 = geometrix::polygon<point2>;
+    using polygon3 = geometrix::polygon<point3>;
+
+    //! A random convex polygon of n vertices inscribed in a circle.
+    polygon2 make_convex_polygon(double cx, double cy, double r, std::size_t n, geometrix::random_real_generator<>& rnd)
+    {
+        std::vector<double> angles;
+        for (std::size_t i = 0; i < n; ++i)
+            angles.push_back(2.0 * geometrix::constants::pi<double>() * rnd());
+        std::sort(angles.begin(), angles.end());
+        polygon2 p;
+        for (auto a : angles)
+            p.push_back(point2{ cx + r * std::cos(a), cy + r * std::sin(a) });
+        return p;
+    }
+
+    //! The distance of two 3D segments by a ternary search on the convex distance from points of the first to the second.
+    double segment_distance_3d(const point3& a, const point3& b, const point3& c, const point3& d)
+    {
+        using geometrix::get;
+        auto point_distance = [&](double s)
+        {
+            double p[3], q[3], cd[3];
+            double pa[3] = { get<0>(a), get<1>(a), get<2>(a) }, pb[3] = { get<0>(b), get<1>(b), get<2>(b) };
+            double pc[3] = { get<0>(c), get<1>(c), get<2>(c) }, pd[3] = { get<0>(d), get<1>(d), get<2>(d) };
+            double ll = 0, t = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                p[k] = pa[k] + s * (pb[k] - pa[k]);
+                cd[k] = pd[k] - pc[k];
+                ll += cd[k] * cd[k];
+                t += (p[k] - pc[k]) * cd[k];
+            }
+            t = ll > 0 ? (std::min)((std::max)(t / ll, 0.0), 1.0) : 0.0;
+            double r = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                q[k] = pc[k] + t * cd[k];
+                r += (p[k] - q[k]) * (p[k] - q[k]);
+            }
+            return std::sqrt(r);
+        };
+
+        double lo = 0, hi = 1;
+        for (int i = 0; i < 200; ++i)
+        {
+            double m1 = lo + (hi - lo) / 3, m2 = hi - (hi - lo) / 3;
+            if (point_distance(m1) < point_distance(m2))
+                hi = m2;
+            else
+                lo = m1;
+        }
+        return point_distance(0.5 * (lo + hi));
+    }
+
+    polygon3 make_cube(double cx, double cy, double cz, double h)
+    {
+        polygon3 p;
+        for (int i = 0; i < 8; ++i)
+            p.push_back(point3{ cx + ((i & 1) ? h : -h), cy + ((i & 2) ? h : -h), cz + ((i & 4) ? h : -h) });
+        return p;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_distance_of_convex_polygons_matches_brute_force)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        auto a = make_convex_polygon(0.0, 0.0, 1.0 + rnd(), 3 + static_cast<std::size_t>(8 * rnd()), rnd);
+        auto b = make_convex_polygon(5.0 * rnd() - 2.5, 5.0 * rnd() - 2.5, 1.0 + rnd(), 3 + static_cast<std::size_t>(8 * rnd()), rnd);
+        auto result = gjk_distance(a, b);
+
+        double expected = (std::numeric_limits<double>::max)();
+        for (std::size_t i = 0; i < a.size(); ++i)
+            for (std::size_t j = 0; j < b.size(); ++j)
+                expected = (std::min)(expected, segment_segment_distance(segment2(a[i], a[(i + 1) % a.size()]), segment2(b[j], b[(j + 1) % b.size()]), cmp));
+
+        if (result.intersecting)
+        {
+            //! Either the boundaries cross or one contains a vertex of the other.
+            EXPECT_TRUE(expected < 1e-9 || gjk_intersection(a, b));
+        }
+        else
+        {
+            EXPECT_NEAR(expected, result.distance, 1e-9);
+            auto dx = get<0>(result.pointB) - get<0>(result.pointA), dy = get<1>(result.pointB) - get<1>(result.pointA);
+            EXPECT_NEAR(expected, std::hypot(dx, dy), 1e-9);
+            EXPECT_FALSE(gjk_intersection(a, b));
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_epa_sphere_sphere)
+{
+    using namespace geometrix;
+
+    sphere<3, point3> a(point3{ 0.0, 0.0, 0.0 }, 1.0);
+    sphere<3, point3> b(point3{ 3.0, 4.0, 0.0 }, 2.0);
+    auto result = gjk_epa_contact(a, b);
+    EXPECT_FALSE(result.intersecting);
+    EXPECT_NEAR(2.0, result.distance, 1e-12);
+    EXPECT_NEAR(0.6, get<0>(result.pointA), 1e-12);
+    EXPECT_NEAR(0.8, get<1>(result.pointA), 1e-12);
+    EXPECT_NEAR(0.6, get<0>(result.normal), 1e-12);
+
+    sphere<3, point3> c(point3{ 0.0, 0.0, 2.5 }, 2.0);
+    result = gjk_epa_contact(a, c);
+    EXPECT_TRUE(result.intersecting);
+    EXPECT_NEAR(-0.5, result.distance, 1e-12);
+    EXPECT_NEAR(1.0, get<2>(result.normal), 1e-12);
+    EXPECT_TRUE(gjk_intersection(a, c));
+    EXPECT_FALSE(gjk_intersection(a, b));
+
+    //! Concentric spheres have cores which coincide.
+    sphere<3, point3> d(point3{ 0.0, 0.0, 0.0 }, 0.5);
+    result = gjk_epa_contact(a, d);
+    EXPECT_TRUE(result.intersecting);
+    EXPECT_NEAR(-1.5, result.distance, 1e-12);
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_capsule_capsule_matches_segment_distance)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        capsule<point3> a(point3{ rnd(), rnd(), rnd() }, point3{ rnd(), rnd(), rnd() }, 0.5);
+        capsule<point3> b(point3{ rnd(), rnd(), rnd() }, point3{ rnd(), rnd(), rnd() }, 0.25);
+        auto expected = segment_distance_3d(get_start(a.get_segment()), get_end(a.get_segment()), get_start(b.get_segment()), get_end(b.get_segment())) - 0.75;
+        auto result = gjk_epa_contact(a, b);
+        if (expected > 1e-9)
+        {
+            EXPECT_FALSE(result.intersecting);
+            EXPECT_NEAR(expected, result.distance, 1e-9);
+        }
+        else if (expected < -1e-9)
+        {
+            EXPECT_TRUE(result.intersecting);
+            if (expected > -0.75 + 1e-9)
+                EXPECT_NEAR(expected, result.distance, 1e-9);
+            else
+                EXPECT_LE(result.distance, expected + 1e-9);
+        }
+        EXPECT_EQ(expected <= 0, gjk_intersection(a, b) || std::abs(expected) < 1e-9);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_epa_penetration_of_boxes)
+{
+    using namespace geometrix;
+
+    polygon2 a{ point2{ 0.0, 0.0 }, point2{ 2.0, 0.0 }, point2{ 2.0, 2.0 }, point2{ 0.0, 2.0 } };
+    polygon2 b{ point2{ 1.7, 0.5 }, point2{ 3.7, 0.5 }, point2{ 3.7, 2.5 }, point2{ 1.7, 2.5 } };
+    auto result = gjk_epa_contact(a, b);
+    EXPECT_TRUE(result.intersecting);
+    EXPECT_NEAR(-0.3, result.distance, 1e-9);
+    EXPECT_NEAR(1.0, get<0>(result.normal), 1e-9);
+    EXPECT_NEAR(0.0, get<1>(result.normal), 1e-9);
+    EXPECT_NEAR(2.0, get<0>(result.pointA), 1e-9);
+    EXPECT_NEAR(1.7, get<0>(result.pointB), 1e-9);
+
+    //! The same boxes as oriented bounding boxes.
+    obb2 oa(point2{ 1.0, 1.0 }, vector2{ 1.0, 0.0 }, vector2{ 0.0, 1.0 }, 1.0, 1.0);
+    obb2 ob(point2{ 2.7, 1.5 }, vector2{ 1.0, 0.0 }, vector2{ 0.0, 1.0 }, 1.0, 1.0);
+    auto obbResult = gjk_epa_contact(oa, ob);
+    EXPECT_TRUE(obbResult.intersecting);
+    EXPECT_NEAR(-0.3, obbResult.distance, 1e-9);
+    EXPECT_NEAR(1.0, get<0>(obbResult.normal), 1e-9);
+
+    auto ca = make_cube(0.0, 0.0, 0.0, 1.0);
+    auto cb = make_cube(0.5, 1.6, 0.2, 1.0);
+    auto cubeResult = gjk_epa_contact(ca, cb);
+    EXPECT_TRUE(cubeResult.intersecting);
+    EXPECT_NEAR(-0.4, cubeResult.distance, 1e-9);
+    EXPECT_NEAR(1.0, get<1>(cubeResult.normal), 1e-9);
+
+    auto cc = make_cube(0.5, 3.0, 0.2, 1.0);
+    cubeResult = gjk_epa_contact(ca, cc);
+    EXPECT_FALSE(cubeResult.intersecting);
+    EXPECT_NEAR(1.0, cubeResult.distance, 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_triangle_sphere)
+{
+    using namespace geometrix;
+
+    triangle<point3> t(point3{ 0.0, 0.0, 0.0 }, point3{ 4.0, 0.0, 0.0 }, point3{ 0.0, 4.0, 0.0 });
+    sphere<3, point3> above(point3{ 1.0, 1.0, 3.0 }, 1.0);
+    auto result = gjk_epa_contact(t, above);
+    EXPECT_FALSE(result.intersecting);
+    EXPECT_NEAR(2.0, result.distance, 1e-9);
+    EXPECT_NEAR(1.0, get<0>(result.pointA), 1e-9);
+    EXPECT_NEAR(0.0, get<2>(result.pointA), 1e-9);
+
+    sphere<3, point3> through(point3{ 1.0, 1.0, 0.25 }, 1.0);
+    result = gjk_epa_contact(t, through);
+    EXPECT_TRUE(result.intersecting);
+    EXPECT_NEAR(-0.75, result.distance, 1e-9);
+    EXPECT_NEAR(1.0, get<2>(result.normal), 1e-9);
+
+    sphere<3, point3> corner(point3{ -3.0, -4.0, 0.0 }, 1.0);
+    result = gjk_epa_contact(t, corner);
+    EXPECT_FALSE(result.intersecting);
+    EXPECT_NEAR(4.0, result.distance, 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, gjk_warm_start_reduces_iterations)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    auto a = make_convex_polygon(0.0, 0.0, 1.0, 32, rnd);
+    auto b0 = make_convex_polygon(0.0, 0.0, 1.0, 32, rnd);
+
+    gjk_cache<2> cache;
+    std::size_t cold = 0, warm = 0;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        double t = 0.01 * frame;
+        polygon2 b;
+        for (auto const& p : b0)
+            b.push_back(point2{ get<0>(p) + 3.0 + std::cos(t), get<1>(p) + std::sin(t) });
+
+        auto coldResult = gjk_distance(a, b);
+        auto warmResult = gjk_distance(a, b, cache);
+        EXPECT_NEAR(coldResult.distance, warmResult.distance, 1e-9);
+        cold += coldResult.iterations;
+        warm += warmResult.iterations;
+    }
+
+    EXPECT_LT(warm, cold);
+    EXPECT_LE(warm, 200);
+}
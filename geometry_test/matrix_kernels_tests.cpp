@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+// matrix_kernels_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+
+#include <geometrix/primitive/point.hpp>
+#include <geometrix/tensor/matrix.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <geometrix/tensor/composite_matrix.hpp>
+#include <geometrix/algebra/algebra.hpp>
+#include <geometrix/algebra/lup_decomposition.hpp>
+#include <geometrix/arithmetic/matrix_arithmetic.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <stdexcept>
+
+namespace {
+
+    template <typename T, std::size_t Rows, std::size_t Columns>
+    geometrix::matrix<T, Rows, Columns> random_matrix(geometrix::random_real_generator<>& rnd)
+    {
+        geometrix::matrix<T, Rows, Columns> m;
+        for (std::size_t i = 0; i < Rows; ++i)
+            for (std::size_t j = 0; j < Columns; ++j)
+                m[i][j] = rnd() - 5.0;
+        return m;
+    }
+
+}//! namespace;
+
+TEST(matrix_kernels_tests, dot_product_sums_left_to_right_at_any_dimension)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    vector<double, 16> a, b;
+    double expected = 0;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        a[i] = rnd() - 5.0;
+        b[i] = rnd() - 5.0;
+        expected = i == 0 ? a[i] * b[i] : expected + a[i] * b[i];
+    }
+
+    EXPECT_EQ(expected, dot_product(a, b));
+    EXPECT_EQ(expected, (detail::dot_product<vector<double, 16>, vector<double, 16>>()(a, b)));
+
+    //! A prefix of the sequences.
+    EXPECT_EQ(a[0] * b[0], (detail::dot_product<vector<double, 16>, vector<double, 16>, dimension<1>>()(a, b)));
+    EXPECT_EQ(a[0] * b[0] + a[1] * b[1] + a[2] * b[2], (detail::dot_product<vector<double, 16>, vector<double, 16>, dimension<3>>()(a, b)));
+}
+
+TEST(matrix_kernels_tests, matrix_construct_and_product_beyond_the_former_size_limits)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    auto a = random_matrix<double, 20, 20>(rnd);
+    auto b = random_matrix<double, 20, 20>(rnd);
+
+    auto c = construct<matrix<double, 20, 20>>(a);
+    for (std::size_t i = 0; i < 20; ++i)
+        for (std::size_t j = 0; j < 20; ++j)
+            ASSERT_EQ(a[i][j], c[i][j]);
+
+    auto ab = construct<matrix<double, 20, 20>>(a * b);
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        for (std::size_t j = 0; j < 20; ++j)
+        {
+            double expected = a[i][0] * b[0][j];
+            for (std::size_t k = 1; k < 20; ++k)
+                expected += a[i][k] * b[k][j];
+            ASSERT_EQ(expected, ab[i][j]);
+        }
+    }
+
+    //! Non square.
+    auto r = random_matrix<double, 2, 5>(rnd);
+    auto rc = construct<matrix<double, 2, 5>>(r);
+    for (std::size_t j = 0; j < 5; ++j)
+        EXPECT_TRUE(r[0][j] == rc[0][j] && r[1][j] == rc[1][j]);
+}
+
+TEST(matrix_kernels_tests, lup_decomposition_solves_systems_of_any_size)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(10.0);
+    auto m = random_matrix<double, 9, 9>(rnd);
+    boost::array<double, 9> b;
+    for (auto& x : b)
+        x = rnd();
+
+    auto lu = m;
+    boost::array<std::size_t, 9> pi;
+    lup_decomposition(lu, pi);
+    auto x = lup_solve(lu, pi, b);
+    for (std::size_t i = 0; i < 9; ++i)
+    {
+        double bi = 0;
+        for (std::size_t j = 0; j < 9; ++j)
+            bi += m[i][j] * x[j];
+        EXPECT_NEAR(b[i], bi, 1e-9);
+    }
+
+    matrix<double, 4, 4> m4 = {{ { 1, 2, 0, 5 }, { 3, 5, 4, 6 }, { 5, 6, 3, 7 }, { 8, 10, 9, 9 } }};
+    boost::array<std::size_t, 4> p4;
+    boost::array<double, 4> b4 = {{ 0.1, 12.5, 10.3, 8. }};
+    auto lu4 = m4;
+    lup_decomposition(lu4, p4);
+    EXPECT_EQ(3, p4[0]);
+    auto x4 = lup_solve(lu4, p4, b4);
+    for (std::size_t i = 0; i < 4; ++i)
+        EXPECT_NEAR(b4[i], m4[i][0] * x4[0] + m4[i][1] * x4[1] + m4[i][2] * x4[2] + m4[i][3] * x4[3], 1e-12);
+
+    matrix<double, 3, 3> singular = {{ { 1, 2, 3 }, { 2, 4, 6 }, { 0, 1, 1 } }};
+    boost::array<std::size_t, 3> p3;
+    EXPECT_THROW(lup_decomposition(singular, p3), std::logic_error);
+}
+
+TEST(matrix_kernels_tests, composite_matrix_from_sub_matrices)
+{
+    using namespace geometrix;
+
+    matrix<double, 3, 3> m = {{ { 1, 1, 2 }, { 3, 2, 5 }, { 6, 7, 3 } }};
+    vector_double_3d v1(7, 8, 9);
+    vector_double_4d v2(10, 11, 12, 13);
+    column_vector<vector_double_3d> cv(v1);
+    row_vector<vector_double_4d> rv(v2);
+
+    auto cm = as_matrix<4, 4>(m, cv, rv);
+    typedef result_of::as_matrix<4, 4, matrix<double, 3, 3>, column_vector<vector_double_3d>, row_vector<vector_double_4d>>::type cmatrix;
+    static_assert(std::is_same<cmatrix, decltype(cm)>::value, "");
+
+    matrix<double, 4, 4> expected = {{ { 1, 1, 2, 7 }, { 3, 2, 5, 8 }, { 6, 7, 3, 9 }, { 10, 11, 12, 13 } }};
+    auto copy = construct<matrix<double, 4, 4>>(cm);
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_EQ(expected[i][j], copy[i][j]);
+
+    auto product = construct<matrix<double, 4, 4>>(cm * cm);
+    auto expectedProduct = construct<matrix<double, 4, 4>>(expected * expected);
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            EXPECT_EQ(expectedProduct[i][j], product[i][j]);
+
+    //! Five column vectors.
+    auto c5 = as_matrix<3, 5>(cv, cv, cv, cv, cv);
+    EXPECT_EQ(8.0, (get<1, 4>(c5)));
+    EXPECT_EQ(9.0, (get<2, 0>(c5)));
+
+    //! More sub matrices than the old preprocessor arity limit of ten.
+    auto r12 = as_matrix<12, 4>(rv, rv, rv, rv, rv, rv, rv, rv, rv, rv, rv, rv);
+    EXPECT_EQ(11.0, (get<11, 1>(r12)));
+    EXPECT_EQ(13.0, (get<5, 3>(r12)));
+}
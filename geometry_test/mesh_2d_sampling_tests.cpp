@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+// mesh_2d_sampling_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/algorithm/distance/point_point_distance.hpp>
+#include <geometrix/utility/alias_sampler.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    geometrix::mesh_2d<double> make_mesh(double maxArea)
+    {
+        using namespace geometrix;
+        polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 5, 6 }, { 0, 10 } };
+        std::vector<polygon2> holes{ polygon2{ { 2, 2 }, { 2, 4 }, { 4, 4 }, { 4, 2 } } };
+        return make_delaunay_mesh(outer, holes, absolute_tolerance_comparison_policy<double>(1e-10), 25.0 * constants::pi<double>() / 180.0, maxArea);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, alias_sampler_draws_in_proportion_to_weights)
+{
+    using namespace geometrix;
+
+    std::vector<double> weights{ 1.0, 2.0, 0.0, 3.0, 4.0, 0.5 };
+    alias_sampler sut(weights);
+    ASSERT_EQ(weights.size(), sut.size());
+
+    //! A uniform grid of draws hits each index in proportion to its weight.
+    const std::size_t n = 1050000;
+    std::vector<std::size_t> counts(weights.size(), 0);
+    for (std::size_t i = 0; i < n; ++i)
+        ++counts[sut((i + 0.5) / n)];
+    EXPECT_EQ(0, counts[2]);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+        EXPECT_NEAR(weights[i] / 10.5, static_cast<double>(counts[i]) / n, 1e-5);
+
+    alias_sampler single(std::vector<double>{ 3.0 });
+    EXPECT_EQ(0, single(0.999));
+}
+
+TEST_F(geometry_kernel_2d_fixture, counter_based_random_generator_matches_known_answers)
+{
+    using namespace geometrix;
+
+    //! Known answers for Philox4x32-10 from the Random123 distribution.
+    counter_based_random_generator zero(0);
+    auto r = zero(0, 0);
+    EXPECT_EQ(0x6627e8d5u, r[0]);
+    EXPECT_EQ(0xe169c58du, r[1]);
+    EXPECT_EQ(0xbc57ac4cu, r[2]);
+    EXPECT_EQ(0x9b00dbd8u, r[3]);
+
+    counter_based_random_generator ones(0xFFFFFFFFFFFFFFFFull);
+    r = ones(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+    EXPECT_EQ(0x408f276du, r[0]);
+    EXPECT_EQ(0x41c83b0eu, r[1]);
+    EXPECT_EQ(0xa20bc7c6u, r[2]);
+    EXPECT_EQ(0x6d5451fdu, r[3]);
+
+    counter_based_random_generator sut(7);
+    double sum = 0;
+    for (std::uint64_t i = 0; i < 100000; ++i)
+    {
+        auto u = counter_based_random_generator::to_unit(sut(i)[0], sut(i)[1]);
+        ASSERT_TRUE(0.0 <= u && u < 1.0);
+        sum += u;
+    }
+    EXPECT_NEAR(0.5, sum / 100000, 0.005);
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_2d_random_positions_are_deterministic_and_area_weighted)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.5);
+    std::vector<point2> serial(20000), parallel(20000), first(5000), rest(15000);
+    mesh.get_random_positions(serial, 11, 0, 1);
+    mesh.get_random_positions(parallel, 11, 0, 4);
+    mesh.get_random_positions(first, 11, 0);
+    mesh.get_random_positions(rest, 11, 5000);
+    std::size_t nRight = 0;
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+        EXPECT_TRUE(numeric_sequence_equals(serial[i], parallel[i], cmp));
+        EXPECT_TRUE(numeric_sequence_equals(serial[i], i < first.size() ? first[i] : rest[i - first.size()], cmp));
+        EXPECT_TRUE(mesh.find_triangle(serial[i], cmp));
+        if (get<0>(serial[i]) > 5.0)
+            ++nRight;
+    }
+
+    //! The region right of x = 5 holds half of the area outside the hole plus the part of the notch right of center.
+    double total = 100.0 - 20.0 - 4.0, right = 50.0 - 10.0;
+    EXPECT_NEAR(right / total, static_cast<double>(nRight) / serial.size(), 0.015);
+
+    std::vector<point2> other(20000);
+    mesh.get_random_positions(other, 12, 0);
+    EXPECT_FALSE(numeric_sequence_equals(serial[0], other[0], cmp));
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_2d_poisson_disk_positions_are_spaced_and_maximal)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.5);
+    const double radius = 0.25;
+    auto positions = mesh.get_poisson_disk_positions(radius, cmp, 3);
+    ASSERT_GT(positions.size(), 300);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        EXPECT_TRUE(mesh.find_triangle(positions[i], cmp));
+        for (std::size_t j = i + 1; j < positions.size(); ++j)
+            ASSERT_GE(point_point_distance(positions[i], positions[j]), radius);
+    }
+
+    //! Nearly every point of the mesh is within twice the radius of a position.
+    std::vector<point2> probes(2000);
+    mesh.get_random_positions(probes, 99);
+    std::size_t nCovered = 0;
+    for (auto const& p : probes)
+    {
+        double d = (std::numeric_limits<double>::max)();
+        for (auto const& q : positions)
+            d = (std::min)(d, point_point_distance(p, q));
+        if (d < 2.0 * radius)
+            ++nCovered;
+    }
+    EXPECT_GE(nCovered, 1990);
+
+    auto again = mesh.get_poisson_disk_positions(radius, cmp, 3);
+    ASSERT_EQ(positions.size(), again.size());
+    EXPECT_TRUE(numeric_sequence_equals(positions.back(), again.back(), cmp));
+}
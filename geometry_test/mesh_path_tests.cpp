@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////
+// mesh_path_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/compact_mesh_2d.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/algorithm/distance/point_point_distance.hpp>
+#include <geometrix/algorithm/mesh_path.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    //! A 10 x 10 square with a 2 x 6 wall in the middle.
+    geometrix::mesh_2d<double> make_mesh(double maxArea)
+    {
+        using namespace geometrix;
+        polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } };
+        std::vector<polygon2> holes{ polygon2{ { 4, 2 }, { 4, 8 }, { 6, 8 }, { 6, 2 } } };
+        return make_delaunay_mesh(outer, holes, absolute_tolerance_comparison_policy<double>(1e-10), 25.0 * constants::pi<double>() / 180.0, maxArea);
+    }
+
+    double get_length(const std::vector<point2>& path)
+    {
+        double length = 0;
+        for (std::size_t i = 1; i < path.size(); ++i)
+            length += geometrix::point_point_distance(path[i - 1], path[i]);
+        return length;
+    }
+
+    //! Sample each leg of the path to check it stays in the mesh.
+    template <typename Mesh, typename NumberComparisonPolicy>
+    bool is_in_mesh(const Mesh& mesh, const std::vector<point2>& path, const NumberComparisonPolicy& cmp)
+    {
+        using namespace geometrix;
+        for (std::size_t i = 1; i < path.size(); ++i)
+        {
+            for (int j = 0; j <= 100; ++j)
+            {
+                double t = j / 100.0;
+                point2 p{ (1 - t) * get<0>(path[i - 1]) + t * get<0>(path[i]), (1 - t) * get<1>(path[i - 1]) + t * get<1>(path[i]) };
+                if (!mesh.find_triangle(p, cmp))
+                    return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_path_is_straight_in_open_space)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.5);
+    auto path = find_mesh_path(mesh, point2{ 0.5, 0.5 }, point2{ 9.5, 1.5 }, cmp);
+    ASSERT_EQ(2, path.size());
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 0.5, 0.5 }, path.front(), cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 9.5, 1.5 }, path.back(), cmp));
+
+    //! Start and goal in the same triangle.
+    path = find_mesh_path(mesh, point2{ 0.5, 0.5 }, point2{ 0.5, 0.6 }, cmp);
+    EXPECT_EQ(2, path.size());
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_path_pulls_taut_around_obstacles)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.5);
+    mesh_path_workspace workspace;
+    std::vector<point2> path;
+    ASSERT_TRUE(find_mesh_path(mesh, point2{ 1, 5 }, point2{ 9, 5 }, cmp, workspace, path));
+    ASSERT_EQ(4, path.size());
+    EXPECT_TRUE(is_in_mesh(mesh, path, cmp));
+
+    //! Around either end of the wall: (1, 5) -> (4, 8) -> (6, 8) -> (9, 5) or its mirror.
+    EXPECT_NEAR(2.0 * std::sqrt(18.0) + 2.0, get_length(path), 1e-9);
+    EXPECT_NEAR(get<1>(path[1]), get<1>(path[2]), 1e-9);
+    EXPECT_NEAR(4.0, get<0>(path[1]), 1e-9);
+    EXPECT_NEAR(6.0, get<0>(path[2]), 1e-9);
+    EXPECT_FALSE(workspace.get_corridor().empty());
+
+    //! Random queries are no longer than the straight line plus the detour and never leave the mesh.
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 200; ++i)
+    {
+        point2 s{ 10.0 * rnd(), 10.0 * rnd() }, g{ 10.0 * rnd(), 10.0 * rnd() };
+        if (!mesh.find_triangle(s, cmp) || !mesh.find_triangle(g, cmp))
+            continue;
+        ASSERT_TRUE(find_mesh_path(mesh, s, g, cmp, workspace, path));
+        EXPECT_TRUE(is_in_mesh(mesh, path, cmp));
+        EXPECT_GE(get_length(path) + 1e-9, point_point_distance(s, g));
+        EXPECT_LE(get_length(path), point_point_distance(s, g) + 12.0);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_path_fails_outside_or_between_components)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.5);
+    mesh_path_workspace workspace;
+    std::vector<point2> path;
+    EXPECT_FALSE(find_mesh_path(mesh, point2{ 5, 5 }, point2{ 1, 1 }, cmp, workspace, path));
+    EXPECT_FALSE(find_mesh_path(mesh, point2{ 1, 1 }, point2{ 11, 1 }, cmp, workspace, path));
+    EXPECT_TRUE(path.empty());
+
+    //! Two triangles which share only a vertex.
+    std::vector<point2> points{ point2{ 0., 0. }, point2{ 1., 0. }, point2{ 0., 1. }, point2{ 2., 1. }, point2{ 1., 2. } };
+    std::vector<std::size_t> indices{ 0, 1, 2, 1, 3, 4 };
+    mesh_2d<double> split(points, indices, cmp);
+    EXPECT_FALSE(find_mesh_path(split, point2{ 0.2, 0.2 }, point2{ 1.5, 1.2 }, cmp, workspace, path));
+    EXPECT_TRUE(find_mesh_path(split, point2{ 0.2, 0.2 }, point2{ 0.3, 0.2 }, cmp, workspace, path));
+}
+
+TEST_F(geometry_kernel_2d_fixture, mesh_paths_batch_matches_sequential_queries)
+{
+    using namespace geometrix;
+
+    auto mesh = make_mesh(0.2);
+    random_real_generator<> rnd(1.0);
+    std::vector<point2> starts, goals;
+    while (starts.size() < 500)
+    {
+        point2 s{ 10.0 * rnd(), 10.0 * rnd() }, g{ 10.0 * rnd(), 10.0 * rnd() };
+        starts.push_back(s);
+        goals.push_back(g);
+    }
+
+    auto paths = find_mesh_paths(mesh, starts, goals, cmp, 4);
+    ASSERT_EQ(starts.size(), paths.size());
+
+    mesh_path_workspace workspace;
+    std::vector<point2> path;
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        bool found = find_mesh_path(mesh, starts[i], goals[i], cmp, workspace, path);
+        EXPECT_EQ(found, !paths[i].empty());
+        ASSERT_EQ(path.size(), paths[i].size());
+        for (std::size_t j = 0; j < path.size(); ++j)
+            EXPECT_TRUE(numeric_sequence_equals(path[j], paths[i][j], cmp));
+    }
+
+    //! The same queries through a compact mesh.
+    compact_mesh_2d<double> compact(mesh);
+    std::vector<mesh_path_workspace> workspaces(3);
+    std::vector<std::vector<point2>> compactPaths;
+    find_mesh_paths(compact, starts, goals, cmp, workspaces, compactPaths);
+    ASSERT_EQ(paths.size(), compactPaths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i)
+        EXPECT_NEAR(get_length(paths[i]), get_length(compactPaths[i]), 1e-9);
+}
@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+// polygon_boolean_operations_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/polygon_boolean_operations.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    using polygon2 = geometrix::polygon<geometrix::point_double_2d>;
+    using polygon_with_holes2 = geometrix::polygon_with_holes<geometrix::point_double_2d>;
+
+    polygon2 make_square(double x, double y, double size)
+    {
+        using point2 = geometrix::point_double_2d;
+        return polygon2{ point2{ x, y }, point2{ x + size, y }, point2{ x + size, y + size }, point2{ x, y + size } };
+    }
+
+    double get_total_area(const std::vector<polygon_with_holes2>& pgons)
+    {
+        double area = 0;
+        for (auto const& pgon : pgons)
+        {
+            EXPECT_GT(geometrix::get_signed_area(pgon.get_outer()), 0.0);
+            area += geometrix::get_signed_area(pgon.get_outer());
+            for (auto const& hole : pgon.get_holes())
+            {
+                EXPECT_LT(geometrix::get_signed_area(hole), 0.0);
+                area += geometrix::get_signed_area(hole);
+            }
+        }
+        return area;
+    }
+
+    std::size_t get_number_holes(const std::vector<polygon_with_holes2>& pgons)
+    {
+        std::size_t n = 0;
+        for (auto const& pgon : pgons)
+            n += pgon.get_holes().size();
+        return n;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, polygon_boolean_operations_of_overlapping_squares)
+{
+    using namespace geometrix;
+
+    auto a = make_square(0, 0, 10);
+    auto b = make_square(5, 5, 10);
+
+    auto u = polygon_union(a, b, cmp);
+    ASSERT_EQ(1, u.size());
+    EXPECT_NEAR(175.0, get_total_area(u), 1e-9);
+    EXPECT_EQ(8, u[0].get_outer().size());
+
+    auto i = polygon_intersection(a, b, cmp);
+    ASSERT_EQ(1, i.size());
+    EXPECT_NEAR(25.0, get_total_area(i), 1e-9);
+    EXPECT_EQ(4, i[0].get_outer().size());
+
+    auto d = polygon_difference(a, b, cmp);
+    ASSERT_EQ(1, d.size());
+    EXPECT_NEAR(75.0, get_total_area(d), 1e-9);
+    EXPECT_EQ(6, d[0].get_outer().size());
+
+    auto x = polygon_xor(a, b, cmp);
+    ASSERT_EQ(2, x.size());
+    EXPECT_NEAR(150.0, get_total_area(x), 1e-9);
+
+    //! Clockwise input gives the same result.
+    auto bcw = b;
+    std::reverse(bcw.begin(), bcw.end());
+    EXPECT_NEAR(175.0, get_total_area(polygon_union(a, bcw, cmp)), 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, polygon_boolean_operations_with_holes)
+{
+    using namespace geometrix;
+
+    auto outer = make_square(0, 0, 10);
+    auto inner = make_square(3, 3, 4);
+
+    //! Cutting a square out of the middle of another leaves a hole.
+    auto ring = polygon_difference(outer, inner, cmp);
+    ASSERT_EQ(1, ring.size());
+    EXPECT_EQ(1, get_number_holes(ring));
+    EXPECT_NEAR(84.0, get_total_area(ring), 1e-9);
+
+    //! Filling the hole with a larger square removes it.
+    auto filled = polygon_union(ring, make_square(2, 2, 6), cmp);
+    ASSERT_EQ(1, filled.size());
+    EXPECT_EQ(0, get_number_holes(filled));
+    EXPECT_NEAR(100.0, get_total_area(filled), 1e-9);
+
+    //! A square across the rim of the hole.
+    auto bridge = polygon_intersection(ring, make_square(1, 4, 4), cmp);
+    ASSERT_EQ(1, bridge.size());
+    EXPECT_NEAR(10.0, get_total_area(bridge), 1e-9);
+
+    //! Two nested rings make an island inside a hole.
+    auto island = polygon_union(ring, make_square(4, 4, 2), cmp);
+    ASSERT_EQ(2, island.size());
+    EXPECT_EQ(1, get_number_holes(island));
+    EXPECT_NEAR(88.0, get_total_area(island), 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, polygon_boolean_operations_of_disjoint_and_touching_squares)
+{
+    using namespace geometrix;
+
+    auto a = make_square(0, 0, 1);
+    auto far = make_square(5, 5, 1);
+    EXPECT_EQ(2, polygon_union(a, far, cmp).size());
+    EXPECT_TRUE(polygon_intersection(a, far, cmp).empty());
+    EXPECT_NEAR(1.0, get_total_area(polygon_difference(a, far, cmp)), 1e-9);
+
+    //! Sharing an edge merges into a rectangle with no vertices left on the shared edge.
+    auto side = make_square(1, 0, 1);
+    auto u = polygon_union(a, side, cmp);
+    ASSERT_EQ(1, u.size());
+    EXPECT_EQ(4, u[0].get_outer().size());
+    EXPECT_NEAR(2.0, get_total_area(u), 1e-9);
+    EXPECT_TRUE(polygon_intersection(a, side, cmp).empty());
+
+    //! Touching at a corner keeps two polygons.
+    auto corner = make_square(1, 1, 1);
+    auto c = polygon_union(a, corner, cmp);
+    ASSERT_EQ(2, c.size());
+    EXPECT_NEAR(2.0, get_total_area(c), 1e-9);
+
+    //! Identical operands.
+    EXPECT_NEAR(1.0, get_total_area(polygon_union(a, a, cmp)), 1e-9);
+    EXPECT_TRUE(polygon_difference(a, a, cmp).empty());
+    EXPECT_TRUE(polygon_xor(a, a, cmp).empty());
+}
+
+TEST_F(geometry_kernel_2d_fixture, cascaded_polygon_union_of_a_grid_of_squares)
+{
+    using namespace geometrix;
+
+    //! A 20 x 20 lattice of 1.5 x 1.5 squares at unit spacing covers a 20.5 x 20.5 square.
+    std::vector<polygon2> squares;
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 20; ++j)
+            squares.push_back(make_square(i, j, 1.5));
+
+    auto result = cascaded_polygon_union(squares, cmp);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ(0, get_number_holes(result));
+    EXPECT_EQ(4, result[0].get_outer().size());
+    EXPECT_NEAR(20.5 * 20.5, get_total_area(result), 1e-6);
+
+    //! The result does not depend on the number of threads.
+    auto serial = cascaded_polygon_union(squares, cmp, 1);
+    ASSERT_EQ(1, serial.size());
+    EXPECT_NEAR(get_total_area(result), get_total_area(serial), 1e-9);
+
+    //! The unit squares around the border of a 10 x 10 block enclose an 8 x 8 hole.
+    std::vector<polygon_with_holes2> frames;
+    for (int i = 0; i < 10; ++i)
+        for (int j = 0; j < 10; ++j)
+            if (i == 0 || j == 0 || i == 9 || j == 9)
+                frames.emplace_back(make_square(i, j, 1));
+    auto framed = cascaded_polygon_union(frames, cmp);
+    ASSERT_EQ(1, framed.size());
+    EXPECT_EQ(1, get_number_holes(framed));
+    EXPECT_NEAR(100.0 - 64.0, get_total_area(framed), 1e-9);
+}
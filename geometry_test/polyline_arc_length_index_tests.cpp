@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+// polyline_arc_length_index_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/point_sequence/polyline_arc_length_index.hpp>
+#include <geometrix/algorithm/point_sequence/length.hpp>
+#include <geometrix/algorithm/distance/point_segment_distance.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    template <typename Polyline>
+    Polyline make_random_walk(std::size_t n)
+    {
+        geometrix::random_real_generator<> rnd(1.0);
+        Polyline result;
+        double x = 0, y = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            result.emplace_back(x, y);
+            x += rnd() - 0.25;
+            y += rnd() - 0.5;
+        }
+        return result;
+    }
+
+    //! The distance from p to the closest segment of pline by checking every segment.
+    template <typename Polyline, typename Point>
+    double get_closest_distance(const Polyline& pline, const Point& p)
+    {
+        using segment2 = geometry_kernel_2d_fixture::segment2;
+        double result = (std::numeric_limits<double>::max)();
+        for (std::size_t i = 1; i < pline.size(); ++i)
+            result = (std::min)(result, geometrix::point_segment_distance(p, segment2(pline[i - 1], pline[i])));
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, polyline_arc_length_index_matches_linear_walk)
+{
+    using namespace geometrix;
+
+    auto pline = make_random_walk<polyline2>(1000);
+    polyline_arc_length_index<polyline2> sut(pline);
+
+    auto length = polyline_length(pline);
+    EXPECT_NEAR(length, sut.get_length(), 1e-9);
+    EXPECT_EQ(pline.size(), sut.size());
+
+    random_real_generator<> rnd(length);
+    for (int q = 0; q < 200; ++q)
+    {
+        auto s = rnd();
+        auto expected = polyline_point_at_position(pline, s);
+        auto result = sut.find_position(s);
+        ASSERT_EQ(std::get<0>(expected), std::get<0>(result));
+        ASSERT_EQ(std::get<1>(expected).is_initialized(), std::get<1>(result).is_initialized());
+        if (std::get<1>(result))
+        {
+            EXPECT_TRUE(numeric_sequence_equals(*std::get<1>(expected), *std::get<1>(result), cmp));
+        }
+
+        point2 a = sut.get_point_at(s);
+        EXPECT_NEAR(s, sut.get_station_of(a, sut.find_segment(s)), 1e-9);
+        EXPECT_NEAR(s, sut.get_station_of_closest_point(a).first, 1e-9);
+
+        auto parts = sut.split(s);
+        auto expectedParts = polyline_split(pline, s);
+        EXPECT_TRUE(point_sequences_equal(std::get<0>(expectedParts), std::get<0>(parts), cmp));
+        EXPECT_TRUE(point_sequences_equal(std::get<1>(expectedParts), std::get<1>(parts), cmp));
+    }
+
+    //! Ends and vertices.
+    EXPECT_TRUE(numeric_sequence_equals(pline.front(), sut.get_point_at(-1.0), cmp));
+    EXPECT_TRUE(numeric_sequence_equals(pline.back(), sut.get_point_at(length + 1.0), cmp));
+    EXPECT_TRUE(numeric_sequence_equals(pline[17], sut.get_point_at(sut.get_station(17)), cmp));
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_arc_length_index_sub_polyline_and_batches)
+{
+    using namespace geometrix;
+
+    polyline2 pline{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 3, 1 } };
+    polyline_arc_length_index<polyline2> sut(pline);
+    EXPECT_EQ(4.0, sut.get_length());
+
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 0.5, 0 }, { 1, 0 }, { 1, 1 }, { 1.5, 1 } }, sut.get_sub_polyline(0.5, 2.5), cmp));
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 1, 0 }, { 1, 1 } }, sut.get_sub_polyline(1.0, 2.0), cmp));
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 1, 0.5 } }, sut.get_sub_polyline(1.5, 1.5), cmp));
+
+    std::vector<double> stations{ 0.5, 1.0, 2.5, 3.0 };
+    std::vector<point2> points;
+    sut.get_points_at(stations, std::back_inserter(points));
+    ASSERT_EQ(4, points.size());
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 0.5, 0 }, points[0], cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 1, 0 }, points[1], cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 1.5, 1 }, points[2], cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 2, 1 }, points[3], cmp));
+
+    auto parts = sut.split_at(std::vector<double>{ 1.5, 3.0 });
+    ASSERT_EQ(3, parts.size());
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 0, 0 }, { 1, 0 }, { 1, 0.5 } }, parts[0], cmp));
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 1, 0.5 }, { 1, 1 }, { 2, 1 } }, parts[1], cmp));
+    EXPECT_TRUE(point_sequences_equal(polyline2{ { 2, 1 }, { 3, 1 } }, parts[2], cmp));
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_arc_length_index_update_after_append_and_parallel_build)
+{
+    using namespace geometrix;
+
+    //! Long enough to be built in several batches.
+    auto pline = make_random_walk<polyline2>(3 * polyline_arc_length_index<polyline2>::batch_size + 17);
+    polyline_arc_length_index<polyline2> serial(pline, 1);
+    polyline_arc_length_index<polyline2> parallel(pline, 4);
+    EXPECT_EQ(serial.get_stations(), parallel.get_stations());
+    EXPECT_NEAR(polyline_length(pline), serial.get_length(), 1e-6);
+
+    auto length = serial.get_length();
+    pline.emplace_back(pline.back()[0] + 3.0, pline.back()[1] + 4.0);
+    serial.update();
+    EXPECT_EQ(pline.size(), serial.size());
+    EXPECT_NEAR(length + 5.0, serial.get_length(), 1e-9);
+
+    polyline_arc_length_index<polyline2> rebuilt(pline);
+    ASSERT_EQ(rebuilt.size(), serial.size());
+    for (std::size_t i = 0; i < rebuilt.size(); ++i)
+        EXPECT_NEAR(rebuilt.get_station(i), serial.get_station(i), 1e-9);
+
+    //! Shrinking the polyline rebuilds the index.
+    pline.resize(10);
+    serial.update();
+    EXPECT_EQ(10, serial.size());
+    EXPECT_NEAR(polyline_length(pline), serial.get_length(), 1e-12);
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_arc_length_index_closest_point_matches_brute_force)
+{
+    using namespace geometrix;
+
+    auto pline = make_random_walk<polyline2>(2000);
+    polyline_arc_length_index<polyline2> sut(pline);
+
+    random_real_generator<> rnd(1.0);
+    auto check = [&]()
+    {
+        for (int q = 0; q < 100; ++q)
+        {
+            auto const& v = pline[static_cast<std::size_t>(rnd() * (pline.size() - 1))];
+            point2 p{ v[0] + 4.0 * rnd() - 2.0, v[1] + 4.0 * rnd() - 2.0 };
+            auto result = sut.get_station_of_closest_point(p);
+            ASSERT_LT(result.second + 1, pline.size());
+            EXPECT_NEAR(sut.get_station_of(p, result.second), result.first, 1e-9);
+            EXPECT_NEAR(get_closest_distance(pline, p), point_point_distance(p, sut.get_point_at(result.first)), 1e-9);
+        }
+    };
+
+    check();
+
+    //! Appended segments are inserted into the segment index.
+    for (int i = 0; i < 100; ++i)
+        pline.emplace_back(pline.back()[0] + rnd() - 0.5, pline.back()[1] + rnd());
+    sut.update();
+    check();
+    auto tail = point2{ pline.back()[0] + 1.0, pline.back()[1] + 1.0 };
+    EXPECT_EQ(pline.size() - 2, sut.get_station_of_closest_point(tail).second);
+}
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+// polyline_similarity_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/distance/polyline_similarity.hpp>
+#include <geometrix/algorithm/distance/point_polyline_distance.hpp>
+#include <geometrix/algorithm/distance/aabb_aabb_distance.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polyline2 = geometrix::polyline<point2>;
+
+    polyline2 make_random_walk(double x, double y, std::size_t n, geometrix::random_real_generator<>& rnd)
+    {
+        polyline2 p;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            p.push_back(point2{ x, y });
+            x += 1.0 + rnd();
+            y += 2.0 * rnd() - 1.0;
+        }
+        return p;
+    }
+
+    //! The directed Hausdorff distance estimated from dense samples of p.
+    double sample_directed_hausdorff(const polyline2& p, const polyline2& q)
+    {
+        using namespace geometrix;
+        double result = 0;
+        for (std::size_t i = 1; i < p.size(); ++i)
+        {
+            for (int k = 0; k <= 1000; ++k)
+            {
+                double t = k / 1000.0;
+                point2 s{ get<0>(p[i - 1]) + t * (get<0>(p[i]) - get<0>(p[i - 1])), get<1>(p[i - 1]) + t * (get<1>(p[i]) - get<1>(p[i - 1])) };
+                double d = (std::numeric_limits<double>::max)();
+                for (std::size_t j = 1; j < q.size(); ++j)
+                    d = (std::min)(d, point_segment_distance(s, segment<point2>(q[j - 1], q[j])));
+                result = (std::max)(result, d);
+            }
+        }
+        return result;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, frechet_distance_of_known_curves)
+{
+    using namespace geometrix;
+
+    polyline2 line{ point2{ 0.0, 0.0 }, point2{ 10.0, 0.0 } };
+    polyline2 tent{ point2{ 0.0, 0.0 }, point2{ 5.0, 3.0 }, point2{ 10.0, 0.0 } };
+    EXPECT_NEAR(3.0, frechet_distance(line, tent, cmp), 1e-9);
+    EXPECT_NEAR(std::sqrt(34.0), discrete_frechet_distance(line, tent, cmp), 1e-12);
+    EXPECT_NEAR(3.0, hausdorff_distance(line, tent, cmp), 1e-9);
+
+    //! Backtracking raises the Fréchet distance but not the Hausdorff distance.
+    polyline2 back{ point2{ 0.0, 0.0 }, point2{ 6.0, 0.0 }, point2{ 4.0, 0.0 }, point2{ 10.0, 0.0 } };
+    EXPECT_NEAR(1.0, frechet_distance(line, back, cmp), 1e-9);
+    EXPECT_NEAR(0.0, hausdorff_distance(line, back, cmp), 1e-9);
+
+    polyline2 shifted{ point2{ 0.0, 1.0 }, point2{ 5.0, 1.0 }, point2{ 10.0, 1.0 } };
+    polyline2 sampled{ point2{ 0.0, 0.0 }, point2{ 5.0, 0.0 }, point2{ 10.0, 0.0 } };
+    EXPECT_NEAR(1.0, discrete_frechet_distance(sampled, shifted, cmp), 1e-12);
+    EXPECT_NEAR(1.0, frechet_distance(line, shifted, cmp), 1e-9);
+
+    //! Reversed curves are far apart under Fréchet.
+    polyline2 reversed{ point2{ 10.0, 0.0 }, point2{ 0.0, 0.0 } };
+    EXPECT_NEAR(10.0, frechet_distance(line, reversed, cmp), 1e-9);
+    EXPECT_NEAR(0.0, hausdorff_distance(line, reversed, cmp), 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, directed_hausdorff_finds_interior_maximum)
+{
+    using namespace geometrix;
+
+    //! The farthest point of the base from the cup is its midpoint, not a vertex.
+    polyline2 base{ point2{ 0.0, 0.0 }, point2{ 10.0, 0.0 } };
+    polyline2 cup{ point2{ 0.0, 0.0 }, point2{ 0.0, 5.0 }, point2{ 10.0, 5.0 }, point2{ 10.0, 0.0 } };
+    EXPECT_NEAR(5.0, directed_hausdorff_distance(base, cup, cmp), 1e-9);
+    EXPECT_NEAR(5.0, directed_hausdorff_distance(cup, base, cmp), 1e-9);
+
+    random_real_generator<> rnd(1.0);
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        auto p = make_random_walk(0.0, 0.0, 10, rnd);
+        auto q = make_random_walk(0.5, 1.0, 15, rnd);
+        auto h = directed_hausdorff_distance(p, q, cmp);
+        auto sampled = sample_directed_hausdorff(p, q);
+        EXPECT_GE(h + 1e-9, sampled);
+        EXPECT_LE(h, sampled + 0.002);
+
+        auto f = frechet_distance(p, q, cmp);
+        EXPECT_GE(f + 1e-9, hausdorff_distance(p, q, cmp));
+        EXPECT_LE(f, discrete_frechet_distance(p, q, cmp) + 1e-9);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_similarity_thresholds_abandon)
+{
+    using namespace geometrix;
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    random_real_generator<> rnd(1.0);
+    auto p = make_random_walk(0.0, 0.0, 30, rnd);
+    auto q = make_random_walk(0.0, 0.5, 30, rnd);
+    for (auto metric : { e_discrete_frechet, e_continuous_frechet, e_directed_hausdorff, e_hausdorff })
+    {
+        auto d = polyline_similarity(p, q, metric, cmp);
+        ASSERT_LT(d, infinity);
+        EXPECT_NEAR(d, polyline_similarity(p, q, metric, cmp, d + 1e-6), 1e-9);
+        EXPECT_EQ(infinity, polyline_similarity(p, q, metric, cmp, 0.9 * d));
+    }
+
+    //! Pairs whose boxes are apart are rejected without visiting the curves.
+    auto far = make_random_walk(0.0, 100.0, 30, rnd);
+    EXPECT_EQ(infinity, hausdorff_distance(p, far, cmp, 10.0));
+    EXPECT_EQ(infinity, frechet_distance(p, far, cmp, 10.0));
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_similarities_batch_matches_pairwise)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    auto query = make_random_walk(0.0, 0.0, 20, rnd);
+    std::vector<polyline2> candidates;
+    for (int i = 0; i < 500; ++i)
+        candidates.push_back(make_random_walk(4.0 * rnd() - 2.0, 40.0 * rnd() - 20.0, 10 + static_cast<std::size_t>(20 * rnd()), rnd));
+
+    for (auto metric : { e_discrete_frechet, e_continuous_frechet, e_hausdorff })
+    {
+        auto all = get_polyline_similarities(query, candidates, metric, cmp);
+        auto near = get_polyline_similarities(query, candidates, metric, cmp, 5.0);
+        ASSERT_EQ(candidates.size(), all.size());
+        std::size_t nNear = 0;
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            EXPECT_NEAR(polyline_similarity(query, candidates[i], metric, cmp), all[i], 1e-9);
+            if (all[i] <= 5.0)
+            {
+                EXPECT_NEAR(all[i], near[i], 1e-9);
+                ++nNear;
+            }
+            else
+                EXPECT_EQ(std::numeric_limits<double>::infinity(), near[i]);
+        }
+        EXPECT_GT(nNear, 0);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, polyline_similarity_in_3d)
+{
+    using namespace geometrix;
+
+    using point3 = point_double_3d;
+    polyline<point3> helix, lifted;
+    for (int i = 0; i <= 100; ++i)
+    {
+        double t = 0.1 * i;
+        helix.push_back(point3{ std::cos(t), std::sin(t), 0.1 * t });
+        lifted.push_back(point3{ std::cos(t), std::sin(t), 0.1 * t + 0.25 });
+    }
+
+    EXPECT_NEAR(0.25, frechet_distance(helix, lifted, cmp), 1e-9);
+    EXPECT_NEAR(0.25, discrete_frechet_distance(helix, lifted, cmp), 1e-12);
+    EXPECT_LE(hausdorff_distance(helix, lifted, cmp), 0.25 + 1e-9);
+
+    //! Finite thresholds try the distance of the bounding boxes first. The helix spans z in [0, 1].
+    EXPECT_NEAR(0.25, frechet_distance(helix, lifted, cmp, 0.3), 1e-9);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), frechet_distance(helix, lifted, cmp, 0.2));
+
+    //! Apart only in z: the boxes are 1.5 apart so the pair is rejected below that and measured above it.
+    polyline<point3> above;
+    for (auto const& p : helix)
+        above.push_back(point3{ p[0], p[1], p[2] + 2.5 });
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), hausdorff_distance(helix, above, cmp, 1.4));
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), frechet_distance(helix, above, cmp, 1.4));
+    EXPECT_NEAR(2.5, frechet_distance(helix, above, cmp, 3.0), 1e-9);
+    EXPECT_NEAR(2.5, discrete_frechet_distance(helix, above, cmp, 3.0), 1e-12);
+}
+
+TEST_F(geometry_kernel_2d_fixture, aabb_aabb_distance_in_3d)
+{
+    using namespace geometrix;
+
+    using point3 = point_double_3d;
+    using aabb3 = axis_aligned_bounding_box<point3>;
+
+    //! The box [lo, hi] on the given axis and [0, 1] on the others.
+    auto make_box = [](std::size_t axis, double lo, double hi)
+    {
+        point3 a{ 0.0, 0.0, 0.0 }, b{ 1.0, 1.0, 1.0 };
+        a[axis] = lo;
+        b[axis] = hi;
+        return aabb3(a, b);
+    };
+
+    aabb3 unit(point3{ 0.0, 0.0, 0.0 }, point3{ 1.0, 1.0, 1.0 });
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        //! Separated above and below.
+        EXPECT_DOUBLE_EQ(1.0, aabb_aabb_distance(unit, make_box(axis, 2.0, 3.0)));
+        EXPECT_DOUBLE_EQ(4.0, aabb_aabb_distance_sqrd(unit, make_box(axis, 3.0, 4.0)));
+        EXPECT_DOUBLE_EQ(0.5, aabb_aabb_distance(make_box(axis, -2.5, -0.5), unit));
+        EXPECT_DOUBLE_EQ(0.5, aabb_aabb_distance(unit, make_box(axis, -2.5, -0.5)));
+
+        //! Touching.
+        EXPECT_EQ(0.0, aabb_aabb_distance(unit, make_box(axis, 1.0, 2.0)));
+        EXPECT_EQ(0.0, aabb_aabb_distance(make_box(axis, -1.0, 0.0), unit));
+
+        //! Overlapping and contained.
+        EXPECT_EQ(0.0, aabb_aabb_distance(unit, make_box(axis, 0.5, 1.5)));
+        EXPECT_EQ(0.0, aabb_aabb_distance(unit, make_box(axis, 0.25, 0.75)));
+        EXPECT_EQ(0.0, aabb_aabb_distance(unit, make_box(axis, -1.0, 2.0)));
+    }
+
+    //! Apart on every axis.
+    aabb3 corner(point3{ 2.0, 3.0, 4.0 }, point3{ 5.0, 5.0, 5.0 });
+    EXPECT_DOUBLE_EQ(1.0 + 4.0 + 9.0, aabb_aabb_distance_sqrd(unit, corner));
+    EXPECT_DOUBLE_EQ(std::sqrt(14.0), aabb_aabb_distance(corner, unit));
+}
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// rotating_calipers_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/rotating_calipers.hpp>
+#include <geometrix/algorithm/distance/polygon_polygon_distance.hpp>
+#include <geometrix/algorithm/point_in_polygon.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    std::vector<point2> make_random_points(double cx, double cy, double r, std::size_t n, geometrix::random_real_generator<>& rnd)
+    {
+        std::vector<point2> points;
+        for (std::size_t i = 0; i < n; ++i)
+            points.push_back(point2{ cx + r * (2.0 * rnd() - 1.0), cy + r * (2.0 * rnd() - 1.0) });
+        return points;
+    }
+
+    bool obb_contains(const geometrix::obb_double_2d& box, const point2& p)
+    {
+        using namespace geometrix;
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            auto const& a = box.get_axis(i);
+            auto d = (get<0>(p) - get<0>(box.get_center())) * get<0>(a) + (get<1>(p) - get<1>(box.get_center())) * get<1>(a);
+            if (std::abs(d) > box.get_halfwidth(i) + 1e-9)
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, monotone_chain_convex_hull_contains_points)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    auto points = make_random_points(0.0, 0.0, 10.0, 500, rnd);
+    points.push_back(point2{ -10.0, -10.0 });
+    points.push_back(point2{ 0.0, -10.0 });
+    points.push_back(point2{ 10.0, -10.0 });
+    auto hull = monotone_chain_convex_hull<polygon2>(points, cmp);
+
+    ASSERT_GE(hull.size(), 3);
+    EXPECT_GT(get_signed_area(hull), 0.0);
+    for (std::size_t i = 0, j = hull.size() - 1; i < hull.size(); j = i++)
+    {
+        EXPECT_EQ(oriented_left, filtered_orientation(hull[j], hull[i], hull[(i + 1) % hull.size()]));
+        for (auto const& p : points)
+            EXPECT_NE(oriented_right, filtered_orientation(hull[j], hull[i], p));
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, convex_polygon_distance_matches_polygon_polygon_distance)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        auto a = monotone_chain_convex_hull<polygon2>(make_random_points(0.0, 0.0, 1.0, 3 + static_cast<std::size_t>(30 * rnd()), rnd), cmp);
+        auto b = monotone_chain_convex_hull<polygon2>(make_random_points(8.0 * rnd() - 4.0, 8.0 * rnd() - 4.0, 1.0, 3 + static_cast<std::size_t>(30 * rnd()), rnd), cmp);
+
+        //! Either orientation is accepted.
+        if (trial % 2)
+            std::reverse(b.begin(), b.end());
+
+        point2 ca, cb;
+        auto d2 = convex_polygon_closest_points(a, b, ca, cb);
+        auto expected = polygon_polygon_distance_sqrd_brute(a, b, cmp);
+        bool overlapping = expected < 1e-18 || point_in_polygon(a[0], b) || point_in_polygon(b[0], a);
+        if (overlapping)
+            EXPECT_EQ(0.0, d2);
+        else
+        {
+            EXPECT_NEAR(expected, d2, 1e-9);
+            EXPECT_NEAR(expected, point_point_distance_sqrd(ca, cb), 1e-9);
+        }
+    }
+
+    //! A polygon inside another is at distance zero, unlike the boundary distance.
+    polygon2 outer{ point2{ 0.0, 0.0 }, point2{ 10.0, 0.0 }, point2{ 10.0, 10.0 }, point2{ 0.0, 10.0 } };
+    polygon2 inner{ point2{ 4.0, 4.0 }, point2{ 6.0, 4.0 }, point2{ 6.0, 6.0 }, point2{ 4.0, 6.0 } };
+    EXPECT_EQ(0.0, convex_polygon_distance(outer, inner));
+    EXPECT_NEAR(4.0, polygon_polygon_distance(outer, inner, cmp), 1e-12);
+}
+
+TEST_F(geometry_kernel_2d_fixture, convex_polygon_diameter_and_width_match_brute_force)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (int trial = 0; trial < 50; ++trial)
+    {
+        auto points = make_random_points(0.0, 0.0, 1.0 + 5.0 * rnd(), 5 + static_cast<std::size_t>(100 * rnd()), rnd);
+        auto hull = monotone_chain_convex_hull<polygon2>(points, cmp);
+
+        double diameter = 0;
+        for (auto const& p : points)
+            for (auto const& q : points)
+                diameter = (std::max)(diameter, point_point_distance(p, q));
+        point2 a, b;
+        EXPECT_NEAR(diameter, convex_polygon_diameter(hull, a, b), 1e-12);
+        EXPECT_NEAR(diameter, point_point_distance(a, b), 1e-12);
+
+        double width = (std::numeric_limits<double>::max)();
+        for (std::size_t i = 0, j = hull.size() - 1; i < hull.size(); j = i++)
+        {
+            double height = 0;
+            for (auto const& p : hull)
+            {
+                double ex = get<0>(hull[i]) - get<0>(hull[j]), ey = get<1>(hull[i]) - get<1>(hull[j]);
+                double offset = (ex * (get<1>(p) - get<1>(hull[j])) - ey * (get<0>(p) - get<0>(hull[j]))) / std::hypot(ex, ey);
+                height = (std::max)(height, offset);
+            }
+            width = (std::min)(width, height);
+        }
+        EXPECT_NEAR(width, convex_polygon_width(hull), 1e-9);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, minimum_area_obb_fits_rotated_rectangle)
+{
+    using namespace geometrix;
+
+    //! Points filling a 6 x 2 rectangle rotated by 30 degrees.
+    random_real_generator<> rnd(1.0);
+    double c = std::cos(constants::pi<double>() / 6.0), s = std::sin(constants::pi<double>() / 6.0);
+    std::vector<point2> points;
+    for (int i = 0; i < 200; ++i)
+    {
+        double u = 6.0 * rnd() - 3.0, v = 2.0 * rnd() - 1.0;
+        points.push_back(point2{ 5.0 + c * u - s * v, 1.0 + s * u + c * v });
+    }
+    for (double u : { -3.0, 3.0 })
+        for (double v : { -1.0, 1.0 })
+            points.push_back(point2{ 5.0 + c * u - s * v, 1.0 + s * u + c * v });
+
+    auto box = make_minimum_area_obb<point2, vector2>(points, cmp);
+    EXPECT_NEAR(12.0, 4.0 * box.get_halfwidth(0) * box.get_halfwidth(1), 1e-9);
+    EXPECT_NEAR(5.0, get<0>(box.get_center()), 1e-9);
+    EXPECT_NEAR(1.0, get<1>(box.get_center()), 1e-9);
+    for (auto const& p : points)
+        EXPECT_TRUE(obb_contains(box, p));
+
+    auto thin = make_minimum_width_obb<point2, vector2>(points, cmp);
+    EXPECT_NEAR(1.0, (std::min)(thin.get_halfwidth(0), thin.get_halfwidth(1)), 1e-9);
+}
+
+TEST_F(geometry_kernel_2d_fixture, minimum_area_obb_is_no_larger_than_sampled_orientations)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        auto points = make_random_points(10.0 * rnd(), 10.0 * rnd(), 1.0 + 5.0 * rnd(), 3 + static_cast<std::size_t>(50 * rnd()), rnd);
+        auto box = make_minimum_area_obb<point2, vector2>(points, cmp);
+        for (auto const& p : points)
+            EXPECT_TRUE(obb_contains(box, p));
+
+        auto area = 4.0 * box.get_halfwidth(0) * box.get_halfwidth(1);
+        for (int k = 0; k < 360; ++k)
+        {
+            double theta = k * constants::pi<double>() / 360.0;
+            double ux = std::cos(theta), uy = std::sin(theta);
+            double lo[2] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+            double hi[2] = { -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max() };
+            for (auto const& p : points)
+            {
+                double d[2] = { get<0>(p) * ux + get<1>(p) * uy, -get<0>(p) * uy + get<1>(p) * ux };
+                for (int i = 0; i < 2; ++i)
+                {
+                    lo[i] = (std::min)(lo[i], d[i]);
+                    hi[i] = (std::max)(hi[i], d[i]);
+                }
+            }
+            EXPECT_LE(area, (hi[0] - lo[0]) * (hi[1] - lo[1]) + 1e-9);
+        }
+    }
+}
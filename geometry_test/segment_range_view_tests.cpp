@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// segment_range_view_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/all_segment_intersections.hpp>
+#include <geometrix/algorithm/hyperplane_partition_policies.hpp>
+#include <geometrix/algorithm/node_bsp_tree_2d.hpp>
+#include <geometrix/algorithm/polygon_with_holes_as_segment_range.hpp>
+#include <geometrix/algorithm/solid_leaf_bsp_tree.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/primitive/segment_range_view.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using segment2 = geometrix::segment_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    template <typename Segments, typename NumberComparisonPolicy>
+    bool segments_equal(const std::vector<segment2>& expected, const Segments& segments, const NumberComparisonPolicy& cmp)
+    {
+        using namespace geometrix;
+        if (expected.size() != segments.size() || expected.size() != static_cast<std::size_t>(std::distance(segments.begin(), segments.end())))
+            return false;
+        std::size_t i = 0;
+        for (auto const& s : segments)
+        {
+            if (!numeric_sequence_equals(get_start(expected[i]), get_start(s), cmp) || !numeric_sequence_equals(get_end(expected[i]), get_end(s), cmp))
+                return false;
+            if (!numeric_sequence_equals(get_start(expected[i]), get_start(segments[i]), cmp) || !numeric_sequence_equals(get_end(expected[i]), get_end(segments[i]), cmp))
+                return false;
+            ++i;
+        }
+        return true;
+    }
+
+    polygon2 make_box(double x0, double y0, double x1, double y1)
+    {
+        return polygon2{ point2{ x0, y0 }, point2{ x1, y0 }, point2{ x1, y1 }, point2{ x0, y1 } };
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, segment_views_match_copied_segment_ranges)
+{
+    using namespace geometrix;
+
+    polygon2 pgon{ point2{ 0, 0 }, point2{ 4, 0 }, point2{ 5, 3 }, point2{ 2, 5 }, point2{ -1, 3 } };
+    auto polygonView = make_polygon_segment_view<segment2>(pgon);
+    EXPECT_TRUE(segments_equal(polygon_as_segment_range<segment2>(pgon), polygonView, cmp));
+    EXPECT_TRUE(numeric_sequence_equals(point2{ 0, 0 }, get_end(polygonView.back()), cmp));
+
+    polyline2 pline{ point2{ 0, 0 }, point2{ 1, 1 }, point2{ 2, 0 } };
+    auto polylineView = make_polyline_segment_view<segment2>(pline);
+    EXPECT_EQ(2, polylineView.size());
+    EXPECT_TRUE(segments_equal(polyline_as_segment_range<segment2>(pline), polylineView, cmp));
+
+    //! Empty boundaries in the middle and at the end are skipped.
+    polygon_with_holes<point2> withHoles(make_box(0, 0, 10, 10), std::vector<polygon2>{ make_box(1, 1, 2, 2), polygon2{}, make_box(5, 5, 7, 6), polygon2{} });
+    auto holesView = make_polygon_with_holes_segment_view<segment2>(withHoles);
+    EXPECT_EQ(12, holesView.size());
+    EXPECT_TRUE(segments_equal(polygon_with_holes_as_segment_range<segment2>(withHoles), holesView, cmp));
+
+    //! Random access from the end and across boundaries.
+    auto expected = polygon_with_holes_as_segment_range<segment2>(withHoles);
+    auto last = holesView.end();
+    for (std::ptrdiff_t n = 1; n <= 12; ++n)
+    {
+        auto it = last - n;
+        EXPECT_EQ(12 - n, it - holesView.begin());
+        EXPECT_TRUE(numeric_sequence_equals(get_start(expected[12 - n]), get_start(*it), cmp));
+        EXPECT_TRUE(numeric_sequence_equals(get_start(expected[12 - n]), get_start(holesView.begin()[12 - n]), cmp));
+    }
+
+    polygon2 single{ point2{ 0, 0 } };
+    EXPECT_TRUE(make_polygon_segment_view<segment2>(single).empty());
+    EXPECT_TRUE(make_polyline_segment_view<segment2>(single).empty());
+}
+
+TEST_F(geometry_kernel_2d_fixture, segment_views_build_bsp_trees_and_intersections)
+{
+    using namespace geometrix;
+
+    polygon2 square{ point2{ 2.0, 2.0 }, point2{ 8.0, 2.0 }, point2{ 8.0, 8.0 }, point2{ 2.0, 8.0 } };
+    solid_leaf_bsp_tree<segment2> fromVector(polygon_as_segment_range<segment2>(square), partition_policies::autopartition_policy(), cmp);
+    solid_leaf_bsp_tree<segment2> fromView(make_polygon_segment_view<segment2>(square), partition_policies::autopartition_policy(), cmp);
+
+    node_bsp_tree_2d<segment2> nodeFromVector(polygon_as_segment_range<segment2>(square), partition_policies::first_segment_selector_policy<segment2>(), cmp);
+    node_bsp_tree_2d<segment2> nodeFromView(make_polygon_segment_view<segment2>(square), partition_policies::first_segment_selector_policy<segment2>(), cmp);
+
+    random_real_generator<> rnd(10.0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        point2 p{ rnd(), rnd() };
+        EXPECT_EQ(fromVector.point_in_solid_space(p, cmp), fromView.point_in_solid_space(p, cmp));
+        EXPECT_EQ(nodeFromVector.locate_point(p, cmp), nodeFromView.locate_point(p, cmp));
+    }
+
+    polygon_with_holes<point2> withHoles(make_box(0, 0, 10, 10), std::vector<polygon2>{ make_box(1, 1, 6, 6), make_box(4, 4, 9, 9) });
+    auto view = make_polygon_with_holes_segment_view<segment2>(withHoles);
+    auto segments = polygon_with_holes_as_segment_range<segment2>(withHoles);
+    std::vector<std::tuple<std::size_t, std::size_t>> expected, result;
+    auto n = all_segment_intersections(segments, [&](std::size_t i, std::size_t j, intersection_type, const point2&, const point2&) { expected.emplace_back(i, j); }, cmp);
+    EXPECT_EQ(n, all_segment_intersections(view, [&](std::size_t i, std::size_t j, intersection_type, const point2&, const point2&) { result.emplace_back(i, j); }, cmp));
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, result);
+}
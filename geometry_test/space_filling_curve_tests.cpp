@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////
+// space_filling_curve_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/space_filling_curve.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/algorithm/distance/point_point_distance.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+    using point2 = geometrix::point_double_2d;
+    using polygon2 = geometrix::polygon<point2>;
+
+    template <typename Points>
+    double get_path_length(const Points& points, const std::vector<std::size_t>& order)
+    {
+        double length = 0;
+        for (std::size_t i = 1; i < order.size(); ++i)
+            length += geometrix::point_point_distance(points[order[i - 1]], points[order[i]]);
+        return length;
+    }
+
+    template <typename Mesh>
+    void check_adjacency(const Mesh& mesh)
+    {
+        auto const& adjMatrix = mesh.get_adjacency_matrix();
+        for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+        {
+            auto const& indices = mesh.get_triangle_indices(i);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                auto j = adjMatrix[i][k];
+                if (j == (std::numeric_limits<std::size_t>::max)())
+                    continue;
+                auto const& other = mesh.get_triangle_indices(j);
+                bool shared = false;
+                for (std::size_t m = 0; m < 3; ++m)
+                    shared = shared || (other[m] == indices[(k + 1) % 3] && other[(m + 1) % 3] == indices[k] && adjMatrix[j][m] == i);
+                EXPECT_TRUE(shared);
+            }
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, morton_and_hilbert_keys_round_trip)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto x = static_cast<std::uint32_t>(4294967295.0 * rnd()), y = static_cast<std::uint32_t>(4294967295.0 * rnd()), z = static_cast<std::uint32_t>(2097151.0 * rnd());
+        std::uint32_t u, v, w;
+        morton_decode_2d(morton_encode_2d(x, y), u, v);
+        EXPECT_EQ(x, u);
+        EXPECT_EQ(y, v);
+        morton_decode_3d(morton_encode_3d(x & 0x1FFFFF, y & 0x1FFFFF, z), u, v, w);
+        EXPECT_EQ(x & 0x1FFFFF, u);
+        EXPECT_EQ(y & 0x1FFFFF, v);
+        EXPECT_EQ(z, w);
+        hilbert_decode_2d(hilbert_encode_2d(x, y), u, v);
+        EXPECT_EQ(x, u);
+        EXPECT_EQ(y, v);
+    }
+    EXPECT_EQ(6u, morton_encode_2d(2, 1));
+    EXPECT_EQ(7u, morton_encode_3d(1, 1, 1));
+
+    //! Consecutive cells along the Hilbert curve share an edge and the curve visits every cell once.
+    const unsigned order = 5;
+    std::vector<bool> visited(1u << (2 * order), false);
+    std::uint32_t px = 0, py = 0;
+    for (std::uint64_t d = 0; d < visited.size(); ++d)
+    {
+        std::uint32_t x, y;
+        hilbert_decode_2d(d, x, y, order);
+        ASSERT_EQ(d, hilbert_encode_2d(x, y, order));
+        EXPECT_FALSE(visited[y * (1u << order) + x]);
+        visited[y * (1u << order) + x] = true;
+        if (d > 0)
+        {
+            EXPECT_EQ(1, std::abs(static_cast<int>(x) - static_cast<int>(px)) + std::abs(static_cast<int>(y) - static_cast<int>(py)));
+        }
+        px = x, py = y;
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, parallel_radix_sort_matches_stable_sort)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    for (auto mask : { 0xFFFFFFFFFFFFFFFFull, 0x0000FFFF0000FF00ull, 0x3ull })
+    {
+        std::vector<std::pair<std::uint64_t, std::size_t>> items(100000);
+        for (std::size_t i = 0; i < items.size(); ++i)
+            items[i] = std::make_pair((static_cast<std::uint64_t>(4294967296.0 * rnd()) << 32 | static_cast<std::uint64_t>(4294967296.0 * rnd())) & mask, i);
+
+        auto expected = items;
+        std::stable_sort(expected.begin(), expected.end(), [](const std::pair<std::uint64_t, std::size_t>& a, const std::pair<std::uint64_t, std::size_t>& b) { return a.first < b.first; });
+        for (std::size_t nThreads : { 1, 4 })
+        {
+            auto sorted = items;
+            parallel_radix_sort(sorted, nThreads);
+            EXPECT_TRUE(expected == sorted);
+        }
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, space_filling_curve_order_improves_locality)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(1.0);
+    std::vector<point2> points;
+    std::vector<point_double_3d> points3;
+    for (int i = 0; i < 20000; ++i)
+    {
+        points.push_back(point2{ 100.0 * rnd(), 50.0 * rnd() });
+        points3.push_back(point_double_3d{ 100.0 * rnd(), 50.0 * rnd(), 10.0 * rnd() });
+    }
+
+    std::vector<std::size_t> identity(points.size());
+    for (std::size_t i = 0; i < identity.size(); ++i)
+        identity[i] = i;
+
+    for (auto curve : { e_morton_curve, e_hilbert_curve })
+    {
+        auto order = get_space_filling_curve_order(points, curve);
+        auto sorted = order;
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT_TRUE(identity == sorted);
+        EXPECT_LT(10.0 * get_path_length(points, order), get_path_length(points, identity));
+    }
+
+    auto order3 = get_space_filling_curve_order(points3, e_morton_curve);
+    EXPECT_LT(5.0 * get_path_length(points3, order3), get_path_length(points3, identity));
+
+    //! Reordering in place applies the returned permutation.
+    auto reordered = points;
+    auto order = reorder_by_space_filling_curve(reordered);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_TRUE(numeric_sequence_equals(points[order[i]], reordered[i], cmp));
+    EXPECT_TRUE(get_path_length(reordered, identity) == get_path_length(points, order));
+}
+
+TEST_F(geometry_kernel_2d_fixture, reordered_mesh_2d_preserves_queries)
+{
+    using namespace geometrix;
+
+    polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 5, 6 }, { 0, 10 } };
+    std::vector<polygon2> holes{ polygon2{ { 2, 2 }, { 2, 4 }, { 4, 4 }, { 4, 2 } } };
+    auto mesh = make_delaunay_mesh(outer, holes, cmp, 25.0 * constants::pi<double>() / 180.0, 0.05);
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < mesh.get_number_triangles(); ++i)
+        for (auto v : mesh.get_triangle_indices(i))
+            indices.push_back(v);
+    using sparse_mesh = mesh_2d<double, mesh_traits<triangle_grid_cache<double, sparse_grid_type_generator>>>;
+    sparse_mesh sparse(mesh.get_vertices(), indices, cmp);
+
+    auto sut = mesh;
+    auto order = sut.reorder();
+    auto sparseOrder = sparse.reorder(e_morton_curve);
+    ASSERT_EQ(mesh.get_number_triangles(), order.size());
+    ASSERT_EQ(mesh.get_number_triangles(), sparseOrder.size());
+    check_adjacency(sut);
+    check_adjacency(sparse);
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        auto const& a = mesh.get_triangle_vertices(order[i]);
+        auto const& b = sut.get_triangle_vertices(i);
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            EXPECT_TRUE(numeric_sequence_equals(a[k], b[k], cmp));
+            EXPECT_TRUE(numeric_sequence_equals(b[k], sut.get_vertices()[sut.get_triangle_indices(i)[k]], cmp));
+        }
+    }
+
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 500; ++i)
+    {
+        auto p = point2{ 11.0 * rnd() - 0.5, 11.0 * rnd() - 0.5 };
+        auto expected = mesh.find_triangle(p, cmp);
+        auto result = sut.find_triangle(p, cmp);
+        auto sparseResult = sparse.find_triangle(p, cmp);
+        ASSERT_EQ(!!expected, !!result);
+        ASSERT_EQ(!!expected, !!sparseResult);
+        if (expected)
+        {
+            EXPECT_TRUE(point_in_triangle(p, sut.get_triangle_vertices(*result)[0], sut.get_triangle_vertices(*result)[1], sut.get_triangle_vertices(*result)[2], cmp));
+            EXPECT_TRUE(point_in_triangle(p, sparse.get_triangle_vertices(*sparseResult)[0], sparse.get_triangle_vertices(*sparseResult)[1], sparse.get_triangle_vertices(*sparseResult)[2], cmp));
+        }
+
+        //! Sampling still lands inside the mesh.
+        EXPECT_TRUE(sut.find_triangle(sut.get_random_position(rnd(), rnd(), rnd()), cmp));
+    }
+}
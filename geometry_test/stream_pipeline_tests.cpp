@@ -0,0 +1,328 @@
+///////////////////////////////////////////////////////////////////////////////
+// stream_pipeline_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/distance/point_segment_distance.hpp>
+#include <geometrix/algorithm/streaming/stream_stages.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+    //! Random walks with a blank line after each.
+    std::string make_polyline_text(std::size_t nPolylines, std::size_t maxVertices, std::vector<geometry_kernel_2d_fixture::polyline2>& polylines)
+    {
+        using point2 = geometry_kernel_2d_fixture::point2;
+        geometrix::random_real_generator<> rnd(1.0);
+        std::ostringstream os;
+        os.precision(17);
+        for (std::size_t k = 0; k < nPolylines; ++k)
+        {
+            geometry_kernel_2d_fixture::polyline2 pline;
+            auto n = 1 + static_cast<std::size_t>(rnd() * maxVertices);
+            point2 p{ 100.0 * rnd(), 100.0 * rnd() };
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                pline.push_back(p);
+                os << p[0] << " " << p[1] << "\n";
+                p = point2{ p[0] + rnd(), p[1] + rnd() - 0.5 };
+            }
+            os << "\n";
+            polylines.push_back(pline);
+        }
+        return os.str();
+    }
+
+    //! The largest distance from a vertex of the original polyline to the simplified polyline.
+    double get_max_deviation(const geometry_kernel_2d_fixture::polyline2& original, const geometry_kernel_2d_fixture::polyline2& simplified)
+    {
+        using segment2 = geometry_kernel_2d_fixture::segment2;
+        double result = 0;
+        for (auto const& p : original)
+        {
+            double d = (std::numeric_limits<double>::max)();
+            for (std::size_t k = 1; k < simplified.size(); ++k)
+                d = (std::min)(d, geometrix::point_segment_distance(p, segment2(simplified[k - 1], simplified[k])));
+            result = (std::max)(result, d);
+        }
+        return result;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_delivers_results_in_order_with_bounded_chunks_in_flight)
+{
+    using namespace geometrix;
+
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::atomic<std::size_t> inFlight{ 0 }, maxInFlight{ 0 };
+    auto source = make_range_stream_source(values.begin(), values.end(), 7);
+    auto counted = [&](std::vector<int>& records)
+    {
+        if (!source(records))
+            return false;
+        auto n = ++inFlight;
+        for (auto m = maxInFlight.load(); n > m && !maxInFlight.compare_exchange_weak(m, n);) {}
+        return true;
+    };
+    struct counted_source
+    {
+        using record_type = int;
+        decltype(counted)& fn;
+        bool operator()(std::vector<int>& records) { return fn(records); }
+    };
+
+    random_real_generator<> rnd(1.0);
+    std::vector<int> delays(200);
+    for (auto& d : delays)
+        d = static_cast<int>(rnd() * 200);
+
+    std::vector<long> sums;
+    stream_pipeline_options options;
+    options.chunks_in_flight = 3;
+    options.threads = 4;
+    auto n = run_stream_pipeline(counted_source{ counted }, [&](const stream_chunk<int>& chunk)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(delays[chunk.sequence % delays.size()]));
+        EXPECT_EQ(static_cast<int>(chunk.first_record), chunk.records.front());
+        return std::accumulate(chunk.records.begin(), chunk.records.end(), 0L);
+    }, [&](long sum)
+    {
+        sums.push_back(sum);
+        --inFlight;
+    }, options);
+
+    EXPECT_EQ(values.size(), n);
+    EXPECT_LE(maxInFlight.load(), options.chunks_in_flight);
+    ASSERT_EQ((values.size() + 6) / 7, sums.size());
+    for (std::size_t i = 0; i < sums.size(); ++i)
+    {
+        long expected = 0;
+        for (std::size_t k = 7 * i; k < (std::min)(values.size(), 7 * i + 7); ++k)
+            expected += values[k];
+        EXPECT_EQ(expected, sums[i]);
+    }
+}
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_rethrows_stage_and_sink_errors)
+{
+    using namespace geometrix;
+
+    std::vector<int> values(10000, 1);
+    auto failingStage = [](const stream_chunk<int>& chunk)
+    {
+        if (chunk.sequence == 5)
+            throw std::runtime_error("stage");
+        return chunk.records.size();
+    };
+    EXPECT_THROW(run_stream_pipeline(make_range_stream_source(values.begin(), values.end(), 10), failingStage, [](std::size_t) {}), std::runtime_error);
+
+    std::size_t nSunk = 0;
+    auto identity = [](const stream_chunk<int>& chunk) { return chunk.records.size(); };
+    EXPECT_THROW(run_stream_pipeline(make_range_stream_source(values.begin(), values.end(), 10), identity, [&](std::size_t) { if (++nSunk == 3) throw std::logic_error("sink"); }), std::logic_error);
+    EXPECT_EQ(3, nSunk);
+}
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_splits_and_rejoins_long_polylines)
+{
+    using namespace geometrix;
+
+    std::vector<polyline2> polylines;
+    auto text = make_polyline_text(50, 40, polylines);
+    for (std::size_t chunkSize : { 2, 3, 16, 1000 })
+    {
+        std::istringstream is(text);
+        std::vector<polyline2> joined;
+        std::size_t maxVertices = 0;
+        run_stream_pipeline(polyline_stream_source<polyline2>(is, chunkSize), [&](const stream_chunk<polyline_piece<polyline2>>& chunk)
+        {
+            std::size_t n = 0;
+            for (auto const& piece : chunk.records)
+                n += piece.points.size();
+            EXPECT_LE(n, chunkSize);
+            return chunk.records;
+        }, make_polyline_joining_sink<polyline2>([&](std::size_t i, polyline2&& pline)
+        {
+            EXPECT_EQ(joined.size(), i);
+            maxVertices = (std::max)(maxVertices, pline.size());
+            joined.push_back(std::move(pline));
+        }));
+
+        ASSERT_EQ(polylines.size(), joined.size());
+        for (std::size_t i = 0; i < polylines.size(); ++i)
+        {
+            ASSERT_EQ(polylines[i].size(), joined[i].size());
+            for (std::size_t k = 0; k < polylines[i].size(); ++k)
+                EXPECT_TRUE(numeric_sequence_equals(polylines[i][k], joined[i][k], cmp));
+        }
+    }
+
+    //! Round trip through the text sink.
+    std::istringstream is(text);
+    std::ostringstream os;
+    os.precision(17);
+    run_stream_pipeline(polyline_stream_source<polyline2>(is, 5), [](const stream_chunk<polyline_piece<polyline2>>& chunk) { return chunk.records; }, polyline_stream_sink<polyline2>(os));
+    EXPECT_EQ(text, os.str());
+}
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_ramer_douglas_peucker_stays_within_tolerance)
+{
+    using namespace geometrix;
+
+    std::vector<polyline2> polylines;
+    auto text = make_polyline_text(30, 200, polylines);
+    const double epsilon = 0.5;
+
+    //! Without splitting the result is that of the algorithm on whole polylines.
+    {
+        std::istringstream is(text);
+        std::size_t count = 0;
+        run_stream_pipeline(polyline_stream_source<polyline2>(is, 1000), ramer_douglas_peucker_stream_stage<double>(epsilon), make_polyline_joining_sink<polyline2>([&](std::size_t i, polyline2&& pline)
+        {
+            auto expected = polylines[i].size() > 1 ? ramer_douglas_peucker_algorithm(polylines[i], epsilon) : polylines[i];
+            ASSERT_EQ(expected.size(), pline.size());
+            for (std::size_t k = 0; k < pline.size(); ++k)
+                EXPECT_TRUE(numeric_sequence_equals(expected[k], pline[k], cmp));
+            if (pline.size() > 1)
+            {
+                EXPECT_LE(get_max_deviation(polylines[i], pline), epsilon);
+            }
+            ++count;
+        }));
+        EXPECT_EQ(polylines.size(), count);
+    }
+
+    //! Polylines longer than a chunk are simplified piecewise: pieces of 25 vertices overlapping by one keep their end points.
+    const std::size_t chunkSize = 25;
+    std::istringstream is(text);
+    std::size_t nSplit = 0;
+    run_stream_pipeline(polyline_stream_source<polyline2>(is, chunkSize), ramer_douglas_peucker_stream_stage<double>(epsilon), make_polyline_joining_sink<polyline2>([&](std::size_t i, polyline2&& pline)
+    {
+        auto const& original = polylines[i];
+        polyline2 expected;
+        for (std::size_t start = 0; start + 1 < original.size() || expected.empty(); start += chunkSize - 1)
+        {
+            polyline2 piece(original.begin() + start, original.begin() + (std::min)(original.size(), start + chunkSize));
+            auto simplified = piece.size() > 1 ? ramer_douglas_peucker_algorithm(piece, epsilon) : piece;
+            expected.insert(expected.end(), simplified.begin() + (expected.empty() ? 0 : 1), simplified.end());
+        }
+        nSplit += original.size() > chunkSize ? 1 : 0;
+
+        ASSERT_EQ(expected.size(), pline.size());
+        for (std::size_t k = 0; k < pline.size(); ++k)
+            EXPECT_TRUE(numeric_sequence_equals(expected[k], pline[k], cmp));
+        if (pline.size() > 1)
+        {
+            EXPECT_LE(get_max_deviation(original, pline), epsilon);
+        }
+    }));
+    EXPECT_GT(nSplit, 0);
+}
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_polyline_offset_requires_whole_polylines)
+{
+    using namespace geometrix;
+
+    std::vector<polyline2> polylines;
+    auto text = make_polyline_text(20, 30, polylines);
+    for (auto& pline : polylines)
+        if (pline.size() < 2)
+            pline.push_back(point2{ pline[0][0] + 1.0, pline[0][1] });
+    std::ostringstream os;
+    os.precision(17);
+    for (auto const& pline : polylines)
+    {
+        for (auto const& p : pline)
+            os << p[0] << " " << p[1] << "\n";
+        os << "\n";
+    }
+    text = os.str();
+
+    auto stage = make_polyline_offset_stream_stage(oriented_left, 0.25, cmp);
+    {
+        std::istringstream is(text);
+        std::size_t count = 0;
+        run_stream_pipeline(polyline_stream_source<polyline2>(is, 100), stage, make_polyline_joining_sink<polyline2>([&](std::size_t i, polyline2&& pline)
+        {
+            auto expected = polyline_offset(polylines[i], oriented_left, 0.25, cmp);
+            ASSERT_EQ(expected.size(), pline.size());
+            for (std::size_t k = 0; k < pline.size(); ++k)
+                EXPECT_TRUE(numeric_sequence_equals(expected[k], pline[k], cmp));
+            ++count;
+        }));
+        EXPECT_EQ(polylines.size(), count);
+    }
+
+    std::istringstream is(text);
+    EXPECT_THROW(run_stream_pipeline(polyline_stream_source<polyline2>(is, 10), stage, [](std::vector<polyline_piece<polyline2>>&&) {}), std::invalid_argument);
+}
+
+TEST_F(geometry_kernel_2d_fixture, stream_pipeline_binary_records_and_tiled_segment_intersections_match_all_segment_intersections)
+{
+    using namespace geometrix;
+
+    random_real_generator<> rnd(100.0);
+    std::vector<segment2> segments;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        point2 p{ rnd(), rnd() };
+        segments.emplace_back(p, point2{ p[0] + 0.05 * rnd() - 2.5, p[1] + 0.05 * rnd() - 2.5 });
+    }
+    //! Long segments crossing many tiles, a segment outside of the tiling and a pair crossing on a tile boundary.
+    segments.emplace_back(point2{ 0, 0 }, point2{ 100, 100 });
+    segments.emplace_back(point2{ 0, 100 }, point2{ 100, 0 });
+    segments.emplace_back(point2{ -20, 50 }, point2{ 120, 50.5 });
+    segments.emplace_back(point2{ 20, 15 }, point2{ 30, 25 });
+    segments.emplace_back(point2{ 20, 25 }, point2{ 30, 15 });
+
+    auto prefix = ::testing::TempDir() + "geometrix_stream_pipeline_test_";
+    auto fileName = prefix + "segments.bin";
+    stream_pipeline_options options;
+    options.threads = 3;
+    run_stream_pipeline(make_range_stream_source(segments.begin(), segments.end(), 128), [](const stream_chunk<segment2>& chunk) { return chunk.records; }, binary_record_file_sink<segment2>(fileName), options);
+
+    //! Tile the file and intersect the tiles.
+    grid_traits<double> tiles(0.0, 100.0, 0.0, 100.0, 10.0);
+    segment_tile_writer<segment2> writer(prefix);
+    auto n = run_stream_pipeline(binary_record_file_source<segment2>(fileName, 100), segment_tiling_stream_stage<double>(tiles), std::ref(writer), options);
+    EXPECT_EQ(segments.size(), n);
+
+    std::set<std::pair<std::size_t, std::size_t>> result;
+    run_stream_pipeline(segment_tile_source<segment2>(prefix, writer.get_tiles()), make_tiled_segment_intersection_stream_stage(tiles, cmp), [&](std::vector<segment_intersection_record<point2>>&& records)
+    {
+        for (auto const& r : records)
+        {
+            EXPECT_LT(r.first, r.second);
+            EXPECT_TRUE(result.emplace(r.first, r.second).second);
+        }
+    }, options);
+
+    std::set<std::pair<std::size_t, std::size_t>> expected;
+    all_segment_intersections(segments, [&](std::size_t i, std::size_t j, intersection_type, const point2&, const point2&) { expected.emplace(i, j); }, cmp);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, result);
+
+    for (auto const& tile : writer.get_tiles())
+        std::remove(writer.get_file_name(tile.first, tile.second).c_str());
+    std::remove(fileName.c_str());
+
+    EXPECT_THROW(binary_record_file_source<segment2>(prefix + "missing.bin", 10), std::runtime_error);
+}
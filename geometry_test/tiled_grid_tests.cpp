@@ -0,0 +1,214 @@
+///////////////////////////////////////////////////////////////////////////////
+// tiled_grid_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./2d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/tiled_grid_2d.hpp>
+#include <geometrix/algorithm/grid_2d.hpp>
+#include <geometrix/algorithm/hash_grid_2d.hpp>
+#include <geometrix/algorithm/fast_voxel_grid_traversal.hpp>
+#include <geometrix/algorithm/floodfill_grid_traversal.hpp>
+#include <geometrix/algorithm/mesh_2d.hpp>
+#include <geometrix/algorithm/constrained_delaunay_triangulation.hpp>
+#include <geometrix/primitive/point_sequence_utilities.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_allocates_tiles_lazily_over_huge_extents)
+{
+    using namespace geometrix;
+
+    //! 100km x 100km at 0.1m is 10^12 cells.
+    grid_traits<double> traits(0.0, 100000.0, 0.0, 100000.0, 0.1);
+    tiled_grid_2d<std::uint8_t, grid_traits<double>> sut(traits);
+    const auto& csut = sut;
+    EXPECT_EQ(0, sut.get_number_tiles());
+    EXPECT_EQ(nullptr, sut.find_cell(500000u, 500000u));
+    EXPECT_EQ(0, csut.get_cell(point2{ 50000.0, 50000.0 }));
+    EXPECT_EQ(0, sut.get_number_tiles());
+
+    sut.get_cell(point2{ 50000.05, 50000.05 }) = 1;
+    sut.get_cell(point2{ 50000.15, 50000.05 }) = 2;
+    sut.get_cell(point2{ 99999.95, 0.05 }) = 3;
+    EXPECT_EQ(2, sut.get_number_tiles());
+    EXPECT_EQ(1, *sut.find_cell(500000u, 500000u));
+    EXPECT_EQ(2, *sut.find_cell(500001u, 500000u));
+    EXPECT_EQ(3, *sut.find_cell(999999u, 0u));
+    EXPECT_EQ(0, *sut.find_cell(500002u, 500000u));
+
+    std::size_t nCells = 0, nSet = 0;
+    sut.for_each_cell([&](std::uint32_t i, std::uint32_t j, std::uint8_t v)
+    {
+        ++nCells;
+        if (v)
+        {
+            ++nSet;
+            EXPECT_EQ(v, sut.get_cell(i, j));
+        }
+    });
+    EXPECT_EQ(2 * 64 * 64, nCells);
+    EXPECT_EQ(3, nSet);
+}
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_matches_hash_grid_and_clips_partial_tiles)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 10.0, 0.0, 7.0, 0.1);
+    tiled_grid_2d<int, grid_traits<double>, 4> sut(traits, -1);
+    hash_grid_2d<int, grid_traits<double>> expected(traits);
+
+    random_real_generator<> rnd(1.0);
+    for (int n = 0; n < 2000; ++n)
+    {
+        auto p = point2{ 10.0 * rnd(), 7.0 * rnd() };
+        sut.get_cell(p) = n;
+        expected.get_cell(p) = n;
+    }
+
+    expected.for_each_cell([&](std::uint32_t i, std::uint32_t j, int v)
+    {
+        ASSERT_NE(nullptr, sut.find_cell(i, j));
+        EXPECT_EQ(v, *sut.find_cell(i, j));
+    });
+    sut.for_each_cell([&](std::uint32_t i, std::uint32_t j, int v)
+    {
+        EXPECT_LT(i, traits.get_width());
+        EXPECT_LT(j, traits.get_height());
+        auto pCell = expected.find_cell(i, j);
+        EXPECT_EQ(pCell ? *pCell : -1, v);
+    });
+
+    sut.erase(0, 0);
+    EXPECT_EQ(-1, sut.get_cell(0u, 0u));
+}
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_snapshot_is_copy_on_write)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 100.0, 0.0, 100.0, 1.0);
+    tiled_grid_2d<int, grid_traits<double>, 3> sut(traits);
+    for (std::uint32_t i = 0; i < 20; ++i)
+        sut.get_cell(i, i) = 1;
+
+    auto snapshot = sut.snapshot();
+    const auto& csut = sut;
+    const auto& csnapshot = snapshot;
+    EXPECT_EQ(csut.find_cell(3u, 3u), csnapshot.find_cell(3u, 3u)) << "Tiles are shared until written.";
+
+    sut.get_cell(3u, 3u) = 2;
+    sut.get_cell(50u, 50u) = 3;
+    sut.clear();
+    sut.get_cell(4u, 4u) = 4;
+
+    EXPECT_EQ(1, snapshot.get_cell(3u, 3u));
+    EXPECT_EQ(1, snapshot.get_cell(4u, 4u));
+    EXPECT_EQ(nullptr, snapshot.find_cell(50u, 50u));
+    EXPECT_EQ(3, snapshot.get_number_tiles());
+
+    //! Writing to the snapshot leaves a second snapshot untouched.
+    auto snapshot2 = snapshot;
+    snapshot.get_cell(0u, 0u) = 5;
+    EXPECT_EQ(5, snapshot.get_cell(0u, 0u));
+    EXPECT_EQ(1, snapshot2.get_cell(0u, 0u));
+}
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_pyramid_hierarchical_query_matches_brute_force)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(0.0, 1000.0, 0.0, 1000.0, 1.0);
+    tiled_grid_2d<std::uint8_t, grid_traits<double>, 4> grid(traits);
+    random_real_generator<> rnd(1.0);
+    for (int n = 0; n < 500; ++n)
+        grid.get_cell(point2{ 1000.0 * rnd(), 1000.0 * rnd() }) = 1;
+
+    auto maxOf = [](std::uint8_t a, std::uint8_t b) { return (std::max)(a, b); };
+    tiled_grid_pyramid<std::uint8_t, grid_traits<double>, 4> sut(grid, 6, maxOf);
+    ASSERT_EQ(6, sut.get_number_levels());
+    EXPECT_DOUBLE_EQ(32.0, sut.get_level(5).get_traits().get_cell_size());
+    EXPECT_LT(sut.get_level(5).get_number_tiles(), grid.get_number_tiles());
+
+    aabb2 box{ point2{ 200.0, 300.0 }, point2{ 450.0, 520.0 } };
+    std::set<std::pair<std::uint32_t, std::uint32_t>> expected, result;
+    grid.for_each_cell([&](std::uint32_t i, std::uint32_t j, std::uint8_t v)
+    {
+        if (v && box.intersects(traits.get_cell_aabb(i, j)))
+            expected.emplace(i, j);
+    });
+
+    std::size_t nDescended = 0;
+    sut.traverse([&](std::size_t level, std::uint32_t i, std::uint32_t j, std::uint8_t v)
+    {
+        ++nDescended;
+        return v && box.intersects(sut.get_level(level).get_traits().get_cell_aabb(i, j));
+    }, [&](std::uint32_t i, std::uint32_t j, std::uint8_t v)
+    {
+        EXPECT_EQ(1, v);
+        result.emplace(i, j);
+    });
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, result);
+    EXPECT_LT(nDescended, traits.get_width() * traits.get_height() / 100);
+}
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_plugs_into_grid_traversals)
+{
+    using namespace geometrix;
+
+    grid_traits<double> traits(-20.0, 20.0, -20.0, 20.0, 0.5);
+    tiled_grid_2d<int, grid_traits<double>> grid(traits);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> fromTraits, fromGrid;
+    segment2 s{ point2{ -15.0, -12.3 }, point2{ 17.1, 9.4 } };
+    fast_voxel_grid_traversal(traits, s, [&](std::uint32_t i, std::uint32_t j) { fromTraits.emplace_back(i, j); }, cmp);
+    fast_voxel_grid_traversal(grid, s, [&](std::uint32_t i, std::uint32_t j) { fromGrid.emplace_back(i, j); ++grid.get_cell(i, j); }, cmp);
+    EXPECT_FALSE(fromTraits.empty());
+    EXPECT_EQ(fromTraits, fromGrid);
+
+    polygon2 pgon;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto t = i * constants::two_pi<double>() / 100;
+        pgon.emplace_back(9.0 * std::cos(t), 9.0 * std::sin(t));
+    }
+    std::set<std::pair<std::uint32_t, std::uint32_t>> hashed, tiled;
+    floodfill_grid_traversal(traits, pgon, [&](std::uint32_t i, std::uint32_t j) { hashed.emplace(i, j); }, cmp);
+    floodfill_grid_traversal(traits, pgon, [&](std::uint32_t i, std::uint32_t j) { tiled.emplace(i, j); }, cmp, tiled_grid_type_generator());
+    EXPECT_FALSE(hashed.empty());
+    EXPECT_EQ(hashed, tiled);
+}
+
+TEST_F(geometry_kernel_2d_fixture, tiled_grid_triangle_cache_matches_dense_cache)
+{
+    using namespace geometrix;
+
+    polygon2 outer{ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 5, 6 }, { 0, 10 } };
+    std::vector<polygon2> holes{ polygon2{ { 2, 2 }, { 2, 4 }, { 4, 4 }, { 4, 2 } } };
+    auto dense = make_delaunay_mesh(outer, holes, cmp, 25.0 * constants::pi<double>() / 180.0, 0.5);
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < dense.get_number_triangles(); ++i)
+        for (auto index : dense.get_triangle_indices(i))
+            indices.push_back(index);
+
+    using tiled_mesh_t = mesh_2d<double, mesh_traits<triangle_grid_cache<double, tiled_grid_type_generator>>>;
+    tiled_mesh_t sut(dense.get_vertices(), indices, cmp);
+
+    random_real_generator<> rnd(1.0);
+    for (int i = 0; i < 500; ++i)
+    {
+        auto p = point2{ 11.0 * rnd() - 0.5, 11.0 * rnd() - 0.5 };
+        EXPECT_TRUE(dense.find_triangle(p, cmp) == sut.find_triangle(p, cmp));
+    }
+}
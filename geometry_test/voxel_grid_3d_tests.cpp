@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+// voxel_grid_3d_tests.cpp
+//
+//  Copyright 2026 Brandon Kohn. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include "./3d_kernel_fixture.hpp"
+
+#include <geometrix/algorithm/grid_3d.hpp>
+#include <geometrix/algorithm/hash_grid_3d.hpp>
+#include <geometrix/algorithm/tiled_grid_3d.hpp>
+#include <geometrix/algorithm/fast_voxel_grid_traversal_3d.hpp>
+#include <geometrix/algorithm/voxelization_3d.hpp>
+#include <geometrix/utility/random_generator.hpp>
+
+#include <array>
+#include <cmath>
+#include <set>
+#include <vector>
+
+namespace {
+
+    using cell3 = std::array<std::uint32_t, 3>;
+
+    //! Does the segment cross the box [low - eps, high + eps]? (slab test)
+    template <typename Point>
+    bool segment_crosses_box(const Point& s, const Point& e, const Point& low, const Point& high, double eps)
+    {
+        double t0 = 0.0, t1 = 1.0;
+        for (std::size_t a = 0; a < 3; ++a)
+        {
+            double d = e[a] - s[a];
+            double lo = low[a] - eps, hi = high[a] + eps;
+            if (hi < lo)
+                return false;
+            if (d == 0.0)
+            {
+                if (s[a] < lo || s[a] > hi)
+                    return false;
+                continue;
+            }
+            double ta = (lo - s[a]) / d, tb = (hi - s[a]) / d;
+            if (tb < ta)
+                std::swap(ta, tb);
+            t0 = (std::max)(t0, ta);
+            t1 = (std::min)(t1, tb);
+        }
+        return t0 <= t1;
+    }
+
+}//! namespace;
+
+TEST_F(geometry_kernel_3d_fixture, voxel_grid_3d_containers_agree)
+{
+    using namespace geometrix;
+    using traits_t = grid_traits_3d<double>;
+
+    traits_t traits(-5.0, 5.0, -5.0, 5.0, 0.0, 3.0, 0.25);
+    EXPECT_EQ(41, traits.get_width());
+    EXPECT_EQ(41, traits.get_height());
+    EXPECT_EQ(13, traits.get_depth());
+    EXPECT_EQ(22, traits.get_x_index(0.5));
+    EXPECT_EQ(4, traits.get_z_index(1.1));
+
+    BOOST_CONCEPT_ASSERT((Grid3DConcept<grid_3d<int, traits_t>>));
+    BOOST_CONCEPT_ASSERT((Grid3DConcept<hash_grid_3d<int, traits_t>>));
+    BOOST_CONCEPT_ASSERT((Grid3DConcept<tiled_grid_3d<int, traits_t>>));
+
+    grid_3d<int, traits_t> dense(traits);
+    hash_grid_3d<int, traits_t> hashed(traits);
+    tiled_grid_3d<int, traits_t, 3> tiled(traits);
+
+    random_real_generator<> rnd(1.0);
+    for (int n = 1; n <= 1000; ++n)
+    {
+        auto p = point3{ 10.0 * rnd() - 5.0, 10.0 * rnd() - 5.0, 3.0 * rnd() };
+        dense.get_cell(p) = n;
+        hashed.get_cell(p) = n;
+        tiled.get_cell(p) = n;
+    }
+
+    std::size_t nSet = 0;
+    dense.for_each_cell([&](std::uint32_t i, std::uint32_t j, std::uint32_t k, int v)
+    {
+        auto pHashed = hashed.find_cell(i, j, k);
+        EXPECT_EQ(v, pHashed ? *pHashed : 0);
+        const auto& ctiled = tiled;
+        EXPECT_EQ(v, ctiled.get_cell(i, j, k));
+        nSet += v != 0;
+    });
+    EXPECT_EQ(hashed.size(), nSet);
+
+    auto snapshot = tiled.snapshot();
+    tiled.clear();
+    EXPECT_EQ(0, tiled.get_number_tiles());
+    hashed.for_each_cell([&](std::uint32_t i, std::uint32_t j, std::uint32_t k, int v)
+    {
+        ASSERT_NE(nullptr, snapshot.find_cell(i, j, k));
+        EXPECT_EQ(v, *snapshot.find_cell(i, j, k));
+    });
+}
+
+TEST_F(geometry_kernel_3d_fixture, fast_voxel_grid_traversal_3d_visits_exactly_the_crossed_cells_in_order)
+{
+    using namespace geometrix;
+
+    grid_traits_3d<double> traits(0.0, 10.0, 0.0, 8.0, 0.0, 6.0, 0.5);
+    random_real_generator<> rnd(1.0);
+    for (int n = 0; n < 200; ++n)
+    {
+        //! Endpoints may lie outside of the grid.
+        point3 s{ 14.0 * rnd() - 2.0, 12.0 * rnd() - 2.0, 10.0 * rnd() - 2.0 };
+        point3 e{ 14.0 * rnd() - 2.0, 12.0 * rnd() - 2.0, 10.0 * rnd() - 2.0 };
+
+        std::vector<cell3> cells;
+        fast_voxel_grid_traversal_3d(traits, segment3{ s, e }, [&](std::uint32_t i, std::uint32_t j, std::uint32_t k) { cells.push_back(cell3{ { i, j, k } }); }, cmp);
+
+        for (std::size_t c = 1; c < cells.size(); ++c)
+        {
+            int manhattan = 0;
+            for (std::size_t a = 0; a < 3; ++a)
+                manhattan += std::abs(int(cells[c][a]) - int(cells[c - 1][a]));
+            EXPECT_EQ(1, manhattan) << "Consecutive cells share a face.";
+        }
+
+        std::set<cell3> visited(cells.begin(), cells.end());
+        EXPECT_EQ(cells.size(), visited.size());
+        for (auto const& c : cells)
+        {
+            auto box = traits.get_cell_aabb(c[0], c[1], c[2]);
+            EXPECT_TRUE(segment_crosses_box(s, e, box.get_lower_bound(), box.get_upper_bound(), 1e-9));
+        }
+
+        //! The last cell along each axis extends past the grid bounds to which the segment is clipped.
+        point3 upper{ traits.get_max_x(), traits.get_max_y(), traits.get_max_z() };
+        for (std::uint32_t i = 0; i < traits.get_width(); ++i)
+            for (std::uint32_t j = 0; j < traits.get_height(); ++j)
+                for (std::uint32_t k = 0; k < traits.get_depth(); ++k)
+                {
+                    auto box = traits.get_cell_aabb(i, j, k);
+                    point3 high{ (std::min)(box.get_upper_bound()[0], upper[0]), (std::min)(box.get_upper_bound()[1], upper[1]), (std::min)(box.get_upper_bound()[2], upper[2]) };
+                    if (segment_crosses_box(s, e, box.get_lower_bound(), high, -1e-9))
+                    {
+                        EXPECT_EQ(1, visited.count(cell3{ { i, j, k } }));
+                    }
+                }
+    }
+
+    //! Axis aligned, stopped early and outside.
+    std::vector<cell3> cells;
+    fast_voxel_grid_traversal_3d(traits, segment3{ point3{ 0.2, 1.2, 2.2 }, point3{ 0.2, 1.2, 4.4 } }, [&](std::uint32_t i, std::uint32_t j, std::uint32_t k) { cells.push_back(cell3{ { i, j, k } }); }, cmp);
+    EXPECT_EQ((std::vector<cell3>{ { { 0, 2, 4 } }, { { 0, 2, 5 } }, { { 0, 2, 6 } }, { { 0, 2, 7 } }, { { 0, 2, 8 } } }), cells);
+
+    std::size_t nVisited = 0;
+    stoppable_fast_voxel_grid_traversal_3d(traits, segment3{ point3{ 0.1, 0.1, 0.1 }, point3{ 9.9, 7.9, 5.9 } }, [&](std::uint32_t, std::uint32_t, std::uint32_t) { return ++nVisited < 3; }, cmp);
+    EXPECT_EQ(3, nVisited);
+
+    nVisited = 0;
+    fast_voxel_grid_traversal_3d(traits, segment3{ point3{ -1.0, -1.0, 7.0 }, point3{ 11.0, 9.0, 7.0 } }, [&](std::uint32_t, std::uint32_t, std::uint32_t) { ++nVisited; }, cmp);
+    EXPECT_EQ(0, nVisited);
+}
+
+TEST_F(geometry_kernel_3d_fixture, fast_voxel_grid_traversal_3d_batch_matches_sequential_order)
+{
+    using namespace geometrix;
+
+    grid_traits_3d<double> traits(-20.0, 20.0, -20.0, 20.0, -2.0, 6.0, 0.2);
+    random_real_generator<> rnd(1.0);
+    std::vector<segment3> rays;
+    point3 sensor{ 0.0, 0.0, 1.5 };
+    for (int n = 0; n < 1000; ++n)
+        rays.emplace_back(sensor, point3{ 40.0 * rnd() - 20.0, 40.0 * rnd() - 20.0, 8.0 * rnd() - 2.0 });
+
+    std::vector<std::pair<std::size_t, cell3>> expected, result;
+    for (std::size_t r = 0; r < rays.size(); ++r)
+        fast_voxel_grid_traversal_3d(traits, rays[r], [&](std::uint32_t i, std::uint32_t j, std::uint32_t k) { expected.emplace_back(r, cell3{ { i, j, k } }); }, cmp);
+
+    fast_voxel_grid_traversal_3d_batch(traits, rays, [&](std::size_t r, std::uint32_t i, std::uint32_t j, std::uint32_t k) { result.emplace_back(r, cell3{ { i, j, k } }); }, cmp, 7, 4);
+    EXPECT_EQ(expected, result);
+
+    //! Occupancy from a scan: cells crossed by a ray are free unless a return lands in them.
+    tiled_grid_3d<std::int8_t, grid_traits_3d<double>> occupancy(traits);
+    fast_voxel_grid_traversal_3d_batch(occupancy, rays, [&](std::size_t, std::uint32_t i, std::uint32_t j, std::uint32_t k)
+    {
+        auto& c = occupancy.get_cell(i, j, k);
+        if (c == 0)
+            c = -1;
+    }, cmp);
+    for (auto const& ray : rays)
+        occupancy.get_cell(ray.get_end()) = 1;
+
+    for (auto const& ray : rays)
+        EXPECT_EQ(1, *occupancy.find_cell(ray.get_end()));
+    EXPECT_EQ(-1, *occupancy.find_cell(sensor));
+}
+
+TEST_F(geometry_kernel_3d_fixture, voxelize_sphere_and_aabb_match_brute_force)
+{
+    using namespace geometrix;
+    using sphere3 = sphere<3, point3>;
+
+    grid_traits_3d<double> traits(0.0, 10.0, 0.0, 10.0, 0.0, 10.0, 0.5);
+    random_real_generator<> rnd(1.0);
+    for (int n = 0; n < 20; ++n)
+    {
+        //! Some spheres cross the grid bounds, which clip the last cells along each axis.
+        sphere3 s{ point3{ 12.0 * rnd() - 1.0, 12.0 * rnd() - 1.0, 12.0 * rnd() - 1.0 }, 0.1 + 3.0 * rnd() };
+        std::set<cell3> expected, result;
+        for (std::uint32_t i = 0; i < traits.get_width(); ++i)
+            for (std::uint32_t j = 0; j < traits.get_height(); ++j)
+                for (std::uint32_t k = 0; k < traits.get_depth(); ++k)
+                {
+                    auto box = traits.get_cell_aabb(i, j, k);
+                    double d2 = 0.0;
+                    for (std::size_t a = 0; a < 3; ++a)
+                    {
+                        double x = s.get_center()[a];
+                        double high = (std::min)(box.get_upper_bound()[a], 10.0);
+                        double d = (std::max)({ box.get_lower_bound()[a] - x, 0.0, x - high });
+                        d2 += d * d;
+                    }
+                    if (d2 <= s.get_radius() * s.get_radius())
+                        expected.insert(cell3{ { i, j, k } });
+                }
+
+        voxelize_sphere(traits, s, [&](std::uint32_t i, std::uint32_t j, std::uint32_t k) { EXPECT_TRUE(result.insert(cell3{ { i, j, k } }).second); });
+        EXPECT_EQ(expected, result);
+    }
+
+    grid_3d<int, grid_traits_3d<double>> grid(traits);
+    axis_aligned_bounding_box<point3> box{ point3{ 1.2, -3.0, 9.2 }, point3{ 2.6, 0.7, 12.0 } };
+    std::size_t nCells = 0;
+    voxelize_aabb(grid, box, [&](std::uint32_t i, std::uint32_t j, std::uint32_t k)
+    {
+        ++nCells;
+        EXPECT_TRUE(box.intersects(traits.get_cell_aabb(i, j, k)));
+        ++grid.get_cell(i, j, k);
+    });
+    EXPECT_EQ(4 * 2 * 3, nCells);
+}